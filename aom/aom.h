@@ -92,6 +92,42 @@ typedef struct av1_ref_frame {
   aom_image_t img;      /**< img structure to populate (output) */
 } av1_ref_frame_t;
 
+/*!\brief Memory usage categories
+ *
+ * Subsystems the heap memory of an encoder or decoder instance is attributed
+ * to in aom_memory_usage_t.
+ */
+typedef enum aom_mem_tag {
+  AOM_MEM_TAG_OTHER,          /**< Anything not in the categories below */
+  AOM_MEM_TAG_FRAME_BUFFERS,  /**< Reference, output and scaled frames */
+  AOM_MEM_TAG_LOOKAHEAD,      /**< Encoder lookahead source frames */
+  AOM_MEM_TAG_TPL,            /**< Encoder tpl model statistics and frames */
+  AOM_MEM_TAG_TF,             /**< Encoder temporal filter output frames */
+  AOM_MEM_TAG_THREAD_DATA,    /**< Per-thread data of the workers */
+  AOM_MEM_TAG_HASH_TABLES,    /**< Hash tables for intra block copy search */
+  AOM_MEM_TAG_ENTROPY_TABLES, /**< CDF, tile context and rate cost tables */
+  AOM_MEM_TAG_COUNT           /**< Number of categories */
+} aom_mem_tag_t;
+
+/*!\brief Memory usage of an encoder or decoder instance
+ *
+ * Heap memory requested by the instance, in bytes. The alignment padding of
+ * the allocator, which is at most the alignment plus a few words per
+ * allocation, is not included. Frame buffers provided by the application
+ * through frame buffer callbacks are not included.
+ */
+typedef struct aom_memory_usage {
+  /*! Memory currently allocated, per category */
+  uint64_t current_bytes[AOM_MEM_TAG_COUNT];
+  /*! Peak memory allocated since the instance was created, per category */
+  uint64_t peak_bytes[AOM_MEM_TAG_COUNT];
+  /*! Memory currently allocated, over all categories */
+  uint64_t total_current_bytes;
+  /*! Peak memory allocated, over all categories. This may be less than the
+   * sum of the per-category peaks. */
+  uint64_t total_peak_bytes;
+} aom_memory_usage_t;
+
 /*!\cond */
 /*!\brief aom decoder control function parameter type
  *
@@ -57,6 +57,15 @@ typedef enum aom_img_fmt {
   AOM_IMG_FMT_YV1216 = AOM_IMG_FMT_YV12 | AOM_IMG_FMT_HIGHBITDEPTH,
   AOM_IMG_FMT_I42216 = AOM_IMG_FMT_I422 | AOM_IMG_FMT_HIGHBITDEPTH,
   AOM_IMG_FMT_I44416 = AOM_IMG_FMT_I444 | AOM_IMG_FMT_HIGHBITDEPTH,
+/*!\brief Allows detection of the presence of AOM_IMG_FMT_P010 at compile time.
+ */
+#define AOM_HAVE_IMG_FMT_P010 1
+  /*!\brief 4:2:0 with U and V interleaved and 16-bit samples.
+   *
+   * Samples are aligned to the most significant bit, i.e. a 10-bit value v is
+   * stored as v << 6. bit_depth holds the number of significant bits.
+   */
+  AOM_IMG_FMT_P010 = AOM_IMG_FMT_NV12 | AOM_IMG_FMT_HIGHBITDEPTH,
 } aom_img_fmt_t; /**< alias for enum aom_img_fmt */
 
 /*!\brief List of supported color primaries */
@@ -211,7 +220,7 @@ typedef struct aom_image {
 #define AOM_PLANE_U 1      /**< U (Chroma) plane */
 #define AOM_PLANE_V 2      /**< V (Chroma) plane */
   /* planes[AOM_PLANE_V] = NULL and stride[AOM_PLANE_V] = 0 when fmt ==
-   * AOM_IMG_FMT_NV12 */
+   * AOM_IMG_FMT_NV12 or AOM_IMG_FMT_P010 */
   unsigned char *planes[3]; /**< pointer to the top left pixel for each plane */
   int stride[3];            /**< stride between rows for each plane */
   size_t sz;                /**< data size */
@@ -1577,6 +1577,110 @@ enum aome_enc_control_id {
    */
   AV1E_SET_MAX_CONSEC_FRAME_DROP_MS_CBR = 169,
 
+  /*!\brief Codec control to let the encoder reference input images instead of
+   * copying them, aom_zero_copy_input_t* parameter.
+   *
+   * By default aom_codec_encode() copies each input image into an internal
+   * lookahead buffer with a border around it. When this control is set, an
+   * image whose planes have at least aom_zero_copy_input_t::border pixels of
+   * padding on all four sides (scaled down by the chroma subsampling for the
+   * chroma planes), such as one allocated with aom_img_alloc_with_border(),
+   * is kept by reference instead. The encoder then writes the extended frame
+   * border into that padding, and the application must not modify or free
+   * the image until the encoder releases it through
+   * aom_zero_copy_input_t::release_cb. Images that cannot be referenced
+   * (because of a smaller border, a monochrome stream or the NV12 format) are
+   * still copied.
+   *
+   * The release callback is called exactly once for each image passed to
+   * aom_codec_encode(), with aom_image_t::user_priv of that image, whether
+   * the call succeeds or not. Copied images are released before
+   * aom_codec_encode() returns. Referenced images are released once they
+   * leave the lookahead, at the latest when the encoder is destroyed.
+   *
+   * Must be set before the first frame is encoded. A NULL release_cb turns
+   * the feature off.
+   */
+  AV1E_SET_ZERO_COPY_INPUT = 170,
+
+  /*!\brief Codec control to use the smaller frame border of unscaled
+   * encoding when resize or superres is enabled, unsigned int parameter.
+   *
+   * With resize or superres the encoder allocates every frame buffer with a
+   * 288 pixel border, so that references of a different resolution can be
+   * used for motion compensation. When set to 1, frame buffers keep the
+   * superblock sized border and only the references that are larger than the
+   * frame being coded get a thicker border, when they are used. This reduces
+   * the memory of each encoder instance, at the cost of a shorter motion
+   * search range near the frame edges.
+   *
+   * - 0 = disable (default)
+   * - 1 = enable
+   *
+   * \note Only used in realtime mode (AOM_USAGE_REALTIME). Must be set before
+   * the first frame is encoded.
+   */
+  AV1E_SET_REDUCED_FRAME_BORDER = 171,
+
+  /*!\brief Codec control to get the heap memory usage of the encoder,
+   * aom_memory_usage_t* parameter.
+   *
+   * Covers the memory allocated during aom_codec_enc_init(),
+   * aom_codec_encode(), aom_codec_enc_config_set() and the controls that
+   * change the encoder configuration, including the allocations of the worker
+   * threads.
+   */
+  AV1E_GET_MEMORY_USAGE = 172,
+
+  /*!\brief Codec control to back frame buffers and large encoder tables with
+   * transparent huge pages, unsigned int parameter.
+   *
+   * Frame buffers are accessed with large strides, which touches many pages
+   * and causes TLB misses in motion compensation and motion search on large
+   * frames. When enabled, allocations of at least 2 MB are aligned to 2 MB and
+   * advised to be backed by huge pages. The encoder output is unchanged.
+   *
+   * - 0 = disable (default)
+   * - 1 = enable
+   *
+   * \note Only available on Linux, in builds with CONFIG_HUGE_PAGES. When the
+   * kernel cannot provide huge pages, the memory is backed by normal pages.
+   * Applies to the buffers allocated after the call.
+   */
+  AV1E_SET_HUGE_PAGES = 173,
+
+  /*!\brief Codec control to trade encoder speed for memory, unsigned int
+   * parameter. None of the levels change the encoded output.
+   *
+   * - 0 = off (default)
+   * - 1 = free the image pyramids of source frames while they wait in the
+   *       lookahead and once they are encoded, and do not keep a scaled copy
+   *       of the previous source frame unless a realtime or VMAF tuned encode
+   *       needs it. This does not slow down the encoder.
+   * - 2 = also free the image pyramids of reference frames after each frame.
+   *       They are computed again when global motion search next uses them,
+   *       which slows down encodes with global motion.
+   *
+   * \note Most of the memory of a good quality encode is in the lookahead
+   * and the tpl model, which scale with the lag in frames. Lower
+   * g_lag_in_frames to save more than this control can.
+   */
+  AV1E_SET_LOW_MEMORY_LEVEL = 174,
+
+  /*!\brief Codec control to keep scaled copies of reference frames for
+   * later frames, unsigned int parameter.
+   *
+   * A reference frame used by several frames coded at another resolution,
+   * such as after AOME_SET_SCALEMODE, or by each recode of a frame, is then
+   * scaled once instead of once per frame. The copies take up to
+   * INTER_REFS_PER_FRAME frame buffers of the coded size. Encodes with
+   * spatial layers do not keep copies. The encoder output is unchanged.
+   *
+   * - 0 = disable (default)
+   * - 1 = enable
+   */
+  AV1E_SET_SCALED_REF_CACHE = 175,
+
   // Any new encoder control IDs should be added above.
   // Maximum allowed encoder control ID is 229.
   // No encoder control ID should be added below.
@@ -1776,6 +1880,26 @@ typedef struct aom_svc_ref_frame_comp_pred {
   int use_comp_pred[3]; /**<Compound reference flag. */
 } aom_svc_ref_frame_comp_pred_t;
 
+/*!\brief Input image release callback prototype
+ *
+ * This callback is invoked by the encoder when it no longer needs an input
+ * image. See AV1E_SET_ZERO_COPY_INPUT.
+ *
+ * \param[in] priv         Callback's private data
+ * \param[in] img_priv     aom_image_t::user_priv of the released image
+ */
+typedef void (*aom_release_input_image_cb_fn_t)(void *priv, void *img_priv);
+
+/*!\brief Parameters for AV1E_SET_ZERO_COPY_INPUT */
+typedef struct aom_zero_copy_input {
+  /*!\brief Padding, in luma pixels, that every input image has on all four
+   * sides of its planes and that the encoder may write into.
+   */
+  unsigned int border;
+  aom_release_input_image_cb_fn_t release_cb; /**< Release callback */
+  void *cb_priv; /**< Private data passed to release_cb */
+} aom_zero_copy_input_t;
+
 /*!brief Frame drop modes for spatial/quality layer SVC */
 typedef enum {
   AOM_LAYER_DROP,           /**< Any spatial layer can drop. */
@@ -2279,6 +2403,24 @@ AOM_CTRL_USE_TYPE(AV1E_SET_POSTENCODE_DROP_RTC, int)
 AOM_CTRL_USE_TYPE(AV1E_SET_MAX_CONSEC_FRAME_DROP_MS_CBR, int)
 #define AOM_CTRL_AV1E_SET_MAX_CONSEC_FRAME_DROP_MS_CBR
 
+AOM_CTRL_USE_TYPE(AV1E_SET_ZERO_COPY_INPUT, aom_zero_copy_input_t *)
+#define AOM_CTRL_AV1E_SET_ZERO_COPY_INPUT
+
+AOM_CTRL_USE_TYPE(AV1E_SET_REDUCED_FRAME_BORDER, unsigned int)
+#define AOM_CTRL_AV1E_SET_REDUCED_FRAME_BORDER
+
+AOM_CTRL_USE_TYPE(AV1E_GET_MEMORY_USAGE, aom_memory_usage_t *)
+#define AOM_CTRL_AV1E_GET_MEMORY_USAGE
+
+AOM_CTRL_USE_TYPE(AV1E_SET_HUGE_PAGES, unsigned int)
+#define AOM_CTRL_AV1E_SET_HUGE_PAGES
+
+AOM_CTRL_USE_TYPE(AV1E_SET_LOW_MEMORY_LEVEL, unsigned int)
+#define AOM_CTRL_AV1E_SET_LOW_MEMORY_LEVEL
+
+AOM_CTRL_USE_TYPE(AV1E_SET_SCALED_REF_CACHE, unsigned int)
+#define AOM_CTRL_AV1E_SET_SCALED_REF_CACHE
+
 /*!\endcond */
 /*! @} - end defgroup aom_encoder */
 #ifdef __cplusplus
@@ -157,6 +157,47 @@ typedef struct aom_s_frame_info {
   int is_s_frame_at_altref;
 } aom_s_frame_info;
 
+/*!\brief Structure to hold the decoding statistics of a temporal unit.
+ *
+ * Defines a structure to hold the cost of decoding the frames passed to the
+ * last aom_codec_decode() call. Times are wall-clock times in microseconds.
+ */
+typedef struct aom_frame_stats {
+  /*! Number of frames decoded */
+  int num_frames;
+  /*! Number of tiles decoded */
+  int num_tiles;
+  /*! Size of the compressed frame data in bytes */
+  size_t frame_bytes;
+  /*! Total time spent decoding the frames */
+  int64_t decode_time;
+  /*! Time spent decoding the tiles, i.e. parsing and reconstruction */
+  int64_t tile_decode_time;
+  /*! Time spent by the tile workers parsing, summed over the workers. Only
+   * measured with row based multithreading, otherwise 0. */
+  int64_t parse_time;
+  /*! Time spent by the tile workers reconstructing, including waiting for
+   * parsed superblocks, summed over the workers. Only measured with row based
+   * multithreading, otherwise 0. */
+  int64_t recon_time;
+  /*! Number of workers used to decode the tiles, including the main thread */
+  int num_workers;
+  /*! Time the tile workers spent working on tiles, summed over the workers.
+   * worker_busy_time / (num_workers * tile_decode_time) is the utilization of
+   * the workers. */
+  int64_t worker_busy_time;
+  /*! Time spent in the deblocking loop filter */
+  int64_t loop_filter_time;
+  /*! Time spent in CDEF */
+  int64_t cdef_time;
+  /*! Time spent in super-resolution upscaling */
+  int64_t superres_time;
+  /*! Time spent in loop restoration */
+  int64_t loop_restoration_time;
+  /*! Time spent applying film grain to the output frames */
+  int64_t film_grain_time;
+} aom_frame_stats;
+
 /*!\brief Structure to hold information about screen content tools.
  *
  * Defines a structure to hold information about screen content
@@ -466,6 +507,74 @@ enum aom_dec_control_id {
    * be used.
    */
   AV1D_GET_MI_INFO,
+
+  /*!\brief Codec control function to set the format of the output images,
+   * int parameter
+   *
+   * Valid values are:
+   * - AOM_IMG_FMT_NONE: planar output in the native format (default)
+   * - AOM_IMG_FMT_NV12: 8-bit 4:2:0 with interleaved chroma
+   * - AOM_IMG_FMT_P010: 10-bit 4:2:0 with interleaved chroma, samples aligned
+   *   to the most significant bit
+   *
+   * The interleaved formats are written while copying the frame out of the
+   * decoder (after film grain synthesis, if any), into a buffer obtained from
+   * the frame buffer callbacks when external frame buffers are used. Only
+   * 4:2:0 and monochrome streams of the matching bit depth can be output in
+   * these formats; aom_codec_get_frame() fails for other streams. This control
+   * has no effect in large scale tile mode.
+   */
+  AV1D_SET_OUTPUT_FORMAT,
+
+  /*!\brief Codec control function to get the decoding statistics of the last
+   * aom_codec_decode() call, aom_frame_stats* parameter
+   *
+   * The statistics cover the frames in the temporal unit. The film grain time
+   * is updated by aom_codec_get_frame().
+   */
+  AOMD_GET_FRAME_STATS,
+
+  /*!\brief Codec control function to set the fast decode level, int parameter
+   *
+   * Trades exactness for speed, e.g. for scrubbing and preview playback. Above
+   * level 0 the output no longer matches that of a conforming decoder:
+   * - 0: normative decoding (default)
+   * - 1: skip film grain. In frames that are not used as references, also
+   *   skip CDEF and loop restoration and use bilinear instead of the signaled
+   *   interpolation filters for motion compensation. The errors do not
+   *   propagate to other frames.
+   * - 2: also skip loop restoration in all frames. The errors propagate until
+   *   the references are refreshed by an intra frame.
+   * - 3: also skip CDEF in all frames.
+   */
+  AV1D_SET_FAST_DECODE,
+
+  /*!\brief Codec control function to get the heap memory usage of the
+   * decoder, aom_memory_usage_t* parameter
+   *
+   * Covers the memory allocated by aom_codec_decode() and
+   * aom_codec_get_frame(), including the allocations of the worker threads.
+   */
+  AOMD_GET_MEMORY_USAGE,
+
+  /*!\brief Codec control function to allocate the frame buffers for the
+   * maximum frame size of the sequence up front, int parameter
+   *
+   * When enabled, at the start of each coded video sequence the decoder grows
+   * its internal frame buffers to the maximum frame width and height of the
+   * sequence header and touches their memory. Streams that change the frame
+   * size, such as with dynamic resize, reference scaling or spatial layers,
+   * then decode without allocating frame buffers or taking page faults on
+   * them. Encoders signal the maximum frame size with
+   * forced_max_frame_width and forced_max_frame_height. This costs the
+   * memory of REF_FRAMES + 1 frames of the maximum size.
+   * - 0: allocate frame buffers as needed (default)
+   * - 1: allocate frame buffers up front
+   *
+   * \note Has no effect when the application provides the frame buffers
+   * with aom_codec_set_frame_buffer_functions().
+   */
+  AV1D_SET_PREALLOC_FRAME_BUFFERS,
 };
 
 /*!\cond */
@@ -598,6 +707,21 @@ AOM_CTRL_USE_TYPE(AOMD_GET_ORDER_HINT, unsigned int *)
 // The AOM_CTRL_USE_TYPE macro can't be used with AV1D_GET_MI_INFO because
 // AV1D_GET_MI_INFO takes more than one parameter.
 #define AOM_CTRL_AV1D_GET_MI_INFO
+
+AOM_CTRL_USE_TYPE(AV1D_SET_OUTPUT_FORMAT, int)
+#define AOM_CTRL_AV1D_SET_OUTPUT_FORMAT
+
+AOM_CTRL_USE_TYPE(AOMD_GET_FRAME_STATS, aom_frame_stats *)
+#define AOM_CTRL_AOMD_GET_FRAME_STATS
+
+AOM_CTRL_USE_TYPE(AV1D_SET_FAST_DECODE, int)
+#define AOM_CTRL_AV1D_SET_FAST_DECODE
+
+AOM_CTRL_USE_TYPE(AOMD_GET_MEMORY_USAGE, aom_memory_usage_t *)
+#define AOM_CTRL_AOMD_GET_MEMORY_USAGE
+
+AOM_CTRL_USE_TYPE(AV1D_SET_PREALLOC_FRAME_BUFFERS, int)
+#define AOM_CTRL_AV1D_SET_PREALLOC_FRAME_BUFFERS
 /*!\endcond */
 /*! @} - end defgroup aom_decoder */
 #ifdef __cplusplus
@@ -131,8 +131,12 @@ if(CONFIG_AV1_HIGHBITDEPTH)
   list(APPEND AOM_DSP_COMMON_INTRIN_SSSE3
               "${AOM_ROOT}/aom_dsp/x86/highbd_convolve_ssse3.c")
 
+  list(APPEND AOM_DSP_COMMON_INTRIN_SSE4_1
+              "${AOM_ROOT}/aom_dsp/x86/highbd_intrapred_sse4.c")
+
   list(APPEND AOM_DSP_COMMON_INTRIN_AVX2
               "${AOM_ROOT}/aom_dsp/x86/highbd_convolve_avx2.c"
+              "${AOM_ROOT}/aom_dsp/x86/highbd_intrapred_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/highbd_loopfilter_avx2.c")
 
   list(APPEND AOM_DSP_COMMON_INTRIN_NEON
@@ -204,8 +208,10 @@ if(CONFIG_AV1_ENCODER)
                 "${AOM_ROOT}/aom_dsp/flow_estimation/x86/disflow_sse4.c")
 
     list(APPEND AOM_DSP_ENCODER_INTRIN_AVX2
+                "${AOM_ROOT}/aom_dsp/flow_estimation/x86/corner_detect_avx2.c"
                 "${AOM_ROOT}/aom_dsp/flow_estimation/x86/corner_match_avx2.c"
-                "${AOM_ROOT}/aom_dsp/flow_estimation/x86/disflow_avx2.c")
+                "${AOM_ROOT}/aom_dsp/flow_estimation/x86/disflow_avx2.c"
+                "${AOM_ROOT}/aom_dsp/x86/noise_model_avx2.c")
 
     list(APPEND AOM_DSP_ENCODER_INTRIN_NEON
                 "${AOM_ROOT}/aom_dsp/flow_estimation/arm/disflow_neon.c")
@@ -245,6 +251,7 @@ if(CONFIG_AV1_ENCODER)
               "${AOM_ROOT}/aom_dsp/x86/avg_intrin_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/fft_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/masked_sad_intrin_avx2.c"
+              "${AOM_ROOT}/aom_dsp/x86/masked_variance_intrin_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/subtract_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/adaptive_quantize_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/quantize_avx2.c"
@@ -253,12 +260,18 @@ if(CONFIG_AV1_ENCODER)
               "${AOM_ROOT}/aom_dsp/x86/sad_impl_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/variance_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/sse_avx2.c"
+              "${AOM_ROOT}/aom_dsp/x86/ssim_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/variance_impl_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/obmc_sad_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/obmc_variance_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/blk_sse_sum_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/sum_squares_avx2.c")
 
+  list(APPEND AOM_DSP_ENCODER_INTRIN_AVX512
+              "${AOM_ROOT}/aom_dsp/x86/sad4d_avx512.c"
+              "${AOM_ROOT}/aom_dsp/x86/synonyms_avx512.h"
+              "${AOM_ROOT}/aom_dsp/x86/variance_avx512.c")
+
   list(APPEND AOM_DSP_ENCODER_INTRIN_AVX
               "${AOM_ROOT}/aom_dsp/x86/aom_quantize_avx.c")
 
@@ -290,6 +303,7 @@ if(CONFIG_AV1_ENCODER)
               "${AOM_ROOT}/aom_dsp/arm/obmc_variance_neon.c"
               "${AOM_ROOT}/aom_dsp/arm/obmc_sad_neon.c"
               "${AOM_ROOT}/aom_dsp/arm/sse_neon.c"
+              "${AOM_ROOT}/aom_dsp/arm/ssim_neon.c"
               "${AOM_ROOT}/aom_dsp/arm/subtract_neon.c"
               "${AOM_ROOT}/aom_dsp/arm/sum_squares_neon.c"
               "${AOM_ROOT}/aom_dsp/arm/blk_sse_sum_neon.c")
@@ -352,6 +366,8 @@ if(CONFIG_AV1_ENCODER)
   if(CONFIG_INTERNAL_STATS)
     list(APPEND AOM_DSP_ENCODER_SOURCES "${AOM_ROOT}/aom_dsp/fastssim.c"
                 "${AOM_ROOT}/aom_dsp/psnrhvs.c")
+    list(APPEND AOM_DSP_ENCODER_INTRIN_AVX2
+                "${AOM_ROOT}/aom_dsp/x86/fastssim_avx2.c")
   endif()
 
   if(CONFIG_TUNE_VMAF)
@@ -481,6 +497,14 @@ function(setup_aom_dsp_targets)
     endif()
   endif()
 
+  if(HAVE_AVX512)
+    if(CONFIG_AV1_ENCODER)
+      add_intrinsics_object_library("${AOM_AVX512_FLAGS}" "avx512"
+                                    "aom_dsp_encoder"
+                                    "AOM_DSP_ENCODER_INTRIN_AVX512")
+    endif()
+  endif()
+
   if(HAVE_NEON)
     add_intrinsics_object_library("${AOM_NEON_INTRIN_FLAG}" "neon"
                                   "aom_dsp_common" "AOM_DSP_COMMON_INTRIN_NEON")
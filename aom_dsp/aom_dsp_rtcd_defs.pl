@@ -304,219 +304,219 @@ if ((aom_config("CONFIG_REALTIME_ONLY") ne "yes") || (aom_config("CONFIG_AV1_DEC
 }  # !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
 
 if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
-  specialize qw/aom_highbd_v_predictor_4x4 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_4x8 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_8x4 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_8x8 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_8x16 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_16x8 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_16x16 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_16x32 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_32x16 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_32x32 sse2 neon/;
-  specialize qw/aom_highbd_v_predictor_32x64 neon/;
-  specialize qw/aom_highbd_v_predictor_64x32 neon/;
-  specialize qw/aom_highbd_v_predictor_64x64 neon/;
+  specialize qw/aom_highbd_v_predictor_4x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_4x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_8x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_8x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_8x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_16x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_16x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_16x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_32x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_32x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_32x64 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_64x32 avx2 neon/;
+  specialize qw/aom_highbd_v_predictor_64x64 avx2 neon/;
 
   # TODO(yunqingwang): optimize rectangular DC_PRED to replace division
   # by multiply and shift.
-  specialize qw/aom_highbd_dc_predictor_4x4 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_4x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_8x4 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_8x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_8x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_16x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_16x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_16x32 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_32x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_32x32 sse2 neon/;
-  specialize qw/aom_highbd_dc_predictor_32x64 neon/;
-  specialize qw/aom_highbd_dc_predictor_64x32 neon/;
-  specialize qw/aom_highbd_dc_predictor_64x64 neon/;
-
-  specialize qw/aom_highbd_h_predictor_4x4 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_4x8 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_8x4 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_8x8 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_8x16 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_16x8 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_16x16 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_16x32 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_32x16 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_32x32 sse2 neon/;
-  specialize qw/aom_highbd_h_predictor_32x64 neon/;
-  specialize qw/aom_highbd_h_predictor_64x32 neon/;
-  specialize qw/aom_highbd_h_predictor_64x64 neon/;
-
-  specialize qw/aom_highbd_dc_128_predictor_4x4 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_4x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_8x4 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_8x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_8x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_16x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_16x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_16x32 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_32x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_32x32 sse2 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_32x64 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_64x32 neon/;
-  specialize qw/aom_highbd_dc_128_predictor_64x64 neon/;
-
-  specialize qw/aom_highbd_dc_left_predictor_4x4 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_4x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_8x4 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_8x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_8x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_16x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_16x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_16x32 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_32x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_32x32 sse2 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_32x64 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_64x32 neon/;
-  specialize qw/aom_highbd_dc_left_predictor_64x64 neon/;
-
-  specialize qw/aom_highbd_dc_top_predictor_4x4 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_4x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_8x4 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_8x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_8x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_16x8 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_16x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_16x32 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_32x16 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_32x32 sse2 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_32x64 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_64x32 neon/;
-  specialize qw/aom_highbd_dc_top_predictor_64x64 neon/;
-
-  specialize qw/aom_highbd_paeth_predictor_4x4 neon/;
-  specialize qw/aom_highbd_paeth_predictor_4x8 neon/;
-  specialize qw/aom_highbd_paeth_predictor_8x4 neon/;
-  specialize qw/aom_highbd_paeth_predictor_8x8 neon/;
-  specialize qw/aom_highbd_paeth_predictor_8x16 neon/;
-  specialize qw/aom_highbd_paeth_predictor_16x8 neon/;
-  specialize qw/aom_highbd_paeth_predictor_16x16 neon/;
-  specialize qw/aom_highbd_paeth_predictor_16x32 neon/;
-  specialize qw/aom_highbd_paeth_predictor_32x16 neon/;
-  specialize qw/aom_highbd_paeth_predictor_32x32 neon/;
-  specialize qw/aom_highbd_paeth_predictor_32x64 neon/;
-  specialize qw/aom_highbd_paeth_predictor_64x32 neon/;
-  specialize qw/aom_highbd_paeth_predictor_64x64 neon/;
-
-  specialize qw/aom_highbd_smooth_predictor_4x4 neon/;
-  specialize qw/aom_highbd_smooth_predictor_4x8 neon/;
-  specialize qw/aom_highbd_smooth_predictor_8x4 neon/;
-  specialize qw/aom_highbd_smooth_predictor_8x8 neon/;
-  specialize qw/aom_highbd_smooth_predictor_8x16 neon/;
-  specialize qw/aom_highbd_smooth_predictor_16x8 neon/;
-  specialize qw/aom_highbd_smooth_predictor_16x16 neon/;
-  specialize qw/aom_highbd_smooth_predictor_16x32 neon/;
-  specialize qw/aom_highbd_smooth_predictor_32x16 neon/;
-  specialize qw/aom_highbd_smooth_predictor_32x32 neon/;
-  specialize qw/aom_highbd_smooth_predictor_32x64 neon/;
-  specialize qw/aom_highbd_smooth_predictor_64x32 neon/;
-  specialize qw/aom_highbd_smooth_predictor_64x64 neon/;
-
-  specialize qw/aom_highbd_smooth_v_predictor_4x4 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_4x8 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_8x4 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_8x8 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_8x16 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_16x8 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_16x16 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_16x32 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_32x16 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_32x32 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_32x64 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_64x32 neon/;
-  specialize qw/aom_highbd_smooth_v_predictor_64x64 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_4x4 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_4x8 neon/;
-
-  specialize qw/aom_highbd_smooth_h_predictor_8x4 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_8x8 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_8x16 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_16x8 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_16x16 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_16x32 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_32x16 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_32x32 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_32x64 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_64x32 neon/;
-  specialize qw/aom_highbd_smooth_h_predictor_64x64 neon/;
+  specialize qw/aom_highbd_dc_predictor_4x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_4x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_8x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_8x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_8x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_16x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_16x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_16x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_32x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_32x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_32x64 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_64x32 avx2 neon/;
+  specialize qw/aom_highbd_dc_predictor_64x64 avx2 neon/;
+
+  specialize qw/aom_highbd_h_predictor_4x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_4x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_8x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_8x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_8x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_16x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_16x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_16x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_32x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_32x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_32x64 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_64x32 avx2 neon/;
+  specialize qw/aom_highbd_h_predictor_64x64 avx2 neon/;
+
+  specialize qw/aom_highbd_dc_128_predictor_4x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_4x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_8x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_8x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_8x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_16x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_16x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_16x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_32x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_32x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_32x64 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_64x32 avx2 neon/;
+  specialize qw/aom_highbd_dc_128_predictor_64x64 avx2 neon/;
+
+  specialize qw/aom_highbd_dc_left_predictor_4x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_4x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_8x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_8x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_8x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_16x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_16x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_16x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_32x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_32x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_32x64 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_64x32 avx2 neon/;
+  specialize qw/aom_highbd_dc_left_predictor_64x64 avx2 neon/;
+
+  specialize qw/aom_highbd_dc_top_predictor_4x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_4x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_8x4 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_8x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_8x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_16x8 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_16x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_16x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_32x16 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_32x32 sse2 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_32x64 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_64x32 avx2 neon/;
+  specialize qw/aom_highbd_dc_top_predictor_64x64 avx2 neon/;
+
+  specialize qw/aom_highbd_paeth_predictor_4x4 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_4x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_8x4 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_8x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_8x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_16x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_16x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_16x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_32x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_32x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_32x64 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_64x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_paeth_predictor_64x64 sse4_1 avx2 neon/;
+
+  specialize qw/aom_highbd_smooth_predictor_4x4 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_4x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_8x4 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_8x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_8x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_16x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_16x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_16x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_32x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_32x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_32x64 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_64x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_predictor_64x64 sse4_1 avx2 neon/;
+
+  specialize qw/aom_highbd_smooth_v_predictor_4x4 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_4x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_8x4 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_8x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_8x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_16x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_16x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_16x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_32x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_32x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_32x64 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_64x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_v_predictor_64x64 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_4x4 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_4x8 sse4_1 avx2 neon/;
+
+  specialize qw/aom_highbd_smooth_h_predictor_8x4 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_8x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_8x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_16x8 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_16x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_16x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_32x16 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_32x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_32x64 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_64x32 sse4_1 avx2 neon/;
+  specialize qw/aom_highbd_smooth_h_predictor_64x64 sse4_1 avx2 neon/;
 
   if ((aom_config("CONFIG_REALTIME_ONLY") ne "yes") ||
       (aom_config("CONFIG_AV1_DECODER") eq "yes")) {
-    specialize qw/aom_highbd_v_predictor_4x16 neon/;
-    specialize qw/aom_highbd_v_predictor_8x32 neon/;
-    specialize qw/aom_highbd_v_predictor_16x4 neon/;
-    specialize qw/aom_highbd_v_predictor_16x64 neon/;
-    specialize qw/aom_highbd_v_predictor_32x8 neon/;
-    specialize qw/aom_highbd_v_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_dc_predictor_4x16 neon/;
-    specialize qw/aom_highbd_dc_predictor_8x32 neon/;
-    specialize qw/aom_highbd_dc_predictor_16x4 neon/;
-    specialize qw/aom_highbd_dc_predictor_16x64 neon/;
-    specialize qw/aom_highbd_dc_predictor_32x8 neon/;
-    specialize qw/aom_highbd_dc_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_h_predictor_4x16 neon/;
-    specialize qw/aom_highbd_h_predictor_8x32 neon/;
-    specialize qw/aom_highbd_h_predictor_16x4 neon/;
-    specialize qw/aom_highbd_h_predictor_16x64 neon/;
-    specialize qw/aom_highbd_h_predictor_32x8 neon/;
-    specialize qw/aom_highbd_h_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_dc_128_predictor_4x16 neon/;
-    specialize qw/aom_highbd_dc_128_predictor_8x32 neon/;
-    specialize qw/aom_highbd_dc_128_predictor_16x4 neon/;
-    specialize qw/aom_highbd_dc_128_predictor_16x64 neon/;
-    specialize qw/aom_highbd_dc_128_predictor_32x8 neon/;
-    specialize qw/aom_highbd_dc_128_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_dc_left_predictor_4x16 neon/;
-    specialize qw/aom_highbd_dc_left_predictor_8x32 neon/;
-    specialize qw/aom_highbd_dc_left_predictor_16x4 neon/;
-    specialize qw/aom_highbd_dc_left_predictor_16x64 neon/;
-    specialize qw/aom_highbd_dc_left_predictor_32x8 neon/;
-    specialize qw/aom_highbd_dc_left_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_dc_top_predictor_4x16 neon/;
-    specialize qw/aom_highbd_dc_top_predictor_8x32 neon/;
-    specialize qw/aom_highbd_dc_top_predictor_16x4 neon/;
-    specialize qw/aom_highbd_dc_top_predictor_16x64 neon/;
-    specialize qw/aom_highbd_dc_top_predictor_32x8 neon/;
-    specialize qw/aom_highbd_dc_top_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_paeth_predictor_4x16 neon/;
-    specialize qw/aom_highbd_paeth_predictor_8x32 neon/;
-    specialize qw/aom_highbd_paeth_predictor_16x4 neon/;
-    specialize qw/aom_highbd_paeth_predictor_16x64 neon/;
-    specialize qw/aom_highbd_paeth_predictor_32x8 neon/;
-    specialize qw/aom_highbd_paeth_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_smooth_predictor_4x16 neon/;
-    specialize qw/aom_highbd_smooth_predictor_8x32 neon/;
-    specialize qw/aom_highbd_smooth_predictor_16x4 neon/;
-    specialize qw/aom_highbd_smooth_predictor_16x64 neon/;
-    specialize qw/aom_highbd_smooth_predictor_32x8 neon/;
-    specialize qw/aom_highbd_smooth_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_smooth_v_predictor_4x16 neon/;
-    specialize qw/aom_highbd_smooth_v_predictor_8x32 neon/;
-    specialize qw/aom_highbd_smooth_v_predictor_16x4 neon/;
-    specialize qw/aom_highbd_smooth_v_predictor_16x64 neon/;
-    specialize qw/aom_highbd_smooth_v_predictor_32x8 neon/;
-    specialize qw/aom_highbd_smooth_v_predictor_64x16 neon/;
-
-    specialize qw/aom_highbd_smooth_h_predictor_4x16 neon/;
-    specialize qw/aom_highbd_smooth_h_predictor_8x32 neon/;
-    specialize qw/aom_highbd_smooth_h_predictor_16x4 neon/;
-    specialize qw/aom_highbd_smooth_h_predictor_16x64 neon/;
-    specialize qw/aom_highbd_smooth_h_predictor_32x8 neon/;
-    specialize qw/aom_highbd_smooth_h_predictor_64x16 neon/;
+    specialize qw/aom_highbd_v_predictor_4x16 avx2 neon/;
+    specialize qw/aom_highbd_v_predictor_8x32 avx2 neon/;
+    specialize qw/aom_highbd_v_predictor_16x4 avx2 neon/;
+    specialize qw/aom_highbd_v_predictor_16x64 avx2 neon/;
+    specialize qw/aom_highbd_v_predictor_32x8 avx2 neon/;
+    specialize qw/aom_highbd_v_predictor_64x16 avx2 neon/;
+
+    specialize qw/aom_highbd_dc_predictor_4x16 avx2 neon/;
+    specialize qw/aom_highbd_dc_predictor_8x32 avx2 neon/;
+    specialize qw/aom_highbd_dc_predictor_16x4 avx2 neon/;
+    specialize qw/aom_highbd_dc_predictor_16x64 avx2 neon/;
+    specialize qw/aom_highbd_dc_predictor_32x8 avx2 neon/;
+    specialize qw/aom_highbd_dc_predictor_64x16 avx2 neon/;
+
+    specialize qw/aom_highbd_h_predictor_4x16 avx2 neon/;
+    specialize qw/aom_highbd_h_predictor_8x32 avx2 neon/;
+    specialize qw/aom_highbd_h_predictor_16x4 avx2 neon/;
+    specialize qw/aom_highbd_h_predictor_16x64 avx2 neon/;
+    specialize qw/aom_highbd_h_predictor_32x8 avx2 neon/;
+    specialize qw/aom_highbd_h_predictor_64x16 avx2 neon/;
+
+    specialize qw/aom_highbd_dc_128_predictor_4x16 avx2 neon/;
+    specialize qw/aom_highbd_dc_128_predictor_8x32 avx2 neon/;
+    specialize qw/aom_highbd_dc_128_predictor_16x4 avx2 neon/;
+    specialize qw/aom_highbd_dc_128_predictor_16x64 avx2 neon/;
+    specialize qw/aom_highbd_dc_128_predictor_32x8 avx2 neon/;
+    specialize qw/aom_highbd_dc_128_predictor_64x16 avx2 neon/;
+
+    specialize qw/aom_highbd_dc_left_predictor_4x16 avx2 neon/;
+    specialize qw/aom_highbd_dc_left_predictor_8x32 avx2 neon/;
+    specialize qw/aom_highbd_dc_left_predictor_16x4 avx2 neon/;
+    specialize qw/aom_highbd_dc_left_predictor_16x64 avx2 neon/;
+    specialize qw/aom_highbd_dc_left_predictor_32x8 avx2 neon/;
+    specialize qw/aom_highbd_dc_left_predictor_64x16 avx2 neon/;
+
+    specialize qw/aom_highbd_dc_top_predictor_4x16 avx2 neon/;
+    specialize qw/aom_highbd_dc_top_predictor_8x32 avx2 neon/;
+    specialize qw/aom_highbd_dc_top_predictor_16x4 avx2 neon/;
+    specialize qw/aom_highbd_dc_top_predictor_16x64 avx2 neon/;
+    specialize qw/aom_highbd_dc_top_predictor_32x8 avx2 neon/;
+    specialize qw/aom_highbd_dc_top_predictor_64x16 avx2 neon/;
+
+    specialize qw/aom_highbd_paeth_predictor_4x16 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_paeth_predictor_8x32 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_paeth_predictor_16x4 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_paeth_predictor_16x64 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_paeth_predictor_32x8 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_paeth_predictor_64x16 sse4_1 avx2 neon/;
+
+    specialize qw/aom_highbd_smooth_predictor_4x16 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_predictor_8x32 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_predictor_16x4 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_predictor_16x64 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_predictor_32x8 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_predictor_64x16 sse4_1 avx2 neon/;
+
+    specialize qw/aom_highbd_smooth_v_predictor_4x16 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_v_predictor_8x32 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_v_predictor_16x4 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_v_predictor_16x64 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_v_predictor_32x8 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_v_predictor_64x16 sse4_1 avx2 neon/;
+
+    specialize qw/aom_highbd_smooth_h_predictor_4x16 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_h_predictor_8x32 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_h_predictor_16x4 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_h_predictor_16x64 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_h_predictor_32x8 sse4_1 avx2 neon/;
+    specialize qw/aom_highbd_smooth_h_predictor_64x16 sse4_1 avx2 neon/;
   }  # !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
 }
 #
@@ -1036,14 +1036,14 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
     }
   }
 
-  specialize qw/aom_sad128x128x4d avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad128x64x4d  avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad64x128x4d  avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad64x64x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad64x32x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad32x64x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad32x32x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad32x16x4d   avx2 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad128x128x4d avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad128x64x4d  avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad64x128x4d  avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad64x64x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad64x32x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad32x64x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad32x32x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad32x16x4d   avx2 avx512 sse2 neon neon_dotprod/;
   specialize qw/aom_sad16x32x4d   avx2 sse2 neon neon_dotprod/;
   specialize qw/aom_sad16x16x4d   avx2 sse2 neon neon_dotprod/;
   specialize qw/aom_sad16x8x4d    avx2 sse2 neon neon_dotprod/;
@@ -1054,22 +1054,22 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
   specialize qw/aom_sad4x8x4d          sse2 neon/;
   specialize qw/aom_sad4x4x4d          sse2 neon/;
 
-  specialize qw/aom_sad64x16x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad32x8x4d    avx2 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad64x16x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad32x8x4d    avx2 avx512 sse2 neon neon_dotprod/;
   specialize qw/aom_sad16x64x4d   avx2 sse2 neon neon_dotprod/;
   specialize qw/aom_sad16x4x4d    avx2 sse2 neon neon_dotprod/;
   specialize qw/aom_sad8x32x4d         sse2 neon/;
   specialize qw/aom_sad4x16x4d         sse2 neon/;
 
-  specialize qw/aom_sad_skip_128x128x4d avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad_skip_128x64x4d  avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad_skip_64x128x4d  avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad_skip_64x64x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad_skip_64x32x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad_skip_64x16x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad_skip_32x64x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad_skip_32x32x4d   avx2 sse2 neon neon_dotprod/;
-  specialize qw/aom_sad_skip_32x16x4d   avx2 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_128x128x4d avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_128x64x4d  avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_64x128x4d  avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_64x64x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_64x32x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_64x16x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_32x64x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_32x32x4d   avx2 avx512 sse2 neon neon_dotprod/;
+  specialize qw/aom_sad_skip_32x16x4d   avx2 avx512 sse2 neon neon_dotprod/;
 
   specialize qw/aom_sad_skip_16x64x4d   avx2 sse2 neon neon_dotprod/;
   specialize qw/aom_sad_skip_16x32x4d   avx2 sse2 neon neon_dotprod/;
@@ -1261,10 +1261,16 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
   # Structured Similarity (SSIM)
   #
   add_proto qw/void aom_ssim_parms_8x8/, "const uint8_t *s, int sp, const uint8_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr";
-  specialize qw/aom_ssim_parms_8x8/, "$sse2_x86_64";
+  specialize qw/aom_ssim_parms_8x8 avx2 neon/, "$sse2_x86_64";
 
   if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
     add_proto qw/void aom_highbd_ssim_parms_8x8/, "const uint16_t *s, int sp, const uint16_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr";
+    specialize qw/aom_highbd_ssim_parms_8x8 avx2 neon/;
+  }
+
+  if (aom_config("CONFIG_INTERNAL_STATS") eq "yes") {
+    add_proto qw/void aom_fastssim_structure_row/, "const uint32_t *gx_buf, const uint32_t *gy_buf, int stride, int j, int w, double c2, double *ssim";
+    specialize qw/aom_fastssim_structure_row avx2/;
   }
 }  # CONFIG_AV1_ENCODER
 
@@ -1336,14 +1342,14 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
     add_proto qw/uint32_t/, "aom_sub_pixel_variance${w}x${h}", "const uint8_t *src_ptr, int source_stride, int xoffset, int  yoffset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse";
     add_proto qw/uint32_t/, "aom_sub_pixel_avg_variance${w}x${h}", "const uint8_t *src_ptr, int source_stride, int xoffset, int  yoffset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse, const uint8_t *second_pred";
   }
-  specialize qw/aom_variance128x128   sse2 avx2 neon neon_dotprod/;
-  specialize qw/aom_variance128x64    sse2 avx2 neon neon_dotprod/;
-  specialize qw/aom_variance64x128    sse2 avx2 neon neon_dotprod/;
-  specialize qw/aom_variance64x64     sse2 avx2 neon neon_dotprod/;
-  specialize qw/aom_variance64x32     sse2 avx2 neon neon_dotprod/;
-  specialize qw/aom_variance32x64     sse2 avx2 neon neon_dotprod/;
-  specialize qw/aom_variance32x32     sse2 avx2 neon neon_dotprod/;
-  specialize qw/aom_variance32x16     sse2 avx2 neon neon_dotprod/;
+  specialize qw/aom_variance128x128   sse2 avx2 avx512 neon neon_dotprod/;
+  specialize qw/aom_variance128x64    sse2 avx2 avx512 neon neon_dotprod/;
+  specialize qw/aom_variance64x128    sse2 avx2 avx512 neon neon_dotprod/;
+  specialize qw/aom_variance64x64     sse2 avx2 avx512 neon neon_dotprod/;
+  specialize qw/aom_variance64x32     sse2 avx2 avx512 neon neon_dotprod/;
+  specialize qw/aom_variance32x64     sse2 avx2 avx512 neon neon_dotprod/;
+  specialize qw/aom_variance32x32     sse2 avx2 avx512 neon neon_dotprod/;
+  specialize qw/aom_variance32x16     sse2 avx2 avx512 neon neon_dotprod/;
   specialize qw/aom_variance16x32     sse2 avx2 neon neon_dotprod/;
   specialize qw/aom_variance16x16     sse2 avx2 neon neon_dotprod/;
   specialize qw/aom_variance16x8      sse2 avx2 neon neon_dotprod/;
@@ -1353,11 +1359,11 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
   specialize qw/aom_variance4x8       sse2      neon neon_dotprod/;
   specialize qw/aom_variance4x4       sse2      neon neon_dotprod/;
 
-  specialize qw/aom_sub_pixel_variance128x128   avx2 neon ssse3/;
-  specialize qw/aom_sub_pixel_variance128x64    avx2 neon ssse3/;
-  specialize qw/aom_sub_pixel_variance64x128    avx2 neon ssse3/;
-  specialize qw/aom_sub_pixel_variance64x64     avx2 neon ssse3/;
-  specialize qw/aom_sub_pixel_variance64x32     avx2 neon ssse3/;
+  specialize qw/aom_sub_pixel_variance128x128   avx2 avx512 neon ssse3/;
+  specialize qw/aom_sub_pixel_variance128x64    avx2 avx512 neon ssse3/;
+  specialize qw/aom_sub_pixel_variance64x128    avx2 avx512 neon ssse3/;
+  specialize qw/aom_sub_pixel_variance64x64     avx2 avx512 neon ssse3/;
+  specialize qw/aom_sub_pixel_variance64x32     avx2 avx512 neon ssse3/;
   specialize qw/aom_sub_pixel_variance32x64     avx2 neon ssse3/;
   specialize qw/aom_sub_pixel_variance32x32     avx2 neon ssse3/;
   specialize qw/aom_sub_pixel_variance32x16     avx2 neon ssse3/;
@@ -1391,9 +1397,9 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
     specialize qw/aom_variance4x16  neon neon_dotprod sse2/;
     specialize qw/aom_variance16x4  neon neon_dotprod sse2 avx2/;
     specialize qw/aom_variance8x32  neon neon_dotprod sse2/;
-    specialize qw/aom_variance32x8  neon neon_dotprod sse2 avx2/;
+    specialize qw/aom_variance32x8  neon neon_dotprod sse2 avx2 avx512/;
     specialize qw/aom_variance16x64 neon neon_dotprod sse2 avx2/;
-    specialize qw/aom_variance64x16 neon neon_dotprod sse2 avx2/;
+    specialize qw/aom_variance64x16 neon neon_dotprod sse2 avx2 avx512/;
 
     specialize qw/aom_sub_pixel_variance4x16 neon ssse3/;
     specialize qw/aom_sub_pixel_variance16x4 neon avx2 ssse3/;
@@ -1613,6 +1619,9 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
     ($w, $h) = @$_;
     add_proto qw/unsigned int/, "aom_masked_sub_pixel_variance${w}x${h}", "const uint8_t *src, int src_stride, int xoffset, int yoffset, const uint8_t *ref, int ref_stride, const uint8_t *second_pred, const uint8_t *msk, int msk_stride, int invert_mask, unsigned int *sse";
     specialize "aom_masked_sub_pixel_variance${w}x${h}", qw/ssse3 neon/;
+    if ($w != 4) {
+      specialize "aom_masked_sub_pixel_variance${w}x${h}", qw/avx2/;
+    }
   }
 
   if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
@@ -1621,6 +1630,9 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
         ($w, $h) = @$_;
         add_proto qw/unsigned int/, "aom_highbd${bd}masked_sub_pixel_variance${w}x${h}", "const uint8_t *src, int src_stride, int xoffset, int yoffset, const uint8_t *ref, int ref_stride, const uint8_t *second_pred, const uint8_t *msk, int msk_stride, int invert_mask, unsigned int *sse";
         specialize "aom_highbd${bd}masked_sub_pixel_variance${w}x${h}", qw/ssse3 neon/;
+        if ($w != 4) {
+          specialize "aom_highbd${bd}masked_sub_pixel_variance${w}x${h}", qw/avx2/;
+        }
       }
     }
   }
@@ -1674,6 +1686,12 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
 
   # Flow estimation library
   if (aom_config("CONFIG_REALTIME_ONLY") ne "yes") {
+    add_proto qw/void aom_fast9_score_row/, "const uint8_t *src, int stride, int width, int threshold, uint8_t *scores";
+    specialize qw/aom_fast9_score_row avx2/;
+
+    add_proto qw/void aom_fast9_nonmax_row/, "const uint8_t *above, const uint8_t *cur, const uint8_t *below, int width, uint8_t *kept";
+    specialize qw/aom_fast9_nonmax_row avx2/;
+
     add_proto qw/bool aom_compute_mean_stddev/, "const unsigned char *frame, int stride, int x, int y, double *mean, double *one_over_stddev";
     specialize qw/aom_compute_mean_stddev sse4_1 avx2/;
 
@@ -1684,6 +1702,15 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
     specialize qw/aom_compute_flow_at_point sse4_1 avx2 neon sve/;
   }
 
+  # Film grain noise model
+  if (aom_config("CONFIG_REALTIME_ONLY") ne "yes") {
+    add_proto qw/void aom_flat_block_gradient_stats/, "const double *block, int block_size, double *stats";
+    specialize qw/aom_flat_block_gradient_stats avx2/;
+
+    add_proto qw/void aom_noise_eqns_add_outer_product/, "double *A, double *b, const double *x, double y, int n";
+    specialize qw/aom_noise_eqns_add_outer_product avx2/;
+  }
+
 }  # CONFIG_AV1_ENCODER
 
 1;
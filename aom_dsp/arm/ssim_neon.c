@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <arm_neon.h>
+
+#include "aom_dsp/arm/sum_neon.h"
+#include "config/aom_config.h"
+#include "config/aom_dsp_rtcd.h"
+
+void aom_ssim_parms_8x8_neon(const uint8_t *s, int sp, const uint8_t *r,
+                             int rp, uint32_t *sum_s, uint32_t *sum_r,
+                             uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                             uint32_t *sum_sxr) {
+  // The 8-row pixel sums fit in 16 bits. The squares and products of a row fit
+  // in 16 bits and are pairwise accumulated into 32 bits.
+  uint16x8_t s_sum = vdupq_n_u16(0);
+  uint16x8_t r_sum = vdupq_n_u16(0);
+  uint32x4_t ss_sum = vdupq_n_u32(0);
+  uint32x4_t rr_sum = vdupq_n_u32(0);
+  uint32x4_t sr_sum = vdupq_n_u32(0);
+
+  int i = 8;
+  do {
+    const uint8x8_t s0 = vld1_u8(s);
+    const uint8x8_t r0 = vld1_u8(r);
+
+    s_sum = vaddw_u8(s_sum, s0);
+    r_sum = vaddw_u8(r_sum, r0);
+    ss_sum = vpadalq_u16(ss_sum, vmull_u8(s0, s0));
+    rr_sum = vpadalq_u16(rr_sum, vmull_u8(r0, r0));
+    sr_sum = vpadalq_u16(sr_sum, vmull_u8(s0, r0));
+
+    s += sp;
+    r += rp;
+  } while (--i != 0);
+
+  *sum_s += horizontal_add_u16x8(s_sum);
+  *sum_r += horizontal_add_u16x8(r_sum);
+  *sum_sq_s += horizontal_add_u32x4(ss_sum);
+  *sum_sq_r += horizontal_add_u32x4(rr_sum);
+  *sum_sxr += horizontal_add_u32x4(sr_sum);
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+void aom_highbd_ssim_parms_8x8_neon(const uint16_t *s, int sp,
+                                    const uint16_t *r, int rp, uint32_t *sum_s,
+                                    uint32_t *sum_r, uint32_t *sum_sq_s,
+                                    uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+  // Samples are at most 12 bits, so the 64-sample totals fit in 32 bits.
+  uint32x4_t s_sum = vdupq_n_u32(0);
+  uint32x4_t r_sum = vdupq_n_u32(0);
+  uint32x4_t ss_sum = vdupq_n_u32(0);
+  uint32x4_t rr_sum = vdupq_n_u32(0);
+  uint32x4_t sr_sum = vdupq_n_u32(0);
+
+  int i = 8;
+  do {
+    const uint16x8_t s0 = vld1q_u16(s);
+    const uint16x8_t r0 = vld1q_u16(r);
+    const uint16x4_t s_lo = vget_low_u16(s0);
+    const uint16x4_t s_hi = vget_high_u16(s0);
+    const uint16x4_t r_lo = vget_low_u16(r0);
+    const uint16x4_t r_hi = vget_high_u16(r0);
+
+    s_sum = vpadalq_u16(s_sum, s0);
+    r_sum = vpadalq_u16(r_sum, r0);
+    ss_sum = vmlal_u16(ss_sum, s_lo, s_lo);
+    ss_sum = vmlal_u16(ss_sum, s_hi, s_hi);
+    rr_sum = vmlal_u16(rr_sum, r_lo, r_lo);
+    rr_sum = vmlal_u16(rr_sum, r_hi, r_hi);
+    sr_sum = vmlal_u16(sr_sum, s_lo, r_lo);
+    sr_sum = vmlal_u16(sr_sum, s_hi, r_hi);
+
+    s += sp;
+    r += rp;
+  } while (--i != 0);
+
+  *sum_s += horizontal_add_u32x4(s_sum);
+  *sum_r += horizontal_add_u32x4(r_sum);
+  *sum_sq_s += horizontal_add_u32x4(ss_sum);
+  *sum_sq_r += horizontal_add_u32x4(rr_sum);
+  *sum_sxr += horizontal_add_u32x4(sr_sum);
+}
+#endif  // CONFIG_AV1_HIGHBITDEPTH
@@ -126,12 +126,14 @@ static void fs_downsample_level(fs_ctx *_ctx, int _l) {
     int j0offs;
     int j1offs;
     j0offs = 2 * j * w2;
-    j1offs = FS_MINI(2 * j + 1, h2) * w2;
+    // Clamp to the last row and column of the level: the next ones belong to
+    // other buffers.
+    j1offs = FS_MINI(2 * j + 1, h2 - 1) * w2;
     for (i = 0; i < w; i++) {
       int i0;
       int i1;
       i0 = 2 * i;
-      i1 = FS_MINI(i0 + 1, w2);
+      i1 = FS_MINI(i0 + 1, w2 - 1);
       dst1[j * w + i] = src1[j0offs + i0] + src1[j0offs + i1] +
                         src1[j1offs + i0] + src1[j1offs + i1];
       dst2[j * w + i] = src2[j0offs + i0] + src2[j0offs + i1] +
@@ -142,7 +144,7 @@ static void fs_downsample_level(fs_ctx *_ctx, int _l) {
 
 static void fs_downsample_level0(fs_ctx *_ctx, const uint8_t *_src1,
                                  int _s1ystride, const uint8_t *_src2,
-                                 int _s2ystride, int _w, int _h, uint32_t shift,
+                                 int _s2ystride, int _h, uint32_t shift,
                                  int buf_is_hbd) {
   uint32_t *dst1;
   uint32_t *dst2;
@@ -154,34 +156,32 @@ static void fs_downsample_level0(fs_ctx *_ctx, const uint8_t *_src1,
   h = _ctx->level[0].h;
   dst1 = _ctx->level[0].im1;
   dst2 = _ctx->level[0].im2;
+  // Since w is half the frame width rounded up, the right pixel 2 * i + 1
+  // never needs clamping and the inner loops have no branches.
   for (j = 0; j < h; j++) {
-    int j0;
-    int j1;
-    j0 = 2 * j;
-    j1 = FS_MINI(j0 + 1, _h);
-    for (i = 0; i < w; i++) {
-      int i0;
-      int i1;
-      i0 = 2 * i;
-      i1 = FS_MINI(i0 + 1, _w);
-      if (!buf_is_hbd) {
-        dst1[j * w + i] =
-            _src1[j0 * _s1ystride + i0] + _src1[j0 * _s1ystride + i1] +
-            _src1[j1 * _s1ystride + i0] + _src1[j1 * _s1ystride + i1];
-        dst2[j * w + i] =
-            _src2[j0 * _s2ystride + i0] + _src2[j0 * _s2ystride + i1] +
-            _src2[j1 * _s2ystride + i0] + _src2[j1 * _s2ystride + i1];
-      } else {
-        uint16_t *src1s = CONVERT_TO_SHORTPTR(_src1);
-        uint16_t *src2s = CONVERT_TO_SHORTPTR(_src2);
-        dst1[j * w + i] = (src1s[j0 * _s1ystride + i0] >> shift) +
-                          (src1s[j0 * _s1ystride + i1] >> shift) +
-                          (src1s[j1 * _s1ystride + i0] >> shift) +
-                          (src1s[j1 * _s1ystride + i1] >> shift);
-        dst2[j * w + i] = (src2s[j0 * _s2ystride + i0] >> shift) +
-                          (src2s[j0 * _s2ystride + i1] >> shift) +
-                          (src2s[j1 * _s2ystride + i0] >> shift) +
-                          (src2s[j1 * _s2ystride + i1] >> shift);
+    const int j0 = 2 * j;
+    const int j1 = FS_MINI(j0 + 1, _h);
+    uint32_t *const out1 = dst1 + j * w;
+    uint32_t *const out2 = dst2 + j * w;
+    if (!buf_is_hbd) {
+      const uint8_t *const s10 = _src1 + j0 * _s1ystride;
+      const uint8_t *const s11 = _src1 + j1 * _s1ystride;
+      const uint8_t *const s20 = _src2 + j0 * _s2ystride;
+      const uint8_t *const s21 = _src2 + j1 * _s2ystride;
+      for (i = 0; i < w; i++) {
+        out1[i] = s10[2 * i] + s10[2 * i + 1] + s11[2 * i] + s11[2 * i + 1];
+        out2[i] = s20[2 * i] + s20[2 * i + 1] + s21[2 * i] + s21[2 * i + 1];
+      }
+    } else {
+      const uint16_t *const s10 = CONVERT_TO_SHORTPTR(_src1) + j0 * _s1ystride;
+      const uint16_t *const s11 = CONVERT_TO_SHORTPTR(_src1) + j1 * _s1ystride;
+      const uint16_t *const s20 = CONVERT_TO_SHORTPTR(_src2) + j0 * _s2ystride;
+      const uint16_t *const s21 = CONVERT_TO_SHORTPTR(_src2) + j1 * _s2ystride;
+      for (i = 0; i < w; i++) {
+        out1[i] = (s10[2 * i] >> shift) + (s10[2 * i + 1] >> shift) +
+                  (s11[2 * i] >> shift) + (s11[2 * i + 1] >> shift);
+        out2[i] = (s20[2 * i] >> shift) + (s20[2 * i + 1] >> shift) +
+                  (s21[2 * i] >> shift) + (s21[2 * i + 1] >> shift);
       }
     }
   }
@@ -307,15 +307,72 @@ static void fs_apply_luminance(fs_ctx *_ctx, int _l, int bit_depth) {
     col_sums_gxgy[(_col1)] = col_sums_gxgy[(_col2)] * 2; \
   } while (0)
 
+// Computes row j - 4 of the structure term from the gradients of rows j - 7
+// to j, which gx_buf and gy_buf keep in a ring of 8 rows. Each output is a
+// weighted sum of the squares and products of the gradients around it, updated
+// column by column.
+void aom_fastssim_structure_row_c(const uint32_t *gx_buf,
+                                  const uint32_t *gy_buf, int stride, int j,
+                                  int w, double c2, double *ssim) {
+  double col_sums_gx2[8];
+  double col_sums_gy2[8];
+  double col_sums_gxgy[8];
+  int i;
+  int k;
+  col_sums_gx2[3] = col_sums_gx2[2] = col_sums_gx2[1] = col_sums_gx2[0] = 0;
+  col_sums_gy2[3] = col_sums_gy2[2] = col_sums_gy2[1] = col_sums_gy2[0] = 0;
+  col_sums_gxgy[3] = col_sums_gxgy[2] = col_sums_gxgy[1] = col_sums_gxgy[0] = 0;
+  for (i = 4; i < 8; i++) {
+    FS_COL_SET(i, -1, 0);
+    FS_COL_ADD(i, 0, 0);
+    for (k = 1; k < 8 - i; k++) {
+      FS_COL_DOUBLE(i, i);
+      FS_COL_ADD(i, -k - 1, 0);
+      FS_COL_ADD(i, k, 0);
+    }
+  }
+  for (i = 0; i < w; i++) {
+    double mugx2;
+    double mugy2;
+    double mugxgy;
+    mugx2 = col_sums_gx2[0];
+    for (k = 1; k < 8; k++) mugx2 += col_sums_gx2[k];
+    mugy2 = col_sums_gy2[0];
+    for (k = 1; k < 8; k++) mugy2 += col_sums_gy2[k];
+    mugxgy = col_sums_gxgy[0];
+    for (k = 1; k < 8; k++) mugxgy += col_sums_gxgy[k];
+    ssim[i] = (2 * mugxgy + c2) / (mugx2 + mugy2 + c2);
+    if (i + 1 < w) {
+      FS_COL_SET(0, -1, 1);
+      FS_COL_ADD(0, 0, 1);
+      FS_COL_SUB(2, -3, 2);
+      FS_COL_SUB(2, 2, 2);
+      FS_COL_HALVE(1, 2);
+      FS_COL_SUB(3, -4, 3);
+      FS_COL_SUB(3, 3, 3);
+      FS_COL_HALVE(2, 3);
+      FS_COL_COPY(3, 4);
+      FS_COL_DOUBLE(4, 5);
+      FS_COL_ADD(4, -4, 5);
+      FS_COL_ADD(4, 3, 5);
+      FS_COL_DOUBLE(5, 6);
+      FS_COL_ADD(5, -3, 6);
+      FS_COL_ADD(5, 2, 6);
+      FS_COL_DOUBLE(6, 7);
+      FS_COL_ADD(6, -2, 7);
+      FS_COL_ADD(6, 1, 7);
+      FS_COL_SET(7, -1, 8);
+      FS_COL_ADD(7, 0, 8);
+    }
+  }
+}
+
 static void fs_calc_structure(fs_ctx *_ctx, int _l, int bit_depth) {
   uint32_t *im1;
   uint32_t *im2;
   unsigned *gx_buf;
   unsigned *gy_buf;
   double *ssim;
-  double col_sums_gx2[8];
-  double col_sums_gy2[8];
-  double col_sums_gxgy[8];
   double c2;
   int stride;
   int w;
@@ -357,54 +414,8 @@ static void fs_calc_structure(fs_ctx *_ctx, int _l, int bit_depth) {
       memset(gy_buf + (j & 7) * stride, 0, stride * sizeof(*gy_buf));
     }
     if (j >= 4) {
-      int k;
-      col_sums_gx2[3] = col_sums_gx2[2] = col_sums_gx2[1] = col_sums_gx2[0] = 0;
-      col_sums_gy2[3] = col_sums_gy2[2] = col_sums_gy2[1] = col_sums_gy2[0] = 0;
-      col_sums_gxgy[3] = col_sums_gxgy[2] = col_sums_gxgy[1] =
-          col_sums_gxgy[0] = 0;
-      for (i = 4; i < 8; i++) {
-        FS_COL_SET(i, -1, 0);
-        FS_COL_ADD(i, 0, 0);
-        for (k = 1; k < 8 - i; k++) {
-          FS_COL_DOUBLE(i, i);
-          FS_COL_ADD(i, -k - 1, 0);
-          FS_COL_ADD(i, k, 0);
-        }
-      }
-      for (i = 0; i < w; i++) {
-        double mugx2;
-        double mugy2;
-        double mugxgy;
-        mugx2 = col_sums_gx2[0];
-        for (k = 1; k < 8; k++) mugx2 += col_sums_gx2[k];
-        mugy2 = col_sums_gy2[0];
-        for (k = 1; k < 8; k++) mugy2 += col_sums_gy2[k];
-        mugxgy = col_sums_gxgy[0];
-        for (k = 1; k < 8; k++) mugxgy += col_sums_gxgy[k];
-        ssim[(j - 4) * w + i] = (2 * mugxgy + c2) / (mugx2 + mugy2 + c2);
-        if (i + 1 < w) {
-          FS_COL_SET(0, -1, 1);
-          FS_COL_ADD(0, 0, 1);
-          FS_COL_SUB(2, -3, 2);
-          FS_COL_SUB(2, 2, 2);
-          FS_COL_HALVE(1, 2);
-          FS_COL_SUB(3, -4, 3);
-          FS_COL_SUB(3, 3, 3);
-          FS_COL_HALVE(2, 3);
-          FS_COL_COPY(3, 4);
-          FS_COL_DOUBLE(4, 5);
-          FS_COL_ADD(4, -4, 5);
-          FS_COL_ADD(4, 3, 5);
-          FS_COL_DOUBLE(5, 6);
-          FS_COL_ADD(5, -3, 6);
-          FS_COL_ADD(5, 2, 6);
-          FS_COL_DOUBLE(6, 7);
-          FS_COL_ADD(6, -2, 7);
-          FS_COL_ADD(6, 1, 7);
-          FS_COL_SET(7, -1, 8);
-          FS_COL_ADD(7, 0, 8);
-        }
-      }
+      aom_fastssim_structure_row(gx_buf, gy_buf, stride, j, w, c2,
+                                 ssim + (j - 4) * w);
     }
   }
 }
@@ -449,7 +460,7 @@ static double calc_ssim(const uint8_t *_src, int _systride, const uint8_t *_dst,
   int l;
   ret = 1;
   if (fs_ctx_init(&ctx, _w, _h, FS_NLEVELS)) return 99.0;
-  fs_downsample_level0(&ctx, _src, _systride, _dst, _dystride, _w, _h, _shift,
+  fs_downsample_level0(&ctx, _src, _systride, _dst, _dystride, _h, _shift,
                        buf_is_hbd);
   for (l = 0; l < FS_NLEVELS - 1; l++) {
     fs_calc_structure(&ctx, l, _bd);
@@ -15,7 +15,7 @@
 #include <math.h>
 #include <assert.h>
 
-#include "third_party/fastfeat/fast.h"
+#include "config/aom_dsp_rtcd.h"
 
 #include "aom_dsp/aom_dsp_common.h"
 #include "aom_dsp/flow_estimation/corner_detect.h"
@@ -40,6 +40,155 @@ CornerList *av1_alloc_corner_list(void) {
   return corners;
 }
 
+void aom_fast9_score_row_c(const uint8_t *src, int stride, int width,
+                           int threshold, uint8_t *scores) {
+  int offsets[16];
+  av1_fast9_make_offsets(offsets, stride);
+
+  for (int x = 0; x < width; ++x) {
+    const uint8_t *const p = src + x;
+    const int c = p[0];
+
+    // Any arc of 9 pixels contains pixel 0 or 8, and two neighboring pixels
+    // out of 0, 4, 8 and 12. This rejects most pixels before the arcs are
+    // examined.
+    if (abs(p[offsets[0]] - c) <= threshold &&
+        abs(p[offsets[8]] - c) <= threshold) {
+      scores[x] = 0;
+      continue;
+    }
+    int candidate = 0;
+    for (int k = 0; k < 16; k += 4) {
+      const int v0 = p[offsets[k]];
+      const int v1 = p[offsets[(k + 4) & 15]];
+      candidate |= (v0 - c > threshold && v1 - c > threshold) ||
+                   (c - v0 > threshold && c - v1 > threshold);
+    }
+    if (!candidate) {
+      scores[x] = 0;
+      continue;
+    }
+
+    // A pixel is a corner at threshold b if the pixels of some arc are all
+    // more than b brighter or all more than b darker than it. The score is
+    // the largest such b. The differences are signed, so one arc minimum
+    // covers the brighter test and one arc maximum the darker test.
+    int diff[16];
+    for (int k = 0; k < 16; ++k) diff[k] = p[offsets[k]] - c;
+    int min2[16];
+    int max2[16];
+    for (int k = 0; k < 16; ++k) {
+      min2[k] = AOMMIN(diff[k], diff[(k + 1) & 15]);
+      max2[k] = AOMMAX(diff[k], diff[(k + 1) & 15]);
+    }
+    int min4[16];
+    int max4[16];
+    for (int k = 0; k < 16; ++k) {
+      min4[k] = AOMMIN(min2[k], min2[(k + 2) & 15]);
+      max4[k] = AOMMAX(max2[k], max2[(k + 2) & 15]);
+    }
+    int best = 0;
+    for (int k = 0; k < 16; ++k) {
+      const int arc_min = AOMMIN(AOMMIN(min4[k], min4[(k + 4) & 15]),
+                                 diff[(k + 8) & 15]);
+      const int arc_max = AOMMAX(AOMMAX(max4[k], max4[(k + 4) & 15]),
+                                 diff[(k + 8) & 15]);
+      best = AOMMAX(best, AOMMAX(arc_min, -arc_max));
+    }
+    scores[x] = best > threshold ? best - 1 : 0;
+  }
+}
+
+void aom_fast9_nonmax_row_c(const uint8_t *above, const uint8_t *cur,
+                            const uint8_t *below, int width, uint8_t *kept) {
+  for (int x = 0; x < width; ++x) {
+    int max_neighbor = AOMMAX(above[x - 1], AOMMAX(above[x], above[x + 1]));
+    max_neighbor = AOMMAX(max_neighbor, AOMMAX(cur[x - 1], cur[x + 1]));
+    max_neighbor = AOMMAX(max_neighbor, below[x - 1]);
+    max_neighbor = AOMMAX(max_neighbor, AOMMAX(below[x], below[x + 1]));
+    kept[x] = cur[x] > max_neighbor ? cur[x] : 0;
+  }
+}
+
+int av1_fast9_detect_corners(const uint8_t *buf, int width, int height,
+                             int stride, int threshold, int max_corners,
+                             int *xy) {
+  assert(threshold > 0 && threshold < 255);
+  if (width <= 2 * FAST_RADIUS || height <= 2 * FAST_RADIUS) return 0;
+
+  // Scores of the whole image, with a zero border where no corners can be
+  // detected. A score of zero means no corner, as scores are at least
+  // `threshold`.
+  const int inner_width = width - 2 * FAST_RADIUS;
+  uint8_t *const score_map = (uint8_t *)aom_calloc(width, height);
+  uint8_t *const kept = (uint8_t *)aom_malloc(inner_width);
+  if (!score_map || !kept) {
+    aom_free(score_map);
+    aom_free(kept);
+    return -1;
+  }
+
+  for (int y = FAST_RADIUS; y < height - FAST_RADIUS; ++y) {
+    aom_fast9_score_row(buf + y * stride + FAST_RADIUS, stride, inner_width,
+                        threshold, score_map + y * width + FAST_RADIUS);
+  }
+
+  int histogram[256];
+  av1_zero(histogram);
+  int num_corners = 0;
+  for (int y = FAST_RADIUS; y < height - FAST_RADIUS; ++y) {
+    const uint8_t *const row = score_map + y * width + FAST_RADIUS;
+    aom_fast9_nonmax_row(row - width, row, row + width, inner_width, kept);
+    for (int x = 0; x < inner_width; ++x) {
+      if (!kept[x]) continue;
+      histogram[kept[x]] += 1;
+      if (num_corners < max_corners) {
+        xy[2 * num_corners + 0] = x + FAST_RADIUS;
+        xy[2 * num_corners + 1] = y;
+      }
+      num_corners++;
+    }
+  }
+
+  if (num_corners > max_corners) {
+    // There are more than max_corners corners available, so pick out a subset
+    // of the sharpest corners, as these will be the most useful for flow
+    // estimation
+    int score_threshold = -1;
+    int found_corners = 0;
+    for (int bucket = 255; bucket >= 0; bucket--) {
+      if (found_corners + histogram[bucket] > max_corners) {
+        // Set threshold here
+        score_threshold = bucket;
+        break;
+      }
+      found_corners += histogram[bucket];
+    }
+    assert(score_threshold != -1 && "Failed to select a valid threshold");
+
+    // The first pass stored the wrong subset, so run the non-maximum
+    // suppression again and keep only the corners above the threshold.
+    num_corners = 0;
+    for (int y = FAST_RADIUS; y < height - FAST_RADIUS; ++y) {
+      const uint8_t *const row = score_map + y * width + FAST_RADIUS;
+      aom_fast9_nonmax_row(row - width, row, row + width, inner_width, kept);
+      for (int x = 0; x < inner_width; ++x) {
+        if (kept[x] > score_threshold) {
+          assert(num_corners < max_corners);
+          xy[2 * num_corners + 0] = x + FAST_RADIUS;
+          xy[2 * num_corners + 1] = y;
+          num_corners++;
+        }
+      }
+    }
+    assert(num_corners == found_corners);
+  }
+
+  aom_free(score_map);
+  aom_free(kept);
+  return num_corners;
+}
+
 static bool compute_corner_list(const YV12_BUFFER_CONFIG *frame, int bit_depth,
                                 int downsample_level, CornerList *corners) {
   ImagePyramid *pyr = frame->y_pyramid;
@@ -59,61 +208,15 @@ static bool compute_corner_list(const YV12_BUFFER_CONFIG *frame, int bit_depth,
   int height = pyr->layers[downsample_level].height;
   int stride = pyr->layers[downsample_level].stride;
 
-  int *scores = NULL;
-  int num_corners;
-  xy *const frame_corners_xy = aom_fast9_detect_nonmax(
-      buf, width, height, stride, FAST_BARRIER, &scores, &num_corners);
+  const int num_corners =
+      av1_fast9_detect_corners(buf, width, height, stride, FAST_BARRIER,
+                               MAX_CORNERS, corners->corners);
   if (num_corners < 0) return false;
 
-  if (num_corners <= MAX_CORNERS) {
-    // Use all detected corners
-    for (int i = 0; i < num_corners; i++) {
-      corners->corners[2 * i + 0] =
-          frame_corners_xy[i].x * (1 << downsample_level);
-      corners->corners[2 * i + 1] =
-          frame_corners_xy[i].y * (1 << downsample_level);
-    }
-    corners->num_corners = num_corners;
-  } else {
-    // There are more than MAX_CORNERS corners avilable, so pick out a subset
-    // of the sharpest corners, as these will be the most useful for flow
-    // estimation
-    int histogram[256];
-    av1_zero(histogram);
-    for (int i = 0; i < num_corners; i++) {
-      assert(FAST_BARRIER <= scores[i] && scores[i] <= 255);
-      histogram[scores[i]] += 1;
-    }
-
-    int threshold = -1;
-    int found_corners = 0;
-    for (int bucket = 255; bucket >= 0; bucket--) {
-      if (found_corners + histogram[bucket] > MAX_CORNERS) {
-        // Set threshold here
-        threshold = bucket;
-        break;
-      }
-      found_corners += histogram[bucket];
-    }
-    assert(threshold != -1 && "Failed to select a valid threshold");
-
-    int copied_corners = 0;
-    for (int i = 0; i < num_corners; i++) {
-      if (scores[i] > threshold) {
-        assert(copied_corners < MAX_CORNERS);
-        corners->corners[2 * copied_corners + 0] =
-            frame_corners_xy[i].x * (1 << downsample_level);
-        corners->corners[2 * copied_corners + 1] =
-            frame_corners_xy[i].y * (1 << downsample_level);
-        copied_corners += 1;
-      }
-    }
-    assert(copied_corners == found_corners);
-    corners->num_corners = copied_corners;
+  for (int i = 0; i < 2 * num_corners; i++) {
+    corners->corners[i] *= 1 << downsample_level;
   }
-
-  free(scores);
-  free(frame_corners_xy);
+  corners->num_corners = num_corners;
   return true;
 }
 
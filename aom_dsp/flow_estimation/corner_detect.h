@@ -26,6 +26,32 @@ extern "C" {
 
 #define MAX_CORNERS 4096
 
+// Radius of the circle of pixels examined by the FAST-9 corner test. No
+// corners are detected within this many pixels of the image edges.
+#define FAST_RADIUS 3
+
+// Sets up the offsets of the 16 pixels on the FAST circle around a pixel,
+// clockwise starting from the pixel 3 rows below it. Any 9 consecutive
+// offsets form an arc, wrapping around from 15 to 0.
+static inline void av1_fast9_make_offsets(int offsets[16], int stride) {
+  offsets[0] = 3 * stride;
+  offsets[1] = 1 + 3 * stride;
+  offsets[2] = 2 + 2 * stride;
+  offsets[3] = 3 + stride;
+  offsets[4] = 3;
+  offsets[5] = 3 - stride;
+  offsets[6] = 2 - 2 * stride;
+  offsets[7] = 1 - 3 * stride;
+  offsets[8] = -3 * stride;
+  offsets[9] = -1 - 3 * stride;
+  offsets[10] = -2 - 2 * stride;
+  offsets[11] = -3 - stride;
+  offsets[12] = -3;
+  offsets[13] = -3 + stride;
+  offsets[14] = -2 + 2 * stride;
+  offsets[15] = -1 + 3 * stride;
+}
+
 typedef struct corner_list {
 #if CONFIG_MULTITHREAD
   // Mutex which is used to prevent the corner list from being computed twice
@@ -55,6 +81,20 @@ typedef struct corner_list {
 
 size_t av1_get_corner_list_size(void);
 
+// Detects the FAST-9 corners of an 8-bit image which score at least
+// `threshold` and are a strict local maximum of the score among their 8
+// neighbors. This gives the same corners as fastfeat's
+// aom_fast9_detect_nonmax().
+//
+// If more than `max_corners` corners are found, only those above the
+// highest score threshold which keeps at most `max_corners` of them are
+// returned. The (x, y) coordinates are written to `xy` in raster order.
+//
+// Returns the number of corners written, or -1 on allocation failure.
+int av1_fast9_detect_corners(const uint8_t *buf, int width, int height,
+                             int stride, int threshold, int max_corners,
+                             int *xy);
+
 CornerList *av1_alloc_corner_list(void);
 
 bool av1_compute_corner_list(const YV12_BUFFER_CONFIG *frame, int bit_depth,
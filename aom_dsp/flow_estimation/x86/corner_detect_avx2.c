@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/flow_estimation/corner_detect.h"
+
+// Returns, per pixel, the largest minimum over the 16 arcs of 9 consecutive
+// differences. The arc minima are built from minima of pairs, then of 4 and
+// 8 consecutive differences.
+static inline __m256i max_arc_min(const __m256i *diff) {
+  __m256i min2[16];
+  __m256i min4[16];
+  for (int k = 0; k < 16; ++k) {
+    min2[k] = _mm256_min_epu8(diff[k], diff[(k + 1) & 15]);
+  }
+  for (int k = 0; k < 16; ++k) {
+    min4[k] = _mm256_min_epu8(min2[k], min2[(k + 2) & 15]);
+  }
+  __m256i best = _mm256_setzero_si256();
+  for (int k = 0; k < 16; ++k) {
+    const __m256i min8 = _mm256_min_epu8(min4[k], min4[(k + 4) & 15]);
+    best = _mm256_max_epu8(best, _mm256_min_epu8(min8, diff[(k + 8) & 15]));
+  }
+  return best;
+}
+
+// Scores 32 pixels at a time. The differences to the circle pixels saturate
+// at zero, so that an arc minimum above the threshold means every pixel of
+// the arc passes the test. Unsigned "a > b" is computed as a nonzero
+// saturating a - b.
+void aom_fast9_score_row_avx2(const uint8_t *src, int stride, int width,
+                              int threshold, uint8_t *scores) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi8(1);
+  const __m256i thresh = _mm256_set1_epi8((char)threshold);
+  int offsets[16];
+  av1_fast9_make_offsets(offsets, stride);
+
+  int x = 0;
+  for (; x + 32 <= width; x += 32) {
+    const uint8_t *const p = src + x;
+    const __m256i center = _mm256_loadu_si256((const __m256i *)p);
+    __m256i brighter[16];
+    __m256i darker[16];
+
+    // Any arc of 9 pixels contains two neighboring pixels out of 0, 4, 8 and
+    // 12, which rejects most groups of pixels before the arcs are examined.
+    __m256i pass_brighter[4];
+    __m256i pass_darker[4];
+    for (int k = 0; k < 16; k += 4) {
+      const __m256i v = _mm256_loadu_si256((const __m256i *)(p + offsets[k]));
+      brighter[k] = _mm256_subs_epu8(v, center);
+      darker[k] = _mm256_subs_epu8(center, v);
+      pass_brighter[k >> 2] = _mm256_subs_epu8(brighter[k], thresh);
+      pass_darker[k >> 2] = _mm256_subs_epu8(darker[k], thresh);
+    }
+    __m256i candidate = zero;
+    for (int k = 0; k < 4; ++k) {
+      const int next = (k + 1) & 3;
+      candidate = _mm256_or_si256(
+          candidate, _mm256_min_epu8(pass_brighter[k], pass_brighter[next]));
+      candidate = _mm256_or_si256(
+          candidate, _mm256_min_epu8(pass_darker[k], pass_darker[next]));
+    }
+    if (_mm256_testz_si256(candidate, candidate)) {
+      _mm256_storeu_si256((__m256i *)(scores + x), zero);
+      continue;
+    }
+
+    for (int k = 0; k < 16; ++k) {
+      if ((k & 3) == 0) continue;
+      const __m256i v = _mm256_loadu_si256((const __m256i *)(p + offsets[k]));
+      brighter[k] = _mm256_subs_epu8(v, center);
+      darker[k] = _mm256_subs_epu8(center, v);
+    }
+    const __m256i best =
+        _mm256_max_epu8(max_arc_min(brighter), max_arc_min(darker));
+    const __m256i not_corner =
+        _mm256_cmpeq_epi8(_mm256_subs_epu8(best, thresh), zero);
+    _mm256_storeu_si256((__m256i *)(scores + x),
+                        _mm256_andnot_si256(not_corner,
+                                            _mm256_sub_epi8(best, one)));
+  }
+
+  if (x < width) {
+    aom_fast9_score_row_c(src + x, stride, width - x, threshold, scores + x);
+  }
+}
+
+void aom_fast9_nonmax_row_avx2(const uint8_t *above, const uint8_t *cur,
+                               const uint8_t *below, int width,
+                               uint8_t *kept) {
+  const __m256i zero = _mm256_setzero_si256();
+  int x = 0;
+  for (; x + 32 <= width; x += 32) {
+    const __m256i a0 = _mm256_loadu_si256((const __m256i *)(above + x - 1));
+    const __m256i a1 = _mm256_loadu_si256((const __m256i *)(above + x));
+    const __m256i a2 = _mm256_loadu_si256((const __m256i *)(above + x + 1));
+    const __m256i c0 = _mm256_loadu_si256((const __m256i *)(cur + x - 1));
+    const __m256i c1 = _mm256_loadu_si256((const __m256i *)(cur + x));
+    const __m256i c2 = _mm256_loadu_si256((const __m256i *)(cur + x + 1));
+    const __m256i b0 = _mm256_loadu_si256((const __m256i *)(below + x - 1));
+    const __m256i b1 = _mm256_loadu_si256((const __m256i *)(below + x));
+    const __m256i b2 = _mm256_loadu_si256((const __m256i *)(below + x + 1));
+    const __m256i max_above = _mm256_max_epu8(_mm256_max_epu8(a0, a1), a2);
+    const __m256i max_below = _mm256_max_epu8(_mm256_max_epu8(b0, b1), b2);
+    const __m256i max_neighbor = _mm256_max_epu8(
+        _mm256_max_epu8(max_above, max_below), _mm256_max_epu8(c0, c2));
+    const __m256i not_max =
+        _mm256_cmpeq_epi8(_mm256_subs_epu8(c1, max_neighbor), zero);
+    _mm256_storeu_si256((__m256i *)(kept + x),
+                        _mm256_andnot_si256(not_max, c1));
+  }
+
+  if (x < width) {
+    aom_fast9_nonmax_row_c(above + x, cur + x, below + x, width - x, kept + x);
+  }
+}
@@ -14,6 +14,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "config/aom_dsp_rtcd.h"
+
 #include "aom_dsp/aom_dsp_common.h"
 #include "aom_dsp/mathutils.h"
 #include "aom_dsp/noise_model.h"
@@ -26,6 +28,33 @@
 
 static const int kMaxLag = 4;
 
+// Runs hook on the first num_workers workers, passing the i-th of the jobs
+// (an array of job_size byte entries) and the shared data. Worker 0 runs on
+// the calling thread; with at most one worker, the hook is called directly on
+// the first job. Returns 0 if any of the hooks failed.
+static int run_noise_jobs(AVxWorker *workers, int num_workers,
+                          AVxWorkerHook hook, void *jobs, size_t job_size,
+                          void *shared) {
+  if (num_workers <= 1) return hook(jobs, shared);
+  const AVxWorkerInterface *const winterface = aom_get_worker_interface();
+  for (int i = num_workers - 1; i >= 0; --i) {
+    AVxWorker *const worker = &workers[i];
+    worker->hook = hook;
+    worker->data1 = (uint8_t *)jobs + i * job_size;
+    worker->data2 = shared;
+    worker->had_error = 0;
+    if (i == 0)
+      winterface->execute(worker);
+    else
+      winterface->launch(worker);
+  }
+  int ok = 1;
+  for (int i = num_workers - 1; i >= 0; --i) {
+    ok &= winterface->sync(&workers[i]);
+  }
+  return ok;
+}
+
 // Defines a function that can be used to obtain the mean of a block for the
 // provided data type (uint8_t, or uint16_t)
 #define GET_BLOCK_MEAN(INT_TYPE, suffix)                                    \
@@ -556,9 +585,36 @@ static int compare_scores(const void *a, const void *b) {
   return 0;
 }
 
-int aom_flat_block_finder_run(const aom_flat_block_finder_t *block_finder,
-                              const uint8_t *const data, int w, int h,
-                              int stride, uint8_t *flat_blocks) {
+void aom_flat_block_gradient_stats_c(const double *block, int block_size,
+                                     double *stats) {
+  // The sums over the interior of the block are split by column into 4
+  // partial sums that are combined in a fixed order, so that the SIMD
+  // versions give identical results.
+  double sums[5][4] = { { 0 } };
+  for (int yi = 1; yi < block_size - 1; ++yi) {
+    const double *const row = block + yi * block_size;
+    for (int xi = 1; xi < block_size - 1; ++xi) {
+      const int lane = (xi - 1) & 3;
+      const double gx = (row[xi + 1] - row[xi - 1]) / 2;
+      const double gy = (row[xi + block_size] - row[xi - block_size]) / 2;
+      sums[0][lane] += gx * gx;
+      sums[1][lane] += gx * gy;
+      sums[2][lane] += gy * gy;
+      sums[3][lane] += row[xi];
+      sums[4][lane] += row[xi] * row[xi];
+    }
+  }
+  for (int i = 0; i < 5; ++i) {
+    stats[i] = (sums[i][0] + sums[i][2]) + (sums[i][1] + sums[i][3]);
+  }
+}
+
+// Computes the flatness features of the block at (bx, by), stores its score
+// and returns whether it is flat by the thresholds.
+static int score_flat_block(const aom_flat_block_finder_t *block_finder,
+                            const uint8_t *const data, int w, int h,
+                            int stride, int bx, int by, double *plane,
+                            double *block, float *score) {
   // The gradient-based features used in this code are based on:
   //  A. Kokaram, D. Kelly, H. Denman and A. Crawford, "Measuring noise
   //  correlation for improved video denoising," 2012 19th, ICIP.
@@ -570,114 +626,165 @@ int aom_flat_block_finder_run(const aom_flat_block_finder_t *block_finder,
   const double kRatioThreshold = 1.25;
   const double kNormThreshold = 0.08 / (32 * 32);
   const double kVarThreshold = 0.005 / (double)n;
+  const int num_interior = (block_size - 2) * (block_size - 2);
+
+  // Compute gradient covariance matrix.
+  aom_flat_block_finder_extract_block(block_finder, data, w, h, stride,
+                                      bx * block_size, by * block_size, plane,
+                                      block);
+  double stats[5];
+  aom_flat_block_gradient_stats(block, block_size, stats);
+  const double mean = stats[3] / num_interior;
+
+  // Normalize gradients by block_size.
+  const double Gxx = stats[0] / num_interior;
+  const double Gxy = stats[1] / num_interior;
+  const double Gyy = stats[2] / num_interior;
+  const double var = stats[4] / num_interior - mean * mean;
+
+  const double trace = Gxx + Gyy;
+  const double det = Gxx * Gyy - Gxy * Gxy;
+  const double e1 = (trace + sqrt(trace * trace - 4 * det)) / 2.;
+  const double e2 = (trace - sqrt(trace * trace - 4 * det)) / 2.;
+  const double norm = e1;  // Spectral norm
+  const double ratio = (e1 / AOMMAX(e2, 1e-6));
+  const int is_flat = (trace < kTraceThreshold) && (ratio < kRatioThreshold) &&
+                      (norm < kNormThreshold) && (var > kVarThreshold);
+  // The following weights are used to combine the above features to give
+  // a sigmoid score for flatness. If the input was normalized to [0,100]
+  // the magnitude of these values would be close to 1 (e.g., weights
+  // corresponding to variance would be a factor of 10000x smaller).
+  // The weights are given in the following order:
+  //    [{var}, {ratio}, {trace}, {norm}, offset]
+  // with one of the most discriminative being simply the variance.
+  const double weights[5] = { -6682, -0.2056, 13087, -12434, 2.5694 };
+  double sum_weights = weights[0] * var + weights[1] * ratio +
+                       weights[2] * trace + weights[3] * norm + weights[4];
+  // clamp the value to [-25.0, 100.0] to prevent overflow
+  sum_weights = fclamp(sum_weights, -25.0, 100.0);
+  *score = var > kVarThreshold ? (float)(1.0 / (1 + exp(-sum_weights))) : 0;
+#ifdef NOISE_MODEL_LOG_SCORE
+  fprintf(stderr, "%d %d: %g %g %g %g %g %d\n", bx, by, *score, var, ratio,
+          trace, norm, is_flat);
+#endif
+  return is_flat;
+}
+
+typedef struct {
+  const aom_flat_block_finder_t *block_finder;
+  const uint8_t *data;
+  int w;
+  int h;
+  int stride;
+  int num_blocks_w;
+  int num_blocks_h;
+  int num_workers;
+  uint8_t *flat_blocks;
+  index_and_score_t *scores;
+} flat_block_finder_shared_t;
+
+typedef struct {
+  int thread_id;
+  double *plane;
+  double *block;
+  int num_flat;
+} flat_block_finder_job_t;
+
+static int flat_block_finder_hook(void *arg1, void *arg2) {
+  flat_block_finder_job_t *const job = (flat_block_finder_job_t *)arg1;
+  const flat_block_finder_shared_t *const shared =
+      (const flat_block_finder_shared_t *)arg2;
+  const int num_blocks_w = shared->num_blocks_w;
+  for (int by = job->thread_id; by < shared->num_blocks_h;
+       by += shared->num_workers) {
+    for (int bx = 0; bx < num_blocks_w; ++bx) {
+      const int index = by * num_blocks_w + bx;
+      const int is_flat = score_flat_block(
+          shared->block_finder, shared->data, shared->w, shared->h,
+          shared->stride, bx, by, job->plane, job->block,
+          &shared->scores[index].score);
+      shared->flat_blocks[index] = is_flat ? 255 : 0;
+      shared->scores[index].index = index;
+      job->num_flat += is_flat;
+    }
+  }
+  return 1;
+}
+
+int aom_flat_block_finder_run(const aom_flat_block_finder_t *block_finder,
+                              const uint8_t *const data, int w, int h,
+                              int stride, uint8_t *flat_blocks) {
+  return aom_flat_block_finder_run_mt(block_finder, data, w, h, stride,
+                                      flat_blocks, NULL, 1);
+}
+
+int aom_flat_block_finder_run_mt(const aom_flat_block_finder_t *block_finder,
+                                 const uint8_t *const data, int w, int h,
+                                 int stride, uint8_t *flat_blocks,
+                                 AVxWorker *workers, int num_workers) {
+  const int block_size = block_finder->block_size;
+  const int n = block_size * block_size;
   const int num_blocks_w = (w + block_size - 1) / block_size;
   const int num_blocks_h = (h + block_size - 1) / block_size;
+  num_workers = AOMMAX(1, AOMMIN(num_workers, num_blocks_h));
   int num_flat = 0;
-  double *plane = (double *)aom_malloc(n * sizeof(*plane));
-  double *block = (double *)aom_malloc(n * sizeof(*block));
+  flat_block_finder_job_t *jobs = (flat_block_finder_job_t *)aom_calloc(
+      num_workers, sizeof(*jobs));
   index_and_score_t *scores = (index_and_score_t *)aom_malloc(
       num_blocks_w * num_blocks_h * sizeof(*scores));
-  if (plane == NULL || block == NULL || scores == NULL) {
-    fprintf(stderr, "Failed to allocate memory for block of size %d\n", n);
-    aom_free(plane);
-    aom_free(block);
-    aom_free(scores);
-    return -1;
-  }
-
+  int alloc_ok = jobs != NULL && scores != NULL;
+  for (int i = 0; alloc_ok && i < num_workers; ++i) {
+    jobs[i].thread_id = i;
+    jobs[i].plane = (double *)aom_malloc(n * sizeof(*jobs[i].plane));
+    jobs[i].block = (double *)aom_malloc(n * sizeof(*jobs[i].block));
+    alloc_ok = jobs[i].plane != NULL && jobs[i].block != NULL;
+  }
+
+  if (alloc_ok) {
+    flat_block_finder_shared_t shared;
+    shared.block_finder = block_finder;
+    shared.data = data;
+    shared.w = w;
+    shared.h = h;
+    shared.stride = stride;
+    shared.num_blocks_w = num_blocks_w;
+    shared.num_blocks_h = num_blocks_h;
+    shared.num_workers = num_workers;
+    shared.flat_blocks = flat_blocks;
+    shared.scores = scores;
 #ifdef NOISE_MODEL_LOG_SCORE
-  fprintf(stderr, "score = [");
+    fprintf(stderr, "score = [\n");
 #endif
-  for (int by = 0; by < num_blocks_h; ++by) {
-    for (int bx = 0; bx < num_blocks_w; ++bx) {
-      // Compute gradient covariance matrix.
-      aom_flat_block_finder_extract_block(block_finder, data, w, h, stride,
-                                          bx * block_size, by * block_size,
-                                          plane, block);
-      double Gxx = 0, Gxy = 0, Gyy = 0;
-      double mean = 0;
-      double var = 0;
-
-      for (int yi = 1; yi < block_size - 1; ++yi) {
-        for (int xi = 1; xi < block_size - 1; ++xi) {
-          const double gx = (block[yi * block_size + xi + 1] -
-                             block[yi * block_size + xi - 1]) /
-                            2;
-          const double gy = (block[yi * block_size + xi + block_size] -
-                             block[yi * block_size + xi - block_size]) /
-                            2;
-          Gxx += gx * gx;
-          Gxy += gx * gy;
-          Gyy += gy * gy;
-
-          const double value = block[yi * block_size + xi];
-          mean += value;
-          var += value * value;
-        }
-      }
-      mean /= (block_size - 2) * (block_size - 2);
-
-      // Normalize gradients by block_size.
-      Gxx /= ((block_size - 2) * (block_size - 2));
-      Gxy /= ((block_size - 2) * (block_size - 2));
-      Gyy /= ((block_size - 2) * (block_size - 2));
-      var = var / ((block_size - 2) * (block_size - 2)) - mean * mean;
-
-      {
-        const double trace = Gxx + Gyy;
-        const double det = Gxx * Gyy - Gxy * Gxy;
-        const double e1 = (trace + sqrt(trace * trace - 4 * det)) / 2.;
-        const double e2 = (trace - sqrt(trace * trace - 4 * det)) / 2.;
-        const double norm = e1;  // Spectral norm
-        const double ratio = (e1 / AOMMAX(e2, 1e-6));
-        const int is_flat = (trace < kTraceThreshold) &&
-                            (ratio < kRatioThreshold) &&
-                            (norm < kNormThreshold) && (var > kVarThreshold);
-        // The following weights are used to combine the above features to give
-        // a sigmoid score for flatness. If the input was normalized to [0,100]
-        // the magnitude of these values would be close to 1 (e.g., weights
-        // corresponding to variance would be a factor of 10000x smaller).
-        // The weights are given in the following order:
-        //    [{var}, {ratio}, {trace}, {norm}, offset]
-        // with one of the most discriminative being simply the variance.
-        const double weights[5] = { -6682, -0.2056, 13087, -12434, 2.5694 };
-        double sum_weights = weights[0] * var + weights[1] * ratio +
-                             weights[2] * trace + weights[3] * norm +
-                             weights[4];
-        // clamp the value to [-25.0, 100.0] to prevent overflow
-        sum_weights = fclamp(sum_weights, -25.0, 100.0);
-        const float score = (float)(1.0 / (1 + exp(-sum_weights)));
-        flat_blocks[by * num_blocks_w + bx] = is_flat ? 255 : 0;
-        scores[by * num_blocks_w + bx].score = var > kVarThreshold ? score : 0;
-        scores[by * num_blocks_w + bx].index = by * num_blocks_w + bx;
+    run_noise_jobs(workers, num_workers, flat_block_finder_hook, jobs,
+                   sizeof(*jobs), &shared);
 #ifdef NOISE_MODEL_LOG_SCORE
-        fprintf(stderr, "%g %g %g %g %g %d ", score, var, ratio, trace, norm,
-                is_flat);
+    fprintf(stderr, "];\n");
 #endif
-        num_flat += is_flat;
+    for (int i = 0; i < num_workers; ++i) num_flat += jobs[i].num_flat;
+
+    // Find the top-scored blocks (most likely to be flat) and set the flat
+    // blocks be the union of the thresholded results and the top 10th
+    // percentile of the scored results.
+    qsort(scores, num_blocks_w * num_blocks_h, sizeof(*scores),
+          &compare_scores);
+    const int top_nth_percentile = num_blocks_w * num_blocks_h * 90 / 100;
+    const float score_threshold = scores[top_nth_percentile].score;
+    for (int i = 0; i < num_blocks_w * num_blocks_h; ++i) {
+      if (scores[i].score >= score_threshold) {
+        num_flat += flat_blocks[scores[i].index] == 0;
+        flat_blocks[scores[i].index] |= 1;
       }
     }
-#ifdef NOISE_MODEL_LOG_SCORE
-    fprintf(stderr, "\n");
-#endif
+  } else {
+    fprintf(stderr, "Failed to allocate memory for block of size %d\n", n);
+    num_flat = -1;
   }
-#ifdef NOISE_MODEL_LOG_SCORE
-  fprintf(stderr, "];\n");
-#endif
-  // Find the top-scored blocks (most likely to be flat) and set the flat blocks
-  // be the union of the thresholded results and the top 10th percentile of the
-  // scored results.
-  qsort(scores, num_blocks_w * num_blocks_h, sizeof(*scores), &compare_scores);
-  const int top_nth_percentile = num_blocks_w * num_blocks_h * 90 / 100;
-  const float score_threshold = scores[top_nth_percentile].score;
-  for (int i = 0; i < num_blocks_w * num_blocks_h; ++i) {
-    if (scores[i].score >= score_threshold) {
-      num_flat += flat_blocks[scores[i].index] == 0;
-      flat_blocks[scores[i].index] |= 1;
-    }
+
+  for (int i = 0; jobs && i < num_workers; ++i) {
+    aom_free(jobs[i].plane);
+    aom_free(jobs[i].block);
   }
-  aom_free(block);
-  aom_free(plane);
+  aom_free(jobs);
   aom_free(scores);
   return num_flat;
 }
@@ -803,25 +910,65 @@ void aom_noise_model_free(aom_noise_model_t *model) {
 EXTRACT_AR_ROW(uint8_t, lowbd)
 EXTRACT_AR_ROW(uint16_t, highbd)
 
-static int add_block_observations(
-    aom_noise_model_t *noise_model, int c, const uint8_t *const data,
-    const uint8_t *const denoised, int w, int h, int stride, int sub_log2[2],
-    const uint8_t *const alt_data, const uint8_t *const alt_denoised,
-    int alt_stride, const uint8_t *const flat_blocks, int block_size,
-    int num_blocks_w, int num_blocks_h) {
+void aom_noise_eqns_add_outer_product_c(double *A, double *b, const double *x,
+                                        double y, int n) {
+  for (int i = 0; i < n; ++i) {
+    for (int j = i; j < n; ++j) {
+      A[i * n + j] += x[i] * x[j];
+    }
+    b[i] += x[i] * y;
+  }
+}
+
+typedef struct {
+  const aom_noise_model_t *noise_model;
+  const uint8_t *data;
+  const uint8_t *denoised;
+  int w;
+  int h;
+  int stride;
+  int *sub_log2;
+  const uint8_t *alt_data;
+  const uint8_t *alt_denoised;
+  int alt_stride;
+  const uint8_t *flat_blocks;
+  int block_size;
+  int num_blocks_w;
+  int num_blocks_h;
+  int n;
+  int num_workers;
+} block_observations_shared_t;
+
+typedef struct {
+  int thread_id;
+  double *A;
+  double *b;
+  double *buffer;
+  int num_observations;
+} block_observations_job_t;
+
+// Adds the observations of the flat blocks of the job's rows of blocks to its
+// own copy of the equation system. The samples are differences of integer
+// pixel values (or averages of up to 4 of them), so the unnormalized sums of
+// products are exact in double precision and do not depend on how the rows
+// are split between the jobs.
+static int block_observations_hook(void *arg1, void *arg2) {
+  block_observations_job_t *const job = (block_observations_job_t *)arg1;
+  const block_observations_shared_t *const shared =
+      (const block_observations_shared_t *)arg2;
+  const aom_noise_model_t *const noise_model = shared->noise_model;
   const int lag = noise_model->params.lag;
   const int num_coords = noise_model->n;
-  const double normalization = (1 << noise_model->params.bit_depth) - 1;
-  double *A = noise_model->latest_state[c].eqns.A;
-  double *b = noise_model->latest_state[c].eqns.b;
-  double *buffer = (double *)aom_malloc(sizeof(*buffer) * (num_coords + 1));
-  const int n = noise_model->latest_state[c].eqns.n;
-
-  if (!buffer) {
-    fprintf(stderr, "Unable to allocate buffer of size %d\n", num_coords + 1);
-    return 0;
-  }
-  for (int by = 0; by < num_blocks_h; ++by) {
+  int *const sub_log2 = shared->sub_log2;
+  const uint8_t *const flat_blocks = shared->flat_blocks;
+  const int block_size = shared->block_size;
+  const int num_blocks_w = shared->num_blocks_w;
+  const int w = shared->w;
+  const int h = shared->h;
+  double *const buffer = job->buffer;
+
+  for (int by = job->thread_id; by < shared->num_blocks_h;
+       by += shared->num_workers) {
     const int y_o = by * (block_size >> sub_log2[1]);
     for (int bx = 0; bx < num_blocks_w; ++bx) {
       const int x_o = bx * (block_size >> sub_log2[0]);
@@ -843,33 +990,85 @@ static int add_block_observations(
         for (int x = x_start; x < x_end; ++x) {
           const double val =
               noise_model->params.use_highbd
-                  ? extract_ar_row_highbd(noise_model->coords, num_coords,
-                                          (const uint16_t *const)data,
-                                          (const uint16_t *const)denoised,
-                                          stride, sub_log2,
-                                          (const uint16_t *const)alt_data,
-                                          (const uint16_t *const)alt_denoised,
-                                          alt_stride, x + x_o, y + y_o, buffer)
-                  : extract_ar_row_lowbd(noise_model->coords, num_coords, data,
-                                         denoised, stride, sub_log2, alt_data,
-                                         alt_denoised, alt_stride, x + x_o,
-                                         y + y_o, buffer);
-          for (int i = 0; i < n; ++i) {
-            for (int j = 0; j < n; ++j) {
-              A[i * n + j] +=
-                  (buffer[i] * buffer[j]) / (normalization * normalization);
-            }
-            b[i] += (buffer[i] * val) / (normalization * normalization);
-          }
-          noise_model->latest_state[c].num_observations++;
+                  ? extract_ar_row_highbd(
+                        noise_model->coords, num_coords,
+                        (const uint16_t *const)shared->data,
+                        (const uint16_t *const)shared->denoised,
+                        shared->stride, sub_log2,
+                        (const uint16_t *const)shared->alt_data,
+                        (const uint16_t *const)shared->alt_denoised,
+                        shared->alt_stride, x + x_o, y + y_o, buffer)
+                  : extract_ar_row_lowbd(
+                        noise_model->coords, num_coords, shared->data,
+                        shared->denoised, shared->stride, sub_log2,
+                        shared->alt_data, shared->alt_denoised,
+                        shared->alt_stride, x + x_o, y + y_o, buffer);
+          aom_noise_eqns_add_outer_product(job->A, job->b, buffer, val,
+                                           shared->n);
+          job->num_observations++;
         }
       }
     }
   }
-  aom_free(buffer);
   return 1;
 }
 
+// Gathers the observations of channel c into its latest equation system, which
+// must have been cleared. The jobs must have space for the largest system.
+static void add_block_observations(
+    aom_noise_model_t *noise_model, int c, const uint8_t *const data,
+    const uint8_t *const denoised, int w, int h, int stride, int sub_log2[2],
+    const uint8_t *const alt_data, const uint8_t *const alt_denoised,
+    int alt_stride, const uint8_t *const flat_blocks, int block_size,
+    int num_blocks_w, int num_blocks_h, block_observations_job_t *jobs,
+    AVxWorker *workers, int num_workers) {
+  aom_noise_state_t *const state = &noise_model->latest_state[c];
+  const int n = state->eqns.n;
+  const double normalization = (1 << noise_model->params.bit_depth) - 1;
+  block_observations_shared_t shared;
+  shared.noise_model = noise_model;
+  shared.data = data;
+  shared.denoised = denoised;
+  shared.w = w;
+  shared.h = h;
+  shared.stride = stride;
+  shared.sub_log2 = sub_log2;
+  shared.alt_data = alt_data;
+  shared.alt_denoised = alt_denoised;
+  shared.alt_stride = alt_stride;
+  shared.flat_blocks = flat_blocks;
+  shared.block_size = block_size;
+  shared.num_blocks_w = num_blocks_w;
+  shared.num_blocks_h = num_blocks_h;
+  shared.n = n;
+  shared.num_workers = num_workers;
+  for (int i = 0; i < num_workers; ++i) {
+    memset(jobs[i].A, 0, sizeof(*jobs[i].A) * n * n);
+    memset(jobs[i].b, 0, sizeof(*jobs[i].b) * n);
+    jobs[i].num_observations = 0;
+  }
+  run_noise_jobs(workers, num_workers, block_observations_hook, jobs,
+                 sizeof(*jobs), &shared);
+
+  for (int k = 0; k < num_workers; ++k) {
+    for (int i = 0; i < n; ++i) {
+      for (int j = i; j < n; ++j) {
+        state->eqns.A[i * n + j] += jobs[k].A[i * n + j];
+      }
+      state->eqns.b[i] += jobs[k].b[i];
+    }
+    state->num_observations += jobs[k].num_observations;
+  }
+  // Normalize, and fill in the lower triangle of the symmetric matrix.
+  for (int i = 0; i < n; ++i) {
+    for (int j = i; j < n; ++j) {
+      state->eqns.A[i * n + j] /= normalization * normalization;
+      state->eqns.A[j * n + i] = state->eqns.A[i * n + j];
+    }
+    state->eqns.b[i] /= normalization * normalization;
+  }
+}
+
 static void add_noise_std_observations(
     aom_noise_model_t *noise_model, int c, const double *coeffs,
     const uint8_t *const data, const uint8_t *const denoised, int w, int h,
@@ -1017,11 +1216,51 @@ aom_noise_status_t aom_noise_model_update(
     aom_noise_model_t *const noise_model, const uint8_t *const data[3],
     const uint8_t *const denoised[3], int w, int h, int stride[3],
     int chroma_sub_log2[2], const uint8_t *const flat_blocks, int block_size) {
+  return aom_noise_model_update_mt(noise_model, data, denoised, w, h, stride,
+                                   chroma_sub_log2, flat_blocks, block_size,
+                                   NULL, 1);
+}
+
+static void free_block_observations_jobs(block_observations_job_t *jobs,
+                                         int num_jobs) {
+  if (!jobs) return;
+  for (int i = 0; i < num_jobs; ++i) {
+    aom_free(jobs[i].A);
+    aom_free(jobs[i].b);
+    aom_free(jobs[i].buffer);
+  }
+  aom_free(jobs);
+}
+
+static block_observations_job_t *alloc_block_observations_jobs(int num_jobs,
+                                                               int n) {
+  block_observations_job_t *jobs =
+      (block_observations_job_t *)aom_calloc(num_jobs, sizeof(*jobs));
+  if (!jobs) return NULL;
+  for (int i = 0; i < num_jobs; ++i) {
+    jobs[i].thread_id = i;
+    jobs[i].A = (double *)aom_malloc(sizeof(*jobs[i].A) * n * n);
+    jobs[i].b = (double *)aom_malloc(sizeof(*jobs[i].b) * n);
+    jobs[i].buffer = (double *)aom_malloc(sizeof(*jobs[i].buffer) * n);
+    if (!jobs[i].A || !jobs[i].b || !jobs[i].buffer) {
+      free_block_observations_jobs(jobs, num_jobs);
+      return NULL;
+    }
+  }
+  return jobs;
+}
+
+aom_noise_status_t aom_noise_model_update_mt(
+    aom_noise_model_t *const noise_model, const uint8_t *const data[3],
+    const uint8_t *const denoised[3], int w, int h, int stride[3],
+    int chroma_sub_log2[2], const uint8_t *const flat_blocks, int block_size,
+    AVxWorker *workers, int num_workers) {
   const int num_blocks_w = (w + block_size - 1) / block_size;
   const int num_blocks_h = (h + block_size - 1) / block_size;
   int y_model_different = 0;
   int num_blocks = 0;
   int i = 0, channel = 0;
+  aom_noise_status_t status = AOM_NOISE_STATUS_OK;
 
   if (block_size <= 1) {
     fprintf(stderr, "block_size = %d must be > 1\n", block_size);
@@ -1053,6 +1292,15 @@ aom_noise_status_t aom_noise_model_update(
     return AOM_NOISE_STATUS_INSUFFICIENT_FLAT_BLOCKS;
   }
 
+  num_workers = AOMMAX(1, AOMMIN(num_workers, num_blocks_h));
+  block_observations_job_t *jobs =
+      alloc_block_observations_jobs(num_workers, noise_model->n + 1);
+  if (!jobs) {
+    fprintf(stderr, "Unable to allocate buffers for %d workers\n",
+            num_workers);
+    return AOM_NOISE_STATUS_INTERNAL_ERROR;
+  }
+
   for (channel = 0; channel < 3; ++channel) {
     int no_subsampling[2] = { 0, 0 };
     const uint8_t *alt_data = channel > 0 ? data[0] : 0;
@@ -1060,13 +1308,11 @@ aom_noise_status_t aom_noise_model_update(
     int *sub = channel > 0 ? chroma_sub_log2 : no_subsampling;
     const int is_chroma = channel != 0;
     if (!data[channel] || !denoised[channel]) break;
-    if (!add_block_observations(noise_model, channel, data[channel],
-                                denoised[channel], w, h, stride[channel], sub,
-                                alt_data, alt_denoised, stride[0], flat_blocks,
-                                block_size, num_blocks_w, num_blocks_h)) {
-      fprintf(stderr, "Adding block observation failed\n");
-      return AOM_NOISE_STATUS_INTERNAL_ERROR;
-    }
+    add_block_observations(noise_model, channel, data[channel],
+                           denoised[channel], w, h, stride[channel], sub,
+                           alt_data, alt_denoised, stride[0], flat_blocks,
+                           block_size, num_blocks_w, num_blocks_h, jobs,
+                           workers, num_workers);
 
     if (!ar_equation_system_solve(&noise_model->latest_state[channel],
                                   is_chroma)) {
@@ -1076,7 +1322,8 @@ aom_noise_status_t aom_noise_model_update(
       } else {
         fprintf(stderr, "Solving latest noise equation system failed %d!\n",
                 channel);
-        return AOM_NOISE_STATUS_INTERNAL_ERROR;
+        status = AOM_NOISE_STATUS_INTERNAL_ERROR;
+        break;
       }
     }
 
@@ -1088,7 +1335,8 @@ aom_noise_status_t aom_noise_model_update(
     if (!aom_noise_strength_solver_solve(
             &noise_model->latest_state[channel].strength_solver)) {
       fprintf(stderr, "Solving latest noise strength failed!\n");
-      return AOM_NOISE_STATUS_INTERNAL_ERROR;
+      status = AOM_NOISE_STATUS_INTERNAL_ERROR;
+      break;
     }
 
     // Check noise characteristics and return if error.
@@ -1114,7 +1362,8 @@ aom_noise_status_t aom_noise_model_update(
       } else {
         fprintf(stderr, "Solving combined noise equation system failed %d!\n",
                 channel);
-        return AOM_NOISE_STATUS_INTERNAL_ERROR;
+        status = AOM_NOISE_STATUS_INTERNAL_ERROR;
+        break;
       }
     }
 
@@ -1125,10 +1374,13 @@ aom_noise_status_t aom_noise_model_update(
     if (!aom_noise_strength_solver_solve(
             &noise_model->combined_state[channel].strength_solver)) {
       fprintf(stderr, "Solving combined noise strength failed!\n");
-      return AOM_NOISE_STATUS_INTERNAL_ERROR;
+      status = AOM_NOISE_STATUS_INTERNAL_ERROR;
+      break;
     }
   }
 
+  free_block_observations_jobs(jobs, num_workers);
+  if (status != AOM_NOISE_STATUS_OK) return status;
   return y_model_different ? AOM_NOISE_STATUS_DIFFERENT_NOISE_TYPE
                            : AOM_NOISE_STATUS_OK;
 }
@@ -1358,15 +1610,145 @@ static float *get_half_cos_window(int block_size) {
 DITHER_AND_QUANTIZE(uint8_t, lowbd)
 DITHER_AND_QUANTIZE(uint16_t, highbd)
 
+typedef struct {
+  const aom_flat_block_finder_t *block_finder;
+  const uint8_t *data;
+  int w;
+  int h;
+  int stride;
+  const float *window_function;
+  const float *noise_psd;
+  int block_size_w;
+  int block_size_h;
+  int offsx;
+  int offsy;
+  int num_blocks_w;
+  int num_blocks_h;
+  float *result;
+  int result_stride;
+  int use_chroma_tx;
+  int num_workers;
+} wiener_denoise_shared_t;
+
+typedef struct {
+  int thread_id;
+  float *plane;
+  float *block;
+  double *plane_d;
+  double *block_d;
+  struct aom_noise_tx_t *tx_full;
+  struct aom_noise_tx_t *tx_chroma;
+} wiener_denoise_job_t;
+
+// Filters the blocks of the job's rows of blocks for one of the overlapped
+// passes. Within a pass the blocks do not overlap, so each row of blocks adds
+// into its own rows of the result.
+static int wiener_denoise_hook(void *arg1, void *arg2) {
+  wiener_denoise_job_t *const job = (wiener_denoise_job_t *)arg1;
+  const wiener_denoise_shared_t *const shared =
+      (const wiener_denoise_shared_t *)arg2;
+  const int block_size_w = shared->block_size_w;
+  const int block_size_h = shared->block_size_h;
+  const int pixels_per_block = block_size_w * block_size_h;
+  const float *const window_function = shared->window_function;
+  struct aom_noise_tx_t *const tx =
+      shared->use_chroma_tx ? job->tx_chroma : job->tx_full;
+  float *const block = job->block;
+  float *const plane = job->plane;
+
+  // Pad the boundary when processing each block-set.
+  for (int by = job->thread_id - 1; by < shared->num_blocks_h;
+       by += shared->num_workers) {
+    for (int bx = -1; bx < shared->num_blocks_w; ++bx) {
+      aom_flat_block_finder_extract_block(
+          shared->block_finder, shared->data, shared->w, shared->h,
+          shared->stride, bx * block_size_w + shared->offsx,
+          by * block_size_h + shared->offsy, job->plane_d, job->block_d);
+      for (int j = 0; j < pixels_per_block; ++j) {
+        block[j] = (float)job->block_d[j];
+        plane[j] = (float)job->plane_d[j];
+      }
+      pointwise_multiply(window_function, block, pixels_per_block);
+      aom_noise_tx_forward(tx, block);
+      aom_noise_tx_filter(tx, shared->noise_psd);
+      aom_noise_tx_inverse(tx, block);
+
+      // Apply window function to the plane approximation (we will apply
+      // it to the sum of plane + block when composing the results).
+      pointwise_multiply(window_function, plane, pixels_per_block);
+
+      for (int y = 0; y < block_size_h; ++y) {
+        const int y_result = y + (by + 1) * block_size_h + shared->offsy;
+        float *const result = shared->result + y_result * shared->result_stride;
+        for (int x = 0; x < block_size_w; ++x) {
+          const int x_result = x + (bx + 1) * block_size_w + shared->offsx;
+          result[x_result] +=
+              (block[y * block_size_w + x] + plane[y * block_size_w + x]) *
+              window_function[y * block_size_w + x];
+        }
+      }
+    }
+  }
+  return 1;
+}
+
+static void free_wiener_denoise_jobs(wiener_denoise_job_t *jobs,
+                                     int num_jobs) {
+  if (!jobs) return;
+  for (int i = 0; i < num_jobs; ++i) {
+    aom_free(jobs[i].plane);
+    aom_free(jobs[i].block);
+    aom_free(jobs[i].plane_d);
+    aom_free(jobs[i].block_d);
+    aom_noise_tx_free(jobs[i].tx_full);
+    aom_noise_tx_free(jobs[i].tx_chroma);
+  }
+  aom_free(jobs);
+}
+
+static wiener_denoise_job_t *alloc_wiener_denoise_jobs(int num_jobs,
+                                                       int block_size,
+                                                       int chroma_sub) {
+  const int n = block_size * block_size;
+  wiener_denoise_job_t *jobs =
+      (wiener_denoise_job_t *)aom_calloc(num_jobs, sizeof(*jobs));
+  if (!jobs) return NULL;
+  for (int i = 0; i < num_jobs; ++i) {
+    wiener_denoise_job_t *const job = &jobs[i];
+    job->thread_id = i;
+    job->plane = (float *)aom_malloc(n * sizeof(*job->plane));
+    job->block = (float *)aom_memalign(32, 2 * n * sizeof(*job->block));
+    job->block_d = (double *)aom_malloc(n * sizeof(*job->block_d));
+    job->plane_d = (double *)aom_malloc(n * sizeof(*job->plane_d));
+    job->tx_full = aom_noise_tx_malloc(block_size);
+    if (chroma_sub != 0) {
+      job->tx_chroma = aom_noise_tx_malloc(block_size >> chroma_sub);
+    }
+    if (!job->plane || !job->block || !job->block_d || !job->plane_d ||
+        !job->tx_full || (chroma_sub != 0 && !job->tx_chroma)) {
+      free_wiener_denoise_jobs(jobs, num_jobs);
+      return NULL;
+    }
+  }
+  return jobs;
+}
+
 int aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoised[3],
                           int w, int h, int stride[3], int chroma_sub[2],
                           float *noise_psd[3], int block_size, int bit_depth,
                           int use_highbd) {
-  float *plane = NULL, *block = NULL, *window_full = NULL,
-        *window_chroma = NULL;
-  double *block_d = NULL, *plane_d = NULL;
-  struct aom_noise_tx_t *tx_full = NULL;
-  struct aom_noise_tx_t *tx_chroma = NULL;
+  return aom_wiener_denoise_2d_mt(data, denoised, w, h, stride, chroma_sub,
+                                  noise_psd, block_size, bit_depth, use_highbd,
+                                  NULL, 1);
+}
+
+int aom_wiener_denoise_2d_mt(const uint8_t *const data[3],
+                             uint8_t *denoised[3], int w, int h, int stride[3],
+                             int chroma_sub[2], float *noise_psd[3],
+                             int block_size, int bit_depth, int use_highbd,
+                             AVxWorker *workers, int num_workers) {
+  float *window_full = NULL, *window_chroma = NULL;
+  wiener_denoise_job_t *jobs = NULL;
   const int num_blocks_w = (w + block_size - 1) / block_size;
   const int num_blocks_h = (h + block_size - 1) / block_size;
   const int result_stride = (num_blocks_w + 2) * block_size;
@@ -1382,87 +1764,62 @@ int aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoised[3],
             "subsampling\n");
     return 0;
   }
+  // Each pass filters num_blocks_h + 1 rows of blocks.
+  num_workers = AOMMAX(1, AOMMIN(num_workers, num_blocks_h + 1));
   init_success &= aom_flat_block_finder_init(&block_finder_full, block_size,
                                              bit_depth, use_highbd);
   result = (float *)aom_malloc((num_blocks_h + 2) * block_size * result_stride *
                                sizeof(*result));
-  plane = (float *)aom_malloc(block_size * block_size * sizeof(*plane));
-  block =
-      (float *)aom_memalign(32, 2 * block_size * block_size * sizeof(*block));
-  block_d = (double *)aom_malloc(block_size * block_size * sizeof(*block_d));
-  plane_d = (double *)aom_malloc(block_size * block_size * sizeof(*plane_d));
   window_full = get_half_cos_window(block_size);
-  tx_full = aom_noise_tx_malloc(block_size);
+  jobs = alloc_wiener_denoise_jobs(num_workers, block_size, chroma_sub[0]);
 
   if (chroma_sub[0] != 0) {
     init_success &= aom_flat_block_finder_init(&block_finder_chroma,
                                                block_size >> chroma_sub[0],
                                                bit_depth, use_highbd);
     window_chroma = get_half_cos_window(block_size >> chroma_sub[0]);
-    tx_chroma = aom_noise_tx_malloc(block_size >> chroma_sub[0]);
   } else {
     window_chroma = window_full;
-    tx_chroma = tx_full;
   }
 
-  init_success &= (tx_full != NULL) && (tx_chroma != NULL) && (plane != NULL) &&
-                  (plane_d != NULL) && (block != NULL) && (block_d != NULL) &&
-                  (window_full != NULL) && (window_chroma != NULL) &&
-                  (result != NULL);
+  init_success &= (jobs != NULL) && (window_full != NULL) &&
+                  (window_chroma != NULL) && (result != NULL);
   for (int c = init_success ? 0 : 3; c < 3; ++c) {
     float *window_function = c == 0 ? window_full : window_chroma;
     aom_flat_block_finder_t *block_finder = &block_finder_full;
     const int chroma_sub_h = c > 0 ? chroma_sub[1] : 0;
     const int chroma_sub_w = c > 0 ? chroma_sub[0] : 0;
-    struct aom_noise_tx_t *tx =
-        (c > 0 && chroma_sub[0] > 0) ? tx_chroma : tx_full;
     if (!data[c] || !denoised[c]) continue;
     if (c > 0 && chroma_sub[0] != 0) {
       block_finder = &block_finder_chroma;
     }
     memset(result, 0, sizeof(*result) * result_stride * result_height);
-    // Do overlapped block processing (half overlapped). The block rows can
-    // easily be done in parallel
+    wiener_denoise_shared_t shared;
+    shared.block_finder = block_finder;
+    shared.data = data[c];
+    shared.w = w >> chroma_sub_w;
+    shared.h = h >> chroma_sub_h;
+    shared.stride = stride[c];
+    shared.window_function = window_function;
+    shared.noise_psd = noise_psd[c];
+    shared.block_size_w = block_size >> chroma_sub_w;
+    shared.block_size_h = block_size >> chroma_sub_h;
+    shared.num_blocks_w = num_blocks_w;
+    shared.num_blocks_h = num_blocks_h;
+    shared.result = result;
+    shared.result_stride = result_stride;
+    shared.use_chroma_tx = c > 0 && chroma_sub[0] > 0;
+    shared.num_workers = num_workers;
+    // Do overlapped block processing (half overlapped). The block rows of
+    // each pass are done in parallel.
     for (int offsy = 0; offsy < (block_size >> chroma_sub_h);
          offsy += (block_size >> chroma_sub_h) / 2) {
       for (int offsx = 0; offsx < (block_size >> chroma_sub_w);
            offsx += (block_size >> chroma_sub_w) / 2) {
-        // Pad the boundary when processing each block-set.
-        for (int by = -1; by < num_blocks_h; ++by) {
-          for (int bx = -1; bx < num_blocks_w; ++bx) {
-            const int pixels_per_block =
-                (block_size >> chroma_sub_w) * (block_size >> chroma_sub_h);
-            aom_flat_block_finder_extract_block(
-                block_finder, data[c], w >> chroma_sub_w, h >> chroma_sub_h,
-                stride[c], bx * (block_size >> chroma_sub_w) + offsx,
-                by * (block_size >> chroma_sub_h) + offsy, plane_d, block_d);
-            for (int j = 0; j < pixels_per_block; ++j) {
-              block[j] = (float)block_d[j];
-              plane[j] = (float)plane_d[j];
-            }
-            pointwise_multiply(window_function, block, pixels_per_block);
-            aom_noise_tx_forward(tx, block);
-            aom_noise_tx_filter(tx, noise_psd[c]);
-            aom_noise_tx_inverse(tx, block);
-
-            // Apply window function to the plane approximation (we will apply
-            // it to the sum of plane + block when composing the results).
-            pointwise_multiply(window_function, plane, pixels_per_block);
-
-            for (int y = 0; y < (block_size >> chroma_sub_h); ++y) {
-              const int y_result =
-                  y + (by + 1) * (block_size >> chroma_sub_h) + offsy;
-              for (int x = 0; x < (block_size >> chroma_sub_w); ++x) {
-                const int x_result =
-                    x + (bx + 1) * (block_size >> chroma_sub_w) + offsx;
-                result[y_result * result_stride + x_result] +=
-                    (block[y * (block_size >> chroma_sub_w) + x] +
-                     plane[y * (block_size >> chroma_sub_w) + x]) *
-                    window_function[y * (block_size >> chroma_sub_w) + x];
-              }
-            }
-          }
-        }
+        shared.offsx = offsx;
+        shared.offsy = offsy;
+        run_noise_jobs(workers, num_workers, wiener_denoise_hook, jobs,
+                       sizeof(*jobs), &shared);
       }
     }
     if (use_highbd) {
@@ -1476,19 +1833,13 @@ int aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoised[3],
     }
   }
   aom_free(result);
-  aom_free(plane);
-  aom_free(block);
-  aom_free(plane_d);
-  aom_free(block_d);
   aom_free(window_full);
-
-  aom_noise_tx_free(tx_full);
+  free_wiener_denoise_jobs(jobs, num_workers);
 
   aom_flat_block_finder_free(&block_finder_full);
   if (chroma_sub[0] != 0) {
     aom_flat_block_finder_free(&block_finder_chroma);
     aom_free(window_chroma);
-    aom_noise_tx_free(tx_chroma);
   }
   return init_success;
 }
@@ -1628,6 +1979,15 @@ static int denoise_and_model_realloc_if_necessary(
 int aom_denoise_and_model_run(struct aom_denoise_and_model_t *ctx,
                               const YV12_BUFFER_CONFIG *sd,
                               aom_film_grain_t *film_grain, int apply_denoise) {
+  return aom_denoise_and_model_run_mt(ctx, sd, film_grain, apply_denoise, NULL,
+                                      1);
+}
+
+int aom_denoise_and_model_run_mt(struct aom_denoise_and_model_t *ctx,
+                                 const YV12_BUFFER_CONFIG *sd,
+                                 aom_film_grain_t *film_grain,
+                                 int apply_denoise, AVxWorker *workers,
+                                 int num_workers) {
   const int block_size = ctx->block_size;
   const int use_highbd = (sd->flags & YV12_FLAG_HIGHBITDEPTH) != 0;
   uint8_t *raw_data[3] = {
@@ -1644,20 +2004,22 @@ int aom_denoise_and_model_run(struct aom_denoise_and_model_t *ctx,
     return 0;
   }
 
-  aom_flat_block_finder_run(&ctx->flat_block_finder, data[0], sd->y_width,
-                            sd->y_height, strides[0], ctx->flat_blocks);
+  aom_flat_block_finder_run_mt(&ctx->flat_block_finder, data[0], sd->y_width,
+                               sd->y_height, strides[0], ctx->flat_blocks,
+                               workers, num_workers);
 
-  if (!aom_wiener_denoise_2d(data, ctx->denoised, sd->y_width, sd->y_height,
-                             strides, chroma_sub_log2, ctx->noise_psd,
-                             block_size, ctx->bit_depth, use_highbd)) {
+  if (!aom_wiener_denoise_2d_mt(data, ctx->denoised, sd->y_width, sd->y_height,
+                                strides, chroma_sub_log2, ctx->noise_psd,
+                                block_size, ctx->bit_depth, use_highbd,
+                                workers, num_workers)) {
     fprintf(stderr, "Unable to denoise image\n");
     return 0;
   }
 
-  const aom_noise_status_t status = aom_noise_model_update(
+  const aom_noise_status_t status = aom_noise_model_update_mt(
       &ctx->noise_model, data, (const uint8_t *const *)ctx->denoised,
       sd->y_width, sd->y_height, strides, chroma_sub_log2, ctx->flat_blocks,
-      block_size);
+      block_size, workers, num_workers);
   int have_noise_estimate = 0;
   if (status == AOM_NOISE_STATUS_OK) {
     have_noise_estimate = 1;
@@ -20,6 +20,7 @@ extern "C" {
 #include "aom_dsp/grain_params.h"
 #include "aom_ports/mem.h"
 #include "aom_scale/yv12config.h"
+#include "aom_util/aom_thread.h"
 
 /*!\brief Wrapper of data required to represent linear system of eqns and soln.
  */
@@ -158,6 +159,17 @@ int aom_flat_block_finder_run(const aom_flat_block_finder_t *block_finder,
                               const uint8_t *const data, int w, int h,
                               int stride, uint8_t *flat_blocks);
 
+/*!\brief Multithreaded version of aom_flat_block_finder_run.
+ *
+ * Rows of blocks are spread over the num_workers workers, the first of which
+ * runs on the calling thread. The result does not depend on num_workers. If
+ * num_workers <= 1, workers may be NULL.
+ */
+int aom_flat_block_finder_run_mt(const aom_flat_block_finder_t *block_finder,
+                                 const uint8_t *const data, int w, int h,
+                                 int stride, uint8_t *flat_blocks,
+                                 AVxWorker *workers, int num_workers);
+
 // The noise shape indicates the allowed coefficients in the AR model.
 enum {
   AOM_NOISE_SHAPE_DIAMOND = 0,
@@ -245,6 +257,18 @@ aom_noise_status_t aom_noise_model_update(
     const uint8_t *const denoised[3], int w, int h, int strides[3],
     int chroma_sub_log2[2], const uint8_t *const flat_blocks, int block_size);
 
+/*!\brief Multithreaded version of aom_noise_model_update.
+ *
+ * The observations of each channel are gathered from rows of blocks spread
+ * over the num_workers workers. The sums are exact, so the model does not
+ * depend on num_workers. If num_workers <= 1, workers may be NULL.
+ */
+aom_noise_status_t aom_noise_model_update_mt(
+    aom_noise_model_t *const noise_model, const uint8_t *const data[3],
+    const uint8_t *const denoised[3], int w, int h, int strides[3],
+    int chroma_sub_log2[2], const uint8_t *const flat_blocks, int block_size,
+    AVxWorker *workers, int num_workers);
+
 /*\brief Save the "latest" estimate into the "combined" estimate.
  *
  * This is meant to be called when the noise modeling detected a change
@@ -283,6 +307,18 @@ int aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoised[3],
                           float *noise_psd[3], int block_size, int bit_depth,
                           int use_highbd);
 
+/*!\brief Multithreaded version of aom_wiener_denoise_2d.
+ *
+ * The rows of blocks of each overlapped pass are spread over the num_workers
+ * workers. The output is identical to aom_wiener_denoise_2d. If
+ * num_workers <= 1, workers may be NULL.
+ */
+int aom_wiener_denoise_2d_mt(const uint8_t *const data[3],
+                             uint8_t *denoised[3], int w, int h, int stride[3],
+                             int chroma_sub_log2[2], float *noise_psd[3],
+                             int block_size, int bit_depth, int use_highbd,
+                             AVxWorker *workers, int num_workers);
+
 struct aom_denoise_and_model_t;
 
 /*!\brief Denoise the buffer and model the residual noise.
@@ -306,6 +342,18 @@ int aom_denoise_and_model_run(struct aom_denoise_and_model_t *ctx,
                               const YV12_BUFFER_CONFIG *sd,
                               aom_film_grain_t *grain, int apply_denoise);
 
+/*!\brief Multithreaded version of aom_denoise_and_model_run.
+ *
+ * Runs the flat block finder, the denoiser and the noise model update on the
+ * given workers. The first worker runs on the calling thread, and the hooks
+ * and data of all workers are overwritten. The results do not depend on
+ * num_workers. If num_workers <= 1, workers may be NULL.
+ */
+int aom_denoise_and_model_run_mt(struct aom_denoise_and_model_t *ctx,
+                                 const YV12_BUFFER_CONFIG *sd,
+                                 aom_film_grain_t *grain, int apply_denoise,
+                                 AVxWorker *workers, int num_workers);
+
 /*!\brief Allocates a context that can be used for denoising and noise modeling.
  *
  * \param[in]  bit_depth   Bit depth of buffers this will be run on.
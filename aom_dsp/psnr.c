@@ -342,87 +342,96 @@ int64_t aom_get_sse_plane(const YV12_BUFFER_CONFIG *a,
 #endif
 }
 
+int64_t aom_get_sse_plane_rows(const YV12_BUFFER_CONFIG *a,
+                               const YV12_BUFFER_CONFIG *b, int plane,
+                               int vstart, int height,
+                               unsigned int input_shift) {
+  const int is_uv = plane > 0;
+  assert(a->crop_widths[is_uv] == b->crop_widths[is_uv]);
+  assert(vstart >= 0 && vstart + height <= a->crop_heights[is_uv]);
+  const int width = a->crop_widths[is_uv];
+  const int a_stride = a->strides[is_uv];
+  const int b_stride = b->strides[is_uv];
 #if CONFIG_AV1_HIGHBITDEPTH
-void aom_calc_highbd_psnr(const YV12_BUFFER_CONFIG *a,
-                          const YV12_BUFFER_CONFIG *b, PSNR_STATS *psnr,
-                          uint32_t bit_depth, uint32_t in_bit_depth) {
-  assert(a->y_crop_width == b->y_crop_width);
-  assert(a->y_crop_height == b->y_crop_height);
-  assert(a->uv_crop_width == b->uv_crop_width);
-  assert(a->uv_crop_height == b->uv_crop_height);
-  const int widths[3] = { a->y_crop_width, a->uv_crop_width, a->uv_crop_width };
-  const int heights[3] = { a->y_crop_height, a->uv_crop_height,
-                           a->uv_crop_height };
-  const int a_strides[3] = { a->y_stride, a->uv_stride, a->uv_stride };
-  const int b_strides[3] = { b->y_stride, b->uv_stride, b->uv_stride };
-  int i;
-  uint64_t total_sse = 0;
-  uint32_t total_samples = 0;
-#if CONFIG_LIBVMAF_PSNR_PEAK
-  double peak = (double)(255 << (in_bit_depth - 8));
-#else
-  double peak = (double)((1 << in_bit_depth) - 1);
-#endif  // CONFIG_LIBVMAF_PSNR_PEAK
-  const unsigned int input_shift = bit_depth - in_bit_depth;
-
-  for (i = 0; i < 3; ++i) {
-    const int w = widths[i];
-    const int h = heights[i];
-    const uint32_t samples = w * h;
-    uint64_t sse;
-    if (a->flags & YV12_FLAG_HIGHBITDEPTH) {
-      if (input_shift) {
-        sse = highbd_get_sse_shift(a->buffers[i], a_strides[i], b->buffers[i],
-                                   b_strides[i], w, h, input_shift);
-      } else {
-        sse = highbd_get_sse(a->buffers[i], a_strides[i], b->buffers[i],
-                             b_strides[i], w, h);
-      }
-    } else {
-      sse = get_sse(a->buffers[i], a_strides[i], b->buffers[i], b_strides[i], w,
-                    h);
+  if (a->flags & YV12_FLAG_HIGHBITDEPTH) {
+    const uint8_t *const pa = CONVERT_TO_BYTEPTR(
+        CONVERT_TO_SHORTPTR(a->buffers[plane]) + vstart * a_stride);
+    const uint8_t *const pb = CONVERT_TO_BYTEPTR(
+        CONVERT_TO_SHORTPTR(b->buffers[plane]) + vstart * b_stride);
+    if (input_shift) {
+      return highbd_get_sse_shift(pa, a_stride, pb, b_stride, width, height,
+                                  input_shift);
     }
-    psnr->sse[1 + i] = sse;
-    psnr->samples[1 + i] = samples;
-    psnr->psnr[1 + i] = aom_sse_to_psnr(samples, peak, (double)sse);
-
-    total_sse += sse;
-    total_samples += samples;
+    return highbd_get_sse(pa, a_stride, pb, b_stride, width, height);
   }
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+  (void)input_shift;
+  return get_sse(a->buffers[plane] + vstart * a_stride, a_stride,
+                 b->buffers[plane] + vstart * b_stride, b_stride, width,
+                 height);
+}
 
-  psnr->sse[0] = total_sse;
-  psnr->samples[0] = total_samples;
-  psnr->psnr[0] =
-      aom_sse_to_psnr((double)total_samples, peak, (double)total_sse);
-
-  // Compute PSNR based on stream bit depth
-  if ((a->flags & YV12_FLAG_HIGHBITDEPTH) && (in_bit_depth < bit_depth)) {
+static double get_psnr_peak(uint32_t bit_depth) {
 #if CONFIG_LIBVMAF_PSNR_PEAK
-    peak = (double)(255 << (bit_depth - 8));
+  return (double)(255 << (bit_depth - 8));
 #else
-    peak = (double)((1 << bit_depth) - 1);
+  return (double)((1 << bit_depth) - 1);
 #endif  // CONFIG_LIBVMAF_PSNR_PEAK
-    total_sse = 0;
-    total_samples = 0;
-    for (i = 0; i < 3; ++i) {
-      const int w = widths[i];
-      const int h = heights[i];
-      const uint32_t samples = w * h;
-      uint64_t sse;
-      sse = highbd_get_sse(a->buffers[i], a_strides[i], b->buffers[i],
-                           b_strides[i], w, h);
-      psnr->sse_hbd[1 + i] = sse;
-      psnr->samples_hbd[1 + i] = samples;
-      psnr->psnr_hbd[1 + i] = aom_sse_to_psnr(samples, peak, (double)sse);
-      total_sse += sse;
-      total_samples += samples;
-    }
+}
 
-    psnr->sse_hbd[0] = total_sse;
-    psnr->samples_hbd[0] = total_samples;
-    psnr->psnr_hbd[0] =
-        aom_sse_to_psnr((double)total_samples, peak, (double)total_sse);
+static void fill_psnr_stats(const YV12_BUFFER_CONFIG *a, const uint64_t sse[3],
+                            double peak, double psnr[4],
+                            uint64_t total_sse[4], uint32_t samples[4]) {
+  uint64_t sse_sum = 0;
+  uint32_t samples_sum = 0;
+  for (int i = 0; i < 3; ++i) {
+    const int is_uv = i > 0;
+    const uint32_t plane_samples =
+        a->crop_widths[is_uv] * a->crop_heights[is_uv];
+    total_sse[1 + i] = sse[i];
+    samples[1 + i] = plane_samples;
+    psnr[1 + i] = aom_sse_to_psnr(plane_samples, peak, (double)sse[i]);
+    sse_sum += sse[i];
+    samples_sum += plane_samples;
   }
+  total_sse[0] = sse_sum;
+  samples[0] = samples_sum;
+  psnr[0] = aom_sse_to_psnr((double)samples_sum, peak, (double)sse_sum);
+}
+
+void aom_calc_psnr_from_sse(const YV12_BUFFER_CONFIG *a,
+                            const uint64_t sse[3], const uint64_t sse_hbd[3],
+                            uint32_t bit_depth, uint32_t in_bit_depth,
+                            PSNR_STATS *psnr) {
+  fill_psnr_stats(a, sse, get_psnr_peak(in_bit_depth), psnr->psnr, psnr->sse,
+                  psnr->samples);
+  if (aom_psnr_needs_hbd_stats(a, bit_depth, in_bit_depth)) {
+    fill_psnr_stats(a, sse_hbd, get_psnr_peak(bit_depth), psnr->psnr_hbd,
+                    psnr->sse_hbd, psnr->samples_hbd);
+  }
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+void aom_calc_highbd_psnr(const YV12_BUFFER_CONFIG *a,
+                          const YV12_BUFFER_CONFIG *b, PSNR_STATS *psnr,
+                          uint32_t bit_depth, uint32_t in_bit_depth) {
+  assert(a->y_crop_width == b->y_crop_width);
+  assert(a->y_crop_height == b->y_crop_height);
+  assert(a->uv_crop_width == b->uv_crop_width);
+  assert(a->uv_crop_height == b->uv_crop_height);
+  const unsigned int input_shift =
+      (a->flags & YV12_FLAG_HIGHBITDEPTH) ? bit_depth - in_bit_depth : 0;
+  const int need_hbd = aom_psnr_needs_hbd_stats(a, bit_depth, in_bit_depth);
+  uint64_t sse[3];
+  uint64_t sse_hbd[3] = { 0, 0, 0 };
+
+  for (int i = 0; i < 3; ++i) {
+    const int height = a->crop_heights[i > 0];
+    sse[i] = aom_get_sse_plane_rows(a, b, i, 0, height, input_shift);
+    // Compute PSNR based on stream bit depth
+    if (need_hbd) sse_hbd[i] = aom_get_sse_plane_rows(a, b, i, 0, height, 0);
+  }
+  aom_calc_psnr_from_sse(a, sse, sse_hbd, bit_depth, in_bit_depth, psnr);
 }
 #endif
 
@@ -432,32 +441,10 @@ void aom_calc_psnr(const YV12_BUFFER_CONFIG *a, const YV12_BUFFER_CONFIG *b,
   assert(a->y_crop_height == b->y_crop_height);
   assert(a->uv_crop_width == b->uv_crop_width);
   assert(a->uv_crop_height == b->uv_crop_height);
-  static const double peak = 255.0;
-  const int widths[3] = { a->y_crop_width, a->uv_crop_width, a->uv_crop_width };
-  const int heights[3] = { a->y_crop_height, a->uv_crop_height,
-                           a->uv_crop_height };
-  const int a_strides[3] = { a->y_stride, a->uv_stride, a->uv_stride };
-  const int b_strides[3] = { b->y_stride, b->uv_stride, b->uv_stride };
-  int i;
-  uint64_t total_sse = 0;
-  uint32_t total_samples = 0;
-
-  for (i = 0; i < 3; ++i) {
-    const int w = widths[i];
-    const int h = heights[i];
-    const uint32_t samples = w * h;
-    const uint64_t sse =
-        get_sse(a->buffers[i], a_strides[i], b->buffers[i], b_strides[i], w, h);
-    psnr->sse[1 + i] = sse;
-    psnr->samples[1 + i] = samples;
-    psnr->psnr[1 + i] = aom_sse_to_psnr(samples, peak, (double)sse);
-
-    total_sse += sse;
-    total_samples += samples;
-  }
+  uint64_t sse[3];
 
-  psnr->sse[0] = total_sse;
-  psnr->samples[0] = total_samples;
-  psnr->psnr[0] =
-      aom_sse_to_psnr((double)total_samples, peak, (double)total_sse);
+  for (int i = 0; i < 3; ++i) {
+    sse[i] = aom_get_sse_plane_rows(a, b, i, 0, a->crop_heights[i > 0], 0);
+  }
+  aom_calc_psnr_from_sse(a, sse, NULL, 8, 8, psnr);
 }
@@ -61,6 +61,48 @@ int64_t aom_get_v_sse_part(const YV12_BUFFER_CONFIG *a,
 int64_t aom_get_v_sse(const YV12_BUFFER_CONFIG *a, const YV12_BUFFER_CONFIG *b);
 int64_t aom_get_sse_plane(const YV12_BUFFER_CONFIG *a,
                           const YV12_BUFFER_CONFIG *b, int plane, int highbd);
+
+/*!\brief Computes the SSE of a band of rows of a plane
+ *
+ * Returns the sum of squared errors between rows [vstart, vstart + height) of
+ * the given plane of \p a and \p b, across the cropped width. Row bands can
+ * be computed independently and summed to give the SSE of the whole plane.
+ *
+ * \param[in]    a             First frame
+ * \param[in]    b             Second frame
+ * \param[in]    plane         Plane index (0: Y, 1: U, 2: V)
+ * \param[in]    vstart        First row of the band
+ * \param[in]    height        Number of rows in the band
+ * \param[in]    input_shift   Right shift applied to high bitdepth samples
+ *                             before the difference is taken
+ */
+int64_t aom_get_sse_plane_rows(const YV12_BUFFER_CONFIG *a,
+                               const YV12_BUFFER_CONFIG *b, int plane,
+                               int vstart, int height,
+                               unsigned int input_shift);
+
+// Returns whether PSNR is also reported at the stream bit depth, which happens
+// for high bitdepth frames when the input bit depth is lower.
+static inline int aom_psnr_needs_hbd_stats(const YV12_BUFFER_CONFIG *a,
+                                           uint32_t bit_depth,
+                                           uint32_t in_bit_depth) {
+  return (a->flags & YV12_FLAG_HIGHBITDEPTH) && in_bit_depth < bit_depth;
+}
+
+/*!\brief Fills PSNR stats from per-plane SSE
+ *
+ * \param[in]    a             Source frame, which gives the plane sizes
+ * \param[in]    sse           Per-plane SSE at the input bit depth
+ * \param[in]    sse_hbd       Per-plane SSE at the stream bit depth. Only read
+ *                             when aom_psnr_needs_hbd_stats() is true.
+ * \param[in]    bit_depth     Stream bit depth
+ * \param[in]    in_bit_depth  Input bit depth
+ * \param[out]   psnr          PSNR stats
+ */
+void aom_calc_psnr_from_sse(const YV12_BUFFER_CONFIG *a,
+                            const uint64_t sse[3], const uint64_t sse_hbd[3],
+                            uint32_t bit_depth, uint32_t in_bit_depth,
+                            PSNR_STATS *psnr);
 #if CONFIG_AV1_HIGHBITDEPTH
 uint64_t aom_highbd_get_y_var(const YV12_BUFFER_CONFIG *a, int hstart,
                               int width, int vstart, int height);
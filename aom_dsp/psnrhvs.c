@@ -134,18 +134,24 @@ static double calc_psnrhvs(const unsigned char *src, int _systride,
   (void)_par;
   ret = pixels = 0;
   sum1 = sum2 = delt = 0.0f;
-  for (y = 0; y < _h; y++) {
-    for (x = 0; x < _w; x++) {
-      if (!buf_is_hbd) {
+  // The bit depth is tested outside the pixel loops rather than per pixel.
+  if (!buf_is_hbd) {
+    for (y = 0; y < _h; y++) {
+      for (x = 0; x < _w; x++) {
         sum1 += _src8[y * _systride + x];
         sum2 += _dst8[y * _dystride + x];
-      } else {
+      }
+    }
+  } else {
+    for (y = 0; y < _h; y++) {
+      for (x = 0; x < _w; x++) {
         sum1 += _src16[y * _systride + x] >> _shift;
         sum2 += _dst16[y * _dystride + x] >> _shift;
       }
     }
   }
   if (luma) delt = (sum1 - sum2) / (_w * _h);
+  const int dc_offset = (int)(delt + 0.5f);
   /*In the PSNR-HVS-M paper[1] the authors describe the construction of
    their masking table as "we have used the quantization table for the
    color component Y of JPEG [6] that has been also obtained on the
@@ -181,16 +187,21 @@ static double calc_psnrhvs(const unsigned char *src, int _systride,
       double s_gmean = 0;
       double s_gvar = 0;
       double s_mask = 0;
-      for (i = 0; i < 8; i++) {
-        for (j = 0; j < 8; j++) {
-          if (!buf_is_hbd) {
+      if (!buf_is_hbd) {
+        for (i = 0; i < 8; i++) {
+          for (j = 0; j < 8; j++) {
             dct_s[i * 8 + j] = _src8[(y + i) * _systride + (j + x)];
-            dct_d[i * 8 + j] = _dst8[(y + i) * _dystride + (j + x)];
-          } else {
+            dct_d[i * 8 + j] =
+                _dst8[(y + i) * _dystride + (j + x)] + dc_offset;
+          }
+        }
+      } else {
+        for (i = 0; i < 8; i++) {
+          for (j = 0; j < 8; j++) {
             dct_s[i * 8 + j] = _src16[(y + i) * _systride + (j + x)] >> _shift;
-            dct_d[i * 8 + j] = _dst16[(y + i) * _dystride + (j + x)] >> _shift;
+            dct_d[i * 8 + j] =
+                (_dst16[(y + i) * _dystride + (j + x)] >> _shift) + dc_offset;
           }
-          dct_d[i * 8 + j] += (int)(delt + 0.5f);
         }
       }
       for (i = 1; i < 7; i++) {
@@ -231,8 +242,10 @@ static double calc_psnrhvs(const unsigned char *src, int _systride,
         for (j = 0; j < 8; j++) {
           double err;
           err = fabs((double)(dct_s_coef[i * 8 + j] - dct_d_coef[i * 8 + j]));
-          if (i != 0 || j != 0)
-            err = err < s_mask / mask[i][j] ? 0 : err - s_mask / mask[i][j];
+          if (i != 0 || j != 0) {
+            const double threshold = s_mask / mask[i][j];
+            err = err < threshold ? 0 : err - threshold;
+          }
           ret += (err * _csf[i][j]) * (err * _csf[i][j]);
           pixels++;
         }
@@ -31,6 +31,8 @@
 // * Whenever frame buffer is reused, reset the counter of filled levels.
 //   This invalidates all of the existing pyramid levels.
 // * Whenever frame buffer is resized, reallocate pyramid
+// * aom_release_pyramid() frees the layer storage of a pyramid which is not
+//   needed for a while. It is allocated again when the pyramid is next filled
 
 size_t aom_get_pyramid_alloc_size(int width, int height, bool image_is_16bit) {
   // Allocate the maximum possible number of layers for this width and height
@@ -98,6 +100,21 @@ size_t aom_get_pyramid_alloc_size(int width, int height, bool image_is_16bit) {
   return alloc_size;
 }
 
+// Allocate the storage for the pyramid levels and fill in the pointers for
+// each level
+// If image is 8-bit, then the lowest level is left unconfigured for now,
+// and will be set up properly when the pyramid is filled in
+static bool alloc_pyramid_buffer(ImagePyramid *pyr) {
+  pyr->buffer_alloc = aom_memalign(PYRAMID_ALIGNMENT, pyr->buffer_size);
+  if (!pyr->buffer_alloc) return false;
+  for (int level = pyr->first_allocated_level; level < pyr->max_levels;
+       level++) {
+    PyramidLayer *layer = &pyr->layers[level];
+    layer->buffer = pyr->buffer_alloc + pyr->layer_offsets[level];
+  }
+  return true;
+}
+
 ImagePyramid *aom_alloc_pyramid(int width, int height, bool image_is_16bit) {
   // Allocate the maximum possible number of layers for this width and height
   const int msb = get_msb(AOMMIN(width, height));
@@ -188,28 +205,20 @@ ImagePyramid *aom_alloc_pyramid(int width, int height, bool image_is_16bit) {
     layer->stride = level_stride;
   }
 
-  pyr->buffer_alloc =
-      aom_memalign(PYRAMID_ALIGNMENT, buffer_size * sizeof(*pyr->buffer_alloc));
-  if (!pyr->buffer_alloc) {
+  pyr->buffer_size = buffer_size * sizeof(*pyr->buffer_alloc);
+  pyr->layer_offsets = layer_offsets;
+  pyr->first_allocated_level = first_allocated_level;
+  if (!alloc_pyramid_buffer(pyr)) {
     aom_free(pyr->layers);
     aom_free(pyr);
     aom_free(layer_offsets);
     return NULL;
   }
 
-  // Fill in pointers for each level
-  // If image is 8-bit, then the lowest level is left unconfigured for now,
-  // and will be set up properly when the pyramid is filled in
-  for (int level = first_allocated_level; level < n_levels; level++) {
-    PyramidLayer *layer = &pyr->layers[level];
-    layer->buffer = pyr->buffer_alloc + layer_offsets[level];
-  }
-
 #if CONFIG_MULTITHREAD
   pthread_mutex_init(&pyr->mutex, NULL);
 #endif  // CONFIG_MULTITHREAD
 
-  aom_free(layer_offsets);
   return pyr;
 }
 
@@ -265,6 +274,10 @@ static inline int fill_pyramid(const YV12_BUFFER_CONFIG *frame, int bit_depth,
     return n_levels;
   }
 
+  if (!frame_pyr->buffer_alloc && !alloc_pyramid_buffer(frame_pyr)) {
+    return -1;
+  }
+
   const int frame_width = frame->y_crop_width;
   const int frame_height = frame->y_crop_height;
   const int frame_stride = frame->y_stride;
@@ -455,6 +468,21 @@ void aom_invalidate_pyramid(ImagePyramid *pyr) {
   }
 }
 
+// Free the pyramid levels, but keep the pyramid itself
+void aom_release_pyramid(ImagePyramid *pyr) {
+  if (pyr) {
+#if CONFIG_MULTITHREAD
+    pthread_mutex_lock(&pyr->mutex);
+#endif  // CONFIG_MULTITHREAD
+    pyr->filled_levels = 0;
+    aom_free(pyr->buffer_alloc);
+    pyr->buffer_alloc = NULL;
+#if CONFIG_MULTITHREAD
+    pthread_mutex_unlock(&pyr->mutex);
+#endif  // CONFIG_MULTITHREAD
+  }
+}
+
 // Release the memory associated with a pyramid
 void aom_free_pyramid(ImagePyramid *pyr) {
   if (pyr) {
@@ -462,6 +490,7 @@ void aom_free_pyramid(ImagePyramid *pyr) {
     pthread_mutex_destroy(&pyr->mutex);
 #endif  // CONFIG_MULTITHREAD
     aom_free(pyr->buffer_alloc);
+    aom_free(pyr->layer_offsets);
     aom_free(pyr->layers);
     aom_free(pyr);
   }
@@ -83,7 +83,16 @@ typedef struct image_pyramid {
   // Number of levels which currently hold valid data
   int filled_levels;
   // Pointer to allocated buffer
+  // This may be NULL after aom_release_pyramid(), in which case it is
+  // allocated again the next time the pyramid is computed
   uint8_t *buffer_alloc;
+  // Size of buffer_alloc, in bytes
+  size_t buffer_size;
+  // Offset of each allocated level within buffer_alloc
+  size_t *layer_offsets;
+  // First level which has its own storage in buffer_alloc. For 8-bit frames,
+  // level 0 points at the frame buffer itself
+  int first_allocated_level;
   // Data for each level
   // The `buffer` pointers inside this array point into the region which
   // is stored in the `buffer_alloc` field here
@@ -128,6 +137,10 @@ bool aom_is_pyramid_valid(ImagePyramid *pyr, int n_levels);
 // This must be done whenever the corresponding frame buffer is reused
 void aom_invalidate_pyramid(ImagePyramid *pyr);
 
+// Free the pyramid levels, but keep the pyramid itself. The levels are
+// allocated again the next time the pyramid is computed
+void aom_release_pyramid(ImagePyramid *pyr);
+
 // Release the memory associated with a pyramid
 void aom_free_pyramid(ImagePyramid *pyr);
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_config.h"
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/aom_dsp_common.h"
+
+// Number of outputs computed per strip of column sums.
+#define FS_STRIP 64
+
+enum { FS_GX2, FS_GY2, FS_GXGY, FS_PRODUCTS };
+
+// The C version slides a window of 8 column sums along the row. Unrolled, the
+// sum at output i is
+//   A(i) + B(i + 1) + C(i + 2) + D(i + 3) + D(i + 4) + C(i + 5) + B(i + 6) +
+//   A(i + 7)
+// over buffer columns, where, with Pn the sum of the two rows at ring offsets
+// -1 - n and n,
+//   A = P0, B = 2 * A + P1, C = 2 * B + P2, D = 2 * C + P3.
+// The gradients are below 2^23 and the weights add up to 104, so every partial
+// sum is an integer below 2^53. The doubles are exact in any order and the
+// result matches the C version bit for bit.
+
+// Adds the squares and products of the gradients in 4 columns of one row.
+static inline void add_products(const uint32_t *gx, const uint32_t *gy,
+                                __m256d *sum) {
+  const __m256d x = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)gx));
+  const __m256d y = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)gy));
+  sum[FS_GX2] = _mm256_add_pd(sum[FS_GX2], _mm256_mul_pd(x, x));
+  sum[FS_GY2] = _mm256_add_pd(sum[FS_GY2], _mm256_mul_pd(y, y));
+  sum[FS_GXGY] = _mm256_add_pd(sum[FS_GXGY], _mm256_mul_pd(x, y));
+}
+
+// Computes A, B, C and D for 4 buffer columns starting at col.
+static inline void column_sums(const uint32_t *gx_buf, const uint32_t *gy_buf,
+                               int stride, int j, int col,
+                               double sums[FS_PRODUCTS][4][FS_STRIP + 8],
+                               int pos) {
+  __m256d acc[FS_PRODUCTS];
+  for (int q = 0; q < FS_PRODUCTS; ++q) acc[q] = _mm256_setzero_pd();
+  for (int n = 0; n < 4; ++n) {
+    const int r0 = ((j - 1 - n) & 7) * stride + col;
+    const int r1 = ((j + n) & 7) * stride + col;
+    __m256d pair[FS_PRODUCTS];
+    for (int q = 0; q < FS_PRODUCTS; ++q) pair[q] = _mm256_setzero_pd();
+    add_products(gx_buf + r0, gy_buf + r0, pair);
+    add_products(gx_buf + r1, gy_buf + r1, pair);
+    for (int q = 0; q < FS_PRODUCTS; ++q) {
+      acc[q] = _mm256_add_pd(_mm256_add_pd(acc[q], acc[q]), pair[q]);
+      _mm256_storeu_pd(&sums[q][n][pos], acc[q]);
+    }
+  }
+}
+
+static inline __m256d window_sum(const double sums[4][FS_STRIP + 8], int i) {
+  const __m256d a = _mm256_add_pd(_mm256_loadu_pd(&sums[0][i]),
+                                  _mm256_loadu_pd(&sums[0][i + 7]));
+  const __m256d b = _mm256_add_pd(_mm256_loadu_pd(&sums[1][i + 1]),
+                                  _mm256_loadu_pd(&sums[1][i + 6]));
+  const __m256d c = _mm256_add_pd(_mm256_loadu_pd(&sums[2][i + 2]),
+                                  _mm256_loadu_pd(&sums[2][i + 5]));
+  const __m256d d = _mm256_add_pd(_mm256_loadu_pd(&sums[3][i + 3]),
+                                  _mm256_loadu_pd(&sums[3][i + 4]));
+  return _mm256_add_pd(_mm256_add_pd(a, b), _mm256_add_pd(c, d));
+}
+
+void aom_fastssim_structure_row_avx2(const uint32_t *gx_buf,
+                                     const uint32_t *gy_buf, int stride, int j,
+                                     int w, double c2, double *ssim) {
+  if (w < 4) {
+    aom_fastssim_structure_row_c(gx_buf, gy_buf, stride, j, w, c2, ssim);
+    return;
+  }
+  double sums[FS_PRODUCTS][4][FS_STRIP + 8];
+  const __m256d c2_v = _mm256_set1_pd(c2);
+  for (int x0 = 0; x0 < w; x0 += FS_STRIP) {
+    int n = AOMMIN(FS_STRIP, w - x0);
+    // Recompute a few outputs rather than read past the end of the row.
+    if (n < 4) {
+      x0 = w - 4;
+      n = 4;
+    }
+    // Outputs x0 to x0 + n - 1 use buffer columns x0 to x0 + n + 7.
+    for (int c = 0; c < n + 8; c += 4) {
+      const int pos = AOMMIN(c, n + 4);
+      column_sums(gx_buf, gy_buf, stride, j, x0 + pos, sums, pos);
+    }
+    for (int i = 0; i < n; i += 4) {
+      const int pos = AOMMIN(i, n - 4);
+      const __m256d gx2 = window_sum(sums[FS_GX2], pos);
+      const __m256d gy2 = window_sum(sums[FS_GY2], pos);
+      const __m256d gxgy = window_sum(sums[FS_GXGY], pos);
+      const __m256d num = _mm256_add_pd(_mm256_add_pd(gxgy, gxgy), c2_v);
+      const __m256d den = _mm256_add_pd(_mm256_add_pd(gx2, gy2), c2_v);
+      _mm256_storeu_pd(ssim + x0 + pos, _mm256_div_pd(num, den));
+    }
+  }
+}
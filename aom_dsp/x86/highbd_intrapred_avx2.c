@@ -0,0 +1,531 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/intrapred_common.h"
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+#include "aom_ports/bitops.h"
+
+// Blocks 16 or more pixels wide are processed in 16-pixel __m256i columns.
+// Narrower blocks use a single __m128i per row, of which only the low 4 lanes
+// are stored when bw == 4.
+
+static inline __m128i load_row_w8(const uint16_t *src, int bw) {
+  return bw == 4 ? xx_loadl_64(src) : xx_loadu_128(src);
+}
+
+static inline void store_row_w8(uint16_t *dst, int bw, const __m128i v) {
+  if (bw == 4) {
+    xx_storel_64(dst, v);
+  } else {
+    xx_storeu_128(dst, v);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// DC_PRED, DC_TOP_PRED, DC_LEFT_PRED, DC_128_PRED
+
+// Sums n pixels, where n is a power of two between 4 and 64. Pixels are at
+// most 12 bits, so pairwise sums fit in the 32-bit lanes of _mm*_madd_epi16().
+static inline int highbd_sum(const uint16_t *ref, int n) {
+  __m128i sum;
+  if (n >= 16) {
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i sum256 = _mm256_madd_epi16(yy_loadu_256(ref), one);
+    for (int i = 16; i < n; i += 16) {
+      sum256 = _mm256_add_epi32(
+          sum256, _mm256_madd_epi16(yy_loadu_256(ref + i), one));
+    }
+    sum = _mm_add_epi32(_mm256_castsi256_si128(sum256),
+                        _mm256_extracti128_si256(sum256, 1));
+  } else {
+    sum = _mm_madd_epi16(load_row_w8(ref, n), _mm_set1_epi16(1));
+  }
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 8));
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 4));
+  return _mm_cvtsi128_si32(sum);
+}
+
+static AOM_FORCE_INLINE void highbd_fill(uint16_t *dst, ptrdiff_t stride,
+                                         int bw, int bh, int value) {
+  if (bw >= 16) {
+    const __m256i v = _mm256_set1_epi16(value);
+    for (int r = 0; r < bh; ++r) {
+      for (int c = 0; c < bw; c += 16) yy_storeu_256(dst + c, v);
+      dst += stride;
+    }
+  } else {
+    const __m128i v = _mm_set1_epi16(value);
+    for (int r = 0; r < bh; r += 4) {
+      store_row_w8(dst, bw, v);
+      store_row_w8(dst + stride, bw, v);
+      store_row_w8(dst + 2 * stride, bw, v);
+      store_row_w8(dst + 3 * stride, bw, v);
+      dst += 4 * stride;
+    }
+  }
+}
+
+// Matches highbd_dc_predictor_rect() in aom_dsp/intrapred.c.
+#define HIGHBD_DC_MULTIPLIER_1X2 0xAAAB
+#define HIGHBD_DC_MULTIPLIER_1X4 0x6667
+#define HIGHBD_DC_SHIFT2 17
+
+static AOM_FORCE_INLINE void highbd_dc_predictor(uint16_t *dst,
+                                                 ptrdiff_t stride, int bw,
+                                                 int bh, const uint16_t *above,
+                                                 const uint16_t *left) {
+  const int sum = highbd_sum(above, bw) + highbd_sum(left, bh);
+  const int count = bw + bh;
+  int dc;
+  if (bw == bh) {
+    dc = (sum + (count >> 1)) / count;
+  } else {
+    // bw + bh is 3 << shift1 for 1:2 blocks and 5 << shift1 for 1:4 blocks.
+    const int ratio = bw > bh ? bw / bh : bh / bw;
+    const int shift1 = ratio == 2 ? get_msb(count / 3) : get_msb(count / 5);
+    const uint32_t multiplier =
+        ratio == 2 ? HIGHBD_DC_MULTIPLIER_1X2 : HIGHBD_DC_MULTIPLIER_1X4;
+    dc = (int)(((uint32_t)(sum + (count >> 1)) >> shift1) * multiplier >>
+               HIGHBD_DC_SHIFT2);
+  }
+  highbd_fill(dst, stride, bw, bh, dc);
+}
+
+#undef HIGHBD_DC_MULTIPLIER_1X2
+#undef HIGHBD_DC_MULTIPLIER_1X4
+#undef HIGHBD_DC_SHIFT2
+
+static AOM_FORCE_INLINE void highbd_dc_top_predictor(uint16_t *dst,
+                                                     ptrdiff_t stride, int bw,
+                                                     int bh,
+                                                     const uint16_t *above) {
+  highbd_fill(dst, stride, bw, bh, (highbd_sum(above, bw) + (bw >> 1)) / bw);
+}
+
+static AOM_FORCE_INLINE void highbd_dc_left_predictor(uint16_t *dst,
+                                                      ptrdiff_t stride, int bw,
+                                                      int bh,
+                                                      const uint16_t *left) {
+  highbd_fill(dst, stride, bw, bh, (highbd_sum(left, bh) + (bh >> 1)) / bh);
+}
+
+// -----------------------------------------------------------------------------
+// V_PRED, H_PRED
+
+static AOM_FORCE_INLINE void highbd_v_predictor(uint16_t *dst,
+                                                ptrdiff_t stride, int bw,
+                                                int bh,
+                                                const uint16_t *above) {
+  if (bw >= 16) {
+    __m256i row[4];
+    for (int c = 0; c < bw; c += 16) row[c >> 4] = yy_loadu_256(above + c);
+    for (int r = 0; r < bh; ++r) {
+      for (int c = 0; c < bw; c += 16) yy_storeu_256(dst + c, row[c >> 4]);
+      dst += stride;
+    }
+  } else {
+    const __m128i row = load_row_w8(above, bw);
+    for (int r = 0; r < bh; ++r) {
+      store_row_w8(dst, bw, row);
+      dst += stride;
+    }
+  }
+}
+
+static AOM_FORCE_INLINE void highbd_h_predictor(uint16_t *dst,
+                                                ptrdiff_t stride, int bw,
+                                                int bh, const uint16_t *left) {
+  if (bw >= 16) {
+    for (int r = 0; r < bh; ++r) {
+      highbd_fill(dst, stride, bw, 1, left[r]);
+      dst += stride;
+    }
+    return;
+  }
+  // Splat 4 left pixels per load rather than broadcasting each from memory.
+  for (int r = 0; r < bh; r += 4) {
+    const __m128i l = xx_loadl_64(left + r);
+    const __m128i l01 = _mm_unpacklo_epi16(l, l);
+    store_row_w8(dst, bw, _mm_shuffle_epi32(l01, 0x00));
+    store_row_w8(dst + stride, bw, _mm_shuffle_epi32(l01, 0x55));
+    store_row_w8(dst + 2 * stride, bw, _mm_shuffle_epi32(l01, 0xaa));
+    store_row_w8(dst + 3 * stride, bw, _mm_shuffle_epi32(l01, 0xff));
+    dst += 4 * stride;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// PAETH_PRED
+
+// With base = top + left - top_left, the distances used by
+// paeth_predictor_single() reduce to
+//   p_left     = |top - top_left|
+//   p_top      = |left - top_left|
+//   p_top_left = |(top - top_left) + (left - top_left)|
+// Pixels are at most 12 bits, so all of them fit in signed 16-bit lanes.
+static inline __m256i paeth_16(const __m256i top, const __m256i top_diff,
+                               const __m256i p_left, const __m256i top_left,
+                               const __m256i left, const __m256i left_diff,
+                               const __m256i p_top) {
+  const __m256i p_top_left =
+      _mm256_abs_epi16(_mm256_add_epi16(top_diff, left_diff));
+  const __m256i not_left =
+      _mm256_or_si256(_mm256_cmpgt_epi16(p_left, p_top),
+                      _mm256_cmpgt_epi16(p_left, p_top_left));
+  const __m256i top_or_top_left =
+      _mm256_blendv_epi8(top, top_left, _mm256_cmpgt_epi16(p_top, p_top_left));
+  return _mm256_blendv_epi8(left, top_or_top_left, not_left);
+}
+
+static inline __m128i paeth_8(const __m128i top, const __m128i top_diff,
+                              const __m128i p_left, const __m128i top_left,
+                              const __m128i left, const __m128i left_diff,
+                              const __m128i p_top) {
+  const __m128i p_top_left = _mm_abs_epi16(_mm_add_epi16(top_diff, left_diff));
+  const __m128i not_left = _mm_or_si128(_mm_cmpgt_epi16(p_left, p_top),
+                                        _mm_cmpgt_epi16(p_left, p_top_left));
+  const __m128i top_or_top_left =
+      _mm_blendv_epi8(top, top_left, _mm_cmpgt_epi16(p_top, p_top_left));
+  return _mm_blendv_epi8(left, top_or_top_left, not_left);
+}
+
+static AOM_FORCE_INLINE void highbd_paeth_predictor(uint16_t *dst,
+                                                    ptrdiff_t stride, int bw,
+                                                    int bh,
+                                                    const uint16_t *above,
+                                                    const uint16_t *left) {
+  const int top_left = above[-1];
+  if (bw >= 16) {
+    const __m256i tl = _mm256_set1_epi16(top_left);
+    __m256i top[4], top_diff[4], p_left[4];
+    for (int c = 0; c < bw; c += 16) {
+      top[c >> 4] = yy_loadu_256(above + c);
+      top_diff[c >> 4] = _mm256_sub_epi16(top[c >> 4], tl);
+      p_left[c >> 4] = _mm256_abs_epi16(top_diff[c >> 4]);
+    }
+    for (int r = 0; r < bh; ++r) {
+      const __m256i l = _mm256_set1_epi16(left[r]);
+      const __m256i left_diff = _mm256_set1_epi16(left[r] - top_left);
+      const __m256i p_top = _mm256_abs_epi16(left_diff);
+      for (int c = 0; c < bw; c += 16) {
+        yy_storeu_256(dst + c, paeth_16(top[c >> 4], top_diff[c >> 4],
+                                        p_left[c >> 4], tl, l, left_diff,
+                                        p_top));
+      }
+      dst += stride;
+    }
+  } else {
+    const __m128i tl = _mm_set1_epi16(top_left);
+    const __m128i top = load_row_w8(above, bw);
+    const __m128i top_diff = _mm_sub_epi16(top, tl);
+    const __m128i p_left = _mm_abs_epi16(top_diff);
+    for (int r = 0; r < bh; ++r) {
+      const __m128i left_diff = _mm_set1_epi16(left[r] - top_left);
+      store_row_w8(dst, bw,
+                   paeth_8(top, top_diff, p_left, tl, _mm_set1_epi16(left[r]),
+                           left_diff, _mm_abs_epi16(left_diff)));
+      dst += stride;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// SMOOTH_PRED, SMOOTH_V_PRED, SMOOTH_H_PRED
+
+// Every smooth predictor is a sum of two (pixel, weight) products per term,
+// computed with _mm*_madd_epi16() on interleaved pairs. The column-dependent
+// half of each pair is interleaved once per block, the row-dependent half is
+// broadcast as a 32-bit (lo, hi) pair per row. Pixels (12 bits) and weights
+// (at most 256) both fit in signed 16-bit lanes, and the products in 32 bits.
+static inline int pair_epi16(int lo, int hi) { return lo | (hi << 16); }
+
+static inline __m256i smooth_round_16(__m256i lo, __m256i hi, int bits) {
+  return _mm256_packus_epi32(_mm256_srli_epi32(lo, bits),
+                             _mm256_srli_epi32(hi, bits));
+}
+
+static inline __m128i smooth_round_8(__m128i lo, __m128i hi, int bits) {
+  return _mm_packus_epi32(_mm_srli_epi32(lo, bits), _mm_srli_epi32(hi, bits));
+}
+
+// pred = (w_h[r] * above[c] + w_w[c] * left[r] + (scale - w_w[c]) * right +
+//         (scale - w_h[r]) * below + scale) >> (1 + SMOOTH_WEIGHT_LOG2_SCALE)
+// The first two terms come from one madd; the right-column term depends only
+// on c and the below-row term (plus rounding) only on r.
+static AOM_FORCE_INLINE void highbd_smooth_predictor(uint16_t *dst,
+                                                     ptrdiff_t stride, int bw,
+                                                     int bh,
+                                                     const uint16_t *above,
+                                                     const uint16_t *left) {
+  const int scale = 1 << SMOOTH_WEIGHT_LOG2_SCALE;
+  const int shift = 1 + SMOOTH_WEIGHT_LOG2_SCALE;
+  const int below = left[bh - 1];
+  const int right = above[bw - 1];
+  const uint16_t *const weights_w = smooth_weights_u16 + bw - 4;
+  const uint16_t *const weights_h = smooth_weights_u16 + bh - 4;
+
+  if (bw >= 16) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i v_scale = _mm256_set1_epi16(scale);
+    const __m256i v_right = _mm256_set1_epi32(right);
+    __m256i top_w_lo[4], top_w_hi[4], right_lo[4], right_hi[4];
+    for (int c = 0; c < bw; c += 16) {
+      const __m256i top = yy_loadu_256(above + c);
+      const __m256i w = yy_loadu_256(weights_w + c);
+      const __m256i inv_w = _mm256_sub_epi16(v_scale, w);
+      top_w_lo[c >> 4] = _mm256_unpacklo_epi16(top, w);
+      top_w_hi[c >> 4] = _mm256_unpackhi_epi16(top, w);
+      right_lo[c >> 4] =
+          _mm256_madd_epi16(_mm256_unpacklo_epi16(inv_w, zero), v_right);
+      right_hi[c >> 4] =
+          _mm256_madd_epi16(_mm256_unpackhi_epi16(inv_w, zero), v_right);
+    }
+    for (int r = 0; r < bh; ++r) {
+      const __m256i coeff =
+          _mm256_set1_epi32(pair_epi16(weights_h[r], left[r]));
+      const __m256i row_term =
+          _mm256_set1_epi32((scale - weights_h[r]) * below + scale);
+      for (int c = 0; c < bw; c += 16) {
+        const __m256i lo = _mm256_add_epi32(
+            _mm256_madd_epi16(top_w_lo[c >> 4], coeff),
+            _mm256_add_epi32(right_lo[c >> 4], row_term));
+        const __m256i hi = _mm256_add_epi32(
+            _mm256_madd_epi16(top_w_hi[c >> 4], coeff),
+            _mm256_add_epi32(right_hi[c >> 4], row_term));
+        yy_storeu_256(dst + c, smooth_round_16(lo, hi, shift));
+      }
+      dst += stride;
+    }
+  } else {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i top = load_row_w8(above, bw);
+    const __m128i w = load_row_w8(weights_w, bw);
+    const __m128i inv_w = _mm_sub_epi16(_mm_set1_epi16(scale), w);
+    const __m128i v_right = _mm_set1_epi32(right);
+    const __m128i top_w_lo = _mm_unpacklo_epi16(top, w);
+    const __m128i top_w_hi = _mm_unpackhi_epi16(top, w);
+    const __m128i right_lo =
+        _mm_madd_epi16(_mm_unpacklo_epi16(inv_w, zero), v_right);
+    const __m128i right_hi =
+        _mm_madd_epi16(_mm_unpackhi_epi16(inv_w, zero), v_right);
+    for (int r = 0; r < bh; ++r) {
+      const __m128i coeff = _mm_set1_epi32(pair_epi16(weights_h[r], left[r]));
+      const __m128i row_term =
+          _mm_set1_epi32((scale - weights_h[r]) * below + scale);
+      const __m128i lo =
+          _mm_add_epi32(_mm_madd_epi16(top_w_lo, coeff),
+                        _mm_add_epi32(right_lo, row_term));
+      const __m128i hi =
+          _mm_add_epi32(_mm_madd_epi16(top_w_hi, coeff),
+                        _mm_add_epi32(right_hi, row_term));
+      store_row_w8(dst, bw, smooth_round_8(lo, hi, shift));
+      dst += stride;
+    }
+  }
+}
+
+// pred = (w_h[r] * above[c] + (scale - w_h[r]) * below + scale / 2) >>
+//        SMOOTH_WEIGHT_LOG2_SCALE
+static AOM_FORCE_INLINE void highbd_smooth_v_predictor(uint16_t *dst,
+                                                       ptrdiff_t stride, int bw,
+                                                       int bh,
+                                                       const uint16_t *above,
+                                                       const uint16_t *left) {
+  const int scale = 1 << SMOOTH_WEIGHT_LOG2_SCALE;
+  const uint16_t *const weights_h = smooth_weights_u16 + bh - 4;
+
+  if (bw >= 16) {
+    const __m256i v_below = _mm256_set1_epi16(left[bh - 1]);
+    const __m256i round = _mm256_set1_epi32(scale >> 1);
+    __m256i top_below_lo[4], top_below_hi[4];
+    for (int c = 0; c < bw; c += 16) {
+      const __m256i top = yy_loadu_256(above + c);
+      top_below_lo[c >> 4] = _mm256_unpacklo_epi16(top, v_below);
+      top_below_hi[c >> 4] = _mm256_unpackhi_epi16(top, v_below);
+    }
+    for (int r = 0; r < bh; ++r) {
+      const __m256i coeff =
+          _mm256_set1_epi32(pair_epi16(weights_h[r], scale - weights_h[r]));
+      for (int c = 0; c < bw; c += 16) {
+        const __m256i lo = _mm256_add_epi32(
+            _mm256_madd_epi16(top_below_lo[c >> 4], coeff), round);
+        const __m256i hi = _mm256_add_epi32(
+            _mm256_madd_epi16(top_below_hi[c >> 4], coeff), round);
+        yy_storeu_256(dst + c,
+                      smooth_round_16(lo, hi, SMOOTH_WEIGHT_LOG2_SCALE));
+      }
+      dst += stride;
+    }
+  } else {
+    const __m128i v_below = _mm_set1_epi16(left[bh - 1]);
+    const __m128i round = _mm_set1_epi32(scale >> 1);
+    const __m128i top = load_row_w8(above, bw);
+    const __m128i top_below_lo = _mm_unpacklo_epi16(top, v_below);
+    const __m128i top_below_hi = _mm_unpackhi_epi16(top, v_below);
+    for (int r = 0; r < bh; ++r) {
+      const __m128i coeff =
+          _mm_set1_epi32(pair_epi16(weights_h[r], scale - weights_h[r]));
+      const __m128i lo =
+          _mm_add_epi32(_mm_madd_epi16(top_below_lo, coeff), round);
+      const __m128i hi =
+          _mm_add_epi32(_mm_madd_epi16(top_below_hi, coeff), round);
+      store_row_w8(dst, bw, smooth_round_8(lo, hi, SMOOTH_WEIGHT_LOG2_SCALE));
+      dst += stride;
+    }
+  }
+}
+
+// pred = (w_w[c] * left[r] + (scale - w_w[c]) * right + scale / 2) >>
+//        SMOOTH_WEIGHT_LOG2_SCALE
+static AOM_FORCE_INLINE void highbd_smooth_h_predictor(uint16_t *dst,
+                                                       ptrdiff_t stride, int bw,
+                                                       int bh,
+                                                       const uint16_t *above,
+                                                       const uint16_t *left) {
+  const int scale = 1 << SMOOTH_WEIGHT_LOG2_SCALE;
+  const int right = above[bw - 1];
+  const uint16_t *const weights_w = smooth_weights_u16 + bw - 4;
+
+  if (bw >= 16) {
+    const __m256i v_scale = _mm256_set1_epi16(scale);
+    const __m256i round = _mm256_set1_epi32(scale >> 1);
+    __m256i w_lo[4], w_hi[4];
+    for (int c = 0; c < bw; c += 16) {
+      const __m256i w = yy_loadu_256(weights_w + c);
+      const __m256i inv_w = _mm256_sub_epi16(v_scale, w);
+      w_lo[c >> 4] = _mm256_unpacklo_epi16(w, inv_w);
+      w_hi[c >> 4] = _mm256_unpackhi_epi16(w, inv_w);
+    }
+    for (int r = 0; r < bh; ++r) {
+      const __m256i coeff = _mm256_set1_epi32(pair_epi16(left[r], right));
+      for (int c = 0; c < bw; c += 16) {
+        const __m256i lo =
+            _mm256_add_epi32(_mm256_madd_epi16(w_lo[c >> 4], coeff), round);
+        const __m256i hi =
+            _mm256_add_epi32(_mm256_madd_epi16(w_hi[c >> 4], coeff), round);
+        yy_storeu_256(dst + c,
+                      smooth_round_16(lo, hi, SMOOTH_WEIGHT_LOG2_SCALE));
+      }
+      dst += stride;
+    }
+  } else {
+    const __m128i round = _mm_set1_epi32(scale >> 1);
+    const __m128i w = load_row_w8(weights_w, bw);
+    const __m128i inv_w = _mm_sub_epi16(_mm_set1_epi16(scale), w);
+    const __m128i w_lo = _mm_unpacklo_epi16(w, inv_w);
+    const __m128i w_hi = _mm_unpackhi_epi16(w, inv_w);
+    for (int r = 0; r < bh; ++r) {
+      const __m128i coeff = _mm_set1_epi32(pair_epi16(left[r], right));
+      const __m128i lo = _mm_add_epi32(_mm_madd_epi16(w_lo, coeff), round);
+      const __m128i hi = _mm_add_epi32(_mm_madd_epi16(w_hi, coeff), round);
+      store_row_w8(dst, bw, smooth_round_8(lo, hi, SMOOTH_WEIGHT_LOG2_SCALE));
+      dst += stride;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+#define HIGHBD_INTRA_PRED_AVX2(W, H)                                           \
+  void aom_highbd_dc_predictor_##W##x##H##_avx2(                               \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_dc_predictor(dst, stride, W, H, above, left);                       \
+  }                                                                            \
+  void aom_highbd_dc_top_predictor_##W##x##H##_avx2(                           \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)left;                                                                \
+    (void)bd;                                                                  \
+    highbd_dc_top_predictor(dst, stride, W, H, above);                         \
+  }                                                                            \
+  void aom_highbd_dc_left_predictor_##W##x##H##_avx2(                          \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)above;                                                               \
+    (void)bd;                                                                  \
+    highbd_dc_left_predictor(dst, stride, W, H, left);                         \
+  }                                                                            \
+  void aom_highbd_dc_128_predictor_##W##x##H##_avx2(                           \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)above;                                                               \
+    (void)left;                                                                \
+    highbd_fill(dst, stride, W, H, 128 << (bd - 8));                           \
+  }                                                                            \
+  void aom_highbd_v_predictor_##W##x##H##_avx2(                                \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)left;                                                                \
+    (void)bd;                                                                  \
+    highbd_v_predictor(dst, stride, W, H, above);                              \
+  }                                                                            \
+  void aom_highbd_h_predictor_##W##x##H##_avx2(                                \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)above;                                                               \
+    (void)bd;                                                                  \
+    highbd_h_predictor(dst, stride, W, H, left);                               \
+  }                                                                            \
+  void aom_highbd_paeth_predictor_##W##x##H##_avx2(                            \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_paeth_predictor(dst, stride, W, H, above, left);                    \
+  }                                                                            \
+  void aom_highbd_smooth_predictor_##W##x##H##_avx2(                           \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_smooth_predictor(dst, stride, W, H, above, left);                   \
+  }                                                                            \
+  void aom_highbd_smooth_v_predictor_##W##x##H##_avx2(                         \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_smooth_v_predictor(dst, stride, W, H, above, left);                 \
+  }                                                                            \
+  void aom_highbd_smooth_h_predictor_##W##x##H##_avx2(                         \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_smooth_h_predictor(dst, stride, W, H, above, left);                 \
+  }
+
+HIGHBD_INTRA_PRED_AVX2(4, 4)
+HIGHBD_INTRA_PRED_AVX2(4, 8)
+HIGHBD_INTRA_PRED_AVX2(8, 4)
+HIGHBD_INTRA_PRED_AVX2(8, 8)
+HIGHBD_INTRA_PRED_AVX2(8, 16)
+HIGHBD_INTRA_PRED_AVX2(16, 8)
+HIGHBD_INTRA_PRED_AVX2(16, 16)
+HIGHBD_INTRA_PRED_AVX2(16, 32)
+HIGHBD_INTRA_PRED_AVX2(32, 16)
+HIGHBD_INTRA_PRED_AVX2(32, 32)
+HIGHBD_INTRA_PRED_AVX2(32, 64)
+HIGHBD_INTRA_PRED_AVX2(64, 32)
+HIGHBD_INTRA_PRED_AVX2(64, 64)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_AVX2(4, 16)
+HIGHBD_INTRA_PRED_AVX2(16, 4)
+HIGHBD_INTRA_PRED_AVX2(8, 32)
+HIGHBD_INTRA_PRED_AVX2(32, 8)
+HIGHBD_INTRA_PRED_AVX2(16, 64)
+HIGHBD_INTRA_PRED_AVX2(64, 16)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+
+#undef HIGHBD_INTRA_PRED_AVX2
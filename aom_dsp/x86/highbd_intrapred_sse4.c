@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <smmintrin.h>
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/intrapred_common.h"
+#include "aom_dsp/x86/synonyms.h"
+
+// These follow the 128-bit paths of aom_dsp/x86/highbd_intrapred_avx2.c.
+// Blocks are processed in 8-pixel columns, of which only the low 4 lanes are
+// stored when bw == 4. The DC, V and H predictors are memory bound and are
+// already covered by SSE2.
+
+static inline __m128i load_row_w8(const uint16_t *src, int bw) {
+  return bw == 4 ? xx_loadl_64(src) : xx_loadu_128(src);
+}
+
+static inline void store_row_w8(uint16_t *dst, int bw, const __m128i v) {
+  if (bw == 4) {
+    xx_storel_64(dst, v);
+  } else {
+    xx_storeu_128(dst, v);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// PAETH_PRED
+
+// See paeth_16() in highbd_intrapred_avx2.c for the derivation.
+static inline __m128i paeth_8(const __m128i top, const __m128i top_diff,
+                              const __m128i p_left, const __m128i top_left,
+                              const __m128i left, const __m128i left_diff,
+                              const __m128i p_top) {
+  const __m128i p_top_left = _mm_abs_epi16(_mm_add_epi16(top_diff, left_diff));
+  const __m128i not_left = _mm_or_si128(_mm_cmpgt_epi16(p_left, p_top),
+                                        _mm_cmpgt_epi16(p_left, p_top_left));
+  const __m128i top_or_top_left =
+      _mm_blendv_epi8(top, top_left, _mm_cmpgt_epi16(p_top, p_top_left));
+  return _mm_blendv_epi8(left, top_or_top_left, not_left);
+}
+
+static AOM_FORCE_INLINE void highbd_paeth_predictor(uint16_t *dst,
+                                                    ptrdiff_t stride, int bw,
+                                                    int bh,
+                                                    const uint16_t *above,
+                                                    const uint16_t *left) {
+  const int top_left = above[-1];
+  const __m128i tl = _mm_set1_epi16(top_left);
+  __m128i top[8], top_diff[8], p_left[8];
+  for (int c = 0; c < bw; c += 8) {
+    top[c >> 3] = load_row_w8(above + c, bw);
+    top_diff[c >> 3] = _mm_sub_epi16(top[c >> 3], tl);
+    p_left[c >> 3] = _mm_abs_epi16(top_diff[c >> 3]);
+  }
+  for (int r = 0; r < bh; ++r) {
+    const __m128i l = _mm_set1_epi16(left[r]);
+    const __m128i left_diff = _mm_set1_epi16(left[r] - top_left);
+    const __m128i p_top = _mm_abs_epi16(left_diff);
+    for (int c = 0; c < bw; c += 8) {
+      store_row_w8(dst + c, bw,
+                   paeth_8(top[c >> 3], top_diff[c >> 3], p_left[c >> 3], tl,
+                           l, left_diff, p_top));
+    }
+    dst += stride;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// SMOOTH_PRED, SMOOTH_V_PRED, SMOOTH_H_PRED
+
+// See the AVX2 versions for the formulas and the (pixel, weight) pairing.
+static inline int pair_epi16(int lo, int hi) { return lo | (hi << 16); }
+
+static inline __m128i smooth_round_8(__m128i lo, __m128i hi, int bits) {
+  return _mm_packus_epi32(_mm_srli_epi32(lo, bits), _mm_srli_epi32(hi, bits));
+}
+
+static AOM_FORCE_INLINE void highbd_smooth_predictor(uint16_t *dst,
+                                                     ptrdiff_t stride, int bw,
+                                                     int bh,
+                                                     const uint16_t *above,
+                                                     const uint16_t *left) {
+  const int scale = 1 << SMOOTH_WEIGHT_LOG2_SCALE;
+  const int shift = 1 + SMOOTH_WEIGHT_LOG2_SCALE;
+  const int below = left[bh - 1];
+  const uint16_t *const weights_w = smooth_weights_u16 + bw - 4;
+  const uint16_t *const weights_h = smooth_weights_u16 + bh - 4;
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i v_scale = _mm_set1_epi16(scale);
+  const __m128i v_right = _mm_set1_epi32(above[bw - 1]);
+  __m128i top_w_lo[8], top_w_hi[8], right_lo[8], right_hi[8];
+  for (int c = 0; c < bw; c += 8) {
+    const __m128i top = load_row_w8(above + c, bw);
+    const __m128i w = load_row_w8(weights_w + c, bw);
+    const __m128i inv_w = _mm_sub_epi16(v_scale, w);
+    top_w_lo[c >> 3] = _mm_unpacklo_epi16(top, w);
+    top_w_hi[c >> 3] = _mm_unpackhi_epi16(top, w);
+    right_lo[c >> 3] = _mm_madd_epi16(_mm_unpacklo_epi16(inv_w, zero), v_right);
+    right_hi[c >> 3] = _mm_madd_epi16(_mm_unpackhi_epi16(inv_w, zero), v_right);
+  }
+  for (int r = 0; r < bh; ++r) {
+    const __m128i coeff = _mm_set1_epi32(pair_epi16(weights_h[r], left[r]));
+    const __m128i row_term =
+        _mm_set1_epi32((scale - weights_h[r]) * below + scale);
+    for (int c = 0; c < bw; c += 8) {
+      const __m128i lo =
+          _mm_add_epi32(_mm_madd_epi16(top_w_lo[c >> 3], coeff),
+                        _mm_add_epi32(right_lo[c >> 3], row_term));
+      const __m128i hi =
+          _mm_add_epi32(_mm_madd_epi16(top_w_hi[c >> 3], coeff),
+                        _mm_add_epi32(right_hi[c >> 3], row_term));
+      store_row_w8(dst + c, bw, smooth_round_8(lo, hi, shift));
+    }
+    dst += stride;
+  }
+}
+
+static AOM_FORCE_INLINE void highbd_smooth_v_predictor(uint16_t *dst,
+                                                       ptrdiff_t stride, int bw,
+                                                       int bh,
+                                                       const uint16_t *above,
+                                                       const uint16_t *left) {
+  const int scale = 1 << SMOOTH_WEIGHT_LOG2_SCALE;
+  const uint16_t *const weights_h = smooth_weights_u16 + bh - 4;
+  const __m128i v_below = _mm_set1_epi16(left[bh - 1]);
+  const __m128i round = _mm_set1_epi32(scale >> 1);
+  __m128i top_below_lo[8], top_below_hi[8];
+  for (int c = 0; c < bw; c += 8) {
+    const __m128i top = load_row_w8(above + c, bw);
+    top_below_lo[c >> 3] = _mm_unpacklo_epi16(top, v_below);
+    top_below_hi[c >> 3] = _mm_unpackhi_epi16(top, v_below);
+  }
+  for (int r = 0; r < bh; ++r) {
+    const __m128i coeff =
+        _mm_set1_epi32(pair_epi16(weights_h[r], scale - weights_h[r]));
+    for (int c = 0; c < bw; c += 8) {
+      const __m128i lo =
+          _mm_add_epi32(_mm_madd_epi16(top_below_lo[c >> 3], coeff), round);
+      const __m128i hi =
+          _mm_add_epi32(_mm_madd_epi16(top_below_hi[c >> 3], coeff), round);
+      store_row_w8(dst + c, bw,
+                   smooth_round_8(lo, hi, SMOOTH_WEIGHT_LOG2_SCALE));
+    }
+    dst += stride;
+  }
+}
+
+static AOM_FORCE_INLINE void highbd_smooth_h_predictor(uint16_t *dst,
+                                                       ptrdiff_t stride, int bw,
+                                                       int bh,
+                                                       const uint16_t *above,
+                                                       const uint16_t *left) {
+  const int scale = 1 << SMOOTH_WEIGHT_LOG2_SCALE;
+  const int right = above[bw - 1];
+  const uint16_t *const weights_w = smooth_weights_u16 + bw - 4;
+  const __m128i v_scale = _mm_set1_epi16(scale);
+  const __m128i round = _mm_set1_epi32(scale >> 1);
+  __m128i w_lo[8], w_hi[8];
+  for (int c = 0; c < bw; c += 8) {
+    const __m128i w = load_row_w8(weights_w + c, bw);
+    const __m128i inv_w = _mm_sub_epi16(v_scale, w);
+    w_lo[c >> 3] = _mm_unpacklo_epi16(w, inv_w);
+    w_hi[c >> 3] = _mm_unpackhi_epi16(w, inv_w);
+  }
+  for (int r = 0; r < bh; ++r) {
+    const __m128i coeff = _mm_set1_epi32(pair_epi16(left[r], right));
+    for (int c = 0; c < bw; c += 8) {
+      const __m128i lo =
+          _mm_add_epi32(_mm_madd_epi16(w_lo[c >> 3], coeff), round);
+      const __m128i hi =
+          _mm_add_epi32(_mm_madd_epi16(w_hi[c >> 3], coeff), round);
+      store_row_w8(dst + c, bw,
+                   smooth_round_8(lo, hi, SMOOTH_WEIGHT_LOG2_SCALE));
+    }
+    dst += stride;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+#define HIGHBD_INTRA_PRED_SSE4_1(W, H)                                         \
+  void aom_highbd_paeth_predictor_##W##x##H##_sse4_1(                          \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_paeth_predictor(dst, stride, W, H, above, left);                    \
+  }                                                                            \
+  void aom_highbd_smooth_predictor_##W##x##H##_sse4_1(                         \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_smooth_predictor(dst, stride, W, H, above, left);                   \
+  }                                                                            \
+  void aom_highbd_smooth_v_predictor_##W##x##H##_sse4_1(                       \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_smooth_v_predictor(dst, stride, W, H, above, left);                 \
+  }                                                                            \
+  void aom_highbd_smooth_h_predictor_##W##x##H##_sse4_1(                       \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                  \
+      const uint16_t *left, int bd) {                                          \
+    (void)bd;                                                                  \
+    highbd_smooth_h_predictor(dst, stride, W, H, above, left);                 \
+  }
+
+HIGHBD_INTRA_PRED_SSE4_1(4, 4)
+HIGHBD_INTRA_PRED_SSE4_1(4, 8)
+HIGHBD_INTRA_PRED_SSE4_1(8, 4)
+HIGHBD_INTRA_PRED_SSE4_1(8, 8)
+HIGHBD_INTRA_PRED_SSE4_1(8, 16)
+HIGHBD_INTRA_PRED_SSE4_1(16, 8)
+HIGHBD_INTRA_PRED_SSE4_1(16, 16)
+HIGHBD_INTRA_PRED_SSE4_1(16, 32)
+HIGHBD_INTRA_PRED_SSE4_1(32, 16)
+HIGHBD_INTRA_PRED_SSE4_1(32, 32)
+HIGHBD_INTRA_PRED_SSE4_1(32, 64)
+HIGHBD_INTRA_PRED_SSE4_1(64, 32)
+HIGHBD_INTRA_PRED_SSE4_1(64, 64)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_SSE4_1(4, 16)
+HIGHBD_INTRA_PRED_SSE4_1(16, 4)
+HIGHBD_INTRA_PRED_SSE4_1(8, 32)
+HIGHBD_INTRA_PRED_SSE4_1(32, 8)
+HIGHBD_INTRA_PRED_SSE4_1(16, 64)
+HIGHBD_INTRA_PRED_SSE4_1(64, 16)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+
+#undef HIGHBD_INTRA_PRED_SSE4_1
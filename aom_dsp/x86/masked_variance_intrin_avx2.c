@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_config.h"
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_filter.h"
+#include "aom_dsp/blend.h"
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+#include "aom_ports/mem.h"
+
+// The arithmetic matches masked_variance_intrin_ssse3.c exactly. Blocks
+// narrower than a register are processed several rows at a time: the
+// intermediate buffers are contiguous, so each 256-bit register holds two
+// 16-wide rows or four 8-wide rows. 4-wide blocks are left to the SSSE3
+// versions since compound prediction, and so masked motion search, needs both
+// dimensions to be at least 8.
+
+// Loads 32 pixels starting at p: one row for w >= 32, two rows for w == 16 and
+// four rows for w == 8. Passing a stride of 0 repeats the first row.
+static inline __m256i load_32_pixels(const uint8_t *p, int stride, int w) {
+  if (w >= 32) return yy_loadu_256(p);
+  if (w == 16) return yy_loadu2_128(p + stride, p);
+  return yy_loadu_4x64(p + 3 * stride, p + 2 * stride, p + stride, p);
+}
+
+static inline __m256i filter_block(const __m256i a, const __m256i b,
+                                   const __m256i filter) {
+  __m256i v0 = _mm256_unpacklo_epi8(a, b);
+  v0 = _mm256_maddubs_epi16(v0, filter);
+  v0 = yy_roundn_epu16(v0, FILTER_BITS);
+
+  __m256i v1 = _mm256_unpackhi_epi8(a, b);
+  v1 = _mm256_maddubs_epi16(v1, filter);
+  v1 = yy_roundn_epu16(v1, FILTER_BITS);
+
+  return _mm256_packus_epi16(v0, v1);
+}
+
+static inline __m256i hfilter_32(const uint8_t *src, int src_stride, int w,
+                                 int xoffset, const __m256i hfilter_vec) {
+  const __m256i x = load_32_pixels(src, src_stride, w);
+  if (xoffset == 0) return x;
+  const __m256i z = load_32_pixels(src + 1, src_stride, w);
+  if (xoffset == 4) return _mm256_avg_epu8(x, z);
+  return filter_block(x, z, hfilter_vec);
+}
+
+// For width a multiple of 8
+static void bilinear_filter(const uint8_t *src, int src_stride, int xoffset,
+                            int yoffset, uint8_t *dst, int w, int h) {
+  const int rows = w >= 32 ? 1 : 32 / w;
+  const uint8_t *hfilter = bilinear_filters_2t[xoffset];
+  const __m256i hfilter_vec =
+      _mm256_set1_epi16(hfilter[0] | (hfilter[1] << 8));
+  uint8_t *b = dst;
+  int i;
+
+  // Horizontal filter. This produces h + 1 rows; for the narrow widths, the
+  // last one is filtered on its own by repeating it across the register.
+  for (i = 0; i + rows <= h + 1; i += rows) {
+    for (int j = 0; j < w; j += 32) {
+      yy_storeu_256(&b[j], hfilter_32(&src[j], src_stride, w, xoffset,
+                                      hfilter_vec));
+    }
+    src += src_stride * rows;
+    b += w * rows;
+  }
+  if (i <= h) {
+    const __m256i res = hfilter_32(src, 0, w, xoffset, hfilter_vec);
+    if (w == 16) {
+      xx_storeu_128(b, _mm256_castsi256_si128(res));
+    } else {
+      xx_storel_64(b, _mm256_castsi256_si128(res));
+    }
+  }
+
+  // Vertical filter. Rows are stored contiguously, so row i + 1 is always w
+  // bytes past row i and the block can be processed as one flat run.
+  if (yoffset == 0) {
+    // The data is already in 'dst', so no need to filter
+  } else if (yoffset == 4) {
+    for (int k = 0; k < w * h; k += 32) {
+      const __m256i x = yy_loadu_256(&dst[k]);
+      const __m256i y = yy_loadu_256(&dst[k + w]);
+      yy_storeu_256(&dst[k], _mm256_avg_epu8(x, y));
+    }
+  } else {
+    const uint8_t *vfilter = bilinear_filters_2t[yoffset];
+    const __m256i vfilter_vec =
+        _mm256_set1_epi16(vfilter[0] | (vfilter[1] << 8));
+    for (int k = 0; k < w * h; k += 32) {
+      const __m256i x = yy_loadu_256(&dst[k]);
+      const __m256i y = yy_loadu_256(&dst[k + w]);
+      yy_storeu_256(&dst[k], filter_block(x, y, vfilter_vec));
+    }
+  }
+}
+
+static inline void accumulate_block(const __m256i src, const __m256i a,
+                                    const __m256i b, const __m256i m,
+                                    __m256i *sum, __m256i *sum_sq) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi16(1);
+  const __m256i mask_max = _mm256_set1_epi8((1 << AOM_BLEND_A64_ROUND_BITS));
+  const __m256i m_inv = _mm256_sub_epi8(mask_max, m);
+
+  // Calculate 32 predicted pixels.
+  // Note that the maximum value of any entry of 'pred_l' or 'pred_r'
+  // is 64 * 255, so we have plenty of space to add rounding constants.
+  const __m256i data_l = _mm256_unpacklo_epi8(a, b);
+  const __m256i mask_l = _mm256_unpacklo_epi8(m, m_inv);
+  __m256i pred_l = _mm256_maddubs_epi16(data_l, mask_l);
+  pred_l = yy_roundn_epu16(pred_l, AOM_BLEND_A64_ROUND_BITS);
+
+  const __m256i data_r = _mm256_unpackhi_epi8(a, b);
+  const __m256i mask_r = _mm256_unpackhi_epi8(m, m_inv);
+  __m256i pred_r = _mm256_maddubs_epi16(data_r, mask_r);
+  pred_r = yy_roundn_epu16(pred_r, AOM_BLEND_A64_ROUND_BITS);
+
+  const __m256i src_l = _mm256_unpacklo_epi8(src, zero);
+  const __m256i src_r = _mm256_unpackhi_epi8(src, zero);
+  const __m256i diff_l = _mm256_sub_epi16(pred_l, src_l);
+  const __m256i diff_r = _mm256_sub_epi16(pred_r, src_r);
+
+  // Update partial sums and partial sums of squares
+  *sum = _mm256_add_epi32(
+      *sum, _mm256_madd_epi16(_mm256_add_epi16(diff_l, diff_r), one));
+  *sum_sq = _mm256_add_epi32(
+      *sum_sq, _mm256_add_epi32(_mm256_madd_epi16(diff_l, diff_l),
+                                _mm256_madd_epi16(diff_r, diff_r)));
+}
+
+// For width a multiple of 8. 'a_ptr' and 'b_ptr' have a stride of 'width'.
+static void masked_variance(const uint8_t *src_ptr, int src_stride,
+                            const uint8_t *a_ptr, const uint8_t *b_ptr,
+                            const uint8_t *m_ptr, int m_stride, int width,
+                            int height, unsigned int *sse, int *sum_) {
+  const int rows = width >= 32 ? 1 : 32 / width;
+  __m256i sum = _mm256_setzero_si256(), sum_sq = _mm256_setzero_si256();
+
+  for (int y = 0; y < height; y += rows) {
+    for (int x = 0; x < width; x += 32) {
+      const __m256i src = load_32_pixels(&src_ptr[x], src_stride, width);
+      const __m256i a = yy_loadu_256(a_ptr);
+      const __m256i b = yy_loadu_256(b_ptr);
+      const __m256i m = load_32_pixels(&m_ptr[x], m_stride, width);
+      accumulate_block(src, a, b, m, &sum, &sum_sq);
+      a_ptr += 32;
+      b_ptr += 32;
+    }
+
+    src_ptr += src_stride * rows;
+    m_ptr += m_stride * rows;
+  }
+  // Reduce down to a single sum and sum of squares
+  sum = _mm256_hadd_epi32(sum, sum_sq);
+  __m128i res = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                              _mm256_extracti128_si256(sum, 1));
+  res = _mm_hadd_epi32(res, res);
+  *sum_ = _mm_cvtsi128_si32(res);
+  *sse = (unsigned int)_mm_cvtsi128_si32(_mm_srli_si128(res, 4));
+}
+
+#define MASK_SUBPIX_VAR_AVX2(W, H)                                          \
+  unsigned int aom_masked_sub_pixel_variance##W##x##H##_avx2(               \
+      const uint8_t *src, int src_stride, int xoffset, int yoffset,         \
+      const uint8_t *ref, int ref_stride, const uint8_t *second_pred,       \
+      const uint8_t *msk, int msk_stride, int invert_mask,                  \
+      unsigned int *sse) {                                                  \
+    int sum;                                                                \
+    uint8_t temp[(H + 1) * W];                                              \
+                                                                            \
+    bilinear_filter(src, src_stride, xoffset, yoffset, temp, W, H);         \
+                                                                            \
+    if (!invert_mask)                                                       \
+      masked_variance(ref, ref_stride, temp, second_pred, msk, msk_stride, \
+                      W, H, sse, &sum);                                     \
+    else                                                                    \
+      masked_variance(ref, ref_stride, second_pred, temp, msk, msk_stride, \
+                      W, H, sse, &sum);                                     \
+    return *sse - (uint32_t)(((int64_t)sum * sum) / (W * H));               \
+  }
+
+MASK_SUBPIX_VAR_AVX2(128, 128)
+MASK_SUBPIX_VAR_AVX2(128, 64)
+MASK_SUBPIX_VAR_AVX2(64, 128)
+MASK_SUBPIX_VAR_AVX2(64, 64)
+MASK_SUBPIX_VAR_AVX2(64, 32)
+MASK_SUBPIX_VAR_AVX2(32, 64)
+MASK_SUBPIX_VAR_AVX2(32, 32)
+MASK_SUBPIX_VAR_AVX2(32, 16)
+MASK_SUBPIX_VAR_AVX2(16, 32)
+MASK_SUBPIX_VAR_AVX2(16, 16)
+MASK_SUBPIX_VAR_AVX2(16, 8)
+MASK_SUBPIX_VAR_AVX2(8, 16)
+MASK_SUBPIX_VAR_AVX2(8, 8)
+MASK_SUBPIX_VAR_AVX2(8, 4)
+
+#if !CONFIG_REALTIME_ONLY
+MASK_SUBPIX_VAR_AVX2(16, 4)
+MASK_SUBPIX_VAR_AVX2(8, 32)
+MASK_SUBPIX_VAR_AVX2(32, 8)
+MASK_SUBPIX_VAR_AVX2(64, 16)
+MASK_SUBPIX_VAR_AVX2(16, 64)
+#endif  // !CONFIG_REALTIME_ONLY
+
+#if CONFIG_AV1_HIGHBITDEPTH
+// Loads 16 pixels starting at p: one row for w >= 16 and two rows for w == 8.
+// Passing a stride of 0 repeats the first row.
+static inline __m256i highbd_load_16_pixels(const uint16_t *p, int stride,
+                                            int w) {
+  if (w >= 16) return yy_loadu_256(p);
+  return yy_loadu2_128(p + stride, p);
+}
+
+// Loads the 16 mask values matching highbd_load_16_pixels(), widened to 16
+// bits.
+static inline __m256i highbd_load_16_mask(const uint8_t *m, int stride,
+                                          int w) {
+  if (w >= 16) return _mm256_cvtepu8_epi16(xx_loadu_128(m));
+  return _mm256_cvtepu8_epi16(xx_loadu_2x64(m + stride, m));
+}
+
+static inline __m256i highbd_filter_block(const __m256i a, const __m256i b,
+                                          const __m256i filter) {
+  const __m256i round_const = _mm256_set1_epi32((1 << FILTER_BITS) >> 1);
+  __m256i v0 = _mm256_unpacklo_epi16(a, b);
+  v0 = _mm256_madd_epi16(v0, filter);
+  v0 = _mm256_srli_epi32(_mm256_add_epi32(v0, round_const), FILTER_BITS);
+
+  __m256i v1 = _mm256_unpackhi_epi16(a, b);
+  v1 = _mm256_madd_epi16(v1, filter);
+  v1 = _mm256_srli_epi32(_mm256_add_epi32(v1, round_const), FILTER_BITS);
+
+  return _mm256_packs_epi32(v0, v1);
+}
+
+static inline __m256i highbd_hfilter_16(const uint16_t *src, int src_stride,
+                                        int w, int xoffset,
+                                        const __m256i hfilter_vec) {
+  const __m256i x = highbd_load_16_pixels(src, src_stride, w);
+  if (xoffset == 0) return x;
+  const __m256i z = highbd_load_16_pixels(src + 1, src_stride, w);
+  if (xoffset == 4) return _mm256_avg_epu16(x, z);
+  return highbd_filter_block(x, z, hfilter_vec);
+}
+
+// For width a multiple of 8
+static void highbd_bilinear_filter(const uint16_t *src, int src_stride,
+                                   int xoffset, int yoffset, uint16_t *dst,
+                                   int w, int h) {
+  const int rows = w >= 16 ? 1 : 2;
+  const uint8_t *hfilter = bilinear_filters_2t[xoffset];
+  const __m256i hfilter_vec =
+      _mm256_set1_epi32(hfilter[0] | (hfilter[1] << 16));
+  uint16_t *b = dst;
+  int i;
+
+  // Horizontal filter. This produces h + 1 rows; for w == 8, the last one is
+  // filtered on its own by repeating it across the register.
+  for (i = 0; i + rows <= h + 1; i += rows) {
+    for (int j = 0; j < w; j += 16) {
+      yy_storeu_256(&b[j], highbd_hfilter_16(&src[j], src_stride, w, xoffset,
+                                             hfilter_vec));
+    }
+    src += src_stride * rows;
+    b += w * rows;
+  }
+  if (i <= h) {
+    const __m256i res = highbd_hfilter_16(src, 0, w, xoffset, hfilter_vec);
+    xx_storeu_128(b, _mm256_castsi256_si128(res));
+  }
+
+  // Vertical filter. Rows are stored contiguously, so row i + 1 is always w
+  // pixels past row i and the block can be processed as one flat run.
+  if (yoffset == 0) {
+    // The data is already in 'dst', so no need to filter
+  } else if (yoffset == 4) {
+    for (int k = 0; k < w * h; k += 16) {
+      const __m256i x = yy_loadu_256(&dst[k]);
+      const __m256i y = yy_loadu_256(&dst[k + w]);
+      yy_storeu_256(&dst[k], _mm256_avg_epu16(x, y));
+    }
+  } else {
+    const uint8_t *vfilter = bilinear_filters_2t[yoffset];
+    const __m256i vfilter_vec =
+        _mm256_set1_epi32(vfilter[0] | (vfilter[1] << 16));
+    for (int k = 0; k < w * h; k += 16) {
+      const __m256i x = yy_loadu_256(&dst[k]);
+      const __m256i y = yy_loadu_256(&dst[k + w]);
+      yy_storeu_256(&dst[k], highbd_filter_block(x, y, vfilter_vec));
+    }
+  }
+}
+
+// For width a multiple of 8. 'a_ptr' and 'b_ptr' have a stride of 'width'.
+static void highbd_masked_variance(const uint16_t *src_ptr, int src_stride,
+                                   const uint16_t *a_ptr, const uint16_t *b_ptr,
+                                   const uint8_t *m_ptr, int m_stride,
+                                   int width, int height, uint64_t *sse,
+                                   int *sum_) {
+  const int rows = width >= 16 ? 1 : 2;
+  // Note on bit widths:
+  // The maximum value of 'sum' is (2^12 - 1) * 128 * 128 =~ 2^26,
+  // so this can be kept as eight 32-bit values.
+  // But the maximum value of 'sum_sq' is (2^12 - 1)^2 * 128 * 128 =~ 2^38,
+  // so this must be stored as four 64-bit values.
+  __m256i sum = _mm256_setzero_si256(), sum_sq = _mm256_setzero_si256();
+  const __m256i mask_max = _mm256_set1_epi16((1 << AOM_BLEND_A64_ROUND_BITS));
+  const __m256i round_const =
+      _mm256_set1_epi32((1 << AOM_BLEND_A64_ROUND_BITS) >> 1);
+  const __m256i zero = _mm256_setzero_si256();
+
+  for (int y = 0; y < height; y += rows) {
+    for (int x = 0; x < width; x += 16) {
+      const __m256i src = highbd_load_16_pixels(&src_ptr[x], src_stride, width);
+      const __m256i a = yy_loadu_256(a_ptr);
+      const __m256i b = yy_loadu_256(b_ptr);
+      const __m256i m = highbd_load_16_mask(&m_ptr[x], m_stride, width);
+      const __m256i m_inv = _mm256_sub_epi16(mask_max, m);
+
+      // Calculate 16 predicted pixels.
+      const __m256i data_l = _mm256_unpacklo_epi16(a, b);
+      const __m256i mask_l = _mm256_unpacklo_epi16(m, m_inv);
+      __m256i pred_l = _mm256_madd_epi16(data_l, mask_l);
+      pred_l = _mm256_srai_epi32(_mm256_add_epi32(pred_l, round_const),
+                                 AOM_BLEND_A64_ROUND_BITS);
+
+      const __m256i data_r = _mm256_unpackhi_epi16(a, b);
+      const __m256i mask_r = _mm256_unpackhi_epi16(m, m_inv);
+      __m256i pred_r = _mm256_madd_epi16(data_r, mask_r);
+      pred_r = _mm256_srai_epi32(_mm256_add_epi32(pred_r, round_const),
+                                 AOM_BLEND_A64_ROUND_BITS);
+
+      const __m256i src_l = _mm256_unpacklo_epi16(src, zero);
+      const __m256i src_r = _mm256_unpackhi_epi16(src, zero);
+      const __m256i diff_l = _mm256_sub_epi32(pred_l, src_l);
+      const __m256i diff_r = _mm256_sub_epi32(pred_r, src_r);
+
+      // Update partial sums and partial sums of squares
+      sum = _mm256_add_epi32(sum, _mm256_add_epi32(diff_l, diff_r));
+      // The differences fit in 16 bits, so re-pack them and use madd to
+      // square and pairwise add them. Each result is non-negative and below
+      // 2^31, so it can be zero-extended to 64 bits.
+      const __m256i tmp = _mm256_packs_epi32(diff_l, diff_r);
+      const __m256i prod = _mm256_madd_epi16(tmp, tmp);
+      sum_sq = _mm256_add_epi64(
+          sum_sq, _mm256_add_epi64(_mm256_unpacklo_epi32(prod, zero),
+                                   _mm256_unpackhi_epi32(prod, zero)));
+      a_ptr += 16;
+      b_ptr += 16;
+    }
+
+    src_ptr += src_stride * rows;
+    m_ptr += m_stride * rows;
+  }
+  // Reduce down to a single sum and sum of squares
+  __m128i sum_128 = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                                  _mm256_extracti128_si256(sum, 1));
+  sum_128 = _mm_hadd_epi32(sum_128, sum_128);
+  sum_128 = _mm_hadd_epi32(sum_128, sum_128);
+  *sum_ = _mm_cvtsi128_si32(sum_128);
+  __m128i sum_sq_128 = _mm_add_epi64(_mm256_castsi256_si128(sum_sq),
+                                     _mm256_extracti128_si256(sum_sq, 1));
+  sum_sq_128 = _mm_add_epi64(sum_sq_128, _mm_srli_si128(sum_sq_128, 8));
+  xx_storel_64(sse, sum_sq_128);
+}
+
+#define HIGHBD_MASK_SUBPIX_VAR_AVX2(W, H)                                   \
+  unsigned int aom_highbd_8_masked_sub_pixel_variance##W##x##H##_avx2(      \
+      const uint8_t *src8, int src_stride, int xoffset, int yoffset,        \
+      const uint8_t *ref8, int ref_stride, const uint8_t *second_pred8,     \
+      const uint8_t *msk, int msk_stride, int invert_mask, uint32_t *sse) { \
+    uint64_t sse64;                                                         \
+    int sum;                                                                \
+    uint16_t temp[(H + 1) * W];                                             \
+    const uint16_t *src = CONVERT_TO_SHORTPTR(src8);                        \
+    const uint16_t *ref = CONVERT_TO_SHORTPTR(ref8);                        \
+    const uint16_t *second_pred = CONVERT_TO_SHORTPTR(second_pred8);        \
+                                                                            \
+    highbd_bilinear_filter(src, src_stride, xoffset, yoffset, temp, W, H);  \
+                                                                            \
+    if (!invert_mask)                                                       \
+      highbd_masked_variance(ref, ref_stride, temp, second_pred, msk,       \
+                             msk_stride, W, H, &sse64, &sum);               \
+    else                                                                    \
+      highbd_masked_variance(ref, ref_stride, second_pred, temp, msk,       \
+                             msk_stride, W, H, &sse64, &sum);               \
+    *sse = (uint32_t)sse64;                                                 \
+    return *sse - (uint32_t)(((int64_t)sum * sum) / (W * H));               \
+  }                                                                         \
+  unsigned int aom_highbd_10_masked_sub_pixel_variance##W##x##H##_avx2(     \
+      const uint8_t *src8, int src_stride, int xoffset, int yoffset,        \
+      const uint8_t *ref8, int ref_stride, const uint8_t *second_pred8,     \
+      const uint8_t *msk, int msk_stride, int invert_mask, uint32_t *sse) { \
+    uint64_t sse64;                                                         \
+    int sum;                                                                \
+    int64_t var;                                                            \
+    uint16_t temp[(H + 1) * W];                                             \
+    const uint16_t *src = CONVERT_TO_SHORTPTR(src8);                        \
+    const uint16_t *ref = CONVERT_TO_SHORTPTR(ref8);                        \
+    const uint16_t *second_pred = CONVERT_TO_SHORTPTR(second_pred8);        \
+                                                                            \
+    highbd_bilinear_filter(src, src_stride, xoffset, yoffset, temp, W, H);  \
+                                                                            \
+    if (!invert_mask)                                                       \
+      highbd_masked_variance(ref, ref_stride, temp, second_pred, msk,       \
+                             msk_stride, W, H, &sse64, &sum);               \
+    else                                                                    \
+      highbd_masked_variance(ref, ref_stride, second_pred, temp, msk,       \
+                             msk_stride, W, H, &sse64, &sum);               \
+    *sse = (uint32_t)ROUND_POWER_OF_TWO(sse64, 4);                          \
+    sum = ROUND_POWER_OF_TWO(sum, 2);                                       \
+    var = (int64_t)(*sse) - (((int64_t)sum * sum) / (W * H));               \
+    return (var >= 0) ? (uint32_t)var : 0;                                  \
+  }                                                                         \
+  unsigned int aom_highbd_12_masked_sub_pixel_variance##W##x##H##_avx2(     \
+      const uint8_t *src8, int src_stride, int xoffset, int yoffset,        \
+      const uint8_t *ref8, int ref_stride, const uint8_t *second_pred8,     \
+      const uint8_t *msk, int msk_stride, int invert_mask, uint32_t *sse) { \
+    uint64_t sse64;                                                         \
+    int sum;                                                                \
+    int64_t var;                                                            \
+    uint16_t temp[(H + 1) * W];                                             \
+    const uint16_t *src = CONVERT_TO_SHORTPTR(src8);                        \
+    const uint16_t *ref = CONVERT_TO_SHORTPTR(ref8);                        \
+    const uint16_t *second_pred = CONVERT_TO_SHORTPTR(second_pred8);        \
+                                                                            \
+    highbd_bilinear_filter(src, src_stride, xoffset, yoffset, temp, W, H);  \
+                                                                            \
+    if (!invert_mask)                                                       \
+      highbd_masked_variance(ref, ref_stride, temp, second_pred, msk,       \
+                             msk_stride, W, H, &sse64, &sum);               \
+    else                                                                    \
+      highbd_masked_variance(ref, ref_stride, second_pred, temp, msk,       \
+                             msk_stride, W, H, &sse64, &sum);               \
+    *sse = (uint32_t)ROUND_POWER_OF_TWO(sse64, 8);                          \
+    sum = ROUND_POWER_OF_TWO(sum, 4);                                       \
+    var = (int64_t)(*sse) - (((int64_t)sum * sum) / (W * H));               \
+    return (var >= 0) ? (uint32_t)var : 0;                                  \
+  }
+
+HIGHBD_MASK_SUBPIX_VAR_AVX2(128, 128)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(128, 64)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(64, 128)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(64, 64)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(64, 32)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(32, 64)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(32, 32)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(32, 16)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(16, 32)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(16, 16)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(16, 8)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(8, 16)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(8, 8)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(8, 4)
+
+#if !CONFIG_REALTIME_ONLY
+HIGHBD_MASK_SUBPIX_VAR_AVX2(16, 4)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(8, 32)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(32, 8)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(16, 64)
+HIGHBD_MASK_SUBPIX_VAR_AVX2(64, 16)
+#endif  // !CONFIG_REALTIME_ONLY
+#endif  // CONFIG_AV1_HIGHBITDEPTH
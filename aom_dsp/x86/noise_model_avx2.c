@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_dsp_rtcd.h"
+
+// Adds the 4 lanes in the order (0 + 2) + (1 + 3), matching the C version.
+static inline double hadd_pd(__m256d v) {
+  const __m128d sum2 = _mm_add_pd(_mm256_castpd256_pd128(v),
+                                  _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(sum2, _mm_unpackhi_pd(sum2, sum2)));
+}
+
+void aom_flat_block_gradient_stats_avx2(const double *block, int block_size,
+                                        double *stats) {
+  const __m256d half = _mm256_set1_pd(0.5);
+  const int end = block_size - 1;
+  __m256d gxx = _mm256_setzero_pd();
+  __m256d gxy = _mm256_setzero_pd();
+  __m256d gyy = _mm256_setzero_pd();
+  __m256d sum = _mm256_setzero_pd();
+  __m256d sum_sq = _mm256_setzero_pd();
+
+  // Lane i accumulates the columns xi with (xi - 1) % 4 == i. The lanes past
+  // the last interior column of a row are masked to zero, which leaves the
+  // sums unchanged.
+  for (int yi = 1; yi < end; ++yi) {
+    const double *const row = block + yi * block_size;
+    for (int xi = 1; xi < end; xi += 4) {
+      __m256d left, right, above, below, center;
+      if (xi + 4 <= end) {
+        left = _mm256_loadu_pd(row + xi - 1);
+        right = _mm256_loadu_pd(row + xi + 1);
+        above = _mm256_loadu_pd(row + xi - block_size);
+        below = _mm256_loadu_pd(row + xi + block_size);
+        center = _mm256_loadu_pd(row + xi);
+      } else {
+        const __m256i mask = _mm256_cmpgt_epi64(
+            _mm256_set1_epi64x(end - xi), _mm256_setr_epi64x(0, 1, 2, 3));
+        left = _mm256_maskload_pd(row + xi - 1, mask);
+        right = _mm256_maskload_pd(row + xi + 1, mask);
+        above = _mm256_maskload_pd(row + xi - block_size, mask);
+        below = _mm256_maskload_pd(row + xi + block_size, mask);
+        center = _mm256_maskload_pd(row + xi, mask);
+      }
+      const __m256d gx = _mm256_mul_pd(_mm256_sub_pd(right, left), half);
+      const __m256d gy = _mm256_mul_pd(_mm256_sub_pd(below, above), half);
+      gxx = _mm256_add_pd(gxx, _mm256_mul_pd(gx, gx));
+      gxy = _mm256_add_pd(gxy, _mm256_mul_pd(gx, gy));
+      gyy = _mm256_add_pd(gyy, _mm256_mul_pd(gy, gy));
+      sum = _mm256_add_pd(sum, center);
+      sum_sq = _mm256_add_pd(sum_sq, _mm256_mul_pd(center, center));
+    }
+  }
+
+  stats[0] = hadd_pd(gxx);
+  stats[1] = hadd_pd(gxy);
+  stats[2] = hadd_pd(gyy);
+  stats[3] = hadd_pd(sum);
+  stats[4] = hadd_pd(sum_sq);
+}
+
+void aom_noise_eqns_add_outer_product_avx2(double *A, double *b,
+                                           const double *x, double y, int n) {
+  for (int i = 0; i < n; ++i) {
+    const __m256d xi = _mm256_set1_pd(x[i]);
+    double *const row = A + i * n;
+    int j = i;
+    for (; j + 4 <= n; j += 4) {
+      const __m256d xi_xj = _mm256_mul_pd(xi, _mm256_loadu_pd(x + j));
+      _mm256_storeu_pd(row + j, _mm256_add_pd(_mm256_loadu_pd(row + j), xi_xj));
+    }
+    for (; j < n; ++j) row[j] += x[i] * x[j];
+  }
+
+  const __m256d yv = _mm256_set1_pd(y);
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const __m256d xi_y = _mm256_mul_pd(_mm256_loadu_pd(x + i), yv);
+    _mm256_storeu_pd(b + i, _mm256_add_pd(_mm256_loadu_pd(b + i), xi_y));
+  }
+  for (; i < n; ++i) b[i] += x[i] * y;
+}
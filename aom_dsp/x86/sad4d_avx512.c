@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+#include <immintrin.h>  // AVX512
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/x86/synonyms_avx512.h"
+
+static AOM_FORCE_INLINE void aggregate_and_store_sum(uint32_t res[4],
+                                                     const __m512i sum_ref0,
+                                                     const __m512i sum_ref1,
+                                                     const __m512i sum_ref2,
+                                                     const __m512i sum_ref3) {
+  // Each 64-bit lane holds a partial sum in its low 32 bits. Fold every
+  // register down to 256 bits first, then proceed as in sad4d_avx2.c.
+  const __m256i sum0 = zz_fold_epi32(sum_ref0);
+  const __m256i sum1 = zz_fold_epi32(sum_ref1);
+  const __m256i sum2 = zz_fold_epi32(sum_ref2);
+  const __m256i sum3 = zz_fold_epi32(sum_ref3);
+  // 0, 0, 1, 1
+  const __m256i sum01 = _mm256_castps_si256(
+      _mm256_shuffle_ps(_mm256_castsi256_ps(sum0), _mm256_castsi256_ps(sum1),
+                        _MM_SHUFFLE(2, 0, 2, 0)));
+  // 2, 2, 3, 3
+  const __m256i sum23 = _mm256_castps_si256(
+      _mm256_shuffle_ps(_mm256_castsi256_ps(sum2), _mm256_castsi256_ps(sum3),
+                        _MM_SHUFFLE(2, 0, 2, 0)));
+  const __m256i sum0123 = _mm256_hadd_epi32(sum01, sum23);
+  const __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(sum0123),
+                                    _mm256_extracti128_si256(sum0123, 1));
+  _mm_storeu_si128((__m128i *)res, sum);
+}
+
+// Blocks 64 pixels wide or wider: one register per 64 pixels of a row.
+static AOM_FORCE_INLINE void aom_sadMxNx4d_avx512(
+    int M, int N, const uint8_t *src, int src_stride,
+    const uint8_t *const ref[4], int ref_stride, uint32_t res[4]) {
+  __m512i sum_ref0 = _mm512_setzero_si512();
+  __m512i sum_ref1 = _mm512_setzero_si512();
+  __m512i sum_ref2 = _mm512_setzero_si512();
+  __m512i sum_ref3 = _mm512_setzero_si512();
+  const uint8_t *ref0 = ref[0];
+  const uint8_t *ref1 = ref[1];
+  const uint8_t *ref2 = ref[2];
+  const uint8_t *ref3 = ref[3];
+
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < M; j += 64) {
+      const __m512i src_reg = zz_loadu_512(src + j);
+      sum_ref0 = _mm512_add_epi32(
+          sum_ref0, _mm512_sad_epu8(zz_loadu_512(ref0 + j), src_reg));
+      sum_ref1 = _mm512_add_epi32(
+          sum_ref1, _mm512_sad_epu8(zz_loadu_512(ref1 + j), src_reg));
+      sum_ref2 = _mm512_add_epi32(
+          sum_ref2, _mm512_sad_epu8(zz_loadu_512(ref2 + j), src_reg));
+      sum_ref3 = _mm512_add_epi32(
+          sum_ref3, _mm512_sad_epu8(zz_loadu_512(ref3 + j), src_reg));
+    }
+    src += src_stride;
+    ref0 += ref_stride;
+    ref1 += ref_stride;
+    ref2 += ref_stride;
+    ref3 += ref_stride;
+  }
+
+  aggregate_and_store_sum(res, sum_ref0, sum_ref1, sum_ref2, sum_ref3);
+}
+
+// 32-pixel-wide blocks: two rows per register.
+static AOM_FORCE_INLINE void aom_sad32xNx4d_avx512(
+    int N, const uint8_t *src, int src_stride, const uint8_t *const ref[4],
+    int ref_stride, uint32_t res[4]) {
+  __m512i sum_ref0 = _mm512_setzero_si512();
+  __m512i sum_ref1 = _mm512_setzero_si512();
+  __m512i sum_ref2 = _mm512_setzero_si512();
+  __m512i sum_ref3 = _mm512_setzero_si512();
+  const uint8_t *ref0 = ref[0];
+  const uint8_t *ref1 = ref[1];
+  const uint8_t *ref2 = ref[2];
+  const uint8_t *ref3 = ref[3];
+
+  for (int i = 0; i < N; i += 2) {
+    const __m512i src_reg = zz_loadu2_256(src + src_stride, src);
+    sum_ref0 = _mm512_add_epi32(
+        sum_ref0,
+        _mm512_sad_epu8(zz_loadu2_256(ref0 + ref_stride, ref0), src_reg));
+    sum_ref1 = _mm512_add_epi32(
+        sum_ref1,
+        _mm512_sad_epu8(zz_loadu2_256(ref1 + ref_stride, ref1), src_reg));
+    sum_ref2 = _mm512_add_epi32(
+        sum_ref2,
+        _mm512_sad_epu8(zz_loadu2_256(ref2 + ref_stride, ref2), src_reg));
+    sum_ref3 = _mm512_add_epi32(
+        sum_ref3,
+        _mm512_sad_epu8(zz_loadu2_256(ref3 + ref_stride, ref3), src_reg));
+    src += 2 * src_stride;
+    ref0 += 2 * ref_stride;
+    ref1 += 2 * ref_stride;
+    ref2 += 2 * ref_stride;
+    ref3 += 2 * ref_stride;
+  }
+
+  aggregate_and_store_sum(res, sum_ref0, sum_ref1, sum_ref2, sum_ref3);
+}
+
+#define SAD32XN_AVX512(n)                                                     \
+  void aom_sad32x##n##x4d_avx512(const uint8_t *src, int src_stride,          \
+                                 const uint8_t *const ref[4], int ref_stride, \
+                                 uint32_t res[4]) {                           \
+    aom_sad32xNx4d_avx512(n, src, src_stride, ref, ref_stride, res);          \
+  }
+
+#define SADMXN_AVX512(m, n)                                                    \
+  void aom_sad##m##x##n##x4d_avx512(const uint8_t *src, int src_stride,        \
+                                    const uint8_t *const ref[4],               \
+                                    int ref_stride, uint32_t res[4]) {         \
+    aom_sadMxNx4d_avx512(m, n, src, src_stride, ref, ref_stride, res);         \
+  }
+
+SAD32XN_AVX512(16)
+SAD32XN_AVX512(32)
+SAD32XN_AVX512(64)
+
+SADMXN_AVX512(64, 32)
+SADMXN_AVX512(64, 64)
+SADMXN_AVX512(64, 128)
+
+SADMXN_AVX512(128, 64)
+SADMXN_AVX512(128, 128)
+
+#if !CONFIG_REALTIME_ONLY
+SAD32XN_AVX512(8)
+SADMXN_AVX512(64, 16)
+#endif  // !CONFIG_REALTIME_ONLY
+
+#define SAD_SKIP_32XN_AVX512(n)                                              \
+  void aom_sad_skip_32x##n##x4d_avx512(const uint8_t *src, int src_stride,   \
+                                       const uint8_t *const ref[4],          \
+                                       int ref_stride, uint32_t res[4]) {    \
+    aom_sad32xNx4d_avx512(((n) >> 1), src, 2 * src_stride, ref,              \
+                          2 * ref_stride, res);                              \
+    res[0] <<= 1;                                                            \
+    res[1] <<= 1;                                                            \
+    res[2] <<= 1;                                                            \
+    res[3] <<= 1;                                                            \
+  }
+
+#define SAD_SKIP_MXN_AVX512(m, n)                                             \
+  void aom_sad_skip_##m##x##n##x4d_avx512(const uint8_t *src, int src_stride, \
+                                          const uint8_t *const ref[4],        \
+                                          int ref_stride, uint32_t res[4]) {  \
+    aom_sadMxNx4d_avx512(m, ((n) >> 1), src, 2 * src_stride, ref,             \
+                         2 * ref_stride, res);                                \
+    res[0] <<= 1;                                                             \
+    res[1] <<= 1;                                                             \
+    res[2] <<= 1;                                                             \
+    res[3] <<= 1;                                                             \
+  }
+
+SAD_SKIP_32XN_AVX512(16)
+SAD_SKIP_32XN_AVX512(32)
+SAD_SKIP_32XN_AVX512(64)
+
+SAD_SKIP_MXN_AVX512(64, 32)
+SAD_SKIP_MXN_AVX512(64, 64)
+SAD_SKIP_MXN_AVX512(64, 128)
+
+SAD_SKIP_MXN_AVX512(128, 64)
+SAD_SKIP_MXN_AVX512(128, 128)
+
+#if !CONFIG_REALTIME_ONLY
+SAD_SKIP_MXN_AVX512(64, 16)
+#endif  // !CONFIG_REALTIME_ONLY
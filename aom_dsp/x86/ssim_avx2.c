@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_config.h"
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+// Reduces the 32-bit lanes of the five accumulators and adds the totals to the
+// output sums.
+static inline void accumulate_ssim_parms(__m256i s, __m256i r, __m256i ss,
+                                         __m256i rr, __m256i sr,
+                                         uint32_t *sum_s, uint32_t *sum_r,
+                                         uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                                         uint32_t *sum_sxr) {
+  const __m256i s_r = _mm256_hadd_epi32(s, r);
+  const __m256i ss_rr = _mm256_hadd_epi32(ss, rr);
+  const __m256i sums = _mm256_hadd_epi32(s_r, ss_rr);
+  const __m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(sums),
+                                     _mm256_extracti128_si256(sums, 1));
+  const __m128i sr4 = _mm_add_epi32(_mm256_castsi256_si128(sr),
+                                    _mm256_extracti128_si256(sr, 1));
+  const __m128i sr2 = _mm_add_epi32(sr4, _mm_srli_si128(sr4, 8));
+  *sum_s += (uint32_t)_mm_cvtsi128_si32(sum4);
+  *sum_r += (uint32_t)_mm_extract_epi32(sum4, 1);
+  *sum_sq_s += (uint32_t)_mm_extract_epi32(sum4, 2);
+  *sum_sq_r += (uint32_t)_mm_extract_epi32(sum4, 3);
+  *sum_sxr +=
+      (uint32_t)_mm_cvtsi128_si32(_mm_add_epi32(sr2, _mm_srli_si128(sr2, 4)));
+}
+
+void aom_ssim_parms_8x8_avx2(const uint8_t *s, int sp, const uint8_t *r,
+                             int rp, uint32_t *sum_s, uint32_t *sum_r,
+                             uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                             uint32_t *sum_sxr) {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i s_sum = _mm256_setzero_si256();
+  __m256i r_sum = _mm256_setzero_si256();
+  __m256i ss_sum = _mm256_setzero_si256();
+  __m256i rr_sum = _mm256_setzero_si256();
+  __m256i sr_sum = _mm256_setzero_si256();
+
+  // Each iteration handles 4 rows of 8 pixels. The plain sums come from SAD
+  // against zero, whose 64-bit lane totals read as 32-bit lanes with zeros in
+  // between. The products are formed on pixels widened to 16 bits.
+  for (int i = 0; i < 8; i += 4) {
+    const __m256i s8 = yy_loadu_4x64(s + 3 * sp, s + 2 * sp, s + sp, s);
+    const __m256i r8 = yy_loadu_4x64(r + 3 * rp, r + 2 * rp, r + rp, r);
+    const __m256i s_lo = _mm256_unpacklo_epi8(s8, zero);
+    const __m256i s_hi = _mm256_unpackhi_epi8(s8, zero);
+    const __m256i r_lo = _mm256_unpacklo_epi8(r8, zero);
+    const __m256i r_hi = _mm256_unpackhi_epi8(r8, zero);
+
+    s_sum = _mm256_add_epi32(s_sum, _mm256_sad_epu8(s8, zero));
+    r_sum = _mm256_add_epi32(r_sum, _mm256_sad_epu8(r8, zero));
+    ss_sum = _mm256_add_epi32(ss_sum, _mm256_madd_epi16(s_lo, s_lo));
+    ss_sum = _mm256_add_epi32(ss_sum, _mm256_madd_epi16(s_hi, s_hi));
+    rr_sum = _mm256_add_epi32(rr_sum, _mm256_madd_epi16(r_lo, r_lo));
+    rr_sum = _mm256_add_epi32(rr_sum, _mm256_madd_epi16(r_hi, r_hi));
+    sr_sum = _mm256_add_epi32(sr_sum, _mm256_madd_epi16(s_lo, r_lo));
+    sr_sum = _mm256_add_epi32(sr_sum, _mm256_madd_epi16(s_hi, r_hi));
+
+    s += 4 * sp;
+    r += 4 * rp;
+  }
+
+  accumulate_ssim_parms(s_sum, r_sum, ss_sum, rr_sum, sr_sum, sum_s, sum_r,
+                        sum_sq_s, sum_sq_r, sum_sxr);
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+void aom_highbd_ssim_parms_8x8_avx2(const uint16_t *s, int sp,
+                                    const uint16_t *r, int rp, uint32_t *sum_s,
+                                    uint32_t *sum_r, uint32_t *sum_sq_s,
+                                    uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+  const __m256i one = _mm256_set1_epi16(1);
+  __m256i s_sum = _mm256_setzero_si256();
+  __m256i r_sum = _mm256_setzero_si256();
+  __m256i ss_sum = _mm256_setzero_si256();
+  __m256i rr_sum = _mm256_setzero_si256();
+  __m256i sr_sum = _mm256_setzero_si256();
+
+  // Samples are at most 12 bits, so the pairwise products of _mm256_madd_epi16
+  // and the 64-sample totals fit in 32 bits.
+  for (int i = 0; i < 8; i += 2) {
+    const __m256i s16 = yy_loadu2_128(s + sp, s);
+    const __m256i r16 = yy_loadu2_128(r + rp, r);
+
+    s_sum = _mm256_add_epi32(s_sum, _mm256_madd_epi16(s16, one));
+    r_sum = _mm256_add_epi32(r_sum, _mm256_madd_epi16(r16, one));
+    ss_sum = _mm256_add_epi32(ss_sum, _mm256_madd_epi16(s16, s16));
+    rr_sum = _mm256_add_epi32(rr_sum, _mm256_madd_epi16(r16, r16));
+    sr_sum = _mm256_add_epi32(sr_sum, _mm256_madd_epi16(s16, r16));
+
+    s += 2 * sp;
+    r += 2 * rp;
+  }
+
+  accumulate_ssim_parms(s_sum, r_sum, ss_sum, rr_sum, sr_sum, sum_s, sum_r,
+                        sum_sq_s, sum_sq_r, sum_sxr);
+}
+#endif  // CONFIG_AV1_HIGHBITDEPTH
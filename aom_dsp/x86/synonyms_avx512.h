@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AOM_DSP_X86_SYNONYMS_AVX512_H_
+#define AOM_AOM_DSP_X86_SYNONYMS_AVX512_H_
+
+#include <immintrin.h>
+
+#include "config/aom_config.h"
+
+#include "aom/aom_integer.h"
+
+/**
+ * Various reusable shorthands for x86 SIMD intrinsics.
+ *
+ * Intrinsics prefixed with zz_ operate on or return 512bit ZMM registers.
+ */
+
+// Loads and stores to do away with the tedium of casting the address
+// to the right type.
+static inline __m512i zz_loadu_512(const void *a) {
+  return _mm512_loadu_si512(a);
+}
+
+static inline void zz_storeu_512(void *const a, const __m512i v) {
+  _mm512_storeu_si512(a, v);
+}
+
+// Loads two 256-bit rows into the low and high halves of a register.
+static inline __m512i zz_loadu2_256(const void *hi, const void *lo) {
+  const __m256i lo_v = _mm256_loadu_si256((const __m256i *)lo);
+  const __m256i hi_v = _mm256_loadu_si256((const __m256i *)hi);
+  return _mm512_inserti64x4(_mm512_castsi256_si512(lo_v), hi_v, 1);
+}
+
+// Adds the high 256 bits of v to its low 256 bits.
+static inline __m256i zz_fold_epi32(const __m512i v) {
+  return _mm256_add_epi32(_mm512_castsi512_si256(v),
+                          _mm512_extracti64x4_epi64(v, 1));
+}
+
+static inline __m256i zz_fold_epi64(const __m512i v) {
+  return _mm256_add_epi64(_mm512_castsi512_si256(v),
+                          _mm512_extracti64x4_epi64(v, 1));
+}
+
+// Horizontal sums of all lanes. These avoid _mm512_reduce_add_*(), which not
+// every supported compiler provides.
+static inline int32_t zz_hsum_epi32(const __m512i v) {
+  const __m256i v256 = zz_fold_epi32(v);
+  __m128i v128 = _mm_add_epi32(_mm256_castsi256_si128(v256),
+                               _mm256_extracti128_si256(v256, 1));
+  v128 = _mm_add_epi32(v128, _mm_srli_si128(v128, 8));
+  v128 = _mm_add_epi32(v128, _mm_srli_si128(v128, 4));
+  return _mm_cvtsi128_si32(v128);
+}
+
+static inline int64_t zz_hsum_epi64(const __m512i v) {
+  const __m256i v256 = zz_fold_epi64(v);
+  __m128i v128 = _mm_add_epi64(_mm256_castsi256_si128(v256),
+                               _mm256_extracti128_si256(v256, 1));
+  v128 = _mm_add_epi64(v128, _mm_srli_si128(v128, 8));
+#if AOM_ARCH_X86_64
+  return _mm_cvtsi128_si64(v128);
+#else
+  int64_t res;
+  _mm_storel_epi64((__m128i *)&res, v128);
+  return res;
+#endif
+}
+
+#endif  // AOM_AOM_DSP_X86_SYNONYMS_AVX512_H_
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/aom_filter.h"
+#include "aom_dsp/x86/synonyms_avx512.h"
+#include "aom_ports/mem.h"
+
+static inline void variance_kernel_avx512(const __m512i src, const __m512i ref,
+                                          __m512i *const sse,
+                                          __m512i *const sum) {
+  const __m512i adj_sub = _mm512_set1_epi16((short)0xff01);  // (1,-1)
+  const __m512i one = _mm512_set1_epi16(1);
+
+  // unpack into pairs of source and reference values
+  const __m512i src_ref0 = _mm512_unpacklo_epi8(src, ref);
+  const __m512i src_ref1 = _mm512_unpackhi_epi8(src, ref);
+
+  // subtract adjacent elements using src*1 + ref*-1
+  const __m512i diff0 = _mm512_maddubs_epi16(src_ref0, adj_sub);
+  const __m512i diff1 = _mm512_maddubs_epi16(src_ref1, adj_sub);
+
+  *sse = _mm512_add_epi32(*sse, _mm512_madd_epi16(diff0, diff0));
+  *sse = _mm512_add_epi32(*sse, _mm512_madd_epi16(diff1, diff1));
+  *sum = _mm512_add_epi32(*sum, _mm512_madd_epi16(diff0, one));
+  *sum = _mm512_add_epi32(*sum, _mm512_madd_epi16(diff1, one));
+}
+
+static inline void variance32_avx512(const uint8_t *src, int src_stride,
+                                     const uint8_t *ref, int ref_stride, int h,
+                                     uint32_t *sse, int *sum) {
+  __m512i vsse = _mm512_setzero_si512();
+  __m512i vsum = _mm512_setzero_si512();
+  for (int i = 0; i < h; i += 2) {
+    const __m512i s = zz_loadu2_256(src + src_stride, src);
+    const __m512i r = zz_loadu2_256(ref + ref_stride, ref);
+    variance_kernel_avx512(s, r, &vsse, &vsum);
+    src += 2 * src_stride;
+    ref += 2 * ref_stride;
+  }
+  *sse = (uint32_t)zz_hsum_epi32(vsse);
+  *sum = zz_hsum_epi32(vsum);
+}
+
+static inline void variance64xn_avx512(const uint8_t *src, int src_stride,
+                                       const uint8_t *ref, int ref_stride,
+                                       int w, int h, uint32_t *sse,
+                                       int *sum) {
+  __m512i vsse = _mm512_setzero_si512();
+  __m512i vsum = _mm512_setzero_si512();
+  for (int i = 0; i < h; ++i) {
+    for (int j = 0; j < w; j += 64) {
+      const __m512i s = zz_loadu_512(src + j);
+      const __m512i r = zz_loadu_512(ref + j);
+      variance_kernel_avx512(s, r, &vsse, &vsum);
+    }
+    src += src_stride;
+    ref += ref_stride;
+  }
+  *sse = (uint32_t)zz_hsum_epi32(vsse);
+  *sum = zz_hsum_epi32(vsum);
+}
+
+#define AOM_VAR_32XN_AVX512(bh)                                           \
+  unsigned int aom_variance32x##bh##_avx512(                              \
+      const uint8_t *src, int src_stride, const uint8_t *ref,             \
+      int ref_stride, unsigned int *sse) {                                \
+    int sum;                                                              \
+    variance32_avx512(src, src_stride, ref, ref_stride, bh, sse, &sum);   \
+    return *sse - (uint32_t)(((int64_t)sum * sum) / (32 * bh));           \
+  }
+
+#define AOM_VAR_AVX512(bw, bh)                                                \
+  unsigned int aom_variance##bw##x##bh##_avx512(                              \
+      const uint8_t *src, int src_stride, const uint8_t *ref,                 \
+      int ref_stride, unsigned int *sse) {                                    \
+    int sum;                                                                  \
+    variance64xn_avx512(src, src_stride, ref, ref_stride, bw, bh, sse, &sum); \
+    return *sse - (uint32_t)(((int64_t)sum * sum) / (bw * bh));               \
+  }
+
+AOM_VAR_32XN_AVX512(16)
+AOM_VAR_32XN_AVX512(32)
+AOM_VAR_32XN_AVX512(64)
+AOM_VAR_AVX512(64, 32)
+AOM_VAR_AVX512(64, 64)
+AOM_VAR_AVX512(64, 128)
+AOM_VAR_AVX512(128, 64)
+AOM_VAR_AVX512(128, 128)
+
+#if !CONFIG_REALTIME_ONLY
+AOM_VAR_32XN_AVX512(8)
+AOM_VAR_AVX512(64, 16)
+#endif  // !CONFIG_REALTIME_ONLY
+
+// Applies the 2-tap bilinear filter to 64 pixel pairs (a[i], b[i]). This
+// matches ROUND_POWER_OF_TWO(a * filter[0] + b * filter[1], FILTER_BITS)
+// exactly: the taps sum to 128, so the products fit in 16 bits and the result
+// in 8 bits.
+static inline __m512i bil_filter_64_avx512(const __m512i a, const __m512i b,
+                                           const __m512i filter) {
+  const __m512i round = _mm512_set1_epi16(1 << (FILTER_BITS - 1));
+  const __m512i lo =
+      _mm512_maddubs_epi16(_mm512_unpacklo_epi8(a, b), filter);
+  const __m512i hi =
+      _mm512_maddubs_epi16(_mm512_unpackhi_epi8(a, b), filter);
+  const __m512i lo_r =
+      _mm512_srli_epi16(_mm512_add_epi16(lo, round), FILTER_BITS);
+  const __m512i hi_r =
+      _mm512_srli_epi16(_mm512_add_epi16(hi, round), FILTER_BITS);
+  return _mm512_packus_epi16(lo_r, hi_r);
+}
+
+static inline __m512i bil_filter_taps_avx512(int offset) {
+  const uint8_t *const f = bilinear_filters_2t[offset];
+  return _mm512_set1_epi16((short)(f[0] | (f[1] << 8)));
+}
+
+// Computes the same bilinear prediction as the two passes of
+// aom_sub_pixel_variance{W}x{H}_c() into dst (stride w), and returns the
+// pointer and stride to feed the variance computation. A zero offset is an
+// identity filter and is skipped.
+static inline const uint8_t *bil_filter_block_avx512(
+    const uint8_t *src, int src_stride, int xoffset, int yoffset, uint8_t *dst,
+    int w, int h, int *out_stride) {
+  const uint8_t *p = src;
+  int p_stride = src_stride;
+
+  if (xoffset) {
+    const __m512i filter = bil_filter_taps_avx512(xoffset);
+    // The vertical pass needs one extra row.
+    const int rows = h + (yoffset != 0);
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < w; j += 64) {
+        const __m512i a = zz_loadu_512(src + j);
+        const __m512i b = zz_loadu_512(src + j + 1);
+        zz_storeu_512(dst + i * w + j, bil_filter_64_avx512(a, b, filter));
+      }
+      src += src_stride;
+    }
+    p = dst;
+    p_stride = w;
+  }
+
+  if (yoffset) {
+    // Row i of the output only depends on rows i and i + 1 of the input, so
+    // the pass may run in place when the horizontal pass wrote to dst.
+    const __m512i filter = bil_filter_taps_avx512(yoffset);
+    for (int i = 0; i < h; ++i) {
+      for (int j = 0; j < w; j += 64) {
+        const __m512i a = zz_loadu_512(p + j);
+        const __m512i b = zz_loadu_512(p + p_stride + j);
+        zz_storeu_512(dst + i * w + j, bil_filter_64_avx512(a, b, filter));
+      }
+      p += p_stride;
+    }
+    p = dst;
+    p_stride = w;
+  }
+
+  *out_stride = p_stride;
+  return p;
+}
+
+#define AOM_SUB_PIXEL_VAR_AVX512(w, h)                                       \
+  unsigned int aom_sub_pixel_variance##w##x##h##_avx512(                     \
+      const uint8_t *src, int src_stride, int xoffset, int yoffset,          \
+      const uint8_t *dst, int dst_stride, unsigned int *sse) {               \
+    DECLARE_ALIGNED(64, uint8_t, temp[((h) + 1) * (w)]);                     \
+    int pred_stride;                                                         \
+    const uint8_t *pred = bil_filter_block_avx512(                           \
+        src, src_stride, xoffset, yoffset, temp, w, h, &pred_stride);        \
+    return aom_variance##w##x##h##_avx512(pred, pred_stride, dst, dst_stride, \
+                                          sse);                              \
+  }
+
+AOM_SUB_PIXEL_VAR_AVX512(64, 32)
+AOM_SUB_PIXEL_VAR_AVX512(64, 64)
+AOM_SUB_PIXEL_VAR_AVX512(64, 128)
+AOM_SUB_PIXEL_VAR_AVX512(128, 64)
+AOM_SUB_PIXEL_VAR_AVX512(128, 128)
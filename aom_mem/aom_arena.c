@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include "aom_mem/aom_arena.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "aom_mem/aom_mem.h"
+
+// Alignment of the backing block.
+#define ARENA_BUF_ALIGN 64
+
+struct aom_arena_chunk {
+  struct aom_arena_chunk *next;
+  // Bytes counted against the arena peak for this chunk.
+  size_t bytes;
+};
+
+static void update_peak(aom_arena_t *arena) {
+  const size_t total = arena->used + arena->chunk_bytes;
+  if (total > arena->peak) arena->peak = total;
+}
+
+static void *alloc_chunk(aom_arena_t *arena, size_t align, size_t size) {
+  const size_t header = sizeof(struct aom_arena_chunk);
+  if (size > AOM_MAX_ALLOCABLE_MEMORY - header - align) return NULL;
+  struct aom_arena_chunk *const chunk =
+      (struct aom_arena_chunk *)aom_malloc(header + align - 1 + size);
+  if (!chunk) return NULL;
+  chunk->next = arena->chunks;
+  chunk->bytes = align - 1 + size;
+  arena->chunks = chunk;
+  arena->chunk_bytes += chunk->bytes;
+  update_peak(arena);
+  return aom_align_addr((uint8_t *)chunk + header, align);
+}
+
+void *aom_arena_memalign(aom_arena_t *arena, size_t align, size_t size) {
+  assert(align > 0 && (align & (align - 1)) == 0);
+  if (arena->buf) {
+    const uintptr_t base = (uintptr_t)arena->buf;
+    const uintptr_t start =
+        (base + arena->used + (align - 1)) & ~(uintptr_t)(align - 1);
+    const size_t offset = (size_t)(start - base);
+    if (offset <= arena->size && size <= arena->size - offset) {
+      arena->used = offset + size;
+      update_peak(arena);
+      return (void *)start;
+    }
+  }
+  return alloc_chunk(arena, align, size);
+}
+
+void *aom_arena_calloc(aom_arena_t *arena, size_t num, size_t size) {
+  if (num != 0 && size > AOM_MAX_ALLOCABLE_MEMORY / num) return NULL;
+  void *const x = aom_arena_memalign(arena, 2 * sizeof(void *), num * size);
+  if (x) memset(x, 0, num * size);
+  return x;
+}
+
+aom_arena_mark_t aom_arena_get_mark(const aom_arena_t *arena) {
+  const aom_arena_mark_t mark = { arena->used, arena->chunks,
+                                  arena->chunk_bytes };
+  return mark;
+}
+
+void aom_arena_release(aom_arena_t *arena, aom_arena_mark_t mark) {
+  assert(mark.used <= arena->used);
+  while (arena->chunks != mark.chunks) {
+    struct aom_arena_chunk *const chunk = arena->chunks;
+    assert(chunk != NULL);
+    arena->chunks = chunk->next;
+    aom_free(chunk);
+  }
+  arena->chunk_bytes = mark.chunk_bytes;
+  arena->used = mark.used;
+}
+
+static void free_chunks(aom_arena_t *arena) {
+  const aom_arena_mark_t empty = { 0, NULL, 0 };
+  aom_arena_release(arena, empty);
+}
+
+void aom_arena_reset(aom_arena_t *arena) {
+  free_chunks(arena);
+  // Grow the backing block to the peak usage, or shrink it when less than half
+  // of it was used, so that a frame with a large peak does not keep its memory
+  // for the frames after it. A reset with no use in between, e.g. for a call
+  // of the encoder that outputs no frame, leaves the block as it is.
+  if (arena->peak > arena->size ||
+      (arena->peak > 0 && arena->peak < arena->size / 2)) {
+    aom_free(arena->buf);
+    arena->buf = (uint8_t *)aom_memalign(ARENA_BUF_ALIGN, arena->peak);
+    // On failure, keep going with chunk allocations only.
+    arena->size = arena->buf ? arena->peak : 0;
+  }
+  arena->peak = 0;
+}
+
+void aom_arena_destroy(aom_arena_t *arena) {
+  free_chunks(arena);
+  aom_free(arena->buf);
+  memset(arena, 0, sizeof(*arena));
+}
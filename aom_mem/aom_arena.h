@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AOM_MEM_AOM_ARENA_H_
+#define AOM_AOM_MEM_AOM_ARENA_H_
+
+#include <stddef.h>
+
+#include "aom/aom_integer.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// A stack-like scratch allocator for buffers that live for a part of a frame.
+//
+// Allocations are carved out of one backing block. Allocations that do not fit
+// get a separate chunk from aom_memalign(). aom_arena_reset() frees the chunks
+// and sizes the backing block for the peak usage seen since the previous
+// reset. The block is only reallocated when it is too small or less than half
+// of it was used, so that a steady state encode does no heap allocation for
+// these buffers, while a frame with an unusually large peak does not set the
+// memory held for the rest of the encode.
+//
+// Memory is returned in LIFO order with aom_arena_get_mark() and
+// aom_arena_release(); there is no way to free a single allocation. An arena
+// is not thread safe.
+struct aom_arena_chunk;
+
+typedef struct aom_arena {
+  uint8_t *buf;
+  size_t size;
+  size_t used;
+  struct aom_arena_chunk *chunks;
+  size_t chunk_bytes;
+  size_t peak;
+} aom_arena_t;
+
+typedef struct aom_arena_mark {
+  size_t used;
+  struct aom_arena_chunk *chunks;
+  size_t chunk_bytes;
+} aom_arena_mark_t;
+
+// The arena must be zero-initialized before first use.
+void *aom_arena_memalign(aom_arena_t *arena, size_t align, size_t size);
+void *aom_arena_calloc(aom_arena_t *arena, size_t num, size_t size);
+
+aom_arena_mark_t aom_arena_get_mark(const aom_arena_t *arena);
+// Returns all the memory allocated after mark was taken to the arena.
+void aom_arena_release(aom_arena_t *arena, aom_arena_mark_t mark);
+
+// Returns all the allocations to the arena and resizes its backing block.
+// Should be called at a point where no arena memory is in use, e.g. at the
+// start of a frame.
+void aom_arena_reset(aom_arena_t *arena);
+// Frees all the memory held by the arena and zeroes it.
+void aom_arena_destroy(aom_arena_t *arena);
+
+#if defined(__cplusplus)
+}  // extern "C"
+#endif
+
+#endif  // AOM_AOM_MEM_AOM_ARENA_H_
@@ -9,6 +9,12 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+// Enable GNU extensions in glibc so that MADV_HUGEPAGE is defined.
+// This must be before any #include statements.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "aom_mem.h"
 #include <assert.h>
 #include <stdlib.h>
@@ -16,6 +22,28 @@
 #include "include/aom_mem_intrnl.h"
 #include "aom/aom_integer.h"
 
+#if CONFIG_HUGE_PAGES && defined(__linux__)
+#include <sys/mman.h>
+#if defined(MADV_HUGEPAGE)
+#define HUGE_PAGE_SIZE ((size_t)2 << 20)
+#endif
+#endif
+
+#if CONFIG_MULTITHREAD
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MEM_THREAD_LOCAL __declspec(thread)
+#else
+#define MEM_THREAD_LOCAL __thread
+#endif
+#else
+#define MEM_THREAD_LOCAL
+#endif
+
+static MEM_THREAD_LOCAL aom_mem_tracker_t *thread_tracker;
+static MEM_THREAD_LOCAL aom_mem_tag_t thread_tag;
+static MEM_THREAD_LOCAL int thread_huge_pages;
+
 static size_t GetAllocationPaddingSize(size_t align) {
   assert(align > 0);
   assert(align < SIZE_MAX - ADDRESS_STORAGE_SIZE);
@@ -52,6 +80,54 @@ static void *GetActualMallocAddress(void *const mem) {
   return (void *)(*malloc_addr_location);
 }
 
+// The tracker, size and tag are stored below the malloc address.
+static size_t *GetAccountingLocation(void *const mem) {
+  return ((size_t *)mem) - 4;
+}
+
+// Adds delta to *counter. Uses atomics where available, as memory charged to
+// a tracker may be freed by a worker thread.
+static size_t AtomicAdd(size_t *counter, size_t delta) {
+#if CONFIG_MULTITHREAD && (defined(__GNUC__) || defined(__clang__))
+  return __atomic_add_fetch(counter, delta, __ATOMIC_RELAXED);
+#elif CONFIG_MULTITHREAD && defined(_MSC_VER) && defined(_WIN64)
+  return (size_t)_InterlockedExchangeAdd64((volatile __int64 *)counter,
+                                           (__int64)delta) +
+         delta;
+#elif CONFIG_MULTITHREAD && defined(_MSC_VER)
+  return (size_t)_InterlockedExchangeAdd((volatile long *)counter,
+                                         (long)delta) +
+         delta;
+#else
+  return *counter += delta;
+#endif
+}
+
+static void AtomicMax(size_t *peak, size_t value) {
+#if CONFIG_MULTITHREAD && (defined(__GNUC__) || defined(__clang__))
+  size_t old = __atomic_load_n(peak, __ATOMIC_RELAXED);
+  while (value > old &&
+         !__atomic_compare_exchange_n(peak, &old, value, 1, __ATOMIC_RELAXED,
+                                      __ATOMIC_RELAXED)) {
+  }
+#else
+  // Without a compare-and-swap the peak may miss a concurrent update.
+  if (value > *peak) *peak = value;
+#endif
+}
+
+static void Charge(aom_mem_tracker_t *tracker, aom_mem_tag_t tag,
+                   size_t size) {
+  AtomicMax(&tracker->peak[tag], AtomicAdd(&tracker->current[tag], size));
+  AtomicMax(&tracker->total_peak, AtomicAdd(&tracker->total, size));
+}
+
+static void Credit(aom_mem_tracker_t *tracker, aom_mem_tag_t tag,
+                   size_t size) {
+  AtomicAdd(&tracker->current[tag], (size_t)0 - size);
+  AtomicAdd(&tracker->total, (size_t)0 - size);
+}
+
 void *aom_memalign(size_t align, size_t size) {
   void *x = NULL;
   if (!check_size_argument_overflow(1, size, align)) return NULL;
@@ -60,6 +136,12 @@ void *aom_memalign(size_t align, size_t size) {
   if (addr) {
     x = aom_align_addr((unsigned char *)addr + ADDRESS_STORAGE_SIZE, align);
     SetActualMallocAddress(x, addr);
+    size_t *const accounting = GetAccountingLocation(x);
+    aom_mem_tracker_t *const tracker = thread_tracker;
+    accounting[0] = (size_t)thread_tag;
+    accounting[1] = size;
+    accounting[2] = (size_t)tracker;
+    if (tracker) Charge(tracker, thread_tag, size);
   }
   return x;
 }
@@ -76,7 +158,72 @@ void *aom_calloc(size_t num, size_t size) {
 
 void aom_free(void *memblk) {
   if (memblk) {
+    const size_t *const accounting = GetAccountingLocation(memblk);
+    aom_mem_tracker_t *const tracker = (aom_mem_tracker_t *)accounting[2];
+    if (tracker) {
+      Credit(tracker, (aom_mem_tag_t)accounting[0], accounting[1]);
+    }
     void *addr = GetActualMallocAddress(memblk);
     free(addr);
   }
 }
+
+aom_mem_tracker_t *aom_mem_set_tracker(aom_mem_tracker_t *tracker) {
+  aom_mem_tracker_t *const prev = thread_tracker;
+  thread_tracker = tracker;
+  // A tag may be left set by an error longjmp()ing out of a tagged scope.
+  thread_tag = AOM_MEM_TAG_OTHER;
+  return prev;
+}
+
+aom_mem_tracker_t *aom_mem_get_tracker(void) { return thread_tracker; }
+
+aom_mem_tag_t aom_mem_push_tag(aom_mem_tag_t tag) {
+  const aom_mem_tag_t prev = thread_tag;
+  if (prev == AOM_MEM_TAG_OTHER) thread_tag = tag;
+  return prev;
+}
+
+void aom_mem_pop_tag(aom_mem_tag_t prev_tag) { thread_tag = prev_tag; }
+
+int aom_mem_set_huge_pages(int enable) {
+  const int prev = thread_huge_pages;
+  thread_huge_pages = enable;
+  return prev;
+}
+
+int aom_mem_get_huge_pages(void) { return thread_huge_pages; }
+
+void aom_mem_get_usage(const aom_mem_tracker_t *tracker,
+                       aom_memory_usage_t *usage) {
+  for (int i = 0; i < AOM_MEM_TAG_COUNT; ++i) {
+    usage->current_bytes[i] = tracker->current[i];
+    usage->peak_bytes[i] = tracker->peak[i];
+  }
+  usage->total_current_bytes = tracker->total;
+  usage->total_peak_bytes = tracker->total_peak;
+}
+
+void *aom_memalign_huge(size_t align, size_t size) {
+#if defined(HUGE_PAGE_SIZE)
+  if (thread_huge_pages && size >= HUGE_PAGE_SIZE && align <= HUGE_PAGE_SIZE) {
+    void *const x = aom_memalign(HUGE_PAGE_SIZE, size);
+    if (x) {
+      // The padding before x is only touched on its last page. madvise()
+      // fails if the kernel has no transparent huge page support, which
+      // leaves the buffer with normal pages.
+      (void)madvise(x, size & ~(HUGE_PAGE_SIZE - 1), MADV_HUGEPAGE);
+      return x;
+    }
+  }
+#endif
+  return aom_memalign(align, size);
+}
+
+void *aom_calloc_huge(size_t num, size_t size) {
+  if (!check_size_argument_overflow(num, size, DEFAULT_ALIGNMENT)) return NULL;
+  const size_t total_size = num * size;
+  void *const x = aom_memalign_huge(DEFAULT_ALIGNMENT, total_size);
+  if (x) memset(x, 0, total_size);
+  return x;
+}
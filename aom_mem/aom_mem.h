@@ -12,6 +12,7 @@
 #ifndef AOM_AOM_MEM_AOM_MEM_H_
 #define AOM_AOM_MEM_AOM_MEM_H_
 
+#include "aom/aom.h"
 #include "aom/aom_integer.h"
 #include "config/aom_config.h"
 
@@ -37,6 +38,46 @@ void *aom_malloc(size_t size);
 void *aom_calloc(size_t num, size_t size);
 void aom_free(void *memblk);
 
+// Accounting of the memory of a codec instance. While a tracker is set for
+// the calling thread, the requested size of each allocation is charged to it,
+// under the current tag of the thread. aom_free() credits the tracker and tag
+// the allocation was charged to, from any thread. A tracker must outlive the
+// allocations charged to it.
+typedef struct aom_mem_tracker {
+  size_t current[AOM_MEM_TAG_COUNT];
+  size_t peak[AOM_MEM_TAG_COUNT];
+  size_t total;
+  size_t total_peak;
+} aom_mem_tracker_t;
+
+// Sets the tracker of the calling thread and returns the previous one. NULL
+// disables the accounting. Also resets the tag of the thread to
+// AOM_MEM_TAG_OTHER.
+aom_mem_tracker_t *aom_mem_set_tracker(aom_mem_tracker_t *tracker);
+aom_mem_tracker_t *aom_mem_get_tracker(void);
+
+// Sets the tag of the calling thread, unless a tag other than
+// AOM_MEM_TAG_OTHER is already set, so that the outermost subsystem wins.
+// Returns the previous tag, to be restored with aom_mem_pop_tag().
+aom_mem_tag_t aom_mem_push_tag(aom_mem_tag_t tag);
+void aom_mem_pop_tag(aom_mem_tag_t prev_tag);
+
+void aom_mem_get_usage(const aom_mem_tracker_t *tracker,
+                       aom_memory_usage_t *usage);
+
+// Sets whether aom_memalign_huge() may use huge pages on the calling thread
+// and returns the previous setting. Huge pages are off by default.
+int aom_mem_set_huge_pages(int enable);
+int aom_mem_get_huge_pages(void);
+
+// Allocates like aom_memalign(), for large buffers such as frame buffers. If
+// huge pages are enabled on the calling thread, allocations of at least 2 MB
+// are aligned to 2 MB and advised to be backed by transparent huge pages.
+// Falls back to normal pages when huge pages are not supported. The memory is
+// freed with aom_free().
+void *aom_memalign_huge(size_t align, size_t size);
+void *aom_calloc_huge(size_t num, size_t size);
+
 static inline void *aom_memset16(void *dest, int val, size_t length) {
   size_t i;
   uint16_t *dest16 = (uint16_t *)dest;
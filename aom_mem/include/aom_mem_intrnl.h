@@ -14,7 +14,9 @@
 
 #include "config/aom_config.h"
 
-#define ADDRESS_STORAGE_SIZE sizeof(size_t)
+// Each allocation is preceded by the address returned by malloc(), the tracker
+// it is charged to, its size and its tag.
+#define ADDRESS_STORAGE_SIZE (4 * sizeof(size_t))
 
 #ifndef DEFAULT_ALIGNMENT
 #if defined(VXWORKS)
@@ -129,7 +129,8 @@ static int realloc_frame_buffer_aligned(
 
       if (frame_size != (size_t)frame_size) return AOM_CODEC_MEM_ERROR;
 
-      ybf->buffer_alloc = (uint8_t *)aom_memalign(32, (size_t)frame_size);
+      ybf->buffer_alloc =
+          (uint8_t *)aom_memalign_huge(32, (size_t)frame_size);
       if (!ybf->buffer_alloc) return AOM_CODEC_MEM_ERROR;
 
       ybf->buffer_alloc_sz = (size_t)frame_size;
@@ -261,11 +262,14 @@ int aom_realloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width, int height,
         alloc_y_plane_only, &y_stride, &uv_stride, &yplane_size, &uvplane_size,
         uv_height);
     if (error) return error;
-    return realloc_frame_buffer_aligned(
+    const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_FRAME_BUFFERS);
+    error = realloc_frame_buffer_aligned(
         ybf, width, height, ss_x, ss_y, use_highbitdepth, border,
         byte_alignment, fb, cb, cb_priv, y_stride, yplane_size, uvplane_size,
         aligned_width, aligned_height, uv_width, uv_height, uv_stride,
         uv_border_w, uv_border_h, alloc_pyramid, alloc_y_plane_only);
+    aom_mem_pop_tag(prev_tag);
+    return error;
   }
   return AOM_CODEC_MEM_ERROR;
 }
@@ -36,6 +36,10 @@ struct AVxWorkerImpl {
   pthread_mutex_t mutex_;
   pthread_cond_t condition_;
   pthread_t thread_;
+  // Memory tracker and huge page setting of the thread that launched the
+  // worker.
+  aom_mem_tracker_t *mem_tracker_;
+  int huge_pages_;
 };
 
 //------------------------------------------------------------------------------
@@ -72,6 +76,8 @@ static THREADFN thread_loop(void *ptr) {
       pthread_cond_wait(&worker->impl_->condition_, &worker->impl_->mutex_);
     }
     if (worker->status_ == AVX_WORKER_STATUS_WORKING) {
+      aom_mem_set_tracker(worker->impl_->mem_tracker_);
+      aom_mem_set_huge_pages(worker->impl_->huge_pages_);
       // When worker->status_ is AVX_WORKER_STATUS_WORKING, the main thread
       // doesn't change worker->status_ and will wait until the worker changes
       // worker->status_ to AVX_WORKER_STATUS_OK. See change_state(). So the
@@ -200,6 +206,13 @@ static void execute(AVxWorker *const worker) {
 
 static void launch(AVxWorker *const worker) {
 #if CONFIG_MULTITHREAD
+  // Charge the allocations of the worker to the codec instance launching it.
+  if (worker->impl_ != NULL) {
+    pthread_mutex_lock(&worker->impl_->mutex_);
+    worker->impl_->mem_tracker_ = aom_mem_get_tracker();
+    worker->impl_->huge_pages_ = aom_mem_get_huge_pages();
+    pthread_mutex_unlock(&worker->impl_->mutex_);
+  }
   change_state(worker, AVX_WORKER_STATUS_WORKING);
 #else
   execute(worker);
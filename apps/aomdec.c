@@ -63,6 +63,10 @@ static const arg_def_t use_yv12 =
     ARG_DEF(NULL, "yv12", 0, "Output raw YV12 frames");
 static const arg_def_t use_i420 =
     ARG_DEF(NULL, "i420", 0, "Output raw I420 frames");
+static const arg_def_t use_nv12 =
+    ARG_DEF(NULL, "nv12", 0, "Output raw NV12 frames (8-bit streams)");
+static const arg_def_t use_p010 =
+    ARG_DEF(NULL, "p010", 0, "Output raw P010 frames (10-bit streams)");
 static const arg_def_t flipuvarg =
     ARG_DEF(NULL, "flipuv", 0, "Flip the chroma planes in the output");
 static const arg_def_t rawvideo =
@@ -76,7 +80,8 @@ static const arg_def_t limitarg =
 static const arg_def_t skiparg =
     ARG_DEF(NULL, "skip", 1, "Skip the first n input frames");
 static const arg_def_t summaryarg =
-    ARG_DEF(NULL, "summary", 0, "Show timing summary");
+    ARG_DEF(NULL, "summary", 0,
+            "Show timing summary, including the time of each decoding stage");
 static const arg_def_t outputfile =
     ARG_DEF("o", "output", 1, "Output file name pattern (see below)");
 static const arg_def_t threadsarg =
@@ -105,15 +110,20 @@ static const arg_def_t outallarg = ARG_DEF(
     NULL, "all-layers", 0, "Output all decoded frames of a scalable bitstream");
 static const arg_def_t skipfilmgrain =
     ARG_DEF(NULL, "skip-film-grain", 0, "Skip film grain application");
+static const arg_def_t fastdecodearg =
+    ARG_DEF(NULL, "fast-decode", 1,
+            "Non-normative fast decoding level (0: off (default), 1-3: faster "
+            "and less exact)");
 
 static const arg_def_t *all_args[] = {
-  &help,           &codecarg, &use_yv12,      &use_i420,
-  &flipuvarg,      &rawvideo, &noblitarg,     &progressarg,
-  &limitarg,       &skiparg,  &summaryarg,    &outputfile,
-  &threadsarg,     &rowmtarg, &verbosearg,    &scalearg,
-  &fb_arg,         &md5arg,   &framestatsarg, &continuearg,
-  &outbitdeptharg, &isannexb, &oppointarg,    &outallarg,
-  &skipfilmgrain,  NULL
+  &help,          &codecarg,    &use_yv12,       &use_i420,
+  &use_nv12,      &use_p010,    &flipuvarg,      &rawvideo,
+  &noblitarg,     &progressarg, &limitarg,       &skiparg,
+  &summaryarg,    &outputfile,  &threadsarg,     &rowmtarg,
+  &verbosearg,    &scalearg,    &fb_arg,         &md5arg,
+  &framestatsarg, &continuearg, &outbitdeptharg, &isannexb,
+  &oppointarg,    &outallarg,   &skipfilmgrain,  &fastdecodearg,
+  NULL
 };
 
 #if CONFIG_LIBYUV
@@ -175,8 +185,9 @@ static void show_help(FILE *fout, int shorthelp) {
           "\n\t%%h   - Frame height"
           "\n\t%%<n> - Frame number, zero padded to <n> places (1..9)"
           "\n\n  Pattern arguments are only supported in conjunction "
-          "with the --yv12 and\n  --i420 options. If the -o option is "
-          "not specified, the output will be\n  directed to stdout.\n");
+          "with the --yv12,\n  --i420, --nv12 and --p010 options. If the -o "
+          "option is not specified, the\n  output will be directed to "
+          "stdout.\n");
   fprintf(fout, "\nIncluded decoders:\n\n");
 
   for (int i = 0; i < get_aom_decoder_count(); ++i) {
@@ -297,6 +308,60 @@ static void show_progress(int frame_in, int frame_out, uint64_t dx_time) {
           (double)frame_out * 1000000.0 / (double)dx_time);
 }
 
+static void accumulate_frame_stats(aom_frame_stats *total,
+                                   const aom_frame_stats *stats) {
+  total->num_frames += stats->num_frames;
+  total->num_tiles += stats->num_tiles;
+  total->frame_bytes += stats->frame_bytes;
+  total->decode_time += stats->decode_time;
+  total->tile_decode_time += stats->tile_decode_time;
+  total->parse_time += stats->parse_time;
+  total->recon_time += stats->recon_time;
+  if (stats->num_workers > total->num_workers)
+    total->num_workers = stats->num_workers;
+  total->worker_busy_time += stats->worker_busy_time;
+  total->loop_filter_time += stats->loop_filter_time;
+  total->cdef_time += stats->cdef_time;
+  total->superres_time += stats->superres_time;
+  total->loop_restoration_time += stats->loop_restoration_time;
+  total->film_grain_time += stats->film_grain_time;
+}
+
+static void show_stage_time(const char *name, int64_t time,
+                            int64_t total_time) {
+  fprintf(stderr, "  %-18s %10" PRId64 " us (%5.1f%%)\n", name, time,
+          total_time ? 100.0 * (double)time / (double)total_time : 0.0);
+}
+
+static void show_frame_stats(const aom_frame_stats *stats) {
+  const int64_t total_time = stats->decode_time + stats->film_grain_time;
+  fprintf(stderr, "%d frames, %d tiles, %" PRIu64 " bytes\n",
+          stats->num_frames, stats->num_tiles, (uint64_t)stats->frame_bytes);
+  show_stage_time("tile decode", stats->tile_decode_time, total_time);
+  show_stage_time("loop filter", stats->loop_filter_time, total_time);
+  show_stage_time("cdef", stats->cdef_time, total_time);
+  show_stage_time("superres", stats->superres_time, total_time);
+  show_stage_time("loop restoration", stats->loop_restoration_time,
+                  total_time);
+  show_stage_time("film grain", stats->film_grain_time, total_time);
+  const int64_t other_time =
+      stats->decode_time - stats->tile_decode_time - stats->loop_filter_time -
+      stats->cdef_time - stats->superres_time - stats->loop_restoration_time;
+  show_stage_time("other", other_time > 0 ? other_time : 0, total_time);
+  if (stats->parse_time || stats->recon_time) {
+    fprintf(stderr,
+            "  tile workers: %" PRId64 " us parsing, %" PRId64
+            " us reconstructing\n",
+            stats->parse_time, stats->recon_time);
+  }
+  if (stats->num_workers > 0 && stats->tile_decode_time > 0) {
+    fprintf(stderr, "  tile worker utilization: %.1f%% of %d workers\n",
+            100.0 * (double)stats->worker_busy_time /
+                ((double)stats->num_workers * (double)stats->tile_decode_time),
+            stats->num_workers);
+  }
+}
+
 struct ExternalFrameBuffer {
   uint8_t *data;
   size_t size;
@@ -451,6 +516,7 @@ static int main_loop(int argc, const char **argv_) {
   int frame_in = 0, frame_out = 0, flipuv = 0, noblit = 0;
   int do_md5 = 0, progress = 0;
   int stop_after = 0, summary = 0, quiet = 1;
+  aom_frame_stats total_frame_stats = { 0 };
   int arg_skip = 0;
   int keep_going = 0;
   uint64_t dx_time = 0;
@@ -462,6 +528,7 @@ static int main_loop(int argc, const char **argv_) {
   int opt_yv12 = 0;
   int opt_i420 = 0;
   int opt_raw = 0;
+  aom_img_fmt_t output_fmt = AOM_IMG_FMT_NONE;
   aom_codec_dec_cfg_t cfg = { 0, 0, 0, !FORCE_HIGHBITDEPTH_DECODING };
   unsigned int fixed_output_bit_depth = 0;
   unsigned int is_annexb = 0;
@@ -471,6 +538,7 @@ static int main_loop(int argc, const char **argv_) {
   int operating_point = 0;
   int output_all_layers = 0;
   int skip_film_grain = 0;
+  int fast_decode = 0;
   int enable_row_mt = 0;
   aom_image_t *scaled_img = NULL;
   aom_image_t *img_shifted = NULL;
@@ -532,17 +600,34 @@ static int main_loop(int argc, const char **argv_) {
       opt_yv12 = 1;
       opt_i420 = 0;
       opt_raw = 0;
+      output_fmt = AOM_IMG_FMT_NONE;
     } else if (arg_match(&arg, &use_i420, argi)) {
       use_y4m = 0;
       flipuv = 0;
       opt_yv12 = 0;
       opt_i420 = 1;
       opt_raw = 0;
+      output_fmt = AOM_IMG_FMT_NONE;
+    } else if (arg_match(&arg, &use_nv12, argi)) {
+      use_y4m = 0;
+      flipuv = 0;
+      opt_yv12 = 0;
+      opt_i420 = 0;
+      opt_raw = 0;
+      output_fmt = AOM_IMG_FMT_NV12;
+    } else if (arg_match(&arg, &use_p010, argi)) {
+      use_y4m = 0;
+      flipuv = 0;
+      opt_yv12 = 0;
+      opt_i420 = 0;
+      opt_raw = 0;
+      output_fmt = AOM_IMG_FMT_P010;
     } else if (arg_match(&arg, &rawvideo, argi)) {
       use_y4m = 0;
       opt_yv12 = 0;
       opt_i420 = 0;
       opt_raw = 1;
+      output_fmt = AOM_IMG_FMT_NONE;
     } else if (arg_match(&arg, &flipuvarg, argi)) {
       flipuv = 1;
     } else if (arg_match(&arg, &noblitarg, argi)) {
@@ -593,11 +678,21 @@ static int main_loop(int argc, const char **argv_) {
       output_all_layers = 1;
     } else if (arg_match(&arg, &skipfilmgrain, argi)) {
       skip_film_grain = 1;
+    } else if (arg_match(&arg, &fastdecodearg, argi)) {
+      fast_decode = arg_parse_int(&arg);
     } else {
       argj++;
     }
   }
 
+  // The decoder writes NV12 and P010 frames directly, so they cannot be
+  // rescaled or shifted afterwards.
+  if (output_fmt != AOM_IMG_FMT_NONE &&
+      (do_scale || fixed_output_bit_depth || flipuv)) {
+    die("Error: --nv12 and --p010 cannot be used with --scale, --flipuv or "
+        "--output-bit-depth.\n");
+  }
+
   /* Check for unrecognized options */
   for (argi = argv; *argi; argi++)
     if (argi[0][0] == '-' && strlen(argi[0]) > 1)
@@ -742,6 +837,20 @@ static int main_loop(int argc, const char **argv_) {
     goto fail;
   }
 
+  if (AOM_CODEC_CONTROL_TYPECHECKED(&decoder, AV1D_SET_FAST_DECODE,
+                                    fast_decode)) {
+    fprintf(stderr, "Failed to set fast_decode: %s\n",
+            aom_codec_error(&decoder));
+    goto fail;
+  }
+
+  if (AOM_CODEC_CONTROL_TYPECHECKED(&decoder, AV1D_SET_OUTPUT_FORMAT,
+                                    output_fmt)) {
+    fprintf(stderr, "Failed to set output format: %s\n",
+            aom_codec_error(&decoder));
+    goto fail;
+  }
+
   if (AOM_CODEC_CONTROL_TYPECHECKED(&decoder, AV1D_SET_ROW_MT, enable_row_mt)) {
     fprintf(stderr, "Failed to set row multithreading mode: %s\n",
             aom_codec_error(&decoder));
@@ -1006,12 +1115,27 @@ static int main_loop(int argc, const char **argv_) {
         }
       }
     }
+
+    // The stats are reset by each aom_codec_decode() call with data and
+    // include the film grain applied by aom_codec_get_frame().
+    if (summary && frame_avail) {
+      aom_frame_stats frame_stats;
+      if (AOM_CODEC_CONTROL_TYPECHECKED(&decoder, AOMD_GET_FRAME_STATS,
+                                        &frame_stats)) {
+        aom_tools_warn("Failed AOMD_GET_FRAME_STATS: %s",
+                       aom_codec_error(&decoder));
+        if (!keep_going) goto fail;
+      } else {
+        accumulate_frame_stats(&total_frame_stats, &frame_stats);
+      }
+    }
   }
 
   if (summary || progress) {
     show_progress(frame_in, frame_out, dx_time);
     fprintf(stderr, "\n");
   }
+  if (summary) show_frame_stats(&total_frame_stats);
 
   if (frames_corrupted) {
     fprintf(stderr, "WARNING: %d frames corrupted.\n", frames_corrupted);
@@ -464,6 +464,10 @@ static const arg_def_t *const av1_key_val_args[] = {
   &g_av1_codec_arg_defs.fwd_kf_dist,
   &g_av1_codec_arg_defs.strict_level_conformance,
   &g_av1_codec_arg_defs.sb_qp_sweep,
+  &g_av1_codec_arg_defs.reduced_frame_border,
+  &g_av1_codec_arg_defs.huge_pages,
+  &g_av1_codec_arg_defs.low_memory_level,
+  &g_av1_codec_arg_defs.scaled_ref_cache,
   &g_av1_codec_arg_defs.dist_metric,
   &g_av1_codec_arg_defs.kf_max_pyr_height,
   &g_av1_codec_arg_defs.auto_tiles,
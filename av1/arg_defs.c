@@ -705,5 +705,22 @@ const av1_codec_arg_definitions_t g_av1_codec_arg_defs = {
       ARG_DEF(NULL, "sb-qp-sweep", 1,
               "When set to 1, enable the superblock level qp sweep for a "
               "given lambda to minimize the rdcost."),
+  .reduced_frame_border =
+      ARG_DEF(NULL, "reduced-frame-border", 1,
+              "Keep the small frame border of unscaled encoding when resize "
+              "or superres is enabled, to reduce memory (0: off (default), "
+              "1: on). Only used in realtime mode."),
+  .huge_pages = ARG_DEF(NULL, "huge-pages", 1,
+                        "Back frame buffers and large tables with transparent "
+                        "huge pages (0: off (default), 1: on). Linux only."),
+  .low_memory_level = ARG_DEF(NULL, "low-memory-level", 1,
+                              "Trade speed for memory (0: off (default), "
+                              "1: free source pyramids, no speed cost, "
+                              "2: also free reference pyramids). Output is "
+                              "unchanged."),
+  .scaled_ref_cache = ARG_DEF(NULL, "scaled-ref-cache", 1,
+                              "Keep scaled reference frames for later frames "
+                              "(0: off (default), 1: on). Output is "
+                              "unchanged."),
 #endif  // CONFIG_AV1_ENCODER
 };
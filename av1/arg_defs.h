@@ -236,6 +236,10 @@ typedef struct av1_codec_arg_definitions {
   arg_def_t strict_level_conformance;
   arg_def_t kf_max_pyr_height;
   arg_def_t sb_qp_sweep;
+  arg_def_t reduced_frame_border;
+  arg_def_t huge_pages;
+  arg_def_t low_memory_level;
+  arg_def_t scaled_ref_cache;
 #endif  // CONFIG_AV1_ENCODER
 } av1_codec_arg_definitions_t;
 
@@ -297,13 +297,17 @@ list(APPEND AOM_AV1_COMMON_INTRIN_SSE4_1
             "${AOM_ROOT}/av1/common/x86/warp_plane_sse4.c")
 
 list(APPEND AOM_AV1_COMMON_INTRIN_AVX2
+            "${AOM_ROOT}/av1/common/x86/av1_convolve_horiz_rs_avx2.c"
+            "${AOM_ROOT}/av1/common/x86/av1_convolve_scale_avx2.c"
             "${AOM_ROOT}/av1/common/x86/av1_inv_txfm_avx2.c"
             "${AOM_ROOT}/av1/common/x86/av1_inv_txfm_avx2.h"
             "${AOM_ROOT}/av1/common/x86/cdef_block_avx2.c"
             "${AOM_ROOT}/av1/common/x86/cfl_avx2.c"
             "${AOM_ROOT}/av1/common/x86/convolve_2d_avx2.c"
             "${AOM_ROOT}/av1/common/x86/convolve_avx2.c"
+            "${AOM_ROOT}/av1/common/x86/filterintra_avx2.c"
             "${AOM_ROOT}/av1/common/x86/highbd_inv_txfm_avx2.c"
+            "${AOM_ROOT}/av1/common/x86/intra_edge_avx2.c"
             "${AOM_ROOT}/av1/common/x86/jnt_convolve_avx2.c"
             "${AOM_ROOT}/av1/common/x86/reconinter_avx2.c"
             "${AOM_ROOT}/av1/common/x86/resize_avx2.c"
@@ -311,6 +315,9 @@ list(APPEND AOM_AV1_COMMON_INTRIN_AVX2
             "${AOM_ROOT}/av1/common/x86/warp_plane_avx2.c"
             "${AOM_ROOT}/av1/common/x86/wiener_convolve_avx2.c")
 
+list(APPEND AOM_AV1_COMMON_INTRIN_AVX512
+            "${AOM_ROOT}/av1/common/x86/convolve_avx512.c")
+
 list(APPEND AOM_AV1_ENCODER_ASM_SSE2 "${AOM_ROOT}/av1/encoder/x86/dct_sse2.asm"
             "${AOM_ROOT}/av1/encoder/x86/error_sse2.asm")
 
@@ -354,9 +361,15 @@ list(APPEND AOM_AV1_ENCODER_INTRIN_AVX2
             "${AOM_ROOT}/av1/encoder/x86/encodetxb_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/rdopt_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/av1_k_means_avx2.c"
+            "${AOM_ROOT}/av1/encoder/x86/palette_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/temporal_filter_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/pickrst_avx2.c")
 
+list(APPEND AOM_AV1_ENCODER_INTRIN_AVX512
+            "${AOM_ROOT}/av1/encoder/x86/av1_quantize_avx512.c"
+            "${AOM_ROOT}/av1/encoder/x86/error_intrin_avx512.c"
+            "${AOM_ROOT}/av1/encoder/x86/highbd_fwd_txfm_avx512.c")
+
 # The functions defined in these files are removed from rtcd when
 # CONFIG_EXCLUDE_SIMD_MISMATCH=1.
 if(NOT CONFIG_EXCLUDE_SIMD_MISMATCH)
@@ -482,6 +495,9 @@ if(CONFIG_AV1_TEMPORAL_DENOISING)
   list(APPEND AOM_AV1_ENCODER_INTRIN_SSE2
               "${AOM_ROOT}/av1/encoder/x86/av1_temporal_denoiser_sse2.c")
 
+  list(APPEND AOM_AV1_ENCODER_INTRIN_AVX2
+              "${AOM_ROOT}/av1/encoder/x86/av1_temporal_denoiser_avx2.c")
+
   list(APPEND AOM_AV1_ENCODER_INTRIN_NEON
               "${AOM_ROOT}/av1/encoder/arm/av1_temporal_denoiser_neon.c")
 endif()
@@ -766,6 +782,18 @@ function(setup_av1_targets)
     endif()
   endif()
 
+  if(HAVE_AVX512)
+    add_intrinsics_object_library("${AOM_AVX512_FLAGS}" "avx512"
+                                  "aom_av1_common"
+                                  "AOM_AV1_COMMON_INTRIN_AVX512")
+
+    if(CONFIG_AV1_ENCODER)
+      add_intrinsics_object_library("${AOM_AVX512_FLAGS}" "avx512"
+                                    "aom_av1_encoder"
+                                    "AOM_AV1_ENCODER_INTRIN_AVX512")
+    endif()
+  endif()
+
   if(HAVE_NEON)
     add_intrinsics_object_library("${AOM_NEON_INTRIN_FLAG}" "neon"
                                   "aom_av1_common" "AOM_AV1_COMMON_INTRIN_NEON")
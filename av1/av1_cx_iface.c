@@ -211,6 +211,14 @@ struct av1_extracfg {
   int strict_level_conformance;
   int kf_max_pyr_height;
   int sb_qp_sweep;
+  // Keep the unscaled frame border with resize and superres in realtime mode.
+  unsigned int reduced_frame_border;
+  // Back frame buffers and large tables with transparent huge pages.
+  unsigned int huge_pages;
+  // How much encoder speed is traded for memory, see LOW_MEM_LEVEL.
+  unsigned int low_memory_level;
+  // Keep scaled copies of reference frames for later frames.
+  unsigned int scaled_ref_cache;
 };
 
 #if !CONFIG_REALTIME_ONLY
@@ -363,6 +371,10 @@ static const struct av1_extracfg default_extra_cfg = {
   0,               // strict_level_conformance
   -1,              // kf_max_pyr_height
   0,               // sb_qp_sweep
+  0,               // reduced_frame_border
+  0,               // huge_pages
+  0,               // low_memory_level
+  0,               // scaled_ref_cache
 };
 #else
 // Some settings are changed for realtime only build.
@@ -515,6 +527,10 @@ static const struct av1_extracfg default_extra_cfg = {
   0,               // strict_level_conformance
   -1,              // kf_max_pyr_height
   0,               // sb_qp_sweep
+  0,               // reduced_frame_border
+  0,               // huge_pages
+  0,               // low_memory_level
+  0,               // scaled_ref_cache
 };
 #endif
 
@@ -544,6 +560,10 @@ struct aom_codec_alg_priv {
   int num_lap_buffers;
   STATS_BUFFER_CTX stats_buf_context;
   bool monochrome_on_init;
+  // Release callback of input images, see AV1E_SET_ZERO_COPY_INPUT.
+  aom_zero_copy_input_t zero_copy;
+  // Memory usage of the instance, see AV1E_GET_MEMORY_USAGE.
+  aom_mem_tracker_t mem_tracker;
 };
 
 static inline int gcd(int64_t a, int b) {
@@ -897,6 +917,10 @@ static aom_codec_err_t validate_config(aom_codec_alg_priv_t *ctx,
   RANGE_CHECK_BOOL(extra_cfg, auto_intra_tools_off);
   RANGE_CHECK_BOOL(extra_cfg, strict_level_conformance);
   RANGE_CHECK_BOOL(extra_cfg, sb_qp_sweep);
+  RANGE_CHECK_BOOL(extra_cfg, reduced_frame_border);
+  RANGE_CHECK_BOOL(extra_cfg, huge_pages);
+  RANGE_CHECK_HI(extra_cfg, low_memory_level, LOW_MEM_REFERENCES);
+  RANGE_CHECK_BOOL(extra_cfg, scaled_ref_cache);
 
   RANGE_CHECK(extra_cfg, kf_max_pyr_height, -1, 5);
   if (extra_cfg->kf_max_pyr_height != -1 &&
@@ -1504,8 +1528,11 @@ static void set_encoder_config(AV1EncoderConfig *oxcf,
   oxcf->unit_test_cfg.sb_multipass_unit_test =
       extra_cfg->sb_multipass_unit_test;
 
+  oxcf->reduced_frame_border = extra_cfg->reduced_frame_border;
+  oxcf->low_mem_level = (LOW_MEM_LEVEL)extra_cfg->low_memory_level;
+  oxcf->scaled_ref_cache = extra_cfg->scaled_ref_cache;
   oxcf->border_in_pixels =
-      av1_get_enc_border_size(av1_is_resize_needed(oxcf),
+      av1_get_enc_border_size(av1_is_resize_border_needed(oxcf),
                               (oxcf->kf_cfg.key_freq_max == 0), BLOCK_128X128);
   memcpy(oxcf->target_seq_level_idx, extra_cfg->target_seq_level_idx,
          sizeof(oxcf->target_seq_level_idx));
@@ -1575,6 +1602,10 @@ static aom_codec_err_t encoder_set_config(aom_codec_alg_priv_t *ctx,
   res = validate_config(ctx, cfg, &ctx->extra_cfg);
 
   if (res == AOM_CODEC_OK) {
+    aom_mem_tracker_t *const prev_tracker =
+        aom_mem_set_tracker(&ctx->mem_tracker);
+    const int prev_huge_pages =
+        aom_mem_set_huge_pages((int)ctx->extra_cfg.huge_pages);
     ctx->cfg = *cfg;
     set_encoder_config(&ctx->oxcf, &ctx->cfg, &ctx->extra_cfg);
     // On profile change, request a key frame
@@ -1588,6 +1619,8 @@ static aom_codec_err_t encoder_set_config(aom_codec_alg_priv_t *ctx,
     if (ctx->ppi->cpi_lap != NULL) {
       av1_change_config(ctx->ppi->cpi_lap, &ctx->oxcf, is_sb_size_changed);
     }
+    aom_mem_set_huge_pages(prev_huge_pages);
+    aom_mem_set_tracker(prev_tracker);
   }
 
   if (force_key) ctx->next_frame_flags |= AOM_EFLAG_FORCE_KF;
@@ -1663,10 +1696,23 @@ static aom_codec_err_t update_encoder_cfg(aom_codec_alg_priv_t *ctx) {
 
 static aom_codec_err_t update_extra_cfg(aom_codec_alg_priv_t *ctx,
                                         const struct av1_extracfg *extra_cfg) {
-  const aom_codec_err_t res = validate_config(ctx, &ctx->cfg, extra_cfg);
+  aom_codec_err_t res = validate_config(ctx, &ctx->cfg, extra_cfg);
   if (res == AOM_CODEC_OK) {
+    const unsigned int prev_low_memory_level = ctx->extra_cfg.low_memory_level;
     ctx->extra_cfg = *extra_cfg;
-    return update_encoder_cfg(ctx);
+    aom_mem_tracker_t *const prev_tracker =
+        aom_mem_set_tracker(&ctx->mem_tracker);
+    const int prev_huge_pages =
+        aom_mem_set_huge_pages((int)extra_cfg->huge_pages);
+    res = update_encoder_cfg(ctx);
+    // Frames already in the lookahead were queued with their pyramids.
+    if (prev_low_memory_level == LOW_MEM_OFF &&
+        extra_cfg->low_memory_level != LOW_MEM_OFF &&
+        ctx->ppi->lookahead != NULL) {
+      av1_lookahead_release_pyramids(ctx->ppi->lookahead);
+    }
+    aom_mem_set_huge_pages(prev_huge_pages);
+    aom_mem_set_tracker(prev_tracker);
   }
   return res;
 }
@@ -2631,6 +2677,37 @@ static aom_codec_err_t ctrl_enable_sb_qp_sweep(aom_codec_alg_priv_t *ctx,
   return update_extra_cfg(ctx, &extra_cfg);
 }
 
+static aom_codec_err_t ctrl_set_reduced_frame_border(aom_codec_alg_priv_t *ctx,
+                                                    va_list args) {
+  if (ctx->ppi->lookahead != NULL) {
+    ERROR("AV1E_SET_REDUCED_FRAME_BORDER must be set before encoding");
+  }
+  struct av1_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.reduced_frame_border = CAST(AV1E_SET_REDUCED_FRAME_BORDER, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
+static aom_codec_err_t ctrl_set_huge_pages(aom_codec_alg_priv_t *ctx,
+                                           va_list args) {
+  struct av1_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.huge_pages = CAST(AV1E_SET_HUGE_PAGES, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
+static aom_codec_err_t ctrl_set_low_memory_level(aom_codec_alg_priv_t *ctx,
+                                                 va_list args) {
+  struct av1_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.low_memory_level = CAST(AV1E_SET_LOW_MEMORY_LEVEL, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
+static aom_codec_err_t ctrl_set_scaled_ref_cache(aom_codec_alg_priv_t *ctx,
+                                                 va_list args) {
+  struct av1_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.scaled_ref_cache = CAST(AV1E_SET_SCALED_REF_CACHE, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
 static aom_codec_err_t ctrl_set_external_partition(aom_codec_alg_priv_t *ctx,
                                                    va_list args) {
   AV1_COMP *const cpi = ctx->ppi->cpi;
@@ -2726,6 +2803,21 @@ static aom_codec_err_t ctrl_set_max_consec_frame_drop_ms_cbr(
   return AOM_CODEC_OK;
 }
 
+static aom_codec_err_t ctrl_set_zero_copy_input(aom_codec_alg_priv_t *ctx,
+                                                va_list args) {
+  const aom_zero_copy_input_t *const zero_copy =
+      CAST(AV1E_SET_ZERO_COPY_INPUT, args);
+  if (zero_copy == NULL) return AOM_CODEC_INVALID_PARAM;
+  // The lookahead buffers take the border of the input images, which frame
+  // buffer allocation requires to be a multiple of 32.
+  if (zero_copy->border & 31) return AOM_CODEC_INVALID_PARAM;
+  if (ctx->ppi->lookahead) {
+    ERROR("Zero copy input must be set before the first frame is encoded");
+  }
+  ctx->zero_copy = *zero_copy;
+  return AOM_CODEC_OK;
+}
+
 static aom_codec_err_t ctrl_set_svc_frame_drop_mode(aom_codec_alg_priv_t *ctx,
                                                     va_list args) {
   AV1_PRIMARY *const ppi = ctx->ppi;
@@ -2858,113 +2950,125 @@ static aom_codec_err_t ctrl_set_auto_intra_tools_off(aom_codec_alg_priv_t *ctx,
   return update_extra_cfg(ctx, &extra_cfg);
 }
 
-static aom_codec_err_t encoder_init(aom_codec_ctx_t *ctx) {
-  aom_codec_err_t res = AOM_CODEC_OK;
-
-  if (ctx->priv == NULL) {
-    aom_codec_alg_priv_t *const priv = aom_calloc(1, sizeof(*priv));
-    if (priv == NULL) return AOM_CODEC_MEM_ERROR;
-
-    ctx->priv = (aom_codec_priv_t *)priv;
-    ctx->priv->init_flags = ctx->init_flags;
-
-    // Update the reference to the config structure to an internal copy.
-    assert(ctx->config.enc);
-    priv->cfg = *ctx->config.enc;
-    ctx->config.enc = &priv->cfg;
-
-    priv->extra_cfg = default_extra_cfg;
-    // Special handling:
-    // By default, if omitted: --enable-cdef=1, --qm-min=5, and --qm-max=9
-    // Here we set its default values to 0, 4, and 10 respectively when
-    // --allintra is turned on.
-    // However, if users set --enable-cdef, --qm-min, or --qm-max, either from
-    // the command line or aom_codec_control(), the encoder still respects it.
-    if (priv->cfg.g_usage == AOM_USAGE_ALL_INTRA) {
-      // CDEF has been found to blur images, so it's disabled in all-intra mode
-      priv->extra_cfg.enable_cdef = 0;
-      // These QM min/max values have been found to be beneficial for images,
-      // when used with an alternative QM formula (see
-      // aom_get_qmlevel_allintra()).
-      // These values could also be beneficial for other usage modes, but
-      // further testing is required.
-      priv->extra_cfg.qm_min = DEFAULT_QM_FIRST_ALLINTRA;
-      priv->extra_cfg.qm_max = DEFAULT_QM_LAST_ALLINTRA;
-    }
-    av1_initialize_enc(priv->cfg.g_usage, priv->cfg.rc_end_usage);
+// Sets up a new encoder instance, with its allocations charged to the memory
+// tracker of the instance.
+static aom_codec_err_t init_encoder_instance(aom_codec_ctx_t *ctx,
+                                             aom_codec_alg_priv_t *priv) {
+  // Update the reference to the config structure to an internal copy.
+  assert(ctx->config.enc);
+  priv->cfg = *ctx->config.enc;
+  ctx->config.enc = &priv->cfg;
+
+  priv->extra_cfg = default_extra_cfg;
+  // Special handling:
+  // By default, if omitted: --enable-cdef=1, --qm-min=5, and --qm-max=9
+  // Here we set its default values to 0, 4, and 10 respectively when
+  // --allintra is turned on.
+  // However, if users set --enable-cdef, --qm-min, or --qm-max, either from
+  // the command line or aom_codec_control(), the encoder still respects it.
+  if (priv->cfg.g_usage == AOM_USAGE_ALL_INTRA) {
+    // CDEF has been found to blur images, so it's disabled in all-intra mode
+    priv->extra_cfg.enable_cdef = 0;
+    // These QM min/max values have been found to be beneficial for images,
+    // when used with an alternative QM formula (see
+    // aom_get_qmlevel_allintra()).
+    // These values could also be beneficial for other usage modes, but
+    // further testing is required.
+    priv->extra_cfg.qm_min = DEFAULT_QM_FIRST_ALLINTRA;
+    priv->extra_cfg.qm_max = DEFAULT_QM_LAST_ALLINTRA;
+  }
+  av1_initialize_enc(priv->cfg.g_usage, priv->cfg.rc_end_usage);
 
-    res = validate_config(priv, &priv->cfg, &priv->extra_cfg);
+  aom_codec_err_t res = validate_config(priv, &priv->cfg, &priv->extra_cfg);
 
-    if (res == AOM_CODEC_OK) {
-      int *num_lap_buffers = &priv->num_lap_buffers;
-      int lap_lag_in_frames = 0;
-      *num_lap_buffers = 0;
-      priv->timestamp_ratio.den = priv->cfg.g_timebase.den;
-      priv->timestamp_ratio.num =
-          (int64_t)priv->cfg.g_timebase.num * TICKS_PER_SEC;
-      reduce_ratio(&priv->timestamp_ratio);
-
-      set_encoder_config(&priv->oxcf, &priv->cfg, &priv->extra_cfg);
-      if (priv->oxcf.rc_cfg.mode != AOM_CBR &&
-          priv->oxcf.pass == AOM_RC_ONE_PASS && priv->oxcf.mode == GOOD) {
-        // Enable look ahead - enabled for AOM_Q, AOM_CQ, AOM_VBR
-        *num_lap_buffers =
-            AOMMIN((int)priv->cfg.g_lag_in_frames,
-                   AOMMIN(MAX_LAP_BUFFERS, priv->oxcf.kf_cfg.key_freq_max +
-                                               SCENE_CUT_KEY_TEST_INTERVAL));
-        if ((int)priv->cfg.g_lag_in_frames - (*num_lap_buffers) >=
-            LAP_LAG_IN_FRAMES) {
-          lap_lag_in_frames = LAP_LAG_IN_FRAMES;
-        }
+  if (res == AOM_CODEC_OK) {
+    int *num_lap_buffers = &priv->num_lap_buffers;
+    int lap_lag_in_frames = 0;
+    *num_lap_buffers = 0;
+    priv->timestamp_ratio.den = priv->cfg.g_timebase.den;
+    priv->timestamp_ratio.num =
+        (int64_t)priv->cfg.g_timebase.num * TICKS_PER_SEC;
+    reduce_ratio(&priv->timestamp_ratio);
+
+    set_encoder_config(&priv->oxcf, &priv->cfg, &priv->extra_cfg);
+    if (priv->oxcf.rc_cfg.mode != AOM_CBR &&
+        priv->oxcf.pass == AOM_RC_ONE_PASS && priv->oxcf.mode == GOOD) {
+      // Enable look ahead - enabled for AOM_Q, AOM_CQ, AOM_VBR
+      *num_lap_buffers =
+          AOMMIN((int)priv->cfg.g_lag_in_frames,
+                 AOMMIN(MAX_LAP_BUFFERS, priv->oxcf.kf_cfg.key_freq_max +
+                                             SCENE_CUT_KEY_TEST_INTERVAL));
+      if ((int)priv->cfg.g_lag_in_frames - (*num_lap_buffers) >=
+          LAP_LAG_IN_FRAMES) {
+        lap_lag_in_frames = LAP_LAG_IN_FRAMES;
       }
-      priv->oxcf.use_highbitdepth =
-          (ctx->init_flags & AOM_CODEC_USE_HIGHBITDEPTH) ? 1 : 0;
+    }
+    priv->oxcf.use_highbitdepth =
+        (ctx->init_flags & AOM_CODEC_USE_HIGHBITDEPTH) ? 1 : 0;
 
-      priv->monochrome_on_init = priv->cfg.monochrome;
+    priv->monochrome_on_init = priv->cfg.monochrome;
 
-      priv->ppi = av1_create_primary_compressor(&priv->pkt_list.head,
-                                                *num_lap_buffers, &priv->oxcf);
-      if (!priv->ppi) return AOM_CODEC_MEM_ERROR;
+    priv->ppi = av1_create_primary_compressor(&priv->pkt_list.head,
+                                              *num_lap_buffers, &priv->oxcf);
+    if (!priv->ppi) return AOM_CODEC_MEM_ERROR;
 
 #if !CONFIG_REALTIME_ONLY
-      res = create_stats_buffer(&priv->frame_stats_buffer,
-                                &priv->stats_buf_context, *num_lap_buffers);
-      if (res != AOM_CODEC_OK) return res;
+    res = create_stats_buffer(&priv->frame_stats_buffer,
+                              &priv->stats_buf_context, *num_lap_buffers);
+    if (res != AOM_CODEC_OK) return res;
 
-      assert(MAX_LAP_BUFFERS >= MAX_LAG_BUFFERS);
-      int size = get_stats_buf_size(*num_lap_buffers, MAX_LAG_BUFFERS);
-      for (int i = 0; i < size; i++)
-        priv->ppi->twopass.frame_stats_arr[i] = &priv->frame_stats_buffer[i];
+    assert(MAX_LAP_BUFFERS >= MAX_LAG_BUFFERS);
+    int size = get_stats_buf_size(*num_lap_buffers, MAX_LAG_BUFFERS);
+    for (int i = 0; i < size; i++)
+      priv->ppi->twopass.frame_stats_arr[i] = &priv->frame_stats_buffer[i];
 
-      priv->ppi->twopass.stats_buf_ctx = &priv->stats_buf_context;
+    priv->ppi->twopass.stats_buf_ctx = &priv->stats_buf_context;
 #endif
 
-      assert(priv->ppi->num_fp_contexts >= 1);
-      res = av1_create_context_and_bufferpool(
-          priv->ppi, &priv->ppi->parallel_cpi[0], &priv->buffer_pool,
-          &priv->oxcf, ENCODE_STAGE, -1);
-      if (res != AOM_CODEC_OK) {
-        priv->base.err_detail = "av1_create_context_and_bufferpool() failed";
-        return res;
-      }
+    assert(priv->ppi->num_fp_contexts >= 1);
+    res = av1_create_context_and_bufferpool(
+        priv->ppi, &priv->ppi->parallel_cpi[0], &priv->buffer_pool,
+        &priv->oxcf, ENCODE_STAGE, -1);
+    if (res != AOM_CODEC_OK) {
+      priv->base.err_detail = "av1_create_context_and_bufferpool() failed";
+      return res;
+    }
 #if !CONFIG_REALTIME_ONLY
-      priv->ppi->parallel_cpi[0]->twopass_frame.stats_in =
-          priv->ppi->twopass.stats_buf_ctx->stats_in_start;
+    priv->ppi->parallel_cpi[0]->twopass_frame.stats_in =
+        priv->ppi->twopass.stats_buf_ctx->stats_in_start;
 #endif
-      priv->ppi->cpi = priv->ppi->parallel_cpi[0];
+    priv->ppi->cpi = priv->ppi->parallel_cpi[0];
 
-      // Create another compressor if look ahead is enabled
-      if (res == AOM_CODEC_OK && *num_lap_buffers) {
-        res = av1_create_context_and_bufferpool(
-            priv->ppi, &priv->ppi->cpi_lap, &priv->buffer_pool_lap, &priv->oxcf,
-            LAP_STAGE, clamp(lap_lag_in_frames, 0, MAX_LAG_BUFFERS));
-      }
+    // Create another compressor if look ahead is enabled
+    if (res == AOM_CODEC_OK && *num_lap_buffers) {
+      res = av1_create_context_and_bufferpool(
+          priv->ppi, &priv->ppi->cpi_lap, &priv->buffer_pool_lap, &priv->oxcf,
+          LAP_STAGE, clamp(lap_lag_in_frames, 0, MAX_LAG_BUFFERS));
     }
   }
 
   return res;
 }
 
+static aom_codec_err_t encoder_init(aom_codec_ctx_t *ctx) {
+  aom_codec_err_t res = AOM_CODEC_OK;
+
+  if (ctx->priv == NULL) {
+    aom_codec_alg_priv_t *const priv = aom_calloc(1, sizeof(*priv));
+    if (priv == NULL) return AOM_CODEC_MEM_ERROR;
+
+    ctx->priv = (aom_codec_priv_t *)priv;
+    ctx->priv->init_flags = ctx->init_flags;
+
+    aom_mem_tracker_t *const prev_tracker =
+        aom_mem_set_tracker(&priv->mem_tracker);
+    res = init_encoder_instance(ctx, priv);
+    aom_mem_set_tracker(prev_tracker);
+  }
+
+  return res;
+}
+
 void av1_destroy_context_and_bufferpool(AV1_COMP *cpi,
                                         BufferPool **p_buffer_pool) {
   av1_remove_compressor(cpi);
@@ -3079,11 +3183,11 @@ static inline int get_src_border_in_pixels(AV1_COMP *cpi, BLOCK_SIZE sb_size) {
 
 // TODO(Mufaddal): Check feasibility of abstracting functions related to LAP
 // into a separate function.
-static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
-                                      const aom_image_t *img,
-                                      aom_codec_pts_t pts,
-                                      unsigned long duration,
-                                      aom_enc_frame_flags_t enc_flags) {
+static aom_codec_err_t encode_image(aom_codec_alg_priv_t *ctx,
+                                    const aom_image_t *img,
+                                    aom_codec_pts_t pts,
+                                    unsigned long duration,
+                                    aom_enc_frame_flags_t enc_flags) {
   const size_t kMinCompressedSize = 8192;
   volatile aom_codec_err_t res = AOM_CODEC_OK;
   AV1_PRIMARY *const ppi = ctx->ppi;
@@ -3264,23 +3368,27 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
             oxcf, oxcf->frm_dim_cfg.width, oxcf->frm_dim_cfg.height,
             ppi->number_spatial_layers);
         oxcf->border_in_pixels =
-            av1_get_enc_border_size(av1_is_resize_needed(oxcf),
+            av1_get_enc_border_size(av1_is_resize_border_needed(oxcf),
                                     oxcf->kf_cfg.key_freq_max == 0, sb_size);
         for (int i = 0; i < ppi->num_fp_contexts; i++) {
           ppi->parallel_cpi[i]->oxcf.border_in_pixels = oxcf->border_in_pixels;
         }
 
         const int src_border_in_pixels = get_src_border_in_pixels(cpi, sb_size);
+        const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_LOOKAHEAD);
         ppi->lookahead = av1_lookahead_init(
             cpi->oxcf.frm_dim_cfg.width, cpi->oxcf.frm_dim_cfg.height,
             subsampling_x, subsampling_y, use_highbitdepth, lag_in_frames,
             src_border_in_pixels, cpi->common.features.byte_alignment,
             ctx->num_lap_buffers, (cpi->oxcf.kf_cfg.key_freq_max == 0),
-            cpi->alloc_pyramid);
+            cpi->alloc_pyramid, &ctx->zero_copy);
+        aom_mem_pop_tag(prev_tag);
       }
       if (!ppi->lookahead)
         aom_internal_error(&ppi->error, AOM_CODEC_MEM_ERROR,
                            "Failed to allocate lag buffers");
+      if (ppi->cpi->oxcf.low_mem_level != LOW_MEM_OFF)
+        av1_lookahead_release_pyramids(ppi->lookahead);
       for (int i = 0; i < ppi->num_fp_contexts; i++) {
         aom_codec_err_t err =
             av1_check_initial_width(ppi->parallel_cpi[i], use_highbitdepth,
@@ -3302,7 +3410,8 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
       // Store the original flags in to the frame buffer. Will extract the
       // key frame flag when we actually encode this frame.
       if (av1_receive_raw_frame(cpi, flags | ctx->next_frame_flags, &sd,
-                                src_time_stamp, src_end_time_stamp)) {
+                                src_time_stamp, src_end_time_stamp,
+                                img->user_priv)) {
         res = update_error_state(ctx, cpi->common.error);
       }
       ctx->next_frame_flags = 0;
@@ -3612,6 +3721,32 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
   return res;
 }
 
+static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
+                                      const aom_image_t *img,
+                                      aom_codec_pts_t pts,
+                                      unsigned long duration,
+                                      aom_enc_frame_flags_t enc_flags) {
+  const struct lookahead_ctx *const lookahead = ctx->ppi->lookahead;
+  const int push_frame_count = lookahead ? lookahead->push_frame_count : 0;
+  aom_mem_tracker_t *const prev_tracker =
+      aom_mem_set_tracker(&ctx->mem_tracker);
+  const int prev_huge_pages =
+      aom_mem_set_huge_pages((int)ctx->extra_cfg.huge_pages);
+  const aom_codec_err_t res = encode_image(ctx, img, pts, duration, enc_flags);
+  aom_mem_set_huge_pages(prev_huge_pages);
+  aom_mem_set_tracker(prev_tracker);
+  // With zero copy input, the lookahead releases the images it queues. Any
+  // other image is handed back to the application here.
+  if (img != NULL && ctx->zero_copy.release_cb != NULL) {
+    const struct lookahead_ctx *const cur_lookahead = ctx->ppi->lookahead;
+    if (cur_lookahead == NULL ||
+        cur_lookahead->push_frame_count == push_frame_count) {
+      ctx->zero_copy.release_cb(ctx->zero_copy.cb_priv, img->user_priv);
+    }
+  }
+  return res;
+}
+
 static const aom_codec_cx_pkt_t *encoder_get_cxdata(aom_codec_alg_priv_t *ctx,
                                                     aom_codec_iter_t *iter) {
   return aom_codec_pkt_list_get(&ctx->pkt_list.head, iter);
@@ -4474,6 +4609,18 @@ static aom_codec_err_t encoder_set_option(aom_codec_alg_priv_t *ctx,
   } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.sb_qp_sweep, argv,
                               err_string)) {
     extra_cfg.sb_qp_sweep = arg_parse_int_helper(&arg, err_string);
+  } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.reduced_frame_border,
+                              argv, err_string)) {
+    extra_cfg.reduced_frame_border = arg_parse_uint_helper(&arg, err_string);
+  } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.huge_pages, argv,
+                              err_string)) {
+    extra_cfg.huge_pages = arg_parse_uint_helper(&arg, err_string);
+  } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.low_memory_level,
+                              argv, err_string)) {
+    extra_cfg.low_memory_level = arg_parse_uint_helper(&arg, err_string);
+  } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.scaled_ref_cache,
+                              argv, err_string)) {
+    extra_cfg.scaled_ref_cache = arg_parse_uint_helper(&arg, err_string);
   } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.kf_max_pyr_height,
                               argv, err_string)) {
     extra_cfg.kf_max_pyr_height = arg_parse_int_helper(&arg, err_string);
@@ -4553,6 +4700,14 @@ static aom_codec_err_t ctrl_get_high_motion_content_screen_rtc(
   return AOM_CODEC_OK;
 }
 
+static aom_codec_err_t ctrl_get_memory_usage(aom_codec_alg_priv_t *ctx,
+                                             va_list args) {
+  aom_memory_usage_t *const arg = va_arg(args, aom_memory_usage_t *);
+  if (arg == NULL) return AOM_CODEC_INVALID_PARAM;
+  aom_mem_get_usage(&ctx->mem_tracker, arg);
+  return AOM_CODEC_OK;
+}
+
 static aom_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { AV1_COPY_REFERENCE, ctrl_copy_reference },
   { AOME_USE_REFERENCE, ctrl_use_reference },
@@ -4703,6 +4858,11 @@ static aom_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { AV1E_SET_POSTENCODE_DROP_RTC, ctrl_set_postencode_drop_rtc },
   { AV1E_SET_MAX_CONSEC_FRAME_DROP_MS_CBR,
     ctrl_set_max_consec_frame_drop_ms_cbr },
+  { AV1E_SET_ZERO_COPY_INPUT, ctrl_set_zero_copy_input },
+  { AV1E_SET_REDUCED_FRAME_BORDER, ctrl_set_reduced_frame_border },
+  { AV1E_SET_HUGE_PAGES, ctrl_set_huge_pages },
+  { AV1E_SET_LOW_MEMORY_LEVEL, ctrl_set_low_memory_level },
+  { AV1E_SET_SCALED_REF_CACHE, ctrl_set_scaled_ref_cache },
 
   // Getters
   { AOME_GET_LAST_QUANTIZER, ctrl_get_quantizer },
@@ -4721,6 +4881,7 @@ static aom_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { AV1E_GET_LUMA_CDEF_STRENGTH, ctrl_get_luma_cdef_strength },
   { AV1E_GET_HIGH_MOTION_CONTENT_SCREEN_RTC,
     ctrl_get_high_motion_content_screen_rtc },
+  { AV1E_GET_MEMORY_USAGE, ctrl_get_memory_usage },
 
   CTRL_MAP_END,
 };
@@ -24,6 +24,7 @@
 #include "aom_dsp/aom_dsp_common.h"
 #include "aom_ports/mem.h"
 #include "aom_ports/mem_ops.h"
+#include "aom_ports/aom_timer.h"
 #include "aom_util/aom_pthread.h"
 #include "aom_util/aom_thread.h"
 
@@ -53,6 +54,8 @@ struct aom_codec_alg_priv {
   int byte_alignment;
   int skip_loop_filter;
   int skip_film_grain;
+  int fast_decode;
+  int prealloc_frame_buffers;
   int decode_tile_row;
   int decode_tile_col;
   unsigned int tile_mode;
@@ -62,12 +65,18 @@ struct aom_codec_alg_priv {
   unsigned int is_annexb;
   int operating_point;
   int output_all_layers;
+  aom_img_fmt_t output_fmt;
 
   AVxWorker *frame_worker;
 
   aom_image_t image_with_grain;
   aom_codec_frame_buffer_t grain_image_frame_buffers[MAX_NUM_SPATIAL_LAYERS];
   size_t num_grain_image_frame_buffers;
+  // Output images in the interleaved chroma format selected by output_fmt.
+  aom_image_t converted_image;
+  aom_codec_frame_buffer_t
+      converted_image_frame_buffers[MAX_NUM_SPATIAL_LAYERS];
+  size_t num_converted_image_frame_buffers;
   int need_resync;  // wait for key/intra-only frame
   // BufferPool that holds all reference frames. Shared by all the FrameWorkers.
   BufferPool *buffer_pool;
@@ -77,6 +86,9 @@ struct aom_codec_alg_priv {
   aom_get_frame_buffer_cb_fn_t get_ext_fb_cb;
   aom_release_frame_buffer_cb_fn_t release_ext_fb_cb;
 
+  // Memory usage of the instance, see AOMD_GET_MEMORY_USAGE.
+  aom_mem_tracker_t mem_tracker;
+
 #if CONFIG_INSPECTION
   aom_inspect_cb inspect_cb;
   void *inspect_ctx;
@@ -103,6 +115,8 @@ static aom_codec_err_t decoder_init(aom_codec_ctx_t *ctx) {
       ctx->config.dec = &priv->cfg;
     }
     priv->num_grain_image_frame_buffers = 0;
+    priv->num_converted_image_frame_buffers = 0;
+    priv->output_fmt = AOM_IMG_FMT_NONE;
     // Turn row_mt on by default.
     priv->row_mt = 1;
 
@@ -140,6 +154,10 @@ static aom_codec_err_t decoder_destroy(aom_codec_alg_priv_t *ctx) {
       ctx->buffer_pool->release_fb_cb(ctx->buffer_pool->cb_priv,
                                       &ctx->grain_image_frame_buffers[i]);
     }
+    for (size_t i = 0; i < ctx->num_converted_image_frame_buffers; i++) {
+      ctx->buffer_pool->release_fb_cb(ctx->buffer_pool->cb_priv,
+                                      &ctx->converted_image_frame_buffers[i]);
+    }
     av1_free_ref_frame_buffers(ctx->buffer_pool);
     av1_free_internal_frame_buffers(&ctx->buffer_pool->int_frame_buffers);
 #if CONFIG_MULTITHREAD
@@ -390,6 +408,8 @@ static void init_buffer_callbacks(aom_codec_alg_priv_t *ctx) {
   cm->features.byte_alignment = ctx->byte_alignment;
   pbi->skip_loop_filter = ctx->skip_loop_filter;
   pbi->skip_film_grain = ctx->skip_film_grain;
+  pbi->fast_decode = ctx->fast_decode;
+  pbi->prealloc_frame_buffers = ctx->prealloc_frame_buffers;
 
   if (ctx->get_ext_fb_cb != NULL && ctx->release_ext_fb_cb != NULL) {
     pool->get_fb_cb = ctx->get_ext_fb_cb;
@@ -584,6 +604,14 @@ static void release_pending_output_frames(aom_codec_alg_priv_t *ctx) {
       ctx->grain_image_frame_buffers[j].priv = NULL;
     }
     ctx->num_grain_image_frame_buffers = 0;
+    for (size_t j = 0; j < ctx->num_converted_image_frame_buffers; j++) {
+      pool->release_fb_cb(pool->cb_priv,
+                          &ctx->converted_image_frame_buffers[j]);
+      ctx->converted_image_frame_buffers[j].data = NULL;
+      ctx->converted_image_frame_buffers[j].size = 0;
+      ctx->converted_image_frame_buffers[j].priv = NULL;
+    }
+    ctx->num_converted_image_frame_buffers = 0;
   }
 }
 
@@ -672,9 +700,9 @@ static aom_codec_err_t decoder_inspect(aom_codec_alg_priv_t *ctx,
   return res;
 }
 
-static aom_codec_err_t decoder_decode(aom_codec_alg_priv_t *ctx,
-                                      const uint8_t *data, size_t data_sz,
-                                      void *user_priv) {
+static aom_codec_err_t decode_data(aom_codec_alg_priv_t *ctx,
+                                   const uint8_t *data, size_t data_sz,
+                                   void *user_priv) {
   aom_codec_err_t res = AOM_CODEC_OK;
 
 #if CONFIG_INSPECTION
@@ -702,6 +730,12 @@ static aom_codec_err_t decoder_decode(aom_codec_alg_priv_t *ctx,
     if (res != AOM_CODEC_OK) return res;
   }
 
+  {
+    FrameWorkerData *const frame_worker_data =
+        (FrameWorkerData *)ctx->frame_worker->data1;
+    av1_zero(frame_worker_data->pbi->frame_stats);
+  }
+
   const uint8_t *data_start = data;
   const uint8_t *data_end = data + data_sz;
 
@@ -763,8 +797,136 @@ static void *AllocWithGetFrameBufferCb(void *priv, size_t size) {
   return param->fb->data;
 }
 
+// Returns true if img can be output in the interleaved chroma format fmt.
+static int is_output_format_supported(aom_img_fmt_t fmt,
+                                      const aom_image_t *img) {
+  const unsigned int bit_depth = fmt == AOM_IMG_FMT_P010 ? 10 : 8;
+  return img->bit_depth == bit_depth &&
+         (img->monochrome ||
+          (img->x_chroma_shift == 1 && img->y_chroma_shift == 1));
+}
+
+// Copies the planar 4:2:0 image img into out_img, which has the format
+// AOM_IMG_FMT_NV12 or AOM_IMG_FMT_P010, interleaving U and V in the same pass.
+static void copy_to_interleaved_image(const aom_image_t *img,
+                                      aom_image_t *out_img) {
+  const int src_hbd = (img->fmt & AOM_IMG_FMT_HIGHBITDEPTH) != 0;
+  const int dst_hbd = (out_img->fmt & AOM_IMG_FMT_HIGHBITDEPTH) != 0;
+  // P010 keeps the samples in the most significant bits.
+  const int shift = dst_hbd ? 16 - (int)img->bit_depth : 0;
+  const int w = (int)img->d_w;
+  const int h = (int)img->d_h;
+  const int uv_w = (w + 1) >> 1;
+  const int uv_h = (h + 1) >> 1;
+
+  for (int r = 0; r < h; ++r) {
+    const uint8_t *src =
+        img->planes[AOM_PLANE_Y] + (ptrdiff_t)r * img->stride[AOM_PLANE_Y];
+    uint8_t *dst = out_img->planes[AOM_PLANE_Y] +
+                   (ptrdiff_t)r * out_img->stride[AOM_PLANE_Y];
+    if (!src_hbd) {
+      memcpy(dst, src, w);
+    } else if (!dst_hbd) {
+      const uint16_t *src16 = (const uint16_t *)src;
+      for (int c = 0; c < w; ++c) dst[c] = (uint8_t)src16[c];
+    } else {
+      const uint16_t *src16 = (const uint16_t *)src;
+      uint16_t *dst16 = (uint16_t *)dst;
+      for (int c = 0; c < w; ++c) dst16[c] = src16[c] << shift;
+    }
+  }
+
+  for (int r = 0; r < uv_h; ++r) {
+    const uint8_t *src_u =
+        img->planes[AOM_PLANE_U] + (ptrdiff_t)r * img->stride[AOM_PLANE_U];
+    const uint8_t *src_v =
+        img->planes[AOM_PLANE_V] + (ptrdiff_t)r * img->stride[AOM_PLANE_V];
+    uint8_t *dst = out_img->planes[AOM_PLANE_U] +
+                   (ptrdiff_t)r * out_img->stride[AOM_PLANE_U];
+    if (img->monochrome) {
+      if (dst_hbd) {
+        uint16_t *dst16 = (uint16_t *)dst;
+        for (int c = 0; c < 2 * uv_w; ++c) dst16[c] = 1 << 15;
+      } else {
+        memset(dst, 128, 2 * uv_w);
+      }
+    } else if (!src_hbd) {
+      for (int c = 0; c < uv_w; ++c) {
+        dst[2 * c] = src_u[c];
+        dst[2 * c + 1] = src_v[c];
+      }
+    } else if (!dst_hbd) {
+      const uint16_t *src_u16 = (const uint16_t *)src_u;
+      const uint16_t *src_v16 = (const uint16_t *)src_v;
+      for (int c = 0; c < uv_w; ++c) {
+        dst[2 * c] = (uint8_t)src_u16[c];
+        dst[2 * c + 1] = (uint8_t)src_v16[c];
+      }
+    } else {
+      const uint16_t *src_u16 = (const uint16_t *)src_u;
+      const uint16_t *src_v16 = (const uint16_t *)src_v;
+      uint16_t *dst16 = (uint16_t *)dst;
+      for (int c = 0; c < uv_w; ++c) {
+        dst16[2 * c] = src_u16[c] << shift;
+        dst16[2 * c + 1] = src_v16[c] << shift;
+      }
+    }
+  }
+}
+
+// Sets the properties of out_img, the interleaved copy of img, that are not
+// set by its allocation.
+static void set_interleaved_image_properties(const aom_codec_alg_priv_t *ctx,
+                                             const aom_image_t *img,
+                                             aom_image_t *out_img) {
+  out_img->bit_depth = img->bit_depth;
+  out_img->r_w = img->r_w;
+  out_img->r_h = img->r_h;
+  out_img->cp = img->cp;
+  out_img->tc = img->tc;
+  out_img->mc = img->mc;
+  out_img->monochrome = img->monochrome;
+  out_img->csp = img->csp;
+  out_img->range = img->range;
+  out_img->temporal_id = img->temporal_id;
+  out_img->spatial_id = img->spatial_id;
+  out_img->metadata = ctx->img.metadata;
+  out_img->user_priv = img->user_priv;
+}
+
+// Copies img into out_img in the format ctx->output_fmt and returns out_img,
+// or NULL if out_img cannot be allocated. Like the film grain image, out_img
+// is allocated through the frame buffer pool so that it comes from the
+// external frame buffers when the application provides them.
+static aom_image_t *convert_to_output_format(aom_codec_alg_priv_t *ctx,
+                                             const aom_image_t *img,
+                                             aom_image_t *out_img) {
+  assert(is_output_format_supported(ctx->output_fmt, img));
+
+  BufferPool *const pool = ctx->buffer_pool;
+  aom_codec_frame_buffer_t *fb =
+      &ctx->converted_image_frame_buffers
+           [ctx->num_converted_image_frame_buffers];
+  AllocCbParam param;
+  param.pool = pool;
+  param.fb = fb;
+  if (!aom_img_alloc_with_cb(out_img, ctx->output_fmt, img->d_w, img->d_h, 16,
+                             AllocWithGetFrameBufferCb, &param)) {
+    return NULL;
+  }
+
+  copy_to_interleaved_image(img, out_img);
+  set_interleaved_image_properties(ctx, img, out_img);
+  out_img->fb_priv = fb->priv;
+
+  ctx->num_converted_image_frame_buffers++;
+  return out_img;
+}
+
 // If grain_params->apply_grain is false, returns img. Otherwise, adds film
-// grain to img, saves the result in grain_img, and returns grain_img.
+// grain to img, saves the result in grain_img, and returns grain_img. If an
+// interleaved output format is selected, grain_img is written in that format
+// so the grain image does not have to be converted again.
 static aom_image_t *add_grain_if_needed(aom_codec_alg_priv_t *ctx,
                                         aom_image_t *img,
                                         aom_image_t *grain_img,
@@ -773,6 +935,8 @@ static aom_image_t *add_grain_if_needed(aom_codec_alg_priv_t *ctx,
 
   const int w_even = ALIGN_POWER_OF_TWO_UNSIGNED(img->d_w, 1);
   const int h_even = ALIGN_POWER_OF_TWO_UNSIGNED(img->d_h, 1);
+  const aom_img_fmt_t fmt =
+      ctx->output_fmt != AOM_IMG_FMT_NONE ? ctx->output_fmt : img->fmt;
 
   BufferPool *const pool = ctx->buffer_pool;
   aom_codec_frame_buffer_t *fb =
@@ -780,14 +944,24 @@ static aom_image_t *add_grain_if_needed(aom_codec_alg_priv_t *ctx,
   AllocCbParam param;
   param.pool = pool;
   param.fb = fb;
-  if (!aom_img_alloc_with_cb(grain_img, img->fmt, w_even, h_even, 16,
+  if (!aom_img_alloc_with_cb(grain_img, fmt, w_even, h_even, 16,
                              AllocWithGetFrameBufferCb, &param)) {
     return NULL;
   }
 
   grain_img->user_priv = img->user_priv;
   grain_img->fb_priv = fb->priv;
-  if (av1_add_film_grain(grain_params, img, grain_img)) {
+  int ret;
+  if (ctx->output_fmt != AOM_IMG_FMT_NONE) {
+    copy_to_interleaved_image(img, grain_img);
+    set_interleaved_image_properties(ctx, img, grain_img);
+    grain_img->d_w = img->d_w;
+    grain_img->d_h = img->d_h;
+    ret = av1_add_film_grain_in_place(grain_params, grain_img);
+  } else {
+    ret = av1_add_film_grain(grain_params, img, grain_img);
+  }
+  if (ret) {
     pool->release_fb_cb(pool->cb_priv, fb);
     return NULL;
   }
@@ -805,8 +979,8 @@ static void move_decoder_metadata_to_img(AV1Decoder *pbi, aom_image_t *img) {
   }
 }
 
-static aom_image_t *decoder_get_frame(aom_codec_alg_priv_t *ctx,
-                                      aom_codec_iter_t *iter) {
+static aom_image_t *get_next_frame(aom_codec_alg_priv_t *ctx,
+                                   aom_codec_iter_t *iter) {
   aom_image_t *img = NULL;
 
   if (!iter) {
@@ -910,9 +1084,23 @@ static aom_image_t *decoder_get_frame(aom_codec_alg_priv_t *ctx,
   img = &ctx->img;
   img->temporal_id = output_frame_buf->temporal_id;
   img->spatial_id = output_frame_buf->spatial_id;
-  if (pbi->skip_film_grain) grain_params->apply_grain = 0;
+  if (pbi->skip_film_grain || pbi->fast_decode) grain_params->apply_grain = 0;
+  if (ctx->output_fmt != AOM_IMG_FMT_NONE &&
+      !is_output_format_supported(ctx->output_fmt, img)) {
+    pbi->error.error_code = AOM_CODEC_UNSUP_BITSTREAM;
+    pbi->error.has_detail = 1;
+    snprintf(pbi->error.detail, sizeof(pbi->error.detail),
+             "Stream cannot be output in the requested format\n");
+    return NULL;
+  }
+  struct aom_usec_timer timer;
+  aom_usec_timer_start(&timer);
   aom_image_t *res =
       add_grain_if_needed(ctx, img, &ctx->image_with_grain, grain_params);
+  if (grain_params->apply_grain) {
+    aom_usec_timer_mark(&timer);
+    pbi->frame_stats.film_grain_time += aom_usec_timer_elapsed(&timer);
+  }
   if (!res) {
     pbi->error.error_code = AOM_CODEC_CORRUPT_FRAME;
     pbi->error.has_detail = 1;
@@ -920,10 +1108,42 @@ static aom_image_t *decoder_get_frame(aom_codec_alg_priv_t *ctx,
              "Grain synthesis failed\n");
     return res;
   }
+  // The film grain image is already in the output format.
+  if (ctx->output_fmt != AOM_IMG_FMT_NONE && res == img) {
+    res = convert_to_output_format(ctx, res, &ctx->converted_image);
+    if (!res) {
+      pbi->error.error_code = AOM_CODEC_MEM_ERROR;
+      pbi->error.has_detail = 1;
+      snprintf(pbi->error.detail, sizeof(pbi->error.detail),
+               "Failed to allocate the output image\n");
+      return res;
+    }
+  }
   *index += 1;  // Advance the iterator to point to the next image
   return res;
 }
 
+// The allocations made while decoding, including those of the worker threads,
+// are charged to the memory tracker of the instance.
+static aom_codec_err_t decoder_decode(aom_codec_alg_priv_t *ctx,
+                                      const uint8_t *data, size_t data_sz,
+                                      void *user_priv) {
+  aom_mem_tracker_t *const prev_tracker =
+      aom_mem_set_tracker(&ctx->mem_tracker);
+  const aom_codec_err_t res = decode_data(ctx, data, data_sz, user_priv);
+  aom_mem_set_tracker(prev_tracker);
+  return res;
+}
+
+static aom_image_t *decoder_get_frame(aom_codec_alg_priv_t *ctx,
+                                      aom_codec_iter_t *iter) {
+  aom_mem_tracker_t *const prev_tracker =
+      aom_mem_set_tracker(&ctx->mem_tracker);
+  aom_image_t *const img = get_next_frame(ctx, iter);
+  aom_mem_set_tracker(prev_tracker);
+  return img;
+}
+
 static aom_codec_err_t decoder_set_fb_fn(
     aom_codec_alg_priv_t *ctx, aom_get_frame_buffer_cb_fn_t cb_get,
     aom_release_frame_buffer_cb_fn_t cb_release, void *cb_priv) {
@@ -1102,6 +1322,33 @@ static aom_codec_err_t ctrl_get_frame_flags(aom_codec_alg_priv_t *ctx,
   return AOM_CODEC_OK;
 }
 
+static aom_codec_err_t ctrl_get_frame_stats(aom_codec_alg_priv_t *ctx,
+                                            va_list args) {
+  aom_frame_stats *const frame_stats = va_arg(args, aom_frame_stats *);
+
+  if (frame_stats) {
+    if (ctx->frame_worker) {
+      AVxWorker *const worker = ctx->frame_worker;
+      FrameWorkerData *const frame_worker_data =
+          (FrameWorkerData *)worker->data1;
+      *frame_stats = frame_worker_data->pbi->frame_stats;
+      return AOM_CODEC_OK;
+    } else {
+      return AOM_CODEC_ERROR;
+    }
+  }
+
+  return AOM_CODEC_INVALID_PARAM;
+}
+
+static aom_codec_err_t ctrl_get_memory_usage(aom_codec_alg_priv_t *ctx,
+                                             va_list args) {
+  aom_memory_usage_t *const arg = va_arg(args, aom_memory_usage_t *);
+  if (arg == NULL) return AOM_CODEC_INVALID_PARAM;
+  aom_mem_get_usage(&ctx->mem_tracker, arg);
+  return AOM_CODEC_OK;
+}
+
 static aom_codec_err_t ctrl_get_tile_info(aom_codec_alg_priv_t *ctx,
                                           va_list args) {
   aom_tile_info *const tile_info = va_arg(args, aom_tile_info *);
@@ -1565,6 +1812,17 @@ static aom_codec_err_t ctrl_set_skip_loop_filter(aom_codec_alg_priv_t *ctx,
   return AOM_CODEC_OK;
 }
 
+static aom_codec_err_t ctrl_set_output_format(aom_codec_alg_priv_t *ctx,
+                                              va_list args) {
+  const aom_img_fmt_t fmt = (aom_img_fmt_t)va_arg(args, int);
+  if (fmt != AOM_IMG_FMT_NONE && fmt != AOM_IMG_FMT_NV12 &&
+      fmt != AOM_IMG_FMT_P010) {
+    return AOM_CODEC_INVALID_PARAM;
+  }
+  ctx->output_fmt = fmt;
+  return AOM_CODEC_OK;
+}
+
 static aom_codec_err_t ctrl_set_skip_film_grain(aom_codec_alg_priv_t *ctx,
                                                 va_list args) {
   ctx->skip_film_grain = va_arg(args, int);
@@ -1578,6 +1836,35 @@ static aom_codec_err_t ctrl_set_skip_film_grain(aom_codec_alg_priv_t *ctx,
   return AOM_CODEC_OK;
 }
 
+static aom_codec_err_t ctrl_set_fast_decode(aom_codec_alg_priv_t *ctx,
+                                            va_list args) {
+  const int fast_decode = va_arg(args, int);
+  if (fast_decode < 0 || fast_decode > 3) return AOM_CODEC_INVALID_PARAM;
+  ctx->fast_decode = fast_decode;
+
+  if (ctx->frame_worker) {
+    AVxWorker *const worker = ctx->frame_worker;
+    FrameWorkerData *const frame_worker_data = (FrameWorkerData *)worker->data1;
+    frame_worker_data->pbi->fast_decode = ctx->fast_decode;
+  }
+
+  return AOM_CODEC_OK;
+}
+
+static aom_codec_err_t ctrl_set_prealloc_frame_buffers(
+    aom_codec_alg_priv_t *ctx, va_list args) {
+  ctx->prealloc_frame_buffers = va_arg(args, int) != 0;
+
+  if (ctx->frame_worker) {
+    AVxWorker *const worker = ctx->frame_worker;
+    FrameWorkerData *const frame_worker_data = (FrameWorkerData *)worker->data1;
+    frame_worker_data->pbi->prealloc_frame_buffers =
+        ctx->prealloc_frame_buffers;
+  }
+
+  return AOM_CODEC_OK;
+}
+
 static aom_codec_err_t ctrl_get_accounting(aom_codec_alg_priv_t *ctx,
                                            va_list args) {
 #if !CONFIG_ACCOUNTING
@@ -1685,6 +1972,9 @@ static aom_codec_ctrl_fn_map_t decoder_ctrl_maps[] = {
   { AV1D_SET_ROW_MT, ctrl_set_row_mt },
   { AV1D_SET_EXT_REF_PTR, ctrl_set_ext_ref_ptr },
   { AV1D_SET_SKIP_FILM_GRAIN, ctrl_set_skip_film_grain },
+  { AV1D_SET_FAST_DECODE, ctrl_set_fast_decode },
+  { AV1D_SET_PREALLOC_FRAME_BUFFERS, ctrl_set_prealloc_frame_buffers },
+  { AV1D_SET_OUTPUT_FORMAT, ctrl_set_output_format },
 
   // Getters
   { AOMD_GET_FRAME_CORRUPTED, ctrl_get_frame_corrupted },
@@ -1715,6 +2005,8 @@ static aom_codec_ctrl_fn_map_t decoder_ctrl_maps[] = {
   { AOMD_GET_BASE_Q_IDX, ctrl_get_base_q_idx },
   { AOMD_GET_ORDER_HINT, ctrl_get_order_hint },
   { AV1D_GET_MI_INFO, ctrl_get_mi_info },
+  { AOMD_GET_FRAME_STATS, ctrl_get_frame_stats },
+  { AOMD_GET_MEMORY_USAGE, ctrl_get_memory_usage },
   CTRL_MAP_END,
 };
 
@@ -49,9 +49,47 @@ void av1_zero_unused_internal_frame_buffers(InternalFrameBufferList *list) {
   assert(list != NULL);
 
   for (i = 0; i < list->num_internal_frame_buffers; ++i) {
-    if (list->int_fb[i].data && !list->int_fb[i].in_use)
-      memset(list->int_fb[i].data, 0, list->int_fb[i].size);
+    InternalFrameBuffer *const int_fb = &list->int_fb[i];
+    if (int_fb->data && !int_fb->in_use && !int_fb->zeroed) {
+      memset(int_fb->data, 0, int_fb->size);
+      int_fb->zeroed = 1;
+    }
+  }
+}
+
+// Replaces the data of int_fb with a zeroed allocation of size bytes.
+static int realloc_internal_frame_buffer(InternalFrameBuffer *int_fb,
+                                         size_t size) {
+  aom_free(int_fb->data);
+  // The data must be zeroed to fix a valgrind error from the C loop filter
+  // due to access uninitialized memory in frame border. It could be
+  // skipped if border were totally removed.
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_FRAME_BUFFERS);
+  int_fb->data = (uint8_t *)aom_calloc(1, size);
+  aom_mem_pop_tag(prev_tag);
+  if (!int_fb->data) {
+    int_fb->size = 0;
+    return -1;
   }
+  int_fb->size = size;
+  int_fb->zeroed = 1;
+  return 0;
+}
+
+int av1_prealloc_internal_frame_buffers(InternalFrameBufferList *list,
+                                        size_t size, int num) {
+  assert(list != NULL);
+  for (int i = 0; i < list->num_internal_frame_buffers && num > 0; ++i) {
+    InternalFrameBuffer *const int_fb = &list->int_fb[i];
+    if (int_fb->in_use) continue;
+    if (int_fb->size < size) {
+      if (realloc_internal_frame_buffer(int_fb, size)) return 1;
+      // calloc() may return pages that are only mapped on first access.
+      memset(int_fb->data, 0, int_fb->size);
+    }
+    --num;
+  }
+  return 0;
 }
 
 int av1_get_frame_buffer(void *cb_priv, size_t min_size,
@@ -61,29 +99,37 @@ int av1_get_frame_buffer(void *cb_priv, size_t min_size,
       (InternalFrameBufferList *)cb_priv;
   if (int_fb_list == NULL) return -1;
 
-  // Find a free frame buffer.
+  // Find the smallest free frame buffer that is large enough. If there is
+  // none, grow the smallest free frame buffer.
+  int best = -1;
   for (i = 0; i < int_fb_list->num_internal_frame_buffers; ++i) {
-    if (!int_fb_list->int_fb[i].in_use) break;
+    const InternalFrameBuffer *const int_fb = &int_fb_list->int_fb[i];
+    if (int_fb->in_use) continue;
+    if (best < 0) {
+      best = i;
+      continue;
+    }
+    const size_t best_size = int_fb_list->int_fb[best].size;
+    const int fits = int_fb->size >= min_size;
+    const int best_fits = best_size >= min_size;
+    if ((fits && !best_fits) ||
+        (fits == best_fits && int_fb->size < best_size)) {
+      best = i;
+    }
   }
 
-  if (i == int_fb_list->num_internal_frame_buffers) return -1;
-
-  if (int_fb_list->int_fb[i].size < min_size) {
-    aom_free(int_fb_list->int_fb[i].data);
-    // The data must be zeroed to fix a valgrind error from the C loop filter
-    // due to access uninitialized memory in frame border. It could be
-    // skipped if border were totally removed.
-    int_fb_list->int_fb[i].data = (uint8_t *)aom_calloc(1, min_size);
-    if (!int_fb_list->int_fb[i].data) {
-      int_fb_list->int_fb[i].size = 0;
-      return -1;
-    }
-    int_fb_list->int_fb[i].size = min_size;
+  if (best < 0) return -1;
+  i = best;
+
+  if (int_fb_list->int_fb[i].size < min_size &&
+      realloc_internal_frame_buffer(&int_fb_list->int_fb[i], min_size)) {
+    return -1;
   }
 
   fb->data = int_fb_list->int_fb[i].data;
   fb->size = int_fb_list->int_fb[i].size;
   int_fb_list->int_fb[i].in_use = 1;
+  int_fb_list->int_fb[i].zeroed = 0;
 
   // Set the frame buffer's private data to point at the internal frame buffer.
   fb->priv = &int_fb_list->int_fb[i];
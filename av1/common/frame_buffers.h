@@ -23,6 +23,9 @@ typedef struct InternalFrameBuffer {
   uint8_t *data;
   size_t size;
   int in_use;
+  // Set while data is all zeros, i.e. since it was allocated or zeroed and
+  // until it is handed out.
+  int zeroed;
 } InternalFrameBuffer;
 
 typedef struct InternalFrameBufferList {
@@ -42,10 +45,18 @@ void av1_free_internal_frame_buffers(InternalFrameBufferList *list);
 // depth.
 void av1_zero_unused_internal_frame_buffers(InternalFrameBufferList *list);
 
+// Grows up to |num| unused internal frame buffers to at least |size| bytes and
+// touches their memory, so that decoding frames of up to that size does no
+// allocation and takes no page faults. Returns 0 on success.
+int av1_prealloc_internal_frame_buffers(InternalFrameBufferList *list,
+                                        size_t size, int num);
+
 // Callback used by libaom to request an external frame buffer. |cb_priv|
 // Callback private data, which points to an InternalFrameBufferList.
 // |min_size| is the minimum size in bytes needed to decode the next frame.
-// |fb| pointer to the frame buffer.
+// |fb| pointer to the frame buffer. The smallest unused buffer of at least
+// |min_size| bytes is returned, so that the buffers sized for the largest
+// frames stay available for them when the frame size changes.
 int av1_get_frame_buffer(void *cb_priv, size_t min_size,
                          aom_codec_frame_buffer_t *fb);
 
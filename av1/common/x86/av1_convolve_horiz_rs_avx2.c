@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "config/av1_rtcd.h"
+
+#include "av1/common/convolve.h"
+#include "av1/common/resize.h"
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+// Computes the source offsets and loads the filters of the output pixels
+// [x, x + n), where n is 4 or 8. Pixel x + i goes in 128-bit lane 0 of
+// fil[i & 3] for i < 4 and in lane 1 for i >= 4. When n is 4, lane 1 repeats
+// lane 0.
+static inline void load_filters_and_offsets(const int16_t *x_filters, int x_qn,
+                                            int x_step_qn, int n,
+                                            int offset[8], __m256i fil[4]) {
+  for (int i = 0; i < 8; ++i) {
+    const int qn = x_qn + (n == 8 ? i : (i & 3)) * x_step_qn;
+    offset[i] = qn >> RS_SCALE_SUBPEL_BITS;
+  }
+  for (int i = 0; i < 4; ++i) {
+    const int qn_lo = x_qn + i * x_step_qn;
+    const int qn_hi = x_qn + (n == 8 ? i + 4 : i) * x_step_qn;
+    const int idx_lo = (qn_lo & RS_SCALE_SUBPEL_MASK) >> RS_SCALE_EXTRA_BITS;
+    const int idx_hi = (qn_hi & RS_SCALE_SUBPEL_MASK) >> RS_SCALE_EXTRA_BITS;
+    assert(idx_lo <= RS_SUBPEL_MASK);
+    assert(idx_hi <= RS_SUBPEL_MASK);
+    fil[i] = yy_loadu2_128(&x_filters[idx_hi * UPSCALE_NORMATIVE_TAPS],
+                           &x_filters[idx_lo * UPSCALE_NORMATIVE_TAPS]);
+  }
+}
+
+// Reduces the products of 8 pixels, laid out as described above, to the 8
+// filtered outputs in order, rounded and packed to 16 bits.
+static inline __m128i reduce_and_round(const __m256i conv0,
+                                       const __m256i conv1,
+                                       const __m256i conv2,
+                                       const __m256i conv3) {
+  const __m256i round_add = _mm256_set1_epi32((1 << FILTER_BITS) >> 1);
+  // ([ D C B A | d c b a ], [ S R Q P | s r q p ])
+  // -> [ S+R Q+P D+C B+A | s+r q+p d+c b+a ]
+  const __m256i conv01 = _mm256_hadd_epi32(conv0, conv1);
+  const __m256i conv23 = _mm256_hadd_epi32(conv2, conv3);
+  const __m256i conv0123 = _mm256_hadd_epi32(conv01, conv23);
+  const __m256i shifted =
+      _mm256_srai_epi32(_mm256_add_epi32(conv0123, round_add), FILTER_BITS);
+  return _mm_packus_epi32(_mm256_castsi256_si128(shifted),
+                          _mm256_extracti128_si256(shifted, 1));
+}
+
+// Note: As in the SSE4.1 version, if the crop width is not a multiple of 4,
+// then, unlike the C version, this function will overwrite some of the padding
+// on the right hand side of the frame. It never writes further than the SSE4.1
+// version does.
+void av1_convolve_horiz_rs_avx2(const uint8_t *src, int src_stride,
+                                uint8_t *dst, int dst_stride, int w, int h,
+                                const int16_t *x_filters, int x0_qn,
+                                int x_step_qn) {
+  assert(UPSCALE_NORMATIVE_TAPS == 8);
+
+  src -= UPSCALE_NORMATIVE_TAPS / 2 - 1;
+
+  int x_qn = x0_qn;
+  for (int x = 0; x < w; x += 8, x_qn += 8 * x_step_qn) {
+    const int n = w - x > 4 ? 8 : 4;
+    int offset[8];
+    __m256i fil[4];
+    load_filters_and_offsets(x_filters, x_qn, x_step_qn, n, offset, fil);
+
+    const uint8_t *src_y = src;
+    uint8_t *dst_y = dst;
+    for (int y = 0; y < h; y++, src_y += src_stride, dst_y += dst_stride) {
+      // Load up the source data, zero-extended to 16 bits. Each register
+      // holds the 8 input pixels of output pixel i and output pixel i + 4.
+      const __m256i src0_16 = _mm256_cvtepu8_epi16(
+          xx_loadu_2x64(&src_y[offset[4]], &src_y[offset[0]]));
+      const __m256i src1_16 = _mm256_cvtepu8_epi16(
+          xx_loadu_2x64(&src_y[offset[5]], &src_y[offset[1]]));
+      const __m256i src2_16 = _mm256_cvtepu8_epi16(
+          xx_loadu_2x64(&src_y[offset[6]], &src_y[offset[2]]));
+      const __m256i src3_16 = _mm256_cvtepu8_epi16(
+          xx_loadu_2x64(&src_y[offset[7]], &src_y[offset[3]]));
+
+      const __m128i shifted_16 =
+          reduce_and_round(_mm256_madd_epi16(src0_16, fil[0]),
+                           _mm256_madd_epi16(src1_16, fil[1]),
+                           _mm256_madd_epi16(src2_16, fil[2]),
+                           _mm256_madd_epi16(src3_16, fil[3]));
+      const __m128i shifted_8 = _mm_packus_epi16(shifted_16, shifted_16);
+      if (n == 8) {
+        xx_storel_64(&dst_y[x], shifted_8);
+      } else {
+        xx_storel_32(&dst_y[x], shifted_8);
+      }
+    }
+  }
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+// Note: As in the SSE4.1 version, if the crop width is not a multiple of 4,
+// then, unlike the C version, this function will overwrite some of the padding
+// on the right hand side of the frame. It never writes further than the SSE4.1
+// version does.
+void av1_highbd_convolve_horiz_rs_avx2(const uint16_t *src, int src_stride,
+                                       uint16_t *dst, int dst_stride, int w,
+                                       int h, const int16_t *x_filters,
+                                       int x0_qn, int x_step_qn, int bd) {
+  assert(UPSCALE_NORMATIVE_TAPS == 8);
+  assert(bd == 8 || bd == 10 || bd == 12);
+
+  src -= UPSCALE_NORMATIVE_TAPS / 2 - 1;
+
+  const __m128i clip_maximum = _mm_set1_epi16((1 << bd) - 1);
+
+  int x_qn = x0_qn;
+  for (int x = 0; x < w; x += 8, x_qn += 8 * x_step_qn) {
+    const int n = w - x > 4 ? 8 : 4;
+    int offset[8];
+    __m256i fil[4];
+    load_filters_and_offsets(x_filters, x_qn, x_step_qn, n, offset, fil);
+
+    const uint16_t *src_y = src;
+    uint16_t *dst_y = dst;
+    for (int y = 0; y < h; y++, src_y += src_stride, dst_y += dst_stride) {
+      // Each register holds the 8 input pixels of output pixel i and output
+      // pixel i + 4.
+      const __m256i src0_16 =
+          yy_loadu2_128(&src_y[offset[4]], &src_y[offset[0]]);
+      const __m256i src1_16 =
+          yy_loadu2_128(&src_y[offset[5]], &src_y[offset[1]]);
+      const __m256i src2_16 =
+          yy_loadu2_128(&src_y[offset[6]], &src_y[offset[2]]);
+      const __m256i src3_16 =
+          yy_loadu2_128(&src_y[offset[7]], &src_y[offset[3]]);
+
+      const __m128i shifted_16 =
+          reduce_and_round(_mm256_madd_epi16(src0_16, fil[0]),
+                           _mm256_madd_epi16(src1_16, fil[1]),
+                           _mm256_madd_epi16(src2_16, fil[2]),
+                           _mm256_madd_epi16(src3_16, fil[3]));
+
+      // Clip the values at (1 << bd) - 1
+      const __m128i clipped_16 = _mm_min_epi16(shifted_16, clip_maximum);
+      if (n == 8) {
+        xx_storeu_128(&dst_y[x], clipped_16);
+      } else {
+        xx_storel_64(&dst_y[x], clipped_16);
+      }
+    }
+  }
+}
+#endif  // CONFIG_AV1_HIGHBITDEPTH
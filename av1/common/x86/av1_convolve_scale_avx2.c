@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "config/av1_rtcd.h"
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_dsp/aom_filter.h"
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+#include "av1/common/convolve.h"
+
+// These follow the structure of av1_convolve_scale_sse4.c: the horizontal pass
+// writes its output transposed so that the 8 taps of the vertical pass are
+// contiguous, and each pass applies one filter to a run of pixels sharing it.
+// Every pass handles 8 rows (or columns) per call instead of 4, with the
+// second group of 4 in the upper 128-bit lane. When only 4 are left, the upper
+// lane repeats the lower one and only the lower half of the result is stored.
+
+// Reduces the 8 pairwise products of each 128-bit lane of c0..c3 to one sum
+// per lane, i.e. returns [ c0 c1 c2 c3 | c0' c1' c2' c3' ] where ci is the sum
+// of lane 0 of the i-th input and ci' of its lane 1.
+static inline __m256i hsum_8x4(const __m256i c0, const __m256i c1,
+                               const __m256i c2, const __m256i c3) {
+  const __m256i c01 = _mm256_hadd_epi32(c0, c1);
+  const __m256i c23 = _mm256_hadd_epi32(c2, c3);
+  return _mm256_hadd_epi32(c01, c23);
+}
+
+// Packs 8 non-negative 32-bit values to 16 bits, preserving their order.
+static inline __m128i pack_8x32(const __m256i v) {
+  return _mm_packus_epi32(_mm256_castsi256_si128(v),
+                          _mm256_extracti128_si256(v, 1));
+}
+
+static inline __m128i round_and_pack(const __m256i v, const __m256i round_add,
+                                     const __m128i round_shift) {
+  return pack_8x32(
+      _mm256_sra_epi32(_mm256_add_epi32(v, round_add), round_shift));
+}
+
+// Filters rows [0, n) of one 8-tap column of 8-bit source, where n is 4 or 8.
+static AOM_FORCE_INLINE __m256i hfilter8_rows(const uint8_t *src,
+                                              int src_stride, int n,
+                                              const __m256i coeff) {
+  const int hi_offset = n == 8 ? 4 : 0;
+  const __m256i s0 = _mm256_cvtepu8_epi16(
+      xx_loadu_2x64(src + hi_offset * src_stride, src));
+  const __m256i s1 = _mm256_cvtepu8_epi16(xx_loadu_2x64(
+      src + (1 + hi_offset) * src_stride, src + 1 * src_stride));
+  const __m256i s2 = _mm256_cvtepu8_epi16(xx_loadu_2x64(
+      src + (2 + hi_offset) * src_stride, src + 2 * src_stride));
+  const __m256i s3 = _mm256_cvtepu8_epi16(xx_loadu_2x64(
+      src + (3 + hi_offset) * src_stride, src + 3 * src_stride));
+  return hsum_8x4(
+      _mm256_madd_epi16(s0, coeff), _mm256_madd_epi16(s1, coeff),
+      _mm256_madd_epi16(s2, coeff), _mm256_madd_epi16(s3, coeff));
+}
+
+// A specialised version of hfilter, the horizontal filter for
+// av1_convolve_2d_scale_avx2. This version only supports 8 tap filters.
+static void hfilter8(const uint8_t *src, int src_stride, int16_t *dst, int w,
+                     int h, int subpel_x_qn, int x_step_qn,
+                     const InterpFilterParams *filter_params, int round) {
+  const int bd = 8;
+  const int ntaps = 8;
+
+  src -= ntaps / 2 - 1;
+
+  const int32_t round_add32 = (1 << round) / 2 + (1 << (bd + FILTER_BITS - 1));
+  const __m256i round_add = _mm256_set1_epi32(round_add32);
+  const __m128i round_shift = _mm_cvtsi32_si128(round);
+
+  int x_qn = subpel_x_qn;
+  for (int x = 0; x < w; ++x, x_qn += x_step_qn) {
+    const uint8_t *const src_col = src + (x_qn >> SCALE_SUBPEL_BITS);
+    const int filter_idx = (x_qn & SCALE_SUBPEL_MASK) >> SCALE_EXTRA_BITS;
+    assert(filter_idx < SUBPEL_SHIFTS);
+    const int16_t *filter =
+        av1_get_interp_filter_subpel_kernel(filter_params, filter_idx);
+    const __m256i coeff = _mm256_broadcastsi128_si256(xx_loadu_128(filter));
+    int16_t *const dst_col = dst + x * h;
+
+    int y = 0;
+    for (; y <= h - 8; y += 8) {
+      const __m256i conv =
+          hfilter8_rows(src_col + y * src_stride, src_stride, 8, coeff);
+      xx_storeu_128(dst_col + y, round_and_pack(conv, round_add, round_shift));
+    }
+    if (y <= h - 4) {
+      const __m256i conv =
+          hfilter8_rows(src_col + y * src_stride, src_stride, 4, coeff);
+      xx_storel_64(dst_col + y, round_and_pack(conv, round_add, round_shift));
+      y += 4;
+    }
+    for (; y < h; ++y) {
+      const uint8_t *const src_row = src_col + y * src_stride;
+
+      int32_t sum = (1 << (bd + FILTER_BITS - 1));
+      for (int k = 0; k < ntaps; ++k) {
+        sum += filter[k] * src_row[k];
+      }
+
+      dst_col[y] = ROUND_POWER_OF_TWO(sum, round);
+    }
+  }
+}
+
+// Filters columns [0, n) of the transposed intermediate block, where n is 4 or
+// 8, and returns the sums with the offset added and round_1 applied.
+static AOM_FORCE_INLINE __m256i vfilter8_cols(const int16_t *src,
+                                              int src_stride, int n,
+                                              const __m256i coeff,
+                                              const __m256i round_add,
+                                              const __m128i round_shift) {
+  const int hi_offset = n == 8 ? 4 : 0;
+  const __m256i s0 = yy_loadu2_128(src + hi_offset * src_stride, src);
+  const __m256i s1 = yy_loadu2_128(src + (1 + hi_offset) * src_stride,
+                                   src + 1 * src_stride);
+  const __m256i s2 = yy_loadu2_128(src + (2 + hi_offset) * src_stride,
+                                   src + 2 * src_stride);
+  const __m256i s3 = yy_loadu2_128(src + (3 + hi_offset) * src_stride,
+                                   src + 3 * src_stride);
+  const __m256i conv = hsum_8x4(
+      _mm256_madd_epi16(s0, coeff), _mm256_madd_epi16(s1, coeff),
+      _mm256_madd_epi16(s2, coeff), _mm256_madd_epi16(s3, coeff));
+  return _mm256_sra_epi32(_mm256_add_epi32(conv, round_add), round_shift);
+}
+
+// A specialised version of vfilter, the vertical filter for
+// av1_convolve_2d_scale_avx2. This version only supports 8 tap filters.
+static void vfilter8(const int16_t *src, int src_stride, uint8_t *dst,
+                     int dst_stride, int w, int h, int subpel_y_qn,
+                     int y_step_qn, const InterpFilterParams *filter_params,
+                     const ConvolveParams *conv_params, int bd) {
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+  const int ntaps = 8;
+
+  const __m128i round_shift = _mm_cvtsi32_si128(conv_params->round_1);
+  // Folds the 1 << offset_bits offset into the rounding constant.
+  const __m256i round_add = _mm256_set1_epi32(
+      (1 << offset_bits) + ((1 << conv_params->round_1) >> 1));
+
+  const int32_t sub32 = ((1 << (offset_bits - conv_params->round_1)) +
+                         (1 << (offset_bits - conv_params->round_1 - 1)));
+  const __m128i sub = _mm_set1_epi16(sub32);
+
+  CONV_BUF_TYPE *dst16 = conv_params->dst;
+  const int dst16_stride = conv_params->dst_stride;
+  const int bits =
+      FILTER_BITS * 2 - conv_params->round_0 - conv_params->round_1;
+  const __m128i bits_shift = _mm_cvtsi32_si128(bits);
+  const __m128i bits_const = _mm_set1_epi16(((1 << bits) >> 1));
+
+  const __m128i wt = xx_set2_epi16(conv_params->fwd_offset,
+                                   conv_params->bck_offset);
+
+  int y_qn = subpel_y_qn;
+  for (int y = 0; y < h; ++y, y_qn += y_step_qn) {
+    const int16_t *src_y = src + (y_qn >> SCALE_SUBPEL_BITS);
+    const int filter_idx = (y_qn & SCALE_SUBPEL_MASK) >> SCALE_EXTRA_BITS;
+    assert(filter_idx < SUBPEL_SHIFTS);
+    const int16_t *filter =
+        av1_get_interp_filter_subpel_kernel(filter_params, filter_idx);
+    const __m256i coeff = _mm256_broadcastsi128_si256(xx_loadu_128(filter));
+
+    int x = 0;
+    for (; x <= w - 4; x += 8) {
+      const int n = x <= w - 8 ? 8 : 4;
+      const __m256i shifted = vfilter8_cols(src_y + x * src_stride, src_stride,
+                                            n, coeff, round_add, round_shift);
+      __m128i shifted_16 = pack_8x32(shifted);
+      uint8_t *dst_x = dst + y * dst_stride + x;
+      CONV_BUF_TYPE *dst_16_x = dst16 + y * dst16_stride + x;
+
+      if (conv_params->is_compound && !conv_params->do_average) {
+        if (n == 8) {
+          xx_storeu_128(dst_16_x, shifted_16);
+        } else {
+          xx_storel_64(dst_16_x, shifted_16);
+        }
+      } else {
+        if (conv_params->is_compound) {
+          const __m128i p_16 =
+              n == 8 ? xx_loadu_128(dst_16_x) : xx_loadl_64(dst_16_x);
+          if (conv_params->use_dist_wtd_comp_avg) {
+            const __m128i wt_res_lo =
+                _mm_madd_epi16(_mm_unpacklo_epi16(p_16, shifted_16), wt);
+            const __m128i wt_res_hi =
+                _mm_madd_epi16(_mm_unpackhi_epi16(p_16, shifted_16), wt);
+            shifted_16 = _mm_packus_epi32(
+                _mm_srai_epi32(wt_res_lo, DIST_PRECISION_BITS),
+                _mm_srai_epi32(wt_res_hi, DIST_PRECISION_BITS));
+          } else {
+            shifted_16 = _mm_srai_epi16(_mm_add_epi16(p_16, shifted_16), 1);
+          }
+        }
+        const __m128i subbed = _mm_sub_epi16(shifted_16, sub);
+        const __m128i result =
+            _mm_sra_epi16(_mm_add_epi16(subbed, bits_const), bits_shift);
+        const __m128i result_8 = _mm_packus_epi16(result, result);
+        if (n == 8) {
+          xx_storel_64(dst_x, result_8);
+        } else {
+          xx_storel_32(dst_x, result_8);
+        }
+      }
+      if (n == 4) x -= 4;
+    }
+    for (; x < w; ++x) {
+      const int16_t *src_x = src_y + x * src_stride;
+      int32_t sum = 1 << offset_bits;
+      for (int k = 0; k < ntaps; ++k) sum += filter[k] * src_x[k];
+      CONV_BUF_TYPE res = ROUND_POWER_OF_TWO(sum, conv_params->round_1);
+
+      if (conv_params->is_compound) {
+        if (conv_params->do_average) {
+          int32_t tmp = dst16[y * dst16_stride + x];
+          if (conv_params->use_dist_wtd_comp_avg) {
+            tmp = tmp * conv_params->fwd_offset + res * conv_params->bck_offset;
+            tmp = tmp >> DIST_PRECISION_BITS;
+          } else {
+            tmp += res;
+            tmp = tmp >> 1;
+          }
+          /* Subtract round offset and convolve round */
+          tmp = tmp - sub32;
+          dst[y * dst_stride + x] = clip_pixel(ROUND_POWER_OF_TWO(tmp, bits));
+        } else {
+          dst16[y * dst16_stride + x] = res;
+        }
+      } else {
+        /* Subtract round offset and convolve round */
+        int32_t tmp = res - sub32;
+        dst[y * dst_stride + x] = clip_pixel(ROUND_POWER_OF_TWO(tmp, bits));
+      }
+    }
+  }
+}
+
+void av1_convolve_2d_scale_avx2(const uint8_t *src, int src_stride,
+                                uint8_t *dst8, int dst8_stride, int w, int h,
+                                const InterpFilterParams *filter_params_x,
+                                const InterpFilterParams *filter_params_y,
+                                const int subpel_x_qn, const int x_step_qn,
+                                const int subpel_y_qn, const int y_step_qn,
+                                ConvolveParams *conv_params) {
+  int16_t tmp[(2 * MAX_SB_SIZE + MAX_FILTER_TAP) * MAX_SB_SIZE];
+  int im_h = (((h - 1) * y_step_qn + subpel_y_qn) >> SCALE_SUBPEL_BITS) +
+             filter_params_y->taps;
+
+  const int xtaps = filter_params_x->taps;
+  const int ytaps = filter_params_y->taps;
+  const int fo_vert = ytaps / 2 - 1;
+  assert((xtaps == 8) && (ytaps == 8));
+  (void)xtaps;
+
+  // horizontal filter
+  hfilter8(src - fo_vert * src_stride, src_stride, tmp, w, im_h, subpel_x_qn,
+           x_step_qn, filter_params_x, conv_params->round_0);
+
+  // vertical filter (input is transposed)
+  vfilter8(tmp, im_h, dst8, dst8_stride, w, h, subpel_y_qn, y_step_qn,
+           filter_params_y, conv_params, 8);
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+// Filters rows [0, n) of one 8-tap column of 16-bit source, where n is 4 or 8.
+static AOM_FORCE_INLINE __m256i highbd_hfilter8_rows(const uint16_t *src,
+                                                     int src_stride, int n,
+                                                     const __m256i coeff) {
+  const int hi_offset = n == 8 ? 4 : 0;
+  const __m256i s0 = yy_loadu2_128(src + hi_offset * src_stride, src);
+  const __m256i s1 = yy_loadu2_128(src + (1 + hi_offset) * src_stride,
+                                   src + 1 * src_stride);
+  const __m256i s2 = yy_loadu2_128(src + (2 + hi_offset) * src_stride,
+                                   src + 2 * src_stride);
+  const __m256i s3 = yy_loadu2_128(src + (3 + hi_offset) * src_stride,
+                                   src + 3 * src_stride);
+  return hsum_8x4(
+      _mm256_madd_epi16(s0, coeff), _mm256_madd_epi16(s1, coeff),
+      _mm256_madd_epi16(s2, coeff), _mm256_madd_epi16(s3, coeff));
+}
+
+// A specialised version of hfilter, the horizontal filter for
+// av1_highbd_convolve_2d_scale_avx2. This version only supports 8 tap
+// filters.
+static void highbd_hfilter8(const uint16_t *src, int src_stride, int16_t *dst,
+                            int w, int h, int subpel_x_qn, int x_step_qn,
+                            const InterpFilterParams *filter_params, int round,
+                            int bd) {
+  const int ntaps = 8;
+
+  src -= ntaps / 2 - 1;
+
+  const int32_t round_add32 = (1 << round) / 2 + (1 << (bd + FILTER_BITS - 1));
+  const __m256i round_add = _mm256_set1_epi32(round_add32);
+  const __m128i round_shift = _mm_cvtsi32_si128(round);
+
+  int x_qn = subpel_x_qn;
+  for (int x = 0; x < w; ++x, x_qn += x_step_qn) {
+    const uint16_t *const src_col = src + (x_qn >> SCALE_SUBPEL_BITS);
+    const int filter_idx = (x_qn & SCALE_SUBPEL_MASK) >> SCALE_EXTRA_BITS;
+    assert(filter_idx < SUBPEL_SHIFTS);
+    const int16_t *filter =
+        av1_get_interp_filter_subpel_kernel(filter_params, filter_idx);
+    const __m256i coeff = _mm256_broadcastsi128_si256(xx_loadu_128(filter));
+    int16_t *const dst_col = dst + x * h;
+
+    int y = 0;
+    for (; y <= h - 8; y += 8) {
+      const __m256i conv =
+          highbd_hfilter8_rows(src_col + y * src_stride, src_stride, 8, coeff);
+      xx_storeu_128(dst_col + y, round_and_pack(conv, round_add, round_shift));
+    }
+    if (y <= h - 4) {
+      const __m256i conv =
+          highbd_hfilter8_rows(src_col + y * src_stride, src_stride, 4, coeff);
+      xx_storel_64(dst_col + y, round_and_pack(conv, round_add, round_shift));
+      y += 4;
+    }
+    for (; y < h; ++y) {
+      const uint16_t *const src_row = src_col + y * src_stride;
+
+      int32_t sum = (1 << (bd + FILTER_BITS - 1));
+      for (int k = 0; k < ntaps; ++k) {
+        sum += filter[k] * src_row[k];
+      }
+
+      dst_col[y] = ROUND_POWER_OF_TWO(sum, round);
+    }
+  }
+}
+
+// A specialised version of vfilter, the vertical filter for
+// av1_highbd_convolve_2d_scale_avx2. This version only supports 8 tap
+// filters.
+static void highbd_vfilter8(const int16_t *src, int src_stride, uint16_t *dst,
+                            int dst_stride, int w, int h, int subpel_y_qn,
+                            int y_step_qn,
+                            const InterpFilterParams *filter_params,
+                            const ConvolveParams *conv_params, int bd) {
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+  const int ntaps = 8;
+
+  const __m128i round_shift = _mm_cvtsi32_si128(conv_params->round_1);
+  // Folds the 1 << offset_bits offset into the rounding constant.
+  const __m256i round_add = _mm256_set1_epi32(
+      (1 << offset_bits) + ((1 << conv_params->round_1) >> 1));
+
+  const int32_t sub32 = ((1 << (offset_bits - conv_params->round_1)) +
+                         (1 << (offset_bits - conv_params->round_1 - 1)));
+  const __m256i sub = _mm256_set1_epi32(sub32);
+
+  CONV_BUF_TYPE *dst16 = conv_params->dst;
+  const int dst16_stride = conv_params->dst_stride;
+  const __m128i clip_pixel_ = _mm_set1_epi16((1 << bd) - 1);
+  const int bits =
+      FILTER_BITS * 2 - conv_params->round_0 - conv_params->round_1;
+  const __m128i bits_shift = _mm_cvtsi32_si128(bits);
+  const __m256i bits_const = _mm256_set1_epi32(((1 << bits) >> 1));
+
+  const __m256i wt0 = _mm256_set1_epi32(conv_params->fwd_offset);
+  const __m256i wt1 = _mm256_set1_epi32(conv_params->bck_offset);
+
+  int y_qn = subpel_y_qn;
+  for (int y = 0; y < h; ++y, y_qn += y_step_qn) {
+    const int16_t *src_y = src + (y_qn >> SCALE_SUBPEL_BITS);
+    const int filter_idx = (y_qn & SCALE_SUBPEL_MASK) >> SCALE_EXTRA_BITS;
+    assert(filter_idx < SUBPEL_SHIFTS);
+    const int16_t *filter =
+        av1_get_interp_filter_subpel_kernel(filter_params, filter_idx);
+    const __m256i coeff = _mm256_broadcastsi128_si256(xx_loadu_128(filter));
+
+    int x = 0;
+    for (; x <= w - 4; x += 8) {
+      const int n = x <= w - 8 ? 8 : 4;
+      __m256i shifted = vfilter8_cols(src_y + x * src_stride, src_stride, n,
+                                      coeff, round_add, round_shift);
+      uint16_t *dst_x = dst + y * dst_stride + x;
+      CONV_BUF_TYPE *dst_16_x = dst16 + y * dst16_stride + x;
+
+      if (conv_params->is_compound && !conv_params->do_average) {
+        const __m128i shifted_16 = pack_8x32(shifted);
+        if (n == 8) {
+          xx_storeu_128(dst_16_x, shifted_16);
+        } else {
+          xx_storel_64(dst_16_x, shifted_16);
+        }
+      } else {
+        if (conv_params->is_compound) {
+          const __m256i p_32 = _mm256_cvtepu16_epi32(
+              n == 8 ? xx_loadu_128(dst_16_x) : xx_loadl_64(dst_16_x));
+          if (conv_params->use_dist_wtd_comp_avg) {
+            shifted = _mm256_add_epi32(_mm256_mullo_epi32(p_32, wt0),
+                                       _mm256_mullo_epi32(shifted, wt1));
+            shifted = _mm256_srai_epi32(shifted, DIST_PRECISION_BITS);
+          } else {
+            shifted = _mm256_srai_epi32(_mm256_add_epi32(p_32, shifted), 1);
+          }
+        }
+        const __m256i subbed = _mm256_sub_epi32(shifted, sub);
+        const __m256i result = _mm256_sra_epi32(
+            _mm256_add_epi32(subbed, bits_const), bits_shift);
+        const __m128i result_16 =
+            _mm_min_epi16(pack_8x32(result), clip_pixel_);
+        if (n == 8) {
+          xx_storeu_128(dst_x, result_16);
+        } else {
+          xx_storel_64(dst_x, result_16);
+        }
+      }
+      if (n == 4) x -= 4;
+    }
+
+    for (; x < w; ++x) {
+      const int16_t *src_x = src_y + x * src_stride;
+      int32_t sum = 1 << offset_bits;
+      for (int k = 0; k < ntaps; ++k) sum += filter[k] * src_x[k];
+      CONV_BUF_TYPE res = ROUND_POWER_OF_TWO(sum, conv_params->round_1);
+      if (conv_params->is_compound) {
+        if (conv_params->do_average) {
+          int32_t tmp = dst16[y * dst16_stride + x];
+          if (conv_params->use_dist_wtd_comp_avg) {
+            tmp = tmp * conv_params->fwd_offset + res * conv_params->bck_offset;
+            tmp = tmp >> DIST_PRECISION_BITS;
+          } else {
+            tmp += res;
+            tmp = tmp >> 1;
+          }
+          /* Subtract round offset and convolve round */
+          tmp = tmp - sub32;
+          dst[y * dst_stride + x] =
+              clip_pixel_highbd(ROUND_POWER_OF_TWO(tmp, bits), bd);
+        } else {
+          dst16[y * dst16_stride + x] = res;
+        }
+      } else {
+        /* Subtract round offset and convolve round */
+        int32_t tmp = res - sub32;
+        dst[y * dst_stride + x] =
+            clip_pixel_highbd(ROUND_POWER_OF_TWO(tmp, bits), bd);
+      }
+    }
+  }
+}
+
+void av1_highbd_convolve_2d_scale_avx2(
+    const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w,
+    int h, const InterpFilterParams *filter_params_x,
+    const InterpFilterParams *filter_params_y, const int subpel_x_qn,
+    const int x_step_qn, const int subpel_y_qn, const int y_step_qn,
+    ConvolveParams *conv_params, int bd) {
+  DECLARE_ALIGNED(32, int16_t,
+                  tmp[(2 * MAX_SB_SIZE + MAX_FILTER_TAP) * MAX_SB_SIZE]);
+  int im_h = (((h - 1) * y_step_qn + subpel_y_qn) >> SCALE_SUBPEL_BITS) +
+             filter_params_y->taps;
+  const int xtaps = filter_params_x->taps;
+  const int ytaps = filter_params_y->taps;
+  const int fo_vert = ytaps / 2 - 1;
+
+  assert((xtaps == 8) && (ytaps == 8));
+  (void)xtaps;
+
+  // horizontal filter
+  highbd_hfilter8(src - fo_vert * src_stride, src_stride, tmp, w, im_h,
+                  subpel_x_qn, x_step_qn, filter_params_x, conv_params->round_0,
+                  bd);
+
+  // vertical filter (input is transposed)
+  highbd_vfilter8(tmp, im_h, dst, dst_stride, w, h, subpel_y_qn, y_step_qn,
+                  filter_params_y, conv_params, bd);
+}
+#endif  // CONFIG_AV1_HIGHBITDEPTH
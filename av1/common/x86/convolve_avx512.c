@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "config/av1_rtcd.h"
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_dsp/x86/convolve_avx2.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+#include "aom_dsp/x86/synonyms_avx512.h"
+#include "aom_ports/mem.h"
+#include "av1/common/convolve.h"
+#include "av1/common/filter.h"
+
+// The AVX-512 kernels handle filters of up to 8 taps on blocks at least 64
+// pixels wide, or 32 pixels for the 2D filter. Other blocks and 12-tap filters
+// are left to the AVX2 code, which is as fast there.
+//
+// As in the AVX2 code, the 8-bit filter stages use _mm512_maddubs_epi16() with
+// the filter taps halved, which is exact because all the taps are even; the
+// rounding shifts are reduced by one bit to match. Filter taps which are zero
+// for the given sub-pixel position are skipped: a filter with 2 * n nonzero
+// taps is processed as n tap pairs starting at tap 4 - n, i.e. n - 1 pixels
+// before the filtered position.
+
+static inline int use_avx512_convolve(int w,
+                                      const InterpFilterParams *filter_params) {
+  return w >= 32 && filter_params->taps == SUBPEL_TAPS;
+}
+
+static inline const int16_t *get_filter_pairs(
+    const InterpFilterParams *filter_params, int subpel_qn, int *num_pairs) {
+  const int16_t *filter = av1_get_interp_filter_subpel_kernel(
+      filter_params, subpel_qn & SUBPEL_MASK);
+  *num_pairs = get_filter_tap(filter_params, subpel_qn) >> 1;
+  return filter + SUBPEL_TAPS / 2 - *num_pairs;
+}
+
+// Tap pairs for _mm512_maddubs_epi16(): halved, as signed bytes.
+static inline int prepare_coeffs_u8(const InterpFilterParams *filter_params,
+                                    int subpel_qn, __m512i *coeffs) {
+  int num_pairs;
+  const int16_t *f = get_filter_pairs(filter_params, subpel_qn, &num_pairs);
+  for (int i = 0; i < num_pairs; ++i) {
+    const uint8_t f0 = (uint8_t)(int8_t)(f[2 * i] >> 1);
+    const uint8_t f1 = (uint8_t)(int8_t)(f[2 * i + 1] >> 1);
+    coeffs[i] = _mm512_set1_epi16((int16_t)(f0 | (f1 << 8)));
+  }
+  return num_pairs;
+}
+
+// Tap pairs for _mm512_madd_epi16().
+static inline int prepare_coeffs_16(const InterpFilterParams *filter_params,
+                                    int subpel_qn, __m512i *coeffs) {
+  int num_pairs;
+  const int16_t *f = get_filter_pairs(filter_params, subpel_qn, &num_pairs);
+  for (int i = 0; i < num_pairs; ++i) {
+    coeffs[i] = _mm512_set1_epi32((int32_t)(
+        (uint16_t)f[2 * i] | ((uint32_t)(uint16_t)f[2 * i + 1] << 16)));
+  }
+  return num_pairs;
+}
+
+static inline void prepare_shuffles(__m512i *filt) {
+  filt[0] = _mm512_broadcast_i64x4(yy_load_256(filt1_global_avx2));
+  filt[1] = _mm512_broadcast_i64x4(yy_load_256(filt2_global_avx2));
+  filt[2] = _mm512_broadcast_i64x4(yy_load_256(filt3_global_avx2));
+  filt[3] = _mm512_broadcast_i64x4(yy_load_256(filt4_global_avx2));
+}
+
+// The filter loops below are unrolled by hand with num_pairs being a
+// compile-time constant in each instantiation, so that the compiler keeps the
+// per-pair vectors in registers.
+
+static AOM_FORCE_INLINE __m512i convolve_horiz_lanes(const __m512i data,
+                                                     const __m512i *coeffs,
+                                                     const __m512i *filt,
+                                                     int num_pairs) {
+  __m512i sum =
+      _mm512_maddubs_epi16(_mm512_shuffle_epi8(data, filt[0]), coeffs[0]);
+  if (num_pairs > 1) {
+    sum = _mm512_add_epi16(
+        sum,
+        _mm512_maddubs_epi16(_mm512_shuffle_epi8(data, filt[1]), coeffs[1]));
+  }
+  if (num_pairs > 2) {
+    sum = _mm512_add_epi16(
+        sum,
+        _mm512_maddubs_epi16(_mm512_shuffle_epi8(data, filt[2]), coeffs[2]));
+  }
+  if (num_pairs > 3) {
+    sum = _mm512_add_epi16(
+        sum,
+        _mm512_maddubs_epi16(_mm512_shuffle_epi8(data, filt[3]), coeffs[3]));
+  }
+  return sum;
+}
+
+// Returns the halved filter sums of 32 pixels as int16, in pixel order. Each
+// 128-bit lane filters 8 pixels from its own 16-byte window.
+static AOM_FORCE_INLINE __m512i convolve_horiz_32(const uint8_t *s,
+                                                  const __m512i *coeffs,
+                                                  const __m512i *filt,
+                                                  int num_pairs) {
+  // The windows start at s, s + 8, s + 16 and s + 24.
+  const __m512i rows = zz_loadu2_256(s + 8, s);
+  const __m512i data =
+      _mm512_shuffle_i64x2(rows, rows, _MM_SHUFFLE(3, 1, 2, 0));
+  return convolve_horiz_lanes(data, coeffs, filt, num_pairs);
+}
+
+static AOM_FORCE_INLINE __m512i convolve_horiz_loads(const uint8_t *s,
+                                                     const __m512i *coeffs,
+                                                     int num_pairs) {
+  __m512i sum = _mm512_maddubs_epi16(zz_loadu_512(s), coeffs[0]);
+  if (num_pairs > 1) {
+    sum = _mm512_add_epi16(
+        sum, _mm512_maddubs_epi16(zz_loadu_512(s + 2), coeffs[1]));
+  }
+  if (num_pairs > 2) {
+    sum = _mm512_add_epi16(
+        sum, _mm512_maddubs_epi16(zz_loadu_512(s + 4), coeffs[2]));
+  }
+  if (num_pairs > 3) {
+    sum = _mm512_add_epi16(
+        sum, _mm512_maddubs_epi16(zz_loadu_512(s + 6), coeffs[3]));
+  }
+  return sum;
+}
+
+// Returns the halved filter sums of 64 pixels as int16 without any shuffles:
+// with unaligned loads, the byte pairs of _mm512_maddubs_epi16() line up with
+// the tap pairs of the even pixels, or of the odd pixels when offset by one.
+// even holds pixels 0, 2, ..., 62 and odd holds pixels 1, 3, ..., 63.
+static AOM_FORCE_INLINE void convolve_horiz_64(const uint8_t *s,
+                                               const __m512i *coeffs,
+                                               int num_pairs, __m512i *even,
+                                               __m512i *odd) {
+  *even = convolve_horiz_loads(s, coeffs, num_pairs);
+  *odd = convolve_horiz_loads(s + 1, coeffs, num_pairs);
+}
+
+// The vertical filters produce two output rows per iteration from a sliding
+// window of interleaved row pairs: even[i] holds rows (y + 2i, y + 2i + 1)
+// and odd[i] holds rows (y + 2i + 1, y + 2i + 2), so each pair of output rows
+// only loads and interleaves two more source rows. The rows hold either 64
+// bytes or 32 int16 values; is_16bit is a compile-time constant.
+typedef struct {
+  __m512i even_lo[4];
+  __m512i even_hi[4];
+  __m512i odd_lo[4];
+  __m512i odd_hi[4];
+  __m512i last;  // The last row loaded.
+} VertWindow;
+
+static AOM_FORCE_INLINE void unpack_rows(const __m512i a, const __m512i b,
+                                         int is_16bit, __m512i *lo,
+                                         __m512i *hi) {
+  *lo = is_16bit ? _mm512_unpacklo_epi16(a, b) : _mm512_unpacklo_epi8(a, b);
+  *hi = is_16bit ? _mm512_unpackhi_epi16(a, b) : _mm512_unpackhi_epi8(a, b);
+}
+
+static AOM_FORCE_INLINE __m512i madd_pair(const __m512i v, const __m512i c,
+                                          int is_16bit) {
+  return is_16bit ? _mm512_madd_epi16(v, c) : _mm512_maddubs_epi16(v, c);
+}
+
+static AOM_FORCE_INLINE __m512i add_sums(const __m512i a, const __m512i b,
+                                         int is_16bit) {
+  return is_16bit ? _mm512_add_epi32(a, b) : _mm512_add_epi16(a, b);
+}
+
+static AOM_FORCE_INLINE __m512i sum_pairs(const __m512i *v,
+                                          const __m512i *coeffs, int num_pairs,
+                                          int is_16bit) {
+  __m512i sum = madd_pair(v[0], coeffs[0], is_16bit);
+  if (num_pairs > 1)
+    sum = add_sums(sum, madd_pair(v[1], coeffs[1], is_16bit), is_16bit);
+  if (num_pairs > 2)
+    sum = add_sums(sum, madd_pair(v[2], coeffs[2], is_16bit), is_16bit);
+  if (num_pairs > 3)
+    sum = add_sums(sum, madd_pair(v[3], coeffs[3], is_16bit), is_16bit);
+  return sum;
+}
+
+// Loads rows 0 to 2 * num_pairs - 1 of s, with stride in bytes.
+static AOM_FORCE_INLINE void window_init(VertWindow *w, const uint8_t *s,
+                                         ptrdiff_t stride, int num_pairs,
+                                         int is_16bit) {
+  __m512i r[8];
+  for (int i = 0; i < 8; ++i) {
+    if (i < 2 * num_pairs) r[i] = zz_loadu_512(s + i * stride);
+  }
+  unpack_rows(r[0], r[1], is_16bit, &w->even_lo[0], &w->even_hi[0]);
+  w->last = r[1];
+  if (num_pairs > 1) {
+    unpack_rows(r[1], r[2], is_16bit, &w->odd_lo[0], &w->odd_hi[0]);
+    unpack_rows(r[2], r[3], is_16bit, &w->even_lo[1], &w->even_hi[1]);
+    w->last = r[3];
+  }
+  if (num_pairs > 2) {
+    unpack_rows(r[3], r[4], is_16bit, &w->odd_lo[1], &w->odd_hi[1]);
+    unpack_rows(r[4], r[5], is_16bit, &w->even_lo[2], &w->even_hi[2]);
+    w->last = r[5];
+  }
+  if (num_pairs > 3) {
+    unpack_rows(r[5], r[6], is_16bit, &w->odd_lo[2], &w->odd_hi[2]);
+    unpack_rows(r[6], r[7], is_16bit, &w->even_lo[3], &w->even_hi[3]);
+    w->last = r[7];
+  }
+}
+
+// Completes the window with row 2 * num_pairs and returns the unrounded sums
+// of output rows 0 (sum[0], sum[1]) and 1 (sum[2], sum[3]).
+static AOM_FORCE_INLINE void window_sums(VertWindow *w, const __m512i next,
+                                         const __m512i *coeffs, int num_pairs,
+                                         int is_16bit, __m512i *sum) {
+  unpack_rows(w->last, next, is_16bit, &w->odd_lo[num_pairs - 1],
+              &w->odd_hi[num_pairs - 1]);
+  w->last = next;
+  sum[0] = sum_pairs(w->even_lo, coeffs, num_pairs, is_16bit);
+  sum[1] = sum_pairs(w->even_hi, coeffs, num_pairs, is_16bit);
+  sum[2] = sum_pairs(w->odd_lo, coeffs, num_pairs, is_16bit);
+  sum[3] = sum_pairs(w->odd_hi, coeffs, num_pairs, is_16bit);
+}
+
+// Moves the window down by two rows, next being the new last row.
+static AOM_FORCE_INLINE void window_slide(VertWindow *w, const __m512i next,
+                                          int num_pairs, int is_16bit) {
+  for (int i = 0; i < 3; ++i) {
+    if (i < num_pairs - 1) {
+      w->even_lo[i] = w->even_lo[i + 1];
+      w->even_hi[i] = w->even_hi[i + 1];
+      w->odd_lo[i] = w->odd_lo[i + 1];
+      w->odd_hi[i] = w->odd_hi[i + 1];
+    }
+  }
+  unpack_rows(w->last, next, is_16bit, &w->even_lo[num_pairs - 1],
+              &w->even_hi[num_pairs - 1]);
+  w->last = next;
+}
+
+// Filters 64 columns of 8-bit rows with the halved taps and stores the
+// rounded bytes.
+static AOM_FORCE_INLINE void convolve_y_sr_64(const uint8_t *s, int stride,
+                                              uint8_t *dst, int dst_stride,
+                                              int h, const __m512i *coeffs,
+                                              int num_pairs) {
+  // ROUND_POWER_OF_TWO(sum, FILTER_BITS) on the halved sum.
+  const __m512i round_const = _mm512_set1_epi16(1 << (FILTER_BITS - 2));
+  VertWindow w;
+
+  window_init(&w, s, stride, num_pairs, 0);
+  s += 2 * num_pairs * stride;
+
+  for (int y = 0; y < h; y += 2) {
+    __m512i sum[4];
+    window_sums(&w, zz_loadu_512(s), coeffs, num_pairs, 0, sum);
+    for (int i = 0; i < 4; ++i) {
+      sum[i] = _mm512_srai_epi16(_mm512_add_epi16(sum[i], round_const),
+                                 FILTER_BITS - 1);
+    }
+    zz_storeu_512(dst, _mm512_packus_epi16(sum[0], sum[1]));
+    zz_storeu_512(dst + dst_stride, _mm512_packus_epi16(sum[2], sum[3]));
+
+    if (y + 2 < h) window_slide(&w, zz_loadu_512(s + stride), num_pairs, 0);
+    s += 2 * stride;
+    dst += 2 * dst_stride;
+  }
+}
+
+// Clips 32 int16 values to [0, 255] and stores them as bytes.
+static inline void store_u8_32(uint8_t *dst, const __m512i v) {
+  const __m512i pos = _mm512_max_epi16(v, _mm512_setzero_si512());
+  _mm256_storeu_si256((__m256i *)dst, _mm512_cvtusepi16_epi8(pos));
+}
+
+typedef struct {
+  __m512i round_v;
+  __m128i shift_v;
+  __m512i offset_v;
+  __m128i shift_bits;
+} Convolve2DRound;
+
+static inline __m512i round_2d_sum(const __m512i sum,
+                                   const Convolve2DRound *r) {
+  const __m512i v =
+      _mm512_sra_epi32(_mm512_add_epi32(sum, r->round_v), r->shift_v);
+  return _mm512_sra_epi32(_mm512_sub_epi32(v, r->offset_v), r->shift_bits);
+}
+
+// Filters 32 columns of the int16 intermediate block and stores the rounded
+// bytes.
+static AOM_FORCE_INLINE void convolve_2d_vert_32(const int16_t *im,
+                                                 int im_stride, uint8_t *dst,
+                                                 int dst_stride, int h,
+                                                 const __m512i *coeffs,
+                                                 int num_pairs,
+                                                 const Convolve2DRound *r) {
+  const uint8_t *s = (const uint8_t *)im;
+  const ptrdiff_t stride = im_stride * sizeof(*im);
+  VertWindow w;
+
+  window_init(&w, s, stride, num_pairs, 1);
+  s += 2 * num_pairs * stride;
+
+  for (int y = 0; y < h; y += 2) {
+    __m512i sum[4];
+    window_sums(&w, zz_loadu_512(s), coeffs, num_pairs, 1, sum);
+    store_u8_32(dst, _mm512_packs_epi32(round_2d_sum(sum[0], r),
+                                        round_2d_sum(sum[1], r)));
+    store_u8_32(dst + dst_stride, _mm512_packs_epi32(round_2d_sum(sum[2], r),
+                                                     round_2d_sum(sum[3], r)));
+
+    if (y + 2 < h) window_slide(&w, zz_loadu_512(s + stride), num_pairs, 1);
+    s += 2 * stride;
+    dst += 2 * dst_stride;
+  }
+}
+
+static AOM_FORCE_INLINE void convolve_2d_sr_avx512(
+    const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride, int w,
+    int h, const __m512i *coeffs_x, int pairs_x, const __m512i *coeffs_y,
+    int pairs_y, const ConvolveParams *conv_params) {
+  DECLARE_ALIGNED(64, int16_t,
+                  im_block[(MAX_SB_SIZE + MAX_FILTER_TAP - 1) * MAX_SB_SIZE]);
+  const int bd = 8;
+  const int im_stride = w;
+  const int im_h = h + 2 * pairs_y - 1;
+  const int round_0 = conv_params->round_0;
+  const int round_1 = conv_params->round_1;
+  const int bits = 2 * FILTER_BITS - round_0 - round_1;
+  const int offset_bits = bd + 2 * FILTER_BITS - round_0;
+  __m512i filt[4];
+  Convolve2DRound r;
+
+  assert(round_0 > 0 && !(h & 1));
+  prepare_shuffles(filt);
+
+  // ROUND_POWER_OF_TWO(sum + (1 << (bd + FILTER_BITS - 1)), round_0) on the
+  // halved sum.
+  const __m512i round_h = _mm512_set1_epi16(
+      (int16_t)((1 << (bd + FILTER_BITS - 2)) + ((1 << (round_0 - 1)) >> 1)));
+  const __m128i shift_h = _mm_cvtsi32_si128(round_0 - 1);
+  r.round_v = _mm512_set1_epi32((1 << offset_bits) + ((1 << round_1) >> 1));
+  r.shift_v = _mm_cvtsi32_si128(round_1);
+  // The rounding constant of the final shift by bits is folded into the
+  // offset.
+  r.offset_v = _mm512_set1_epi32((1 << (offset_bits - round_1)) +
+                                 (1 << (offset_bits - round_1 - 1)) -
+                                 ((1 << bits) >> 1));
+  r.shift_bits = _mm_cvtsi32_si128(bits);
+
+  // Only the rows and columns touched by the nonzero taps are read.
+  const uint8_t *src_horiz = src - (pairs_y - 1) * src_stride - (pairs_x - 1);
+
+  if (w == 32) {
+    for (int y = 0; y < im_h; ++y) {
+      const __m512i sum = convolve_horiz_32(src_horiz, coeffs_x, filt, pairs_x);
+      zz_storeu_512(im_block + y * im_stride,
+                    _mm512_sra_epi16(_mm512_add_epi16(sum, round_h), shift_h));
+      src_horiz += src_stride;
+    }
+  } else {
+    // Interleaves the even and odd pixels back into pixel order.
+    DECLARE_ALIGNED(64, static const uint16_t, interleave_idx[2][32]) = {
+      { 0,  32, 1,  33, 2,  34, 3,  35, 4,  36, 5,  37, 6,  38, 7,  39,
+        8,  40, 9,  41, 10, 42, 11, 43, 12, 44, 13, 45, 14, 46, 15, 47 },
+      { 16, 48, 17, 49, 18, 50, 19, 51, 20, 52, 21, 53, 22, 54, 23, 55,
+        24, 56, 25, 57, 26, 58, 27, 59, 28, 60, 29, 61, 30, 62, 31, 63 }
+    };
+    const __m512i idx0 = zz_loadu_512(interleave_idx[0]);
+    const __m512i idx1 = zz_loadu_512(interleave_idx[1]);
+    for (int y = 0; y < im_h; ++y) {
+      for (int x = 0; x < w; x += 64) {
+        __m512i even, odd;
+        convolve_horiz_64(src_horiz + x, coeffs_x, pairs_x, &even, &odd);
+        even = _mm512_sra_epi16(_mm512_add_epi16(even, round_h), shift_h);
+        odd = _mm512_sra_epi16(_mm512_add_epi16(odd, round_h), shift_h);
+        int16_t *const im = im_block + y * im_stride + x;
+        zz_storeu_512(im, _mm512_permutex2var_epi16(even, idx0, odd));
+        zz_storeu_512(im + 32, _mm512_permutex2var_epi16(even, idx1, odd));
+      }
+      src_horiz += src_stride;
+    }
+  }
+
+  for (int x = 0; x < w; x += 32) {
+    convolve_2d_vert_32(im_block + x, im_stride, dst + x, dst_stride, h,
+                        coeffs_y, pairs_y, &r);
+  }
+}
+
+void av1_convolve_2d_sr_avx512(
+    const uint8_t *src, int32_t src_stride, uint8_t *dst, int32_t dst_stride,
+    int32_t w, int32_t h, const InterpFilterParams *filter_params_x,
+    const InterpFilterParams *filter_params_y, const int32_t subpel_x_qn,
+    const int32_t subpel_y_qn, ConvolveParams *conv_params) {
+  if (!use_avx512_convolve(w, filter_params_x) ||
+      filter_params_y->taps != SUBPEL_TAPS) {
+    av1_convolve_2d_sr_avx2(src, src_stride, dst, dst_stride, w, h,
+                            filter_params_x, filter_params_y, subpel_x_qn,
+                            subpel_y_qn, conv_params);
+    return;
+  }
+
+  __m512i coeffs_x[4], coeffs_y[4];
+  const int pairs_x = prepare_coeffs_u8(filter_params_x, subpel_x_qn, coeffs_x);
+  const int pairs_y = prepare_coeffs_16(filter_params_y, subpel_y_qn, coeffs_y);
+
+  // Dispatch on the tap counts so that the inner loops are unrolled.
+  switch (pairs_x * 4 + pairs_y) {
+#define CONVOLVE_2D_SR_CASE(px, py)                                          \
+  case (px) * 4 + (py):                                                      \
+    convolve_2d_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs_x, \
+                          px, coeffs_y, py, conv_params);                   \
+    break;
+    CONVOLVE_2D_SR_CASE(1, 1)
+    CONVOLVE_2D_SR_CASE(1, 2)
+    CONVOLVE_2D_SR_CASE(1, 3)
+    CONVOLVE_2D_SR_CASE(1, 4)
+    CONVOLVE_2D_SR_CASE(2, 1)
+    CONVOLVE_2D_SR_CASE(2, 2)
+    CONVOLVE_2D_SR_CASE(2, 3)
+    CONVOLVE_2D_SR_CASE(2, 4)
+    CONVOLVE_2D_SR_CASE(3, 1)
+    CONVOLVE_2D_SR_CASE(3, 2)
+    CONVOLVE_2D_SR_CASE(3, 3)
+    CONVOLVE_2D_SR_CASE(3, 4)
+    CONVOLVE_2D_SR_CASE(4, 1)
+    CONVOLVE_2D_SR_CASE(4, 2)
+    CONVOLVE_2D_SR_CASE(4, 3)
+    CONVOLVE_2D_SR_CASE(4, 4)
+#undef CONVOLVE_2D_SR_CASE
+    default: assert(0);
+  }
+}
+
+static AOM_FORCE_INLINE void convolve_x_sr_avx512(
+    const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride, int w,
+    int h, const __m512i *coeffs, int num_pairs,
+    const ConvolveParams *conv_params) {
+  const int round_0 = conv_params->round_0;
+  const int bits = FILTER_BITS - round_0;
+  // ROUND_POWER_OF_TWO(ROUND_POWER_OF_TWO(sum, round_0), bits) on the halved
+  // sum.
+  const __m512i round_0_const =
+      _mm512_set1_epi16((int16_t)((1 << (round_0 - 1)) >> 1));
+  const __m128i round_0_shift = _mm_cvtsi32_si128(round_0 - 1);
+  const __m512i round_const = _mm512_set1_epi16((int16_t)((1 << bits) >> 1));
+  const __m128i round_shift = _mm_cvtsi32_si128(bits);
+  // Interleaves the bytes of _mm512_packus_epi16(even, odd) within each
+  // 128-bit lane.
+  const __m512i interleave = _mm512_broadcast_i32x4(
+      _mm_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15));
+  const uint8_t *s = src - (num_pairs - 1);
+
+  assert(bits >= 0 && round_0 > 0);
+
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; x += 64) {
+      __m512i res[2];
+      convolve_horiz_64(s + x, coeffs, num_pairs, &res[0], &res[1]);
+      for (int i = 0; i < 2; ++i) {
+        res[i] = _mm512_sra_epi16(_mm512_add_epi16(res[i], round_0_const),
+                                  round_0_shift);
+        res[i] = _mm512_sra_epi16(_mm512_add_epi16(res[i], round_const),
+                                  round_shift);
+      }
+      zz_storeu_512(dst + x, _mm512_shuffle_epi8(
+                                 _mm512_packus_epi16(res[0], res[1]),
+                                 interleave));
+    }
+    s += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void av1_convolve_x_sr_avx512(const uint8_t *src, int32_t src_stride,
+                              uint8_t *dst, int32_t dst_stride, int32_t w,
+                              int32_t h,
+                              const InterpFilterParams *filter_params_x,
+                              const int32_t subpel_x_qn,
+                              ConvolveParams *conv_params) {
+  // 32-wide blocks are no faster than with AVX2 here, since each row fills
+  // only half a register.
+  if (w < 64 || !use_avx512_convolve(w, filter_params_x)) {
+    av1_convolve_x_sr_avx2(src, src_stride, dst, dst_stride, w, h,
+                           filter_params_x, subpel_x_qn, conv_params);
+    return;
+  }
+
+  __m512i coeffs[4];
+  const int num_pairs = prepare_coeffs_u8(filter_params_x, subpel_x_qn, coeffs);
+  switch (num_pairs) {
+    case 1:
+      convolve_x_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs, 1,
+                           conv_params);
+      break;
+    case 2:
+      convolve_x_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs, 2,
+                           conv_params);
+      break;
+    case 3:
+      convolve_x_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs, 3,
+                           conv_params);
+      break;
+    default:
+      assert(num_pairs == 4);
+      convolve_x_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs, 4,
+                           conv_params);
+      break;
+  }
+}
+
+static AOM_FORCE_INLINE void convolve_y_sr_avx512(const uint8_t *src,
+                                                  int src_stride, uint8_t *dst,
+                                                  int dst_stride, int w, int h,
+                                                  const __m512i *coeffs,
+                                                  int num_pairs) {
+  const uint8_t *s = src - (num_pairs - 1) * src_stride;
+  assert(!(h & 1));
+  for (int x = 0; x < w; x += 64) {
+    convolve_y_sr_64(s + x, src_stride, dst + x, dst_stride, h, coeffs,
+                     num_pairs);
+  }
+}
+
+void av1_convolve_y_sr_avx512(const uint8_t *src, int32_t src_stride,
+                              uint8_t *dst, int32_t dst_stride, int32_t w,
+                              int32_t h,
+                              const InterpFilterParams *filter_params_y,
+                              const int32_t subpel_y_qn) {
+  // 32-wide blocks are no faster than with AVX2 here, since each row fills
+  // only half a register.
+  if (w < 64 || !use_avx512_convolve(w, filter_params_y)) {
+    av1_convolve_y_sr_avx2(src, src_stride, dst, dst_stride, w, h,
+                           filter_params_y, subpel_y_qn);
+    return;
+  }
+
+  __m512i coeffs[4];
+  const int num_pairs = prepare_coeffs_u8(filter_params_y, subpel_y_qn, coeffs);
+  switch (num_pairs) {
+    case 1:
+      convolve_y_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs, 1);
+      break;
+    case 2:
+      convolve_y_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs, 2);
+      break;
+    case 3:
+      convolve_y_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs, 3);
+      break;
+    default:
+      assert(num_pairs == 4);
+      convolve_y_sr_avx512(src, src_stride, dst, dst_stride, w, h, coeffs, 4);
+      break;
+  }
+}
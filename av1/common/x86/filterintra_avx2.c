@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/av1_rtcd.h"
+
+#include "aom_dsp/x86/mem_sse2.h"
+#include "aom_dsp/x86/synonyms.h"
+#include "av1/common/enums.h"
+#include "av1/common/reconintra.h"
+
+// Packs the 7 inputs of a 4x2 block into the low 7 bytes of a 64-bit word:
+// top-left, the 4 pixels above and the 2 pixels to the left. The top byte is
+// multiplied by a zero tap.
+static inline uint64_t pack_4x2_inputs(uint8_t top_left, const uint8_t *top,
+                                       uint8_t left0, uint8_t left1) {
+  return top_left | ((uint64_t)(uint32_t)loadu_int32(top) << 8) |
+         ((uint64_t)left0 << 40) | ((uint64_t)left1 << 48);
+}
+
+// Filters two independent 4x2 blocks, one per 128-bit lane. Each lane of
+// |pixels| holds the packed inputs of its block twice. Returns the first
+// output row of each block in bytes 0-3 of its lane and the second row in
+// bytes 4-7.
+static inline __m256i filter_4x2x2(const __m256i pixels, const __m256i *taps) {
+  const __m256i mul_01 = _mm256_maddubs_epi16(pixels, taps[0]);
+  const __m256i mul_23 = _mm256_maddubs_epi16(pixels, taps[1]);
+  const __m256i mul_45 = _mm256_maddubs_epi16(pixels, taps[2]);
+  const __m256i mul_67 = _mm256_maddubs_epi16(pixels, taps[3]);
+  const __m256i row0 = _mm256_hadd_epi16(mul_01, mul_23);
+  const __m256i row1 = _mm256_hadd_epi16(mul_45, mul_67);
+  __m256i output = _mm256_hadd_epi16(row0, row1);
+  output = _mm256_srai_epi16(
+      _mm256_add_epi16(output, _mm256_set1_epi16(1 << 3)), 4);
+  return _mm256_packus_epi16(output, output);
+}
+
+static inline void store_4x2(uint8_t *dst, ptrdiff_t stride, __m128i rows) {
+  xx_storel_32(dst, rows);
+  xx_storel_32(dst + stride, _mm_srli_si128(rows, 4));
+}
+
+// The recursive filter makes every 4x2 block depend on the blocks to its left,
+// above and above-left, so the blocks of a row cannot be filtered together.
+// Instead, each 4-row stripe is filtered as a two-stage wavefront: lane 0
+// filters rows 0-1 of column c while lane 1 filters rows 2-3 of column c - 1,
+// whose top row lane 0 produced in the previous step.
+void av1_filter_intra_predictor_avx2(uint8_t *dst, ptrdiff_t stride,
+                                     TX_SIZE tx_size, const uint8_t *above,
+                                     const uint8_t *left, int mode) {
+  const int bw = tx_size_wide[tx_size];
+  const int bh = tx_size_high[tx_size];
+  // A 4-wide block is a single column of dependent 4x2 blocks, with nothing
+  // to filter alongside it.
+  if (bw == 4) {
+    av1_filter_intra_predictor_sse4_1(dst, stride, tx_size, above, left, mode);
+    return;
+  }
+  const int cols = bw >> 2;
+
+  __m256i taps[4];
+  for (int i = 0; i < 4; ++i) {
+    taps[i] = _mm256_broadcastsi128_si256(
+        xx_load_128(av1_filter_intra_taps[mode][2 * i]));
+  }
+
+  for (int r = 0; r < bh; r += 4) {
+    uint8_t *const row0 = dst + r * stride;
+    uint8_t *const row1 = row0 + stride;
+    uint8_t *const row2 = row1 + stride;
+    uint8_t *const row3 = row2 + stride;
+    const uint8_t *const top = r ? row0 - stride : above;
+    const uint8_t top_left = r ? left[r - 1] : above[-1];
+
+    for (int c = 0; c <= cols; ++c) {
+      const int x0 = 4 * c;
+      const int x1 = x0 - 4;
+      uint64_t upper = 0;
+      uint64_t lower = 0;
+      if (c < cols) {
+        upper = c ? pack_4x2_inputs(top[x0 - 1], top + x0, row0[x0 - 1],
+                                    row1[x0 - 1])
+                  : pack_4x2_inputs(top_left, top, left[r], left[r + 1]);
+      }
+      if (c > 0) {
+        lower = x1 ? pack_4x2_inputs(row1[x1 - 1], row1 + x1, row2[x1 - 1],
+                                     row3[x1 - 1])
+                   : pack_4x2_inputs(left[r + 1], row1, left[r + 2],
+                                     left[r + 3]);
+      }
+      const __m256i output = filter_4x2x2(
+          _mm256_set_epi64x((int64_t)lower, (int64_t)lower, (int64_t)upper,
+                            (int64_t)upper),
+          taps);
+      if (c < cols) {
+        store_4x2(row0 + x0, stride, _mm256_castsi256_si128(output));
+      }
+      if (c > 0) {
+        store_4x2(row2 + x1, stride, _mm256_extracti128_si256(output, 1));
+      }
+    }
+  }
+}
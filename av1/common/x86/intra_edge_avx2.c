@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "config/aom_config.h"
+#include "config/av1_rtcd.h"
+
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+// Stores the first len (1 <= len <= 16) of the 16 filtered 8-bit samples in d
+// to out. Like the SSE4.1 version, this may rewrite (unchanged) samples past
+// the end of the edge, but never further than the SSE4.1 version does.
+static inline void store_filtered_edge(uint8_t *out, __m128i d, int len) {
+  if (len >= 16) {
+    xx_storeu_128(out, d);
+    return;
+  }
+  const __m128i iden =
+      _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i mask = _mm_cmpgt_epi8(_mm_set1_epi8(len), iden);
+  const __m128i out0 = _mm_blendv_epi8(xx_loadu_128(out), d, mask);
+  if (len > 8) {
+    xx_storeu_128(out, out0);
+  } else {
+    xx_storel_64(out, out0);
+  }
+}
+
+void av1_filter_intra_edge_avx2(uint8_t *p, int sz, int strength) {
+  if (!strength) return;
+  assert(sz >= 1 && sz <= 129);
+
+  DECLARE_ALIGNED(16, static const int8_t, kern[3][16]) = {
+    { 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0 },  // strength 1: 4,8,4
+    { 5, 6, 5, 0, 5, 6, 5, 0, 5, 6, 5, 0, 5, 6, 5, 0 },  // strength 2: 5,6,5
+    { 2, 4, 4, 4, 2, 0, 0, 0, 2, 4, 4, 4, 2, 0, 0, 0 }  // strength 3: 2,4,4,4,2
+  };
+
+  DECLARE_ALIGNED(16, static const int8_t, v_const[3][16]) = {
+    { 0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6 },
+    { 4, 5, 6, 7, 5, 6, 7, 8, 6, 7, 8, 9, 7, 8, 9, 10 },
+    { 0, 1, 2, 3, 4, 5, 6, 7, 1, 2, 3, 4, 5, 6, 7, 8 },
+  };
+
+  // Extend the first and last samples to simplify the loop for the 5-tap case
+  p[-1] = p[0];
+  xx_storeu_128(&p[sz], _mm_set1_epi8((char)p[sz - 1]));
+
+  // Adjust input pointer for filter support area
+  const uint8_t *in = (strength == 3) ? p - 1 : p;
+
+  // Avoid modifying first sample
+  uint8_t *out = p + 1;
+  int len = sz - 1;
+
+  const __m256i coef0 =
+      _mm256_broadcastsi128_si256(xx_load_128(kern[strength - 1]));
+  const __m256i eight = _mm256_set1_epi16(8);
+
+  // Each iteration filters 16 samples, 8 per 128-bit lane. The low lane
+  // holds input samples 0-15 and the high lane samples 8-23.
+  if (strength < 3) {  // 3-tap filter
+    const __m256i shuf0 = _mm256_broadcastsi128_si256(xx_load_128(v_const[0]));
+    const __m256i shuf1 = _mm256_broadcastsi128_si256(xx_load_128(v_const[1]));
+    __m256i in0 = yy_loadu_256(in);
+    while (len > 0) {
+      // Load the next inputs before the outputs overwrite them.
+      const __m256i in16 = len > 16 ? yy_loadu_256(in + 16) : in0;
+      const __m256i x = _mm256_permute4x64_epi64(in0, 0x94);
+      __m256i d0 = _mm256_shuffle_epi8(x, shuf0);
+      __m256i d1 = _mm256_shuffle_epi8(x, shuf1);
+      d0 = _mm256_maddubs_epi16(d0, coef0);
+      d1 = _mm256_maddubs_epi16(d1, coef0);
+      d0 = _mm256_hadd_epi16(d0, d1);
+      d0 = _mm256_srai_epi16(_mm256_add_epi16(d0, eight), 4);
+      store_filtered_edge(out,
+                          _mm_packus_epi16(_mm256_castsi256_si128(d0),
+                                           _mm256_extracti128_si256(d0, 1)),
+                          len);
+      in0 = in16;
+      in += 16;
+      out += 16;
+      len -= 16;
+    }
+  } else {  // 5-tap filter
+    const __m256i two = _mm256_set1_epi8(2);
+    const __m256i shuf_a =
+        _mm256_broadcastsi128_si256(xx_load_128(v_const[2]));
+    const __m256i shuf_b = _mm256_add_epi8(shuf_a, two);
+    const __m256i shuf_c = _mm256_add_epi8(shuf_b, two);
+    const __m256i shuf_d = _mm256_add_epi8(shuf_c, two);
+    __m256i in0 = yy_loadu_256(in);
+    while (len > 0) {
+      // Load the next inputs before the outputs overwrite them.
+      const __m256i in16 = len > 16 ? yy_loadu_256(in + 16) : in0;
+      const __m256i x = _mm256_permute4x64_epi64(in0, 0x94);
+      __m256i d0 = _mm256_shuffle_epi8(x, shuf_a);
+      __m256i d1 = _mm256_shuffle_epi8(x, shuf_b);
+      __m256i d2 = _mm256_shuffle_epi8(x, shuf_c);
+      __m256i d3 = _mm256_shuffle_epi8(x, shuf_d);
+      d0 = _mm256_maddubs_epi16(d0, coef0);
+      d1 = _mm256_maddubs_epi16(d1, coef0);
+      d2 = _mm256_maddubs_epi16(d2, coef0);
+      d3 = _mm256_maddubs_epi16(d3, coef0);
+      d0 = _mm256_hadd_epi16(d0, d1);
+      d2 = _mm256_hadd_epi16(d2, d3);
+      d0 = _mm256_hadd_epi16(d0, d2);
+      d0 = _mm256_srai_epi16(_mm256_add_epi16(d0, eight), 4);
+      store_filtered_edge(out,
+                          _mm_packus_epi16(_mm256_castsi256_si128(d0),
+                                           _mm256_extracti128_si256(d0, 1)),
+                          len);
+      in0 = in16;
+      in += 16;
+      out += 16;
+      len -= 16;
+    }
+  }
+}
+
+void av1_upsample_intra_edge_avx2(uint8_t *p, int sz) {
+  // interpolate half-sample positions
+  assert(sz <= 24);
+
+  DECLARE_ALIGNED(16, static const int8_t, kernel[1][16]) = {
+    { -1, 9, 9, -1, -1, 9, 9, -1, -1, 9, 9, -1, -1, 9, 9, -1 }
+  };
+
+  DECLARE_ALIGNED(
+      16, static const int8_t,
+      v_const[2][16]) = { { 0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6 },
+                          { 4, 5, 6, 7, 5, 6, 7, 8, 6, 7, 8, 9, 7, 8, 9, 10 } };
+
+  // Extend first/last samples (upper-left p[-1], last p[sz-1])
+  // to support 4-tap filter
+  p[-2] = p[-1];
+  p[sz] = p[sz - 1];
+
+  uint8_t *in = &p[-2];
+  uint8_t *out = &p[-2];
+
+  int n = sz + 1;  // Input length including upper-left sample
+
+  // The whole input is loaded before the output overwrites it. The low lane
+  // of x0 holds samples 0-15 and the high lane samples 16-31.
+  const __m256i x0 = yy_loadu_256(in);
+  const __m256i x16 = _mm256_permute2x128_si256(x0, x0, 0x81);
+  const __m256i x8 = _mm256_alignr_epi8(x16, x0, 8);
+
+  const __m256i coef0 = _mm256_broadcastsi128_si256(xx_load_128(kernel[0]));
+  const __m256i shuf0 = _mm256_broadcastsi128_si256(xx_load_128(v_const[0]));
+  const __m256i shuf1 = _mm256_broadcastsi128_si256(xx_load_128(v_const[1]));
+  const __m256i eight = _mm256_set1_epi16(8);
+
+  // Interpolate half-sample positions 0-7 and 16-23 from x0 and 8-15 and
+  // 24-31 from x8.
+  __m256i d0 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(x0, shuf0), coef0);
+  __m256i d1 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(x0, shuf1), coef0);
+  __m256i d2 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(x8, shuf0), coef0);
+  __m256i d3 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(x8, shuf1), coef0);
+  d0 = _mm256_hadd_epi16(d0, d1);
+  d2 = _mm256_hadd_epi16(d2, d3);
+  d0 = _mm256_srai_epi16(_mm256_add_epi16(d0, eight), 4);
+  d2 = _mm256_srai_epi16(_mm256_add_epi16(d2, eight), 4);
+  d0 = _mm256_packus_epi16(d0, d2);
+  const __m256i x1 = _mm256_alignr_epi8(x16, x0, 1);
+  const __m256i out0 = _mm256_unpacklo_epi8(x1, d0);
+  const __m256i out1 = _mm256_unpackhi_epi8(x1, d0);
+  yy_storeu_256(&out[0], _mm256_permute2x128_si256(out0, out1, 0x20));
+  if (n > 16) {
+    yy_storeu_256(&out[32], _mm256_permute2x128_si256(out0, out1, 0x31));
+  }
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+
+// Stores the first len (1 <= len <= 16) of the 16 filtered samples in d to
+// out, with the same write extent as store_filtered_edge().
+static inline void highbd_store_filtered_edge(uint16_t *out, __m256i d,
+                                              int len) {
+  if (len >= 16) {
+    yy_storeu_256(out, d);
+    return;
+  }
+  const __m256i iden =
+      _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m256i mask = _mm256_cmpgt_epi16(_mm256_set1_epi16(len), iden);
+  if (len > 8) {
+    yy_storeu_256(out, _mm256_blendv_epi8(yy_loadu_256(out), d, mask));
+  } else {
+    xx_storeu_128(out, _mm_blendv_epi8(xx_loadu_128(out),
+                                       _mm256_castsi256_si128(d),
+                                       _mm256_castsi256_si128(mask)));
+  }
+}
+
+// Loads the 16 input samples that follow the current ones before the outputs
+// overwrite them, reading no further than the SSE4.1 version does. Only the
+// low 8 are needed while at most 16 outputs remain.
+static inline __m256i load_next_inputs(const uint16_t *in, int len) {
+  if (len > 16) return yy_loadu_256(in);
+  if (len > 8) return _mm256_castsi128_si256(xx_loadu_128(in));
+  return _mm256_setzero_si256();
+}
+
+void av1_highbd_filter_intra_edge_avx2(uint16_t *p, int sz, int strength) {
+  if (!strength) return;
+  assert(sz >= 1 && sz <= 129);
+
+  DECLARE_ALIGNED(16, static const int16_t, kern[3][8]) = {
+    { 4, 8, 4, 8, 4, 8, 4, 8 },  // strength 1: 4,8,4
+    { 5, 6, 5, 6, 5, 6, 5, 6 },  // strength 2: 5,6,5
+    { 2, 4, 2, 4, 2, 4, 2, 4 }   // strength 3: 2,4,4,4,2
+  };
+
+  // Extend the first and last samples to simplify the loop for the 5-tap case
+  p[-1] = p[0];
+  xx_storeu_128(&p[sz], _mm_set1_epi16(p[sz - 1]));
+
+  // Adjust input pointer for filter support area
+  const uint16_t *in = (strength == 3) ? p - 1 : p;
+
+  // Avoid modifying first sample
+  uint16_t *out = p + 1;
+  int len = sz - 1;
+
+  const __m256i coef0 =
+      _mm256_broadcastsi128_si256(xx_load_128(kern[strength - 1]));
+  const __m256i eight = _mm256_set1_epi16(8);
+
+  // Each iteration filters 16 samples, 8 per 128-bit lane. The alignr shifts
+  // below work within each lane, so in8 holds the 8 samples that follow each
+  // lane of in0.
+  if (strength < 3) {  // 3-tap filter
+    __m256i in0 = yy_loadu_256(in);
+    while (len > 0) {
+      const __m256i in16 = load_next_inputs(in + 16, len);
+      const __m256i in8 = _mm256_permute2x128_si256(in0, in16, 0x21);
+      const __m256i in1 = _mm256_alignr_epi8(in8, in0, 2);
+      const __m256i in2 = _mm256_alignr_epi8(in8, in0, 4);
+      const __m256i in02 = _mm256_add_epi16(in0, in2);
+      __m256i d0 = _mm256_unpacklo_epi16(in02, in1);
+      __m256i d1 = _mm256_unpackhi_epi16(in02, in1);
+      d0 = _mm256_mullo_epi16(d0, coef0);
+      d1 = _mm256_mullo_epi16(d1, coef0);
+      d0 = _mm256_hadd_epi16(d0, d1);
+      d0 = _mm256_srli_epi16(_mm256_add_epi16(d0, eight), 4);
+      highbd_store_filtered_edge(out, d0, len);
+      in0 = in16;
+      in += 16;
+      out += 16;
+      len -= 16;
+    }
+  } else {  // 5-tap filter
+    __m256i in0 = yy_loadu_256(in);
+    while (len > 0) {
+      const __m256i in16 = load_next_inputs(in + 16, len);
+      const __m256i in8 = _mm256_permute2x128_si256(in0, in16, 0x21);
+      const __m256i in1 = _mm256_alignr_epi8(in8, in0, 2);
+      const __m256i in2 = _mm256_alignr_epi8(in8, in0, 4);
+      const __m256i in3 = _mm256_alignr_epi8(in8, in0, 6);
+      const __m256i in4 = _mm256_alignr_epi8(in8, in0, 8);
+      const __m256i in04 = _mm256_add_epi16(in0, in4);
+      const __m256i in123 =
+          _mm256_add_epi16(_mm256_add_epi16(in1, in2), in3);
+      __m256i d0 = _mm256_unpacklo_epi16(in04, in123);
+      __m256i d1 = _mm256_unpackhi_epi16(in04, in123);
+      d0 = _mm256_mullo_epi16(d0, coef0);
+      d1 = _mm256_mullo_epi16(d1, coef0);
+      d0 = _mm256_hadd_epi16(d0, d1);
+      d0 = _mm256_srli_epi16(_mm256_add_epi16(d0, eight), 4);
+      highbd_store_filtered_edge(out, d0, len);
+      in0 = in16;
+      in += 16;
+      out += 16;
+      len -= 16;
+    }
+  }
+}
+
+void av1_highbd_upsample_intra_edge_avx2(uint16_t *p, int sz, int bd) {
+  // interpolate half-sample positions
+  assert(sz <= 24);
+
+  DECLARE_ALIGNED(16, static const int16_t,
+                  kernel[1][8]) = { { -1, 9, -1, 9, -1, 9, -1, 9 } };
+
+  // Extend first/last samples (upper-left p[-1], last p[sz-1])
+  // to support 4-tap filter
+  p[-2] = p[-1];
+  p[sz] = p[sz - 1];
+
+  uint16_t *in = &p[-2];
+  uint16_t *out = in;
+  int n = sz + 1;
+
+  // The whole input is loaded before the output overwrites it.
+  __m128i in0 = xx_loadu_128(&in[0]);
+  __m128i in8 = xx_loadu_128(&in[8]);
+  __m128i in16 = xx_loadu_128(&in[16]);
+  __m128i in24 = xx_loadu_128(&in[24]);
+
+  const __m256i coef0 = _mm256_broadcastsi128_si256(xx_load_128(kernel[0]));
+  const __m256i eight = _mm256_set1_epi32(8);
+  const __m256i max0 = _mm256_set1_epi16((1 << bd) - 1);
+
+  while (n > 0) {
+    // Interpolate 16 half-sample positions, 8 per 128-bit lane.
+    const __m256i x0 = yy_set_m128i(in8, in0);
+    const __m256i x8 = yy_set_m128i(in16, in8);
+    const __m256i x1 = _mm256_alignr_epi8(x8, x0, 2);
+    const __m256i x2 = _mm256_alignr_epi8(x8, x0, 4);
+    const __m256i x3 = _mm256_alignr_epi8(x8, x0, 6);
+    const __m256i sum0 = _mm256_add_epi16(x0, x3);
+    const __m256i sum1 = _mm256_add_epi16(x1, x2);
+    __m256i d0 = _mm256_unpacklo_epi16(sum0, sum1);
+    __m256i d1 = _mm256_unpackhi_epi16(sum0, sum1);
+    d0 = _mm256_madd_epi16(d0, coef0);
+    d1 = _mm256_madd_epi16(d1, coef0);
+    d0 = _mm256_srai_epi32(_mm256_add_epi32(d0, eight), 4);
+    d1 = _mm256_srai_epi32(_mm256_add_epi32(d1, eight), 4);
+    d0 = _mm256_min_epi16(_mm256_packus_epi32(d0, d1), max0);
+    const __m256i out0 = _mm256_unpacklo_epi16(x1, d0);
+    const __m256i out1 = _mm256_unpackhi_epi16(x1, d0);
+    yy_storeu_256(&out[0], _mm256_permute2x128_si256(out0, out1, 0x20));
+    // Match the SSE4.1 write extent, which works on 8 inputs at a time.
+    if (n > 8) {
+      yy_storeu_256(&out[16], _mm256_permute2x128_si256(out0, out1, 0x31));
+    }
+    in0 = in16;
+    in8 = in24;
+    in16 = _mm_setzero_si128();
+    in24 = _mm_setzero_si128();
+    out += 32;
+    n -= 16;
+  }
+}
+
+#endif  // CONFIG_AV1_HIGHBITDEPTH
@@ -668,6 +668,14 @@ static void dec_build_inter_predictors(const AV1_COMMON *cm,
                                        const MB_MODE_INFO *mi,
                                        int build_for_obmc, int bw, int bh,
                                        int mi_x, int mi_y) {
+  if (dcb->bilinear_mc) {
+    // The filters of the sub8x8 chroma neighbors are left unchanged.
+    MB_MODE_INFO bilinear_mi = *mi;
+    bilinear_mi.interp_filters = av1_broadcast_interp_filter(BILINEAR);
+    build_inter_predictors(cm, &dcb->xd, plane, &bilinear_mi, build_for_obmc,
+                           bw, bh, mi_x, mi_y, dcb->mc_buf);
+    return;
+  }
   build_inter_predictors(cm, &dcb->xd, plane, mi, build_for_obmc, bw, bh, mi_x,
                          mi_y, dcb->mc_buf);
 }
@@ -680,6 +688,7 @@ static inline void dec_build_inter_predictor(const AV1_COMMON *cm,
   const int num_planes = av1_num_planes(cm);
   for (int plane = 0; plane < num_planes; ++plane) {
     if (plane && !xd->is_chroma_ref) break;
+    if (dcb->merged_mc_planes & (1 << plane)) continue;
     const int mi_x = mi_col * MI_SIZE;
     const int mi_y = mi_row * MI_SIZE;
     dec_build_inter_predictors(cm, dcb, plane, xd->mi[0], 0,
@@ -1250,6 +1259,130 @@ static PARTITION_TYPE read_partition(MACROBLOCKD *xd, int mi_row, int mi_col,
   }
 }
 
+// Returns true if the inter prediction of 'mbmi' can be built together with
+// that of 'ref_mbmi' as part of one larger block without changing the result.
+static inline int is_mc_mergeable(const AV1_COMMON *cm, const MACROBLOCKD *xd,
+                                  const MB_MODE_INFO *ref_mbmi,
+                                  const MB_MODE_INFO *mbmi) {
+  if (!is_inter_block(mbmi) || is_intrabc_block(mbmi)) return 0;
+  if (block_size_wide[mbmi->bsize] < 8 || block_size_high[mbmi->bsize] < 8)
+    return 0;
+  if (mbmi->motion_mode != SIMPLE_TRANSLATION || is_interintra_pred(mbmi))
+    return 0;
+  const int is_compound = has_second_ref(mbmi);
+  if (is_compound && is_masked_compound_type(mbmi->interinter_comp.type))
+    return 0;
+  for (int ref = 0; ref < 1 + is_compound; ++ref) {
+    const MV_REFERENCE_FRAME frame = mbmi->ref_frame[ref];
+    if (is_global_mv_block(mbmi, xd->global_motion[frame].wmtype)) return 0;
+    if (av1_is_scaled(get_ref_scale_factors_const(cm, frame))) return 0;
+  }
+  if (mbmi == ref_mbmi) return 1;
+  return mbmi->ref_frame[0] == ref_mbmi->ref_frame[0] &&
+         mbmi->ref_frame[1] == ref_mbmi->ref_frame[1] &&
+         mbmi->mv[0].as_int == ref_mbmi->mv[0].as_int &&
+         (!is_compound || (mbmi->mv[1].as_int == ref_mbmi->mv[1].as_int &&
+                           mbmi->compound_idx == ref_mbmi->compound_idx &&
+                           mbmi->interinter_comp.type ==
+                               ref_mbmi->interinter_comp.type)) &&
+         mbmi->interp_filters.as_int == ref_mbmi->interp_filters.as_int;
+}
+
+// Returns the bitmask of planes whose inter prediction can be built for the
+// whole partition at (mi_row, mi_col) with a single call, because all of its
+// coding blocks use the same translational motion from unscaled references.
+// The result is bit-exact with per-block prediction as long as no block
+// switches to the 4-tap filters and no reference fetch needs the MV clamp or
+// border extension, so the merged reference area must lie inside the frame.
+static int get_merged_mc_planes(const AV1_COMMON *cm, const MACROBLOCKD *xd,
+                                int mi_row, int mi_col, BLOCK_SIZE bsize) {
+  const CommonModeInfoParams *const mi_params = &cm->mi_params;
+  const int bw = mi_size_wide[bsize];
+  const int bh = mi_size_high[bsize];
+  if (mi_row + bh > mi_params->mi_rows || mi_col + bw > mi_params->mi_cols)
+    return 0;
+
+  MB_MODE_INFO **const mi =
+      mi_params->mi_grid_base + mi_row * mi_params->mi_stride + mi_col;
+  const MB_MODE_INFO *const ref_mbmi = mi[0];
+  if (!is_mc_mergeable(cm, xd, ref_mbmi, ref_mbmi)) return 0;
+
+  int min_bw = block_size_wide[ref_mbmi->bsize];
+  int min_bh = block_size_high[ref_mbmi->bsize];
+  const MB_MODE_INFO *prev_mbmi = ref_mbmi;
+  // Coding blocks of at least 8x8 are aligned to 8 pixels, so sampling every
+  // second mi unit visits all of them, and any smaller block is caught by the
+  // size check in is_mc_mergeable().
+  for (int r = 0; r < bh; r += 2) {
+    for (int c = 0; c < bw; c += 2) {
+      const MB_MODE_INFO *const mbmi = mi[r * mi_params->mi_stride + c];
+      if (mbmi == prev_mbmi) continue;
+      if (!is_mc_mergeable(cm, xd, ref_mbmi, mbmi)) return 0;
+      min_bw = AOMMIN(min_bw, block_size_wide[mbmi->bsize]);
+      min_bh = AOMMIN(min_bh, block_size_high[mbmi->bsize]);
+      prev_mbmi = mbmi;
+    }
+  }
+
+  // Keep the reference area, including the filter taps of the subsampled
+  // planes, inside the frame.
+  const int margin = 2 * AOM_INTERP_EXTEND;
+  for (int ref = 0; ref < 1 + has_second_ref(ref_mbmi); ++ref) {
+    const YV12_BUFFER_CONFIG *const ref_buf =
+        &get_ref_frame_buf(cm, ref_mbmi->ref_frame[ref])->buf;
+    const MV mv = ref_mbmi->mv[ref].as_mv;
+    const int x0 = mi_col * MI_SIZE + (mv.col >> 3) - margin;
+    const int y0 = mi_row * MI_SIZE + (mv.row >> 3) - margin;
+    const int x1 = x0 + bw * MI_SIZE + 2 * margin;
+    const int y1 = y0 + bh * MI_SIZE + 2 * margin;
+    if (x0 < 0 || y0 < 0 || x1 > ref_buf->y_crop_width ||
+        y1 > ref_buf->y_crop_height)
+      return 0;
+  }
+
+  int planes = 1 << AOM_PLANE_Y;
+  // Chroma blocks of width or height 4 use the 4-tap filters, which would
+  // change if they were predicted as part of a larger block.
+  const struct macroblockd_plane *const pd = &xd->plane[AOM_PLANE_U];
+  if (av1_num_planes(cm) > 1 && (min_bw >> pd->subsampling_x) > 4 &&
+      (min_bh >> pd->subsampling_y) > 4)
+    planes |= (1 << AOM_PLANE_U) | (1 << AOM_PLANE_V);
+  return planes;
+}
+
+// Builds the inter prediction of the given planes for a whole partition
+// whose coding blocks all share the motion of the top-left one.
+static inline void dec_build_merged_inter_predictors(AV1Decoder *const pbi,
+                                                     ThreadData *const td,
+                                                     int mi_row, int mi_col,
+                                                     BLOCK_SIZE bsize,
+                                                     int planes) {
+  AV1_COMMON *const cm = &pbi->common;
+  DecoderCodingBlock *const dcb = &td->dcb;
+  MACROBLOCKD *const xd = &dcb->xd;
+  const int num_planes = av1_num_planes(cm);
+  set_offsets_for_pred_and_recon(pbi, td, mi_row, mi_col, bsize);
+
+  MB_MODE_INFO mbmi = *xd->mi[0];
+  mbmi.bsize = bsize;
+  for (int ref = 0; ref < 1 + has_second_ref(&mbmi); ++ref) {
+    const MV_REFERENCE_FRAME frame = mbmi.ref_frame[ref];
+    const RefCntBuffer *ref_buf = get_ref_frame_buf(cm, frame);
+    const struct scale_factors *ref_scale_factors =
+        get_ref_scale_factors_const(cm, frame);
+    xd->block_ref_scale_factors[ref] = ref_scale_factors;
+    av1_setup_pre_planes(xd, ref, &ref_buf->buf, mi_row, mi_col,
+                         ref_scale_factors, num_planes);
+  }
+
+  for (int plane = 0; plane < num_planes; ++plane) {
+    if (!(planes & (1 << plane))) continue;
+    dec_build_inter_predictors(cm, dcb, plane, &mbmi, 0,
+                               xd->plane[plane].width, xd->plane[plane].height,
+                               mi_col * MI_SIZE, mi_row * MI_SIZE);
+  }
+}
+
 // TODO(slavarnway): eliminate bsize and subsize in future commits
 static inline void decode_partition(AV1Decoder *const pbi, ThreadData *const td,
                                     int mi_row, int mi_col, aom_reader *reader,
@@ -1328,6 +1461,19 @@ static inline void decode_partition(AV1Decoder *const pbi, ThreadData *const td,
                        block_size_wide[subsize], block_size_high[subsize]);
   }
 
+  // When reconstructing an already parsed superblock, build the prediction of
+  // a split partition in one go if all of its blocks move together.
+  int merged_mc = 0;
+  if (parse_decode_flag == 0x2 && partition != PARTITION_NONE &&
+      !dcb->merged_mc_planes) {
+    const int planes = get_merged_mc_planes(cm, xd, mi_row, mi_col, bsize);
+    if (planes) {
+      dec_build_merged_inter_predictors(pbi, td, mi_row, mi_col, bsize, planes);
+      dcb->merged_mc_planes = planes;
+      merged_mc = 1;
+    }
+  }
+
 #define DEC_BLOCK_STX_ARG
 #define DEC_BLOCK_EPT_ARG partition,
 #define DEC_BLOCK(db_r, db_c, db_subsize)                                  \
@@ -1395,6 +1541,8 @@ static inline void decode_partition(AV1Decoder *const pbi, ThreadData *const td,
 #undef DEC_BLOCK_EPT_ARG
 #undef DEC_BLOCK_STX_ARG
 
+  if (merged_mc) dcb->merged_mc_planes = 0;
+
   if (parse_decode_flag & 1)
     update_ext_partition_context(xd, mi_row, mi_col, subsize, bsize, partition);
 }
@@ -2702,6 +2850,8 @@ static inline void set_decode_func_pointers(ThreadData *td,
   td->inverse_tx_inter_block_visit = decode_block_void;
   td->predict_inter_block_visit = predict_inter_block_void;
   td->cfl_store_inter_block_visit = cfl_store_inter_block_void;
+  // A decode job that was aborted by an error may have left this set.
+  td->dcb.merged_mc_planes = 0;
 
   if (parse_decode_flag & 0x1) {
     td->read_coeffs_tx_intra_block_visit = read_coeffs_tx_intra_block;
@@ -3000,7 +3150,11 @@ static int tile_worker_hook(void *arg1, void *arg2) {
       // decode tile
       int tile_row = tile_data->tile_info.tile_row;
       int tile_col = tile_data->tile_info.tile_col;
+      struct aom_usec_timer timer;
+      aom_usec_timer_start(&timer);
       decode_tile(pbi, td, tile_row, tile_col);
+      aom_usec_timer_mark(&timer);
+      thread_data->busy_time += aom_usec_timer_elapsed(&timer);
     } else {
       break;
     }
@@ -3255,7 +3409,13 @@ static int row_mt_worker_hook(void *arg1, void *arg2) {
       pthread_mutex_unlock(pbi->row_mt_mutex_);
 #endif
       // decode tile
+      struct aom_usec_timer timer;
+      aom_usec_timer_start(&timer);
       parse_tile_row_mt(pbi, td, tile_data);
+      aom_usec_timer_mark(&timer);
+      const int64_t elapsed_time = aom_usec_timer_elapsed(&timer);
+      thread_data->parse_time += elapsed_time;
+      thread_data->busy_time += elapsed_time;
 #if CONFIG_MULTITHREAD
       pthread_mutex_lock(pbi->row_mt_mutex_);
 #endif
@@ -3313,7 +3473,13 @@ static int row_mt_worker_hook(void *arg1, void *arg2) {
     av1_init_macroblockd(cm, &td->dcb.xd);
     td->dcb.xd.error_info = &thread_data->error_info;
 
+    struct aom_usec_timer timer;
+    aom_usec_timer_start(&timer);
     decode_tile_sb_row(pbi, td, &tile_data->tile_info, mi_row);
+    aom_usec_timer_mark(&timer);
+    const int64_t elapsed_time = aom_usec_timer_elapsed(&timer);
+    thread_data->recon_time += elapsed_time;
+    thread_data->busy_time += elapsed_time;
 
 #if CONFIG_MULTITHREAD
     pthread_mutex_lock(pbi->row_mt_mutex_);
@@ -3455,6 +3621,9 @@ static inline void reset_dec_workers(AV1Decoder *pbi, AVxWorkerHook worker_hook,
           thread_data->td->tmp_obmc_bufs[j];
     }
     winterface->sync(worker);
+    thread_data->parse_time = 0;
+    thread_data->recon_time = 0;
+    thread_data->busy_time = 0;
 
     worker->hook = worker_hook;
     worker->data1 = thread_data;
@@ -3488,12 +3657,18 @@ static inline void launch_dec_workers(AV1Decoder *pbi, const uint8_t *data_end,
 
 static inline void sync_dec_workers(AV1Decoder *pbi, int num_workers) {
   const AVxWorkerInterface *const winterface = aom_get_worker_interface();
+  aom_frame_stats *const stats = &pbi->frame_stats;
   int corrupted = 0;
 
   for (int worker_idx = num_workers; worker_idx > 0; --worker_idx) {
     AVxWorker *const worker = &pbi->tile_workers[worker_idx - 1];
+    const DecWorkerData *const thread_data = pbi->thread_data + worker_idx - 1;
     aom_merge_corrupted_flag(&corrupted, !winterface->sync(worker));
+    stats->parse_time += thread_data->parse_time;
+    stats->recon_time += thread_data->recon_time;
+    stats->worker_busy_time += thread_data->busy_time;
   }
+  stats->num_workers = AOMMAX(stats->num_workers, num_workers);
 
   pbi->dcb.corrupted = corrupted;
 }
@@ -3502,6 +3677,7 @@ static inline void decode_mt_init(AV1Decoder *pbi) {
   AV1_COMMON *const cm = &pbi->common;
   const AVxWorkerInterface *const winterface = aom_get_worker_interface();
   int worker_idx;
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_THREAD_DATA);
 
   // Create workers and thread_data
   if (pbi->num_workers == 0) {
@@ -3545,6 +3721,7 @@ static inline void decode_mt_init(AV1Decoder *pbi) {
       allocate_mc_tmp_buf(cm, thread_data->td, buf_size, use_highbd);
     }
   }
+  aom_mem_pop_tag(prev_tag);
 }
 
 static inline void tile_mt_queue(AV1Decoder *pbi, int tile_cols, int tile_rows,
@@ -4462,6 +4639,60 @@ static inline void show_existing_frame_reset(AV1Decoder *const pbi,
   cm->features.refresh_frame_context = REFRESH_FRAME_CONTEXT_DISABLED;
 }
 
+static int get_frame_buffer_size(void *priv, size_t min_size,
+                                 aom_codec_frame_buffer_t *fb) {
+  (void)fb;
+  *(size_t *)priv = min_size;
+  return -1;
+}
+
+// Grows the internal frame buffers to the maximum frame size of the sequence,
+// so that a change of the frame size within the sequence does no allocation.
+static void prealloc_frame_buffers(AV1_COMMON *cm) {
+  BufferPool *const pool = cm->buffer_pool;
+  const SequenceHeader *const seq_params = cm->seq_params;
+  if (pool->get_fb_cb != av1_get_frame_buffer) return;
+
+  // Have aom_realloc_frame_buffer() compute the size of the largest frame
+  // buffer without allocating it.
+  YV12_BUFFER_CONFIG buf;
+  aom_codec_frame_buffer_t raw_frame_buffer;
+  size_t size = 0;
+  memset(&buf, 0, sizeof(buf));
+  memset(&raw_frame_buffer, 0, sizeof(raw_frame_buffer));
+  aom_realloc_frame_buffer(&buf, seq_params->max_frame_width,
+                           seq_params->max_frame_height,
+                           seq_params->subsampling_x, seq_params->subsampling_y,
+                           seq_params->use_highbitdepth,
+                           AOM_DEC_BORDER_IN_PIXELS,
+                           cm->features.byte_alignment, &raw_frame_buffer,
+                           get_frame_buffer_size, &size, false, 0);
+  if (size == 0) return;
+
+  lock_buffer_pool(pool);
+  // The references and the frame being decoded.
+  const int err = av1_prealloc_internal_frame_buffers(&pool->int_frame_buffers,
+                                                      size, REF_FRAMES + 1);
+  unlock_buffer_pool(pool);
+  if (err) {
+    aom_internal_error(cm->error, AOM_CODEC_MEM_ERROR,
+                       "Failed to preallocate frame buffers");
+  }
+
+  // The loop restoration output only grows, so size it for the largest frame
+  // as well.
+  if (seq_params->enable_restoration &&
+      aom_realloc_frame_buffer(
+          &cm->rst_frame, seq_params->max_frame_width,
+          seq_params->max_frame_height, seq_params->subsampling_x,
+          seq_params->subsampling_y, seq_params->use_highbitdepth,
+          AOM_RESTORATION_FRAME_BORDER, cm->features.byte_alignment, NULL,
+          NULL, NULL, false, 0) != AOM_CODEC_OK) {
+    aom_internal_error(cm->error, AOM_CODEC_MEM_ERROR,
+                       "Failed to preallocate restoration dst buffer");
+  }
+}
+
 static inline void reset_frame_buffers(AV1_COMMON *cm) {
   RefCntBuffer *const frame_bufs = cm->buffer_pool->frame_bufs;
   int i;
@@ -4600,6 +4831,9 @@ static int read_uncompressed_header(AV1Decoder *pbi,
                            "Sequence header has changed without a keyframe.");
       }
     }
+    if (pbi->decoding_first_frame && pbi->prealloc_frame_buffers) {
+      prealloc_frame_buffers(cm);
+    }
 
     cm->show_frame = aom_rb_read_bit(rb);
     if (cm->show_frame == 0) pbi->is_arf_frame_present = 1;
@@ -5261,6 +5495,26 @@ static inline void setup_frame_info(AV1Decoder *pbi) {
   }
 }
 
+// Returns 1 if the current frame is not used as a reference by later frames,
+// so that non-normative shortcuts taken on it do not propagate.
+static inline int is_non_reference_frame(const AV1_COMMON *cm) {
+  return cm->current_frame.refresh_frame_flags == 0;
+}
+
+// Returns 1 if the fast decode level allows skipping CDEF on the current
+// frame.
+static inline int fast_decode_skip_cdef(const AV1Decoder *pbi) {
+  if (pbi->fast_decode >= 3) return 1;
+  return pbi->fast_decode >= 1 && is_non_reference_frame(&pbi->common);
+}
+
+// Returns 1 if the fast decode level allows skipping loop restoration on the
+// current frame.
+static inline int fast_decode_skip_lr(const AV1Decoder *pbi) {
+  if (pbi->fast_decode >= 2) return 1;
+  return pbi->fast_decode >= 1 && is_non_reference_frame(&pbi->common);
+}
+
 void av1_decode_tg_tiles_and_wrapup(AV1Decoder *pbi, const uint8_t *data,
                                     const uint8_t *data_end,
                                     const uint8_t **p_data_end, int start_tile,
@@ -5270,19 +5524,34 @@ void av1_decode_tg_tiles_and_wrapup(AV1Decoder *pbi, const uint8_t *data,
   MACROBLOCKD *const xd = &pbi->dcb.xd;
   const int tile_count_tg = end_tile - start_tile + 1;
 
+  aom_frame_stats *const stats = &pbi->frame_stats;
+  struct aom_usec_timer timer;
+
   xd->error_info = cm->error;
   if (initialize_flag) setup_frame_info(pbi);
   const int num_planes = av1_num_planes(cm);
+  // The tile workers take a copy of pbi->dcb.
+  pbi->dcb.bilinear_mc = pbi->fast_decode >= 1 && is_non_reference_frame(cm);
 
+  aom_usec_timer_start(&timer);
   if (pbi->max_threads > 1 && !(tiles->large_scale && !pbi->ext_tile_debug) &&
-      pbi->row_mt)
+      pbi->row_mt) {
     *p_data_end =
         decode_tiles_row_mt(pbi, data, data_end, start_tile, end_tile);
-  else if (pbi->max_threads > 1 && tile_count_tg > 1 &&
-           !(tiles->large_scale && !pbi->ext_tile_debug))
+    aom_usec_timer_mark(&timer);
+  } else if (pbi->max_threads > 1 && tile_count_tg > 1 &&
+             !(tiles->large_scale && !pbi->ext_tile_debug)) {
     *p_data_end = decode_tiles_mt(pbi, data, data_end, start_tile, end_tile);
-  else
+    aom_usec_timer_mark(&timer);
+  } else {
     *p_data_end = decode_tiles(pbi, data, data_end, start_tile, end_tile);
+    aom_usec_timer_mark(&timer);
+    // The main thread is the only worker.
+    stats->num_workers = AOMMAX(stats->num_workers, 1);
+    stats->worker_busy_time += aom_usec_timer_elapsed(&timer);
+  }
+  stats->tile_decode_time += aom_usec_timer_elapsed(&timer);
+  stats->num_tiles += tile_count_tg;
 
   // If the bit stream is monochrome, set the U and V buffers to a constant.
   if (num_planes < 3) {
@@ -5299,30 +5568,40 @@ void av1_decode_tg_tiles_and_wrapup(AV1Decoder *pbi, const uint8_t *data,
 
   if (!cm->features.allow_intrabc && !tiles->single_tile_decoding) {
     if (cm->lf.filter_level[0] || cm->lf.filter_level[1]) {
+      aom_usec_timer_start(&timer);
       av1_loop_filter_frame_mt(&cm->cur_frame->buf, cm, &pbi->dcb.xd, 0,
                                num_planes, 0, pbi->tile_workers,
                                pbi->num_workers, &pbi->lf_row_sync, 0);
+      aom_usec_timer_mark(&timer);
+      stats->loop_filter_time += aom_usec_timer_elapsed(&timer);
     }
 
     const int do_cdef =
-        !pbi->skip_loop_filter && !cm->features.coded_lossless &&
+        !pbi->skip_loop_filter && !fast_decode_skip_cdef(pbi) &&
+        !cm->features.coded_lossless &&
         (cm->cdef_info.cdef_bits || cm->cdef_info.cdef_strengths[0] ||
          cm->cdef_info.cdef_uv_strengths[0]);
     const int do_superres = av1_superres_scaled(cm);
     const int optimized_loop_restoration = !do_cdef && !do_superres;
     const int do_loop_restoration =
-        cm->rst_info[0].frame_restoration_type != RESTORE_NONE ||
-        cm->rst_info[1].frame_restoration_type != RESTORE_NONE ||
-        cm->rst_info[2].frame_restoration_type != RESTORE_NONE;
+        !fast_decode_skip_lr(pbi) &&
+        (cm->rst_info[0].frame_restoration_type != RESTORE_NONE ||
+         cm->rst_info[1].frame_restoration_type != RESTORE_NONE ||
+         cm->rst_info[2].frame_restoration_type != RESTORE_NONE);
     // Frame border extension is not required in the decoder
     // as it happens in extend_mc_border().
     int do_extend_border_mt = 0;
     if (!optimized_loop_restoration) {
-      if (do_loop_restoration)
+      if (do_loop_restoration) {
+        aom_usec_timer_start(&timer);
         av1_loop_restoration_save_boundary_lines(&pbi->common.cur_frame->buf,
                                                  cm, 0);
+        aom_usec_timer_mark(&timer);
+        stats->loop_restoration_time += aom_usec_timer_elapsed(&timer);
+      }
 
       if (do_cdef) {
+        aom_usec_timer_start(&timer);
         if (pbi->num_workers > 1) {
           av1_cdef_frame_mt(cm, &pbi->dcb.xd, pbi->cdef_worker,
                             pbi->tile_workers, &pbi->cdef_sync,
@@ -5332,11 +5611,17 @@ void av1_decode_tg_tiles_and_wrapup(AV1Decoder *pbi, const uint8_t *data,
           av1_cdef_frame(&pbi->common.cur_frame->buf, cm, &pbi->dcb.xd,
                          av1_cdef_init_fb_row);
         }
+        aom_usec_timer_mark(&timer);
+        stats->cdef_time += aom_usec_timer_elapsed(&timer);
       }
 
+      aom_usec_timer_start(&timer);
       superres_post_decode(pbi);
+      aom_usec_timer_mark(&timer);
+      stats->superres_time += aom_usec_timer_elapsed(&timer);
 
       if (do_loop_restoration) {
+        aom_usec_timer_start(&timer);
         av1_loop_restoration_save_boundary_lines(&pbi->common.cur_frame->buf,
                                                  cm, 1);
         if (pbi->num_workers > 1) {
@@ -5349,11 +5634,14 @@ void av1_decode_tg_tiles_and_wrapup(AV1Decoder *pbi, const uint8_t *data,
                                             cm, optimized_loop_restoration,
                                             &pbi->lr_ctxt);
         }
+        aom_usec_timer_mark(&timer);
+        stats->loop_restoration_time += aom_usec_timer_elapsed(&timer);
       }
     } else {
       // In no cdef and no superres case. Provide an optimized version of
       // loop_restoration_filter.
       if (do_loop_restoration) {
+        aom_usec_timer_start(&timer);
         if (pbi->num_workers > 1) {
           av1_loop_restoration_filter_frame_mt(
               (YV12_BUFFER_CONFIG *)xd->cur_buf, cm, optimized_loop_restoration,
@@ -5364,6 +5652,8 @@ void av1_decode_tg_tiles_and_wrapup(AV1Decoder *pbi, const uint8_t *data,
                                             cm, optimized_loop_restoration,
                                             &pbi->lr_ctxt);
         }
+        aom_usec_timer_mark(&timer);
+        stats->loop_restoration_time += aom_usec_timer_elapsed(&timer);
       }
     }
   }
@@ -107,11 +107,13 @@ AV1Decoder *av1_decoder_create(BufferPool *const pool) {
 
   pbi->error.setjmp = 1;
 
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_ENTROPY_TABLES);
   CHECK_MEM_ERROR(cm, cm->fc,
                   (FRAME_CONTEXT *)aom_memalign(32, sizeof(*cm->fc)));
   CHECK_MEM_ERROR(
       cm, cm->default_frame_context,
       (FRAME_CONTEXT *)aom_memalign(32, sizeof(*cm->default_frame_context)));
+  aom_mem_pop_tag(prev_tag);
   memset(cm->fc, 0, sizeof(*cm->fc));
   memset(cm->default_frame_context, 0, sizeof(*cm->default_frame_context));
 
@@ -469,8 +471,13 @@ int av1_receive_compressed_data(AV1Decoder *pbi, size_t size,
 
   pbi->error.setjmp = 1;
 
+  struct aom_usec_timer timer;
+  aom_usec_timer_start(&timer);
   int frame_decoded =
       aom_decode_frame_from_obus(pbi, source, source + size, psource);
+  aom_usec_timer_mark(&timer);
+  pbi->frame_stats.decode_time += aom_usec_timer_elapsed(&timer);
+  pbi->frame_stats.frame_bytes += (size_t)(*psource - source);
 
   if (frame_decoded < 0) {
     assert(pbi->error.error_code != AOM_CODEC_OK);
@@ -494,6 +501,7 @@ int av1_receive_compressed_data(AV1Decoder *pbi, size_t size,
 
   if (frame_decoded) {
     pbi->decoding_first_frame = 0;
+    ++pbi->frame_stats.num_frames;
   }
 
   if (pbi->error.error_code != AOM_CODEC_OK) {
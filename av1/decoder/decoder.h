@@ -81,6 +81,18 @@ typedef struct DecoderCodingBlock {
    * in xd->ref_mv_stack[i].
    */
   uint8_t ref_mv_count[MODE_CTX_REF_FRAMES];
+  /*!
+   * Bitmask of the planes whose inter prediction has already been built for
+   * the partition currently being reconstructed, because all of its coding
+   * blocks share the same motion. Only used when reconstruction runs
+   * separately from parsing.
+   */
+  int merged_mc_planes;
+  /*!
+   * If set, inter prediction uses the bilinear filter instead of the signaled
+   * interpolation filters. Non-normative, see AV1D_SET_FAST_DECODE.
+   */
+  int bilinear_mc;
 } DecoderCodingBlock;
 
 /*!\cond */
@@ -337,6 +349,10 @@ typedef struct AV1Decoder {
   int context_update_tile_id;
   int skip_loop_filter;
   int skip_film_grain;
+  int fast_decode;
+  // Grow the internal frame buffers to the maximum frame size at the start of
+  // each coded video sequence.
+  int prealloc_frame_buffers;
   int is_annexb;
   int valid_for_referencing[REF_FRAMES];
   int is_fwd_kf_present;
@@ -344,6 +360,11 @@ typedef struct AV1Decoder {
   int num_tile_groups;
   aom_s_frame_info sframe_info;
 
+  /*!
+   * Decoding statistics of the current temporal unit.
+   */
+  aom_frame_stats frame_stats;
+
   /*!
    * Elements part of the sequence header, that are applicable for all the
    * frames in the video.
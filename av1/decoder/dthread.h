@@ -28,6 +28,10 @@ typedef struct DecWorkerData {
   struct ThreadData *td;
   const uint8_t *data_end;
   struct aom_internal_error_info error_info;
+  // Time in microseconds spent on the tile jobs of the current tile group.
+  int64_t parse_time;
+  int64_t recon_time;
+  int64_t busy_time;
 } DecWorkerData;
 
 // WorkerData for the FrameWorker thread. It contains all the information of
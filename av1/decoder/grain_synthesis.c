@@ -625,10 +625,11 @@ static int scale_LUT(int *scaling_lut, int index, int bit_depth) {
                              (bit_depth - 8));
 }
 
+// The samples of one chroma plane are chroma_step apart.
 static void add_noise_to_block(const aom_film_grain_t *params, uint8_t *luma,
                                uint8_t *cb, uint8_t *cr, int luma_stride,
-                               int chroma_stride, int *luma_grain,
-                               int *cb_grain, int *cr_grain,
+                               int chroma_stride, int chroma_step,
+                               int *luma_grain, int *cb_grain, int *cr_grain,
                                int luma_grain_stride, int chroma_grain_stride,
                                int half_luma_height, int half_luma_width,
                                int bit_depth, int chroma_subsamp_y,
@@ -691,12 +692,13 @@ static void add_noise_to_block(const aom_film_grain_t *params, uint8_t *luma,
         average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
       }
 
+      const int chroma_pos = i * chroma_stride + j * chroma_step;
       if (apply_cb) {
-        cb[i * chroma_stride + j] = clamp(
-            cb[i * chroma_stride + j] +
+        cb[chroma_pos] = clamp(
+            cb[chroma_pos] +
                 ((scale_LUT(scaling_lut_cb,
                             clamp(((average_luma * cb_luma_mult +
-                                    cb_mult * cb[i * chroma_stride + j]) >>
+                                    cb_mult * cb[chroma_pos]) >>
                                    6) +
                                       cb_offset,
                                   0, (256 << (bit_depth - 8)) - 1),
@@ -708,11 +710,11 @@ static void add_noise_to_block(const aom_film_grain_t *params, uint8_t *luma,
       }
 
       if (apply_cr) {
-        cr[i * chroma_stride + j] = clamp(
-            cr[i * chroma_stride + j] +
+        cr[chroma_pos] = clamp(
+            cr[chroma_pos] +
                 ((scale_LUT(scaling_lut_cr,
                             clamp(((average_luma * cr_luma_mult +
-                                    cr_mult * cr[i * chroma_stride + j]) >>
+                                    cr_mult * cr[chroma_pos]) >>
                                    6) +
                                       cr_offset,
                                   0, (256 << (bit_depth - 8)) - 1),
@@ -740,12 +742,16 @@ static void add_noise_to_block(const aom_film_grain_t *params, uint8_t *luma,
   }
 }
 
+// Samples are stored in the sample_shift most significant bits of luma, cb and
+// cr (e.g. for AOM_IMG_FMT_P010), and the samples of one chroma plane are
+// chroma_step apart.
 static void add_noise_to_block_hbd(
     const aom_film_grain_t *params, uint16_t *luma, uint16_t *cb, uint16_t *cr,
-    int luma_stride, int chroma_stride, int *luma_grain, int *cb_grain,
-    int *cr_grain, int luma_grain_stride, int chroma_grain_stride,
-    int half_luma_height, int half_luma_width, int bit_depth,
-    int chroma_subsamp_y, int chroma_subsamp_x, int mc_identity) {
+    int luma_stride, int chroma_stride, int chroma_step, int sample_shift,
+    int *luma_grain, int *cb_grain, int *cr_grain, int luma_grain_stride,
+    int chroma_grain_stride, int half_luma_height, int half_luma_width,
+    int bit_depth, int chroma_subsamp_y, int chroma_subsamp_x,
+    int mc_identity) {
   int cb_mult = params->cb_mult - 128;            // fixed scale
   int cb_luma_mult = params->cb_luma_mult - 128;  // fixed scale
   // offset value depends on the bit depth
@@ -796,47 +802,51 @@ static void add_noise_to_block_hbd(
 
   for (int i = 0; i < (half_luma_height << (1 - chroma_subsamp_y)); i++) {
     for (int j = 0; j < (half_luma_width << (1 - chroma_subsamp_x)); j++) {
+      const uint16_t *luma_row = luma + (i << chroma_subsamp_y) * luma_stride;
       int average_luma = 0;
       if (chroma_subsamp_x) {
-        average_luma = (luma[(i << chroma_subsamp_y) * luma_stride +
-                             (j << chroma_subsamp_x)] +
-                        luma[(i << chroma_subsamp_y) * luma_stride +
-                             (j << chroma_subsamp_x) + 1] +
-                        1) >>
+        const int x0 = j << chroma_subsamp_x;
+        average_luma = ((luma_row[x0] >> sample_shift) +
+                        (luma_row[x0 + 1] >> sample_shift) + 1) >>
                        1;
       } else {
-        average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
+        average_luma = luma_row[j] >> sample_shift;
       }
 
+      const int chroma_pos = i * chroma_stride + j * chroma_step;
       if (apply_cb) {
-        cb[i * chroma_stride + j] = clamp(
-            cb[i * chroma_stride + j] +
-                ((scale_LUT(scaling_lut_cb,
-                            clamp(((average_luma * cb_luma_mult +
-                                    cb_mult * cb[i * chroma_stride + j]) >>
-                                   6) +
-                                      cb_offset,
-                                  0, (256 << (bit_depth - 8)) - 1),
-                            bit_depth) *
-                      cb_grain[i * chroma_grain_stride + j] +
-                  rounding_offset) >>
-                 params->scaling_shift),
-            min_chroma, max_chroma);
+        const int cb_val = cb[chroma_pos] >> sample_shift;
+        cb[chroma_pos] =
+            clamp(cb_val +
+                      ((scale_LUT(scaling_lut_cb,
+                                  clamp(((average_luma * cb_luma_mult +
+                                          cb_mult * cb_val) >>
+                                         6) +
+                                            cb_offset,
+                                        0, (256 << (bit_depth - 8)) - 1),
+                                  bit_depth) *
+                            cb_grain[i * chroma_grain_stride + j] +
+                        rounding_offset) >>
+                       params->scaling_shift),
+                  min_chroma, max_chroma)
+            << sample_shift;
       }
       if (apply_cr) {
-        cr[i * chroma_stride + j] = clamp(
-            cr[i * chroma_stride + j] +
-                ((scale_LUT(scaling_lut_cr,
-                            clamp(((average_luma * cr_luma_mult +
-                                    cr_mult * cr[i * chroma_stride + j]) >>
-                                   6) +
-                                      cr_offset,
-                                  0, (256 << (bit_depth - 8)) - 1),
-                            bit_depth) *
-                      cr_grain[i * chroma_grain_stride + j] +
-                  rounding_offset) >>
-                 params->scaling_shift),
-            min_chroma, max_chroma);
+        const int cr_val = cr[chroma_pos] >> sample_shift;
+        cr[chroma_pos] =
+            clamp(cr_val +
+                      ((scale_LUT(scaling_lut_cr,
+                                  clamp(((average_luma * cr_luma_mult +
+                                          cr_mult * cr_val) >>
+                                         6) +
+                                            cr_offset,
+                                        0, (256 << (bit_depth - 8)) - 1),
+                                  bit_depth) *
+                            cr_grain[i * chroma_grain_stride + j] +
+                        rounding_offset) >>
+                       params->scaling_shift),
+                  min_chroma, max_chroma)
+            << sample_shift;
       }
     }
   }
@@ -844,14 +854,14 @@ static void add_noise_to_block_hbd(
   if (apply_y) {
     for (int i = 0; i < (half_luma_height << 1); i++) {
       for (int j = 0; j < (half_luma_width << 1); j++) {
+        const int luma_val = luma[i * luma_stride + j] >> sample_shift;
         luma[i * luma_stride + j] =
-            clamp(luma[i * luma_stride + j] +
-                      ((scale_LUT(scaling_lut_y, luma[i * luma_stride + j],
-                                  bit_depth) *
-                            luma_grain[i * luma_grain_stride + j] +
-                        rounding_offset) >>
-                       params->scaling_shift),
-                  min_luma, max_luma);
+            clamp(luma_val + ((scale_LUT(scaling_lut_y, luma_val, bit_depth) *
+                                   luma_grain[i * luma_grain_stride + j] +
+                               rounding_offset) >>
+                              params->scaling_shift),
+                  min_luma, max_luma)
+            << sample_shift;
       }
     }
   }
@@ -983,10 +993,15 @@ static void hor_boundary_overlap(int *top_block, int top_stride,
  * \param[in]    width            luma plane width
  * \param[in]    luma_stride      luma plane stride
  * \param[in]    chroma_stride    chroma plane stride
+ * \param[in]    chroma_step      distance between the samples of one chroma
+ *                                plane, 2 if cb and cr are interleaved
+ * \param[in]    sample_shift     number of unused least significant bits of
+ *                                the high bitdepth samples
  */
 static int add_film_grain_run(const aom_film_grain_t *params, uint8_t *luma,
                               uint8_t *cb, uint8_t *cr, int height, int width,
                               int luma_stride, int chroma_stride,
+                              int chroma_step, int sample_shift,
                               int use_high_bit_depth, int chroma_subsamp_y,
                               int chroma_subsamp_x, int mc_identity) {
   int **pred_pos_luma;
@@ -1127,11 +1142,12 @@ static int add_film_grain_run(const aom_film_grain_t *params, uint8_t *luma,
               (uint16_t *)luma + ((y + i) << 1) * luma_stride + (x << 1),
               (uint16_t *)cb +
                   ((y + i) << (1 - chroma_subsamp_y)) * chroma_stride +
-                  (x << (1 - chroma_subsamp_x)),
+                  (x << (1 - chroma_subsamp_x)) * chroma_step,
               (uint16_t *)cr +
                   ((y + i) << (1 - chroma_subsamp_y)) * chroma_stride +
-                  (x << (1 - chroma_subsamp_x)),
-              luma_stride, chroma_stride, y_col_buf + i * 4,
+                  (x << (1 - chroma_subsamp_x)) * chroma_step,
+              luma_stride, chroma_stride, chroma_step, sample_shift,
+              y_col_buf + i * 4,
               cb_col_buf + i * (2 - chroma_subsamp_y) * (2 - chroma_subsamp_x),
               cr_col_buf + i * (2 - chroma_subsamp_y) * (2 - chroma_subsamp_x),
               2, (2 - chroma_subsamp_x),
@@ -1141,10 +1157,10 @@ static int add_film_grain_run(const aom_film_grain_t *params, uint8_t *luma,
           add_noise_to_block(
               params, luma + ((y + i) << 1) * luma_stride + (x << 1),
               cb + ((y + i) << (1 - chroma_subsamp_y)) * chroma_stride +
-                  (x << (1 - chroma_subsamp_x)),
+                  (x << (1 - chroma_subsamp_x)) * chroma_step,
               cr + ((y + i) << (1 - chroma_subsamp_y)) * chroma_stride +
-                  (x << (1 - chroma_subsamp_x)),
-              luma_stride, chroma_stride, y_col_buf + i * 4,
+                  (x << (1 - chroma_subsamp_x)) * chroma_step,
+              luma_stride, chroma_stride, chroma_step, y_col_buf + i * 4,
               cb_col_buf + i * (2 - chroma_subsamp_y) * (2 - chroma_subsamp_x),
               cr_col_buf + i * (2 - chroma_subsamp_y) * (2 - chroma_subsamp_x),
               2, (2 - chroma_subsamp_x),
@@ -1210,10 +1226,11 @@ static int add_film_grain_run(const aom_film_grain_t *params, uint8_t *luma,
           add_noise_to_block_hbd(
               params, (uint16_t *)luma + (y << 1) * luma_stride + (x << 1),
               (uint16_t *)cb + (y << (1 - chroma_subsamp_y)) * chroma_stride +
-                  (x << ((1 - chroma_subsamp_x))),
+                  (x << ((1 - chroma_subsamp_x))) * chroma_step,
               (uint16_t *)cr + (y << (1 - chroma_subsamp_y)) * chroma_stride +
-                  (x << ((1 - chroma_subsamp_x))),
-              luma_stride, chroma_stride, y_line_buf + (x << 1),
+                  (x << ((1 - chroma_subsamp_x))) * chroma_step,
+              luma_stride, chroma_stride, chroma_step, sample_shift,
+              y_line_buf + (x << 1),
               cb_line_buf + (x << (1 - chroma_subsamp_x)),
               cr_line_buf + (x << (1 - chroma_subsamp_x)), luma_stride,
               chroma_stride, 1,
@@ -1223,10 +1240,10 @@ static int add_film_grain_run(const aom_film_grain_t *params, uint8_t *luma,
           add_noise_to_block(
               params, luma + (y << 1) * luma_stride + (x << 1),
               cb + (y << (1 - chroma_subsamp_y)) * chroma_stride +
-                  (x << ((1 - chroma_subsamp_x))),
+                  (x << ((1 - chroma_subsamp_x))) * chroma_step,
               cr + (y << (1 - chroma_subsamp_y)) * chroma_stride +
-                  (x << ((1 - chroma_subsamp_x))),
-              luma_stride, chroma_stride, y_line_buf + (x << 1),
+                  (x << ((1 - chroma_subsamp_x))) * chroma_step,
+              luma_stride, chroma_stride, chroma_step, y_line_buf + (x << 1),
               cb_line_buf + (x << (1 - chroma_subsamp_x)),
               cr_line_buf + (x << (1 - chroma_subsamp_x)), luma_stride,
               chroma_stride, 1,
@@ -1244,11 +1261,11 @@ static int add_film_grain_run(const aom_film_grain_t *params, uint8_t *luma,
             (uint16_t *)luma + ((y + i) << 1) * luma_stride + ((x + j) << 1),
             (uint16_t *)cb +
                 ((y + i) << (1 - chroma_subsamp_y)) * chroma_stride +
-                ((x + j) << (1 - chroma_subsamp_x)),
+                ((x + j) << (1 - chroma_subsamp_x)) * chroma_step,
             (uint16_t *)cr +
                 ((y + i) << (1 - chroma_subsamp_y)) * chroma_stride +
-                ((x + j) << (1 - chroma_subsamp_x)),
-            luma_stride, chroma_stride,
+                ((x + j) << (1 - chroma_subsamp_x)) * chroma_step,
+            luma_stride, chroma_stride, chroma_step, sample_shift,
             luma_grain_block + (luma_offset_y + (i << 1)) * luma_grain_stride +
                 luma_offset_x + (j << 1),
             cb_grain_block +
@@ -1267,10 +1284,10 @@ static int add_film_grain_run(const aom_film_grain_t *params, uint8_t *luma,
         add_noise_to_block(
             params, luma + ((y + i) << 1) * luma_stride + ((x + j) << 1),
             cb + ((y + i) << (1 - chroma_subsamp_y)) * chroma_stride +
-                ((x + j) << (1 - chroma_subsamp_x)),
+                ((x + j) << (1 - chroma_subsamp_x)) * chroma_step,
             cr + ((y + i) << (1 - chroma_subsamp_y)) * chroma_stride +
-                ((x + j) << (1 - chroma_subsamp_x)),
-            luma_stride, chroma_stride,
+                ((x + j) << (1 - chroma_subsamp_x)) * chroma_step,
+            luma_stride, chroma_stride, chroma_step,
             luma_grain_block + (luma_offset_y + (i << 1)) * luma_grain_stride +
                 luma_offset_x + (j << 1),
             cb_grain_block +
@@ -1369,14 +1386,99 @@ static int add_film_grain_run(const aom_film_grain_t *params, uint8_t *luma,
   return 0;
 }
 
-int av1_add_film_grain(const aom_film_grain_t *params, const aom_image_t *src,
-                       aom_image_t *dst) {
+int av1_add_film_grain_in_place(const aom_film_grain_t *params,
+                                aom_image_t *img) {
   uint8_t *luma, *cb, *cr;
   int height, width, luma_stride, chroma_stride;
   int use_high_bit_depth = 0;
   int chroma_subsamp_x = 0;
   int chroma_subsamp_y = 0;
-  int mc_identity = src->mc == AOM_CICP_MC_IDENTITY ? 1 : 0;
+  int chroma_step = 1;
+  int sample_shift = 0;
+  int mc_identity = img->mc == AOM_CICP_MC_IDENTITY ? 1 : 0;
+
+  switch (img->fmt) {
+    case AOM_IMG_FMT_AOMI420:
+    case AOM_IMG_FMT_I420:
+      use_high_bit_depth = 0;
+      chroma_subsamp_x = 1;
+      chroma_subsamp_y = 1;
+      break;
+    case AOM_IMG_FMT_I42016:
+      use_high_bit_depth = 1;
+      chroma_subsamp_x = 1;
+      chroma_subsamp_y = 1;
+      break;
+      //    case AOM_IMG_FMT_444A:
+    case AOM_IMG_FMT_I444:
+      use_high_bit_depth = 0;
+      chroma_subsamp_x = 0;
+      chroma_subsamp_y = 0;
+      break;
+    case AOM_IMG_FMT_I44416:
+      use_high_bit_depth = 1;
+      chroma_subsamp_x = 0;
+      chroma_subsamp_y = 0;
+      break;
+    case AOM_IMG_FMT_I422:
+      use_high_bit_depth = 0;
+      chroma_subsamp_x = 1;
+      chroma_subsamp_y = 0;
+      break;
+    case AOM_IMG_FMT_I42216:
+      use_high_bit_depth = 1;
+      chroma_subsamp_x = 1;
+      chroma_subsamp_y = 0;
+      break;
+    case AOM_IMG_FMT_NV12:
+      use_high_bit_depth = 0;
+      chroma_subsamp_x = 1;
+      chroma_subsamp_y = 1;
+      chroma_step = 2;
+      break;
+    case AOM_IMG_FMT_P010:
+      use_high_bit_depth = 1;
+      chroma_subsamp_x = 1;
+      chroma_subsamp_y = 1;
+      chroma_step = 2;
+      sample_shift = 16 - (int)img->bit_depth;
+      break;
+    default:  // unknown input format
+      fprintf(stderr, "Film grain error: input format is not supported!");
+      return -1;
+  }
+
+  assert(params->bit_depth == img->bit_depth);
+
+  width = img->d_w % 2 ? img->d_w + 1 : img->d_w;
+  height = img->d_h % 2 ? img->d_h + 1 : img->d_h;
+
+  // Note that img is already assumed to be aligned to even.
+  extend_even(img->planes[AOM_PLANE_Y], img->stride[AOM_PLANE_Y], img->d_w,
+              img->d_h, use_high_bit_depth);
+
+  luma = img->planes[AOM_PLANE_Y];
+  cb = img->planes[AOM_PLANE_U];
+  // The V samples of an interleaved chroma plane follow the U samples.
+  cr = chroma_step == 2 ? cb + (1 << use_high_bit_depth)
+                        : img->planes[AOM_PLANE_V];
+
+  // luma and chroma strides in samples
+  luma_stride = img->stride[AOM_PLANE_Y] >> use_high_bit_depth;
+  chroma_stride = img->stride[AOM_PLANE_U] >> use_high_bit_depth;
+
+  return add_film_grain_run(params, luma, cb, cr, height, width, luma_stride,
+                            chroma_stride, chroma_step, sample_shift,
+                            use_high_bit_depth, chroma_subsamp_y,
+                            chroma_subsamp_x, mc_identity);
+}
+
+int av1_add_film_grain(const aom_film_grain_t *params, const aom_image_t *src,
+                       aom_image_t *dst) {
+  int height, width;
+  int use_high_bit_depth = 0;
+  int chroma_subsamp_x = 0;
+  int chroma_subsamp_y = 0;
 
   switch (src->fmt) {
     case AOM_IMG_FMT_AOMI420:
@@ -1446,9 +1548,6 @@ int av1_add_film_grain(const aom_film_grain_t *params, const aom_image_t *src,
   copy_rect(src->planes[AOM_PLANE_Y], src->stride[AOM_PLANE_Y],
             dst->planes[AOM_PLANE_Y], dst->stride[AOM_PLANE_Y], src->d_w,
             src->d_h, use_high_bit_depth);
-  // Note that dst is already assumed to be aligned to even.
-  extend_even(dst->planes[AOM_PLANE_Y], dst->stride[AOM_PLANE_Y], src->d_w,
-              src->d_h, use_high_bit_depth);
 
   if (!src->monochrome) {
     copy_rect(src->planes[AOM_PLANE_U], src->stride[AOM_PLANE_U],
@@ -1462,15 +1561,5 @@ int av1_add_film_grain(const aom_film_grain_t *params, const aom_image_t *src,
               use_high_bit_depth);
   }
 
-  luma = dst->planes[AOM_PLANE_Y];
-  cb = dst->planes[AOM_PLANE_U];
-  cr = dst->planes[AOM_PLANE_V];
-
-  // luma and chroma strides in samples
-  luma_stride = dst->stride[AOM_PLANE_Y] >> use_high_bit_depth;
-  chroma_stride = dst->stride[AOM_PLANE_U] >> use_high_bit_depth;
-
-  return add_film_grain_run(params, luma, cb, cr, height, width, luma_stride,
-                            chroma_stride, use_high_bit_depth, chroma_subsamp_y,
-                            chroma_subsamp_x, mc_identity);
+  return av1_add_film_grain_in_place(params, dst);
 }
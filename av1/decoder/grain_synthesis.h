@@ -38,6 +38,21 @@ extern "C" {
 int av1_add_film_grain(const aom_film_grain_t *grain_params,
                        const aom_image_t *src, aom_image_t *dst);
 
+/*!\brief Add film grain in place
+ *
+ * Add film grain to an image whose width and height are allocated aligned to
+ * even. Besides the planar formats supported by av1_add_film_grain(), the
+ * image may be in the interleaved AOM_IMG_FMT_NV12 or AOM_IMG_FMT_P010
+ * format.
+ *
+ * Returns 0 for success, -1 for failure
+ *
+ * \param[in]    grain_params     Grain parameters
+ * \param[in]    img              Image to add grain to
+ */
+int av1_add_film_grain_in_place(const aom_film_grain_t *grain_params,
+                                aom_image_t *img);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
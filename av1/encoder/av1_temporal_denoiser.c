@@ -322,15 +322,21 @@ void av1_denoiser_denoise(AV1_COMP *cpi, MACROBLOCK *mb, int mi_row, int mi_col,
       cpi->svc.number_spatial_layers - cpi->svc.spatial_layer_id == 2
           ? denoiser->num_ref_frames
           : 0;
-  YV12_BUFFER_CONFIG avg = denoiser->running_avg_y[INTRA_FRAME + shift];
+  // Only the block's own region of the shared running average buffers is
+  // accessed below, so blocks can be denoised concurrently by the row-MT
+  // workers.
+  const YV12_BUFFER_CONFIG *const avg =
+      &denoiser->running_avg_y[INTRA_FRAME + shift];
   const int denoise_layer_index =
       cpi->svc.number_spatial_layers - cpi->svc.spatial_layer_id - 1;
-  YV12_BUFFER_CONFIG mc_avg = denoiser->mc_running_avg_y[denoise_layer_index];
-  uint8_t *avg_start = block_start(avg.y_buffer, avg.y_stride, mi_row, mi_col);
+  const YV12_BUFFER_CONFIG *const mc_avg =
+      &denoiser->mc_running_avg_y[denoise_layer_index];
+  uint8_t *avg_start =
+      block_start(avg->y_buffer, avg->y_stride, mi_row, mi_col);
 
   uint8_t *mc_avg_start =
-      block_start(mc_avg.y_buffer, mc_avg.y_stride, mi_row, mi_col);
-  struct buf_2d src = mb->plane[0].src;
+      block_start(mc_avg->y_buffer, mc_avg->y_stride, mi_row, mi_col);
+  const struct buf_2d *const src = &mb->plane[0].src;
   int increase_denoising = 0;
   int last_is_reference = cpi->ref_frame_flags & AOM_LAST_FLAG;
   mv_col = ctx->best_sse_mv.as_mv.col;
@@ -353,16 +359,16 @@ void av1_denoiser_denoise(AV1_COMP *cpi, MACROBLOCK *mb, int mi_row, int mi_col,
         cpi->svc.spatial_layer_id, use_gf_temporal_ref);
 
   if (decision == FILTER_BLOCK) {
-    decision = av1_denoiser_filter(src.buf, src.stride, mc_avg_start,
-                                   mc_avg.y_stride, avg_start, avg.y_stride,
+    decision = av1_denoiser_filter(src->buf, src->stride, mc_avg_start,
+                                   mc_avg->y_stride, avg_start, avg->y_stride,
                                    increase_denoising, bs, motion_magnitude);
   }
 
   if (decision == FILTER_BLOCK) {
-    aom_convolve_copy(avg_start, avg.y_stride, src.buf, src.stride,
+    aom_convolve_copy(avg_start, avg->y_stride, src->buf, src->stride,
                       block_size_wide[bs], block_size_high[bs]);
   } else {  // COPY_BLOCK
-    aom_convolve_copy(src.buf, src.stride, avg_start, avg.y_stride,
+    aom_convolve_copy(src->buf, src->stride, avg_start, avg->y_stride,
                       block_size_wide[bs], block_size_high[bs]);
   }
   *denoiser_decision = decision;
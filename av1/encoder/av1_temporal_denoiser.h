@@ -78,6 +78,12 @@ void av1_denoiser_update_frame_info(
     int gld_fb_idx, int lst_fb_idx, int resized,
     int svc_refresh_denoiser_buffers, int second_spatial_layer);
 
+// Denoises the luma block at (mi_row, mi_col) in place in the source. This is
+// called from nonrd pickmode and is safe to run concurrently for different
+// blocks: it only reads the frame-level denoiser state, which is fixed while
+// the tiles are encoded, and only writes the block's own region of the
+// source and the running average buffers. Per-block state lives in mb and
+// ctx, which belong to the calling thread.
 void av1_denoiser_denoise(struct AV1_COMP *cpi, MACROBLOCK *mb, int mi_row,
                           int mi_col, BLOCK_SIZE bs, PICK_MODE_CONTEXT *ctx,
                           AV1_DENOISER_DECISION *denoiser_decision,
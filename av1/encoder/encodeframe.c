@@ -394,8 +394,9 @@ static void init_ref_frame_space(AV1_COMP *cpi, ThreadData *td, int mi_row,
       }
       // tpl_pred_error is the pred_error reduction of best_ref w.r.t.
       // LAST_FRAME.
-      tpl_pred_error[best_rf_idx] = this_stats->pred_error[best_rf_idx] -
-                                    this_stats->pred_error[LAST_FRAME - 1];
+      tpl_pred_error[best_rf_idx] =
+          (int64_t)this_stats->pred_error[best_rf_idx] -
+          this_stats->pred_error[LAST_FRAME - 1];
 
       for (int rf_idx = 1; rf_idx < INTER_REFS_PER_FRAME; ++rf_idx)
         inter_cost[rf_idx] += tpl_pred_error[rf_idx];
@@ -1303,9 +1304,12 @@ void av1_alloc_tile_data(AV1_COMP *cpi) {
   enc_row_mt->allocated_tile_cols = 0;
   enc_row_mt->allocated_tile_rows = 0;
 
+  // The tile data is dominated by the entropy context of each tile.
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_ENTROPY_TABLES);
   CHECK_MEM_ERROR(
       cm, cpi->tile_data,
       aom_memalign(32, tile_cols * tile_rows * sizeof(*cpi->tile_data)));
+  aom_mem_pop_tag(prev_tag);
 
   cpi->allocated_tiles = tile_cols * tile_rows;
   enc_row_mt->allocated_tile_cols = tile_cols;
@@ -1501,6 +1505,7 @@ static inline void encode_tiles(AV1_COMP *cpi) {
   if (cpi->allocated_tiles < tile_cols * tile_rows) av1_alloc_tile_data(cpi);
 
   av1_init_tile_data(cpi);
+  const aom_arena_mark_t arena_mark = aom_arena_get_mark(&cpi->frame_arena);
   av1_alloc_mb_data(cpi, mb);
 
   for (tile_row = 0; tile_row < tile_rows; ++tile_row) {
@@ -1526,6 +1531,7 @@ static inline void encode_tiles(AV1_COMP *cpi) {
   }
 
   av1_dealloc_mb_data(mb, av1_num_planes(cm));
+  aom_arena_release(&cpi->frame_arena, arena_mark);
 }
 
 // Set the relative distance of a reference frame w.r.t. current frame
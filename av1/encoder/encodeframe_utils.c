@@ -102,6 +102,7 @@ int av1_get_cb_rdmult(const AV1_COMP *const cpi, MACROBLOCK *const x,
   TplParams *const tpl_data = &cpi->ppi->tpl_data;
   TplDepFrame *tpl_frame = &tpl_data->tpl_frame[tpl_idx];
   TplDepStats *tpl_stats = tpl_frame->tpl_stats_ptr;
+  TplDepFlow *tpl_flow = tpl_frame->tpl_flow_ptr;
 
   const int mi_wide = mi_size_wide[bsize];
   const int mi_high = mi_size_high[bsize];
@@ -117,13 +118,15 @@ int av1_get_cb_rdmult(const AV1_COMP *const cpi, MACROBLOCK *const x,
       if (row >= cm->mi_params.mi_rows || col >= cm->mi_params.mi_cols)
         continue;
 
-      TplDepStats *this_stats = &tpl_stats[av1_tpl_ptr_pos(
-          row, col, tpl_stride, tpl_data->tpl_stats_block_mis_log2)];
+      const int pos = av1_tpl_ptr_pos(row, col, tpl_stride,
+                                      tpl_data->tpl_stats_block_mis_log2);
+      TplDepStats *this_stats = &tpl_stats[pos];
+      TplDepFlow *this_flow = &tpl_flow[pos];
 
       double cbcmp = (double)this_stats->srcrf_dist;
       int64_t mc_dep_delta =
-          RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                 this_stats->mc_dep_dist);
+          RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                 this_flow->mc_dep_dist);
       double dist_scaled = (double)(this_stats->recrf_dist << RDDIV_BITS);
       intra_cost_base += log(dist_scaled) * cbcmp;
       mc_dep_cost_base += log(3 * dist_scaled + mc_dep_delta) * cbcmp;
@@ -692,6 +695,7 @@ int av1_get_rdmult_delta(AV1_COMP *cpi, BLOCK_SIZE bsize, int mi_row,
 
   TplDepFrame *tpl_frame = &tpl_data->tpl_frame[tpl_idx];
   TplDepStats *tpl_stats = tpl_frame->tpl_stats_ptr;
+  TplDepFlow *tpl_flow = tpl_frame->tpl_flow_ptr;
   int tpl_stride = tpl_frame->stride;
 
   if (!av1_tpl_stats_ready(&cpi->ppi->tpl_data, cpi->gf_frame_index)) {
@@ -716,11 +720,12 @@ int av1_get_rdmult_delta(AV1_COMP *cpi, BLOCK_SIZE bsize, int mi_row,
   for (int row = mi_row; row < mi_row + mi_high; row += row_step) {
     for (int col = mi_col_sr; col < mi_col_end_sr; col += col_step_sr) {
       if (row >= cm->mi_params.mi_rows || col >= mi_cols_sr) continue;
-      TplDepStats *this_stats =
-          &tpl_stats[av1_tpl_ptr_pos(row, col, tpl_stride, block_mis_log2)];
+      const int pos = av1_tpl_ptr_pos(row, col, tpl_stride, block_mis_log2);
+      TplDepStats *this_stats = &tpl_stats[pos];
+      TplDepFlow *this_flow = &tpl_flow[pos];
       int64_t mc_dep_delta =
-          RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                 this_stats->mc_dep_dist);
+          RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                 this_flow->mc_dep_dist);
       intra_cost += this_stats->recrf_dist << RDDIV_BITS;
       mc_dep_cost += (this_stats->recrf_dist << RDDIV_BITS) + mc_dep_delta;
 #ifndef NDEBUG
@@ -911,6 +916,7 @@ int av1_get_q_for_deltaq_objective(AV1_COMP *const cpi, ThreadData *td,
 
   TplDepFrame *tpl_frame = &tpl_data->tpl_frame[tpl_idx];
   TplDepStats *tpl_stats = tpl_frame->tpl_stats_ptr;
+  TplDepFlow *tpl_flow = tpl_frame->tpl_flow_ptr;
   int tpl_stride = tpl_frame->stride;
   if (!tpl_frame->is_valid) return base_qindex;
 
@@ -929,12 +935,13 @@ int av1_get_q_for_deltaq_objective(AV1_COMP *const cpi, ThreadData *td,
   for (int row = mi_row; row < mi_row + mi_high; row += row_step) {
     for (int col = mi_col_sr; col < mi_col_end_sr; col += col_step_sr) {
       if (row >= cm->mi_params.mi_rows || col >= mi_cols_sr) continue;
-      TplDepStats *this_stats =
-          &tpl_stats[av1_tpl_ptr_pos(row, col, tpl_stride, block_mis_log2)];
+      const int pos = av1_tpl_ptr_pos(row, col, tpl_stride, block_mis_log2);
+      TplDepStats *this_stats = &tpl_stats[pos];
+      TplDepFlow *this_flow = &tpl_flow[pos];
       double cbcmp = (double)this_stats->srcrf_dist;
       int64_t mc_dep_delta =
-          RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                 this_stats->mc_dep_dist);
+          RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                 this_flow->mc_dep_dist);
       double dist_scaled = (double)(this_stats->recrf_dist << RDDIV_BITS);
       intra_cost += log(dist_scaled) * cbcmp;
       mc_dep_cost += log(dist_scaled + mc_dep_delta) * cbcmp;
@@ -1679,13 +1686,14 @@ void av1_set_cost_upd_freq(AV1_COMP *cpi, ThreadData *td,
 }
 
 void av1_dealloc_src_diff_buf(struct macroblock *mb, int num_planes) {
+  // The buffers are owned by the frame arena.
   for (int plane = 0; plane < num_planes; ++plane) {
-    aom_free(mb->plane[plane].src_diff);
     mb->plane[plane].src_diff = NULL;
   }
 }
 
-void av1_alloc_src_diff_buf(const struct AV1Common *cm, struct macroblock *mb) {
+void av1_alloc_src_diff_buf(const struct AV1Common *cm, struct macroblock *mb,
+                            aom_arena_t *arena) {
   const int num_planes = av1_num_planes(cm);
 #ifndef NDEBUG
   for (int plane = 0; plane < num_planes; ++plane) {
@@ -1697,8 +1705,9 @@ void av1_alloc_src_diff_buf(const struct AV1Common *cm, struct macroblock *mb) {
         plane ? cm->seq_params->subsampling_x + cm->seq_params->subsampling_y
               : 0;
     const int sb_size = MAX_SB_SQUARE >> subsampling_xy;
-    CHECK_MEM_ERROR(cm, mb->plane[plane].src_diff,
-                    (int16_t *)aom_memalign(
-                        32, sizeof(*mb->plane[plane].src_diff) * sb_size));
+    CHECK_MEM_ERROR(
+        cm, mb->plane[plane].src_diff,
+        (int16_t *)aom_arena_memalign(
+            arena, 32, sizeof(*mb->plane[plane].src_diff) * sb_size));
   }
 }
@@ -463,10 +463,10 @@ static inline void allocate_winner_mode_stats(const AV1_COMP *cpi,
                       winner_mode_count * sizeof(mb->winner_mode_stats[0])));
 }
 
-void av1_alloc_src_diff_buf(const struct AV1Common *cm, struct macroblock *mb);
+void av1_alloc_src_diff_buf(const struct AV1Common *cm, struct macroblock *mb,
+                            aom_arena_t *arena);
 
-static inline void av1_alloc_mb_data(const AV1_COMP *cpi,
-                                     struct macroblock *mb) {
+static inline void av1_alloc_mb_data(AV1_COMP *cpi, struct macroblock *mb) {
   const AV1_COMMON *cm = &cpi->common;
   const SPEED_FEATURES *sf = &cpi->sf;
   if (!sf->rt_sf.use_nonrd_pick_mode) {
@@ -481,7 +481,7 @@ static inline void av1_alloc_mb_data(const AV1_COMP *cpi,
           (InterModesInfo *)aom_malloc(sizeof(*mb->inter_modes_info)));
   }
 
-  av1_alloc_src_diff_buf(cm, mb);
+  av1_alloc_src_diff_buf(cm, mb, &cpi->frame_arena);
 
   CHECK_MEM_ERROR(cm, mb->e_mbd.seg_mask,
                   (uint8_t *)aom_memalign(
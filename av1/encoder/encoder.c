@@ -31,6 +31,7 @@
 #endif
 #include "aom_dsp/flow_estimation/corner_detect.h"
 #include "aom_dsp/psnr.h"
+#include "aom_dsp/pyramid.h"
 #if CONFIG_INTERNAL_STATS
 #include "aom_dsp/ssim.h"
 #endif
@@ -1391,11 +1392,13 @@ AV1_COMP *av1_create_compressor(AV1_PRIMARY *ppi, const AV1EncoderConfig *oxcf,
 
   mi_params->mi_alloc_bsize = BLOCK_4X4;
 
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_ENTROPY_TABLES);
   CHECK_MEM_ERROR(cm, cm->fc,
                   (FRAME_CONTEXT *)aom_memalign(32, sizeof(*cm->fc)));
   CHECK_MEM_ERROR(
       cm, cm->default_frame_context,
       (FRAME_CONTEXT *)aom_memalign(32, sizeof(*cm->default_frame_context)));
+  aom_mem_pop_tag(prev_tag);
   memset(cm->fc, 0, sizeof(*cm->fc));
   memset(cm->default_frame_context, 0, sizeof(*cm->default_frame_context));
 
@@ -1640,8 +1643,10 @@ void av1_remove_primary_compressor(AV1_PRIMARY *ppi) {
 
   for (int frame = 0; frame < MAX_LAG_BUFFERS; ++frame) {
     aom_free(tpl_data->tpl_stats_pool[frame]);
+    aom_free(tpl_data->tpl_flow_pool[frame]);
     aom_free_frame_buffer(&tpl_data->tpl_rec_pool[frame]);
     tpl_data->tpl_stats_pool[frame] = NULL;
+    tpl_data->tpl_flow_pool[frame] = NULL;
   }
 
 #if !CONFIG_REALTIME_ONLY
@@ -1688,6 +1693,8 @@ void av1_remove_compressor(AV1_COMP *cpi) {
   av1_denoiser_free(&(cpi->denoiser));
 #endif
 
+  av1_free_scaled_ref_cache(cpi);
+
   if (cm->error) {
     // Help detect use after free of the error detail string.
     memset(cm->error->detail, 'A', sizeof(cm->error->detail) - 1);
@@ -1762,14 +1769,7 @@ static void generate_psnr_packet(AV1_COMP *cpi) {
   struct aom_codec_cx_pkt pkt;
   int i;
   PSNR_STATS psnr;
-#if CONFIG_AV1_HIGHBITDEPTH
-  const uint32_t in_bit_depth = cpi->oxcf.input_cfg.input_bit_depth;
-  const uint32_t bit_depth = cpi->td.mb.e_mbd.bd;
-  aom_calc_highbd_psnr(cpi->source, &cpi->common.cur_frame->buf, &psnr,
-                       bit_depth, in_bit_depth);
-#else
-  aom_calc_psnr(cpi->source, &cpi->common.cur_frame->buf, &psnr);
-#endif
+  av1_calc_psnr_mt(cpi, cpi->source, &cpi->common.cur_frame->buf, &psnr);
 
   for (i = 0; i < 4; ++i) {
     pkt.data.psnr.samples[i] = psnr.samples[i];
@@ -1778,8 +1778,9 @@ static void generate_psnr_packet(AV1_COMP *cpi) {
   }
 
 #if CONFIG_AV1_HIGHBITDEPTH
-  if ((cpi->source->flags & YV12_FLAG_HIGHBITDEPTH) &&
-      (in_bit_depth < bit_depth)) {
+  const uint32_t in_bit_depth = cpi->oxcf.input_cfg.input_bit_depth;
+  const uint32_t bit_depth = cpi->td.mb.e_mbd.bd;
+  if (aom_psnr_needs_hbd_stats(cpi->source, bit_depth, in_bit_depth)) {
     for (i = 0; i < 4; ++i) {
       pkt.data.psnr.samples_hbd[i] = psnr.samples_hbd[i];
       pkt.data.psnr.sse_hbd[i] = psnr.sse_hbd[i];
@@ -1817,6 +1818,7 @@ int av1_set_reference_enc(AV1_COMP *cpi, int idx, YV12_BUFFER_CONFIG *sd) {
   YV12_BUFFER_CONFIG *cfg = get_ref_frame(cm, idx);
   if (cfg) {
     aom_yv12_copy_frame(sd, cfg, num_planes);
+    av1_invalidate_scaled_refs(cpi, cm->ref_frame_map[idx]);
     return 0;
   } else {
     return -1;
@@ -2205,7 +2207,7 @@ void av1_set_frame_size(AV1_COMP *cpi, int width, int height) {
 
   AV1EncoderConfig *oxcf = &cpi->oxcf;
   oxcf->border_in_pixels = av1_get_enc_border_size(
-      av1_is_resize_needed(oxcf), oxcf->kf_cfg.key_freq_max == 0,
+      av1_is_resize_border_needed(oxcf), oxcf->kf_cfg.key_freq_max == 0,
       cm->seq_params->sb_size);
 
   // Reset the frame pointers to the current frame size.
@@ -2259,6 +2261,22 @@ void av1_set_frame_size(AV1_COMP *cpi, int width, int height) {
   set_ref_ptrs(cm, xd, LAST_FRAME, LAST_FRAME);
 }
 
+// Returns whether the borders of the reconstructed frame must be extended.
+// The extended borders are only read by the motion compensation of later
+// frames, so they are skipped for frames that never become a reference: all
+// intra encodes, RTC non-reference frames and any frame that does not refresh a
+// reference slot. Motion vectors pointing outside such a frame can never be
+// produced, so skipping the extension does not change the bitstream.
+// Referenced frames are still extended in full once the frame is filtered:
+// motion search and TPL read the borders of every reference, and without
+// resizing the border is only the superblock size plus 32 pixels (see
+// av1_get_enc_border_size()).
+static inline bool frame_borders_needed(const AV1_COMP *cpi) {
+  return cpi->oxcf.mode != ALLINTRA &&
+         !cpi->ppi->rtc_ref.non_reference_frame &&
+         cpi->common.current_frame.refresh_frame_flags != 0;
+}
+
 static inline int extend_borders_mt(const AV1_COMP *cpi,
                                     MULTI_THREADED_MODULES stage, int plane) {
   const AV1_COMMON *const cm = &cpi->common;
@@ -2271,10 +2289,10 @@ static inline int extend_borders_mt(const AV1_COMP *cpi,
     // of the current and above superblock row is complete.
     case MOD_LPF: return 0;
     case MOD_CDEF:
-      return is_cdef_used(cm) && !cpi->ppi->rtc_ref.non_reference_frame &&
+      return is_cdef_used(cm) && frame_borders_needed(cpi) &&
              !is_restoration_used(cm) && !av1_superres_scaled(cm);
     case MOD_LR:
-      return is_restoration_used(cm) &&
+      return is_restoration_used(cm) && frame_borders_needed(cpi) &&
              (cm->rst_info[plane].frame_restoration_type != RESTORE_NONE);
     default: assert(0);
   }
@@ -2347,7 +2365,7 @@ static void cdef_restoration_frame(AV1_COMP *cpi, AV1_COMMON *cm,
       if (num_workers > 1) {
         // Extension of frame borders is multi-threaded along with loop
         // restoration filter.
-        const int do_extend_border = 1;
+        const int do_extend_border = frame_borders_needed(cpi);
         av1_loop_restoration_filter_frame_mt(
             &cm->cur_frame->buf, cm, 0, mt_info->workers, num_workers,
             &mt_info->lr_row_sync, &cpi->lr_ctxt, do_extend_border);
@@ -2365,6 +2383,9 @@ static void cdef_restoration_frame(AV1_COMP *cpi, AV1_COMMON *cm,
 
 static void extend_frame_borders(AV1_COMP *cpi) {
   const AV1_COMMON *const cm = &cpi->common;
+#if CONFIG_COLLECT_COMPONENT_TIMING
+  start_timing(cpi, extend_frame_borders_time);
+#endif
   // TODO(debargha): Fix mv search range on encoder side
   for (int plane = 0; plane < av1_num_planes(cm); ++plane) {
     const bool extend_border_done = extend_borders_mt(cpi, MOD_CDEF, plane) ||
@@ -2375,6 +2396,9 @@ static void extend_frame_borders(AV1_COMP *cpi) {
                                          ybf->crop_heights[plane > 0]);
     }
   }
+#if CONFIG_COLLECT_COMPONENT_TIMING
+  end_timing(cpi, extend_frame_borders_time);
+#endif
 }
 
 /*!\brief Select and apply deblocking filters, cdef filters, and restoration
@@ -2572,7 +2596,10 @@ static int encode_without_recode(AV1_COMP *cpi) {
     memset(cpi->consec_zero_mv, 0, current_size * sizeof(*cpi->consec_zero_mv));
   }
 
-  if (cpi->scaled_last_source_available) {
+  if (!av1_need_scaled_last_source(cpi)) {
+    cpi->last_source = NULL;
+    cpi->scaled_last_source_available = 0;
+  } else if (cpi->scaled_last_source_available) {
     cpi->last_source = &cpi->scaled_last_source;
     cpi->scaled_last_source_available = 0;
   } else if (cpi->unscaled_last_source != NULL) {
@@ -2871,7 +2898,9 @@ static int encode_with_recode_loop(AV1_COMP *cpi, size_t *size, uint8_t *dest,
     }
 #endif
 
-    if (cpi->unscaled_last_source != NULL) {
+    if (!av1_need_scaled_last_source(cpi)) {
+      cpi->last_source = NULL;
+    } else if (cpi->unscaled_last_source != NULL) {
       cpi->last_source = av1_realloc_and_scale_if_required(
           cm, cpi->unscaled_last_source, &cpi->scaled_last_source,
           EIGHTTAP_REGULAR, 0, false, false, cpi->oxcf.border_in_pixels,
@@ -3257,9 +3286,7 @@ static int encode_with_recode_loop_and_filter(AV1_COMP *cpi, size_t *size,
     loopfilter_frame(cpi, cm);
   }
 
-  if (cpi->oxcf.mode != ALLINTRA && !cpi->ppi->rtc_ref.non_reference_frame) {
-    extend_frame_borders(cpi);
-  }
+  if (frame_borders_needed(cpi)) extend_frame_borders(cpi);
 
 #ifdef OUTPUT_YUV_REC
   aom_write_one_yuv_frame(cm, &cm->cur_frame->buf);
@@ -3998,6 +4025,26 @@ static int encode_frame_to_data_rate(AV1_COMP *cpi, size_t *size, uint8_t *dest,
   return AOM_CODEC_OK;
 }
 
+#if !CONFIG_REALTIME_ONLY
+// Frees the image pyramids which are not needed for a while, to save memory.
+// The pyramid of the source frame is invalidated at the start of each frame
+// anyway, so it is not needed once the frame is encoded.
+static void release_pyramids(AV1_COMP *cpi) {
+  const LOW_MEM_LEVEL level = cpi->oxcf.low_mem_level;
+  if (level == LOW_MEM_OFF || !cpi->alloc_pyramid) return;
+  if (cpi->source != NULL) aom_release_pyramid(cpi->source->y_pyramid);
+  if (cpi->unscaled_source != NULL)
+    aom_release_pyramid(cpi->unscaled_source->y_pyramid);
+  // With parallel frame encoding, the other frames may be reading the pyramids
+  // of their references.
+  if (level >= LOW_MEM_REFERENCES && cpi->ppi->num_fp_contexts == 1) {
+    RefCntBuffer *const frame_bufs = cpi->common.buffer_pool->frame_bufs;
+    for (int i = 0; i < FRAME_BUFFERS; ++i)
+      aom_release_pyramid(frame_bufs[i].buf.y_pyramid);
+  }
+}
+#endif  // !CONFIG_REALTIME_ONLY
+
 int av1_encode(AV1_COMP *const cpi, uint8_t *const dest, size_t dest_size,
                const EncodeFrameInput *const frame_input,
                const EncodeFrameParams *const frame_params,
@@ -4054,6 +4101,9 @@ int av1_encode(AV1_COMP *const cpi, uint8_t *const dest, size_t dest_size,
         AOM_CODEC_OK) {
       return AOM_CODEC_ERROR;
     }
+#if !CONFIG_REALTIME_ONLY
+    release_pyramids(cpi);
+#endif  // !CONFIG_REALTIME_ONLY
   } else {
     return AOM_CODEC_ERROR;
   }
@@ -4084,9 +4134,12 @@ static int apply_denoise_2d(AV1_COMP *cpi, const YV12_BUFFER_CONFIG *sd,
     }
     memset(cpi->film_grain_table, 0, sizeof(*cpi->film_grain_table));
   }
-  if (aom_denoise_and_model_run(cpi->denoise_and_model, sd,
-                                &cm->film_grain_params,
-                                cpi->oxcf.enable_dnl_denoising)) {
+  // The encoder workers are created when the first frame is encoded, so the
+  // first frame is denoised on the main thread only.
+  if (aom_denoise_and_model_run_mt(
+          cpi->denoise_and_model, sd, &cm->film_grain_params,
+          cpi->oxcf.enable_dnl_denoising, cpi->mt_info.workers,
+          cpi->mt_info.num_workers)) {
     if (cm->film_grain_params.apply_grain) {
       aom_film_grain_table_append(cpi->film_grain_table, time_stamp, end_time,
                                   &cm->film_grain_params);
@@ -4098,7 +4151,7 @@ static int apply_denoise_2d(AV1_COMP *cpi, const YV12_BUFFER_CONFIG *sd,
 
 int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
                           const YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
-                          int64_t end_time) {
+                          int64_t end_time, void *input_priv) {
   AV1_COMMON *const cm = &cpi->common;
   const SequenceHeader *const seq_params = cm->seq_params;
   int res = 0;
@@ -4158,11 +4211,14 @@ int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
   }
 #endif  //  CONFIG_DENOISE
 
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_LOOKAHEAD);
   if (av1_lookahead_push(cpi->ppi->lookahead, sd, time_stamp, end_time,
-                         use_highbitdepth, cpi->alloc_pyramid, frame_flags)) {
+                         use_highbitdepth, cpi->alloc_pyramid, frame_flags,
+                         input_priv)) {
     aom_set_error(cm->error, AOM_CODEC_ERROR, "av1_lookahead_push() failed");
     res = -1;
   }
+  aom_mem_pop_tag(prev_tag);
 #if CONFIG_INTERNAL_STATS
   aom_usec_timer_mark(&timer);
   cpi->ppi->total_time_receive_data += aom_usec_timer_elapsed(&timer);
@@ -4248,11 +4304,7 @@ static void compute_internal_stats(AV1_COMP *cpi, int frame_bytes) {
       PSNR_STATS psnr;
       double weight[2] = { 0.0, 0.0 };
       double frame_ssim2[2] = { 0.0, 0.0 };
-#if CONFIG_AV1_HIGHBITDEPTH
-      aom_calc_highbd_psnr(orig, recon, &psnr, bit_depth, in_bit_depth);
-#else
-      aom_calc_psnr(orig, recon, &psnr);
-#endif
+      av1_calc_psnr_mt(cpi, orig, recon, &psnr);
       adjust_image_stat(psnr.psnr[1], psnr.psnr[2], psnr.psnr[3], psnr.psnr[0],
                         &(ppi->psnr[0]));
       ppi->total_sq_error[0] += psnr.sse[0];
@@ -4719,6 +4771,10 @@ int av1_get_compressed_data(AV1_COMP *cpi, AV1_COMP_DATA *const cpi_data) {
   }
   cm->error->setjmp = 1;
 
+  // Return the scratch buffers of the previous frame, including any left in
+  // use by an error, and size the arena for the peak usage of that frame.
+  aom_arena_reset(&cpi->frame_arena);
+
 #if CONFIG_INTERNAL_STATS
   cpi->frame_recode_hits = 0;
   cpi->time_compress_data = 0;
@@ -4769,6 +4825,8 @@ int av1_get_compressed_data(AV1_COMP *cpi, AV1_COMP_DATA *const cpi_data) {
     aom_internal_error(cpi->common.error, AOM_CODEC_ERROR,
                        "Failed to allocate new cur_frame");
   }
+  // The scaled copies of the previous frame in this buffer are out of date.
+  av1_invalidate_scaled_refs(cpi, cm->cur_frame);
 
 #if CONFIG_COLLECT_COMPONENT_TIMING
   // Accumulate 2nd pass time in 2-pass case or 1 pass time in 1-pass case.
@@ -21,6 +21,7 @@
 #include "config/aom_config.h"
 
 #include "aom/aomcx.h"
+#include "aom_mem/aom_arena.h"
 #include "aom_util/aom_pthread.h"
 
 #include "av1/common/alloccommon.h"
@@ -249,6 +250,25 @@ typedef enum {
   SKIP_APPLY_LOOPFILTER = 1 << 3,
 } SKIP_APPLY_POSTPROC_FILTER;
 
+/*!\enum LOW_MEM_LEVEL
+ * \brief This enum controls what the encoder frees to save memory. None of
+ * the levels change the encoded output.
+ */
+typedef enum {
+  LOW_MEM_OFF, /**< Free nothing early */
+  /*!
+   * Free the image pyramids of source frames once a frame is encoded, and do
+   * not keep a scaled copy of the last source frame when nothing reads it.
+   * This does not slow down the encoder.
+   */
+  LOW_MEM_SOURCES,
+  /*!
+   * Also free the image pyramids of reference frames after each frame. They
+   * are computed again whenever global motion search uses them.
+   */
+  LOW_MEM_REFERENCES,
+} LOW_MEM_LEVEL;
+
 /*!
  * \brief Encoder config related to resize.
  */
@@ -1106,6 +1126,16 @@ typedef struct AV1EncoderConfig {
 
   // A flag to control if we enable the superblock qp sweep for a given lambda
   int sb_qp_sweep;
+
+  // Indicates whether realtime encoding with resize or superres keeps the
+  // border of unscaled encoding, see av1_is_resize_border_needed().
+  bool reduced_frame_border;
+
+  // What the encoder frees to save memory.
+  LOW_MEM_LEVEL low_mem_level;
+
+  // Indicates whether scaled reference frames are kept for later frames.
+  bool scaled_ref_cache;
   /*!\endcond */
 } AV1EncoderConfig;
 
@@ -1948,6 +1978,7 @@ enum {
   loop_filter_time,
   cdef_time,
   loop_restoration_time,
+  extend_frame_borders_time,
   av1_pack_bitstream_final_time,
   av1_encode_frame_time,
   av1_compute_global_motion_time,
@@ -2007,6 +2038,7 @@ static inline char const *get_component_name(int index) {
     case loop_filter_time: return "loop_filter_time";
     case cdef_time: return "cdef_time";
     case loop_restoration_time: return "loop_restoration_time";
+    case extend_frame_borders_time: return "extend_frame_borders_time";
     case av1_pack_bitstream_final_time: return "av1_pack_bitstream_final_time";
     case av1_encode_frame_time: return "av1_encode_frame_time";
     case av1_compute_global_motion_time:
@@ -2179,6 +2211,61 @@ typedef struct {
   int height; /*!< Desired resized height */
 } ResizePendingParams;
 
+/*!
+ * \brief A scaled copy of a reference frame kept for reuse.
+ */
+typedef struct {
+  /*!
+   * The reference frame the copy was scaled from. No reference is held on it;
+   * the entry is dropped when the buffer is reused for a new frame.
+   */
+  const RefCntBuffer *src;
+  /*!
+   * The scaled copy. The cache holds one reference on it.
+   */
+  RefCntBuffer *buf;
+  /*!
+   * Scaler settings the copy was made with.
+   */
+  InterpFilter filter;
+  /*!
+   * Scaler phase the copy was made with.
+   */
+  int phase;
+  /*!
+   * Whether the copy was made with the optimized scaler, if available.
+   */
+  int use_optimized_scaler;
+  /*!
+   * Frame counter value when the copy was last used, for eviction.
+   */
+  unsigned int last_used;
+} ScaledRefCacheEntry;
+
+/*!
+ * \brief Scaled reference frames shared between frames.
+ *
+ * A reference frame used by several frames coded at another resolution, such
+ * as the golden frame after a resize, is scaled once and the copy is shared
+ * by all the frames using it. The copies are frame buffers of the buffer
+ * pool; there are at most INTER_REFS_PER_FRAME of them so that the pool is
+ * never exhausted.
+ */
+typedef struct {
+  /*!
+   * The cached copies.
+   */
+  ScaledRefCacheEntry entries[INTER_REFS_PER_FRAME];
+  /*!
+   * Number of valid entries.
+   */
+  int num_entries;
+  /*!
+   * Number of av1_scale_references() calls, for eviction.
+   */
+  unsigned int counter;
+} ScaledRefCache;
+
 /*!
  * \brief Refrence frame distance related variables.
  */
@@ -3016,6 +3103,11 @@ typedef struct AV1_COMP {
    */
   RefCntBuffer *scaled_ref_buf[INTER_REFS_PER_FRAME];
 
+  /*!
+   * Scaled reference frames kept for reuse by later frames.
+   */
+  ScaledRefCache scaled_ref_cache;
+
   /*!
    * Pointer to the buffer holding the last show frame.
    */
@@ -3674,6 +3766,13 @@ typedef struct AV1_COMP {
    * so scaling is not needed for last_source.
    */
   int scaled_last_source_available;
+
+  /*!
+   * Scratch memory for the buffers that only live for one stage of a frame
+   * encode: temporal filtering, tpl, global motion and the source difference
+   * buffers. It is reset at the start of each frame.
+   */
+  aom_arena_t frame_arena;
 } AV1_COMP;
 
 /*!
@@ -3803,15 +3902,18 @@ int av1_init_parallel_frame_context(const AV1_COMP_DATA *const first_cpi_data,
  * \param[in,out] sd             Contain raw frame data
  * \param[in]     time_stamp     Time stamp of the frame
  * \param[in]     end_time_stamp End time stamp
+ * \param[in]     input_priv     Private data of the input image, passed to
+ *                               the release callback of zero copy input
  *
  * \return Returns a value to indicate if the frame data is received
  * successfully.
  * \note The caller can assume that a copy of this frame is made and not just a
- * copy of the pointer.
+ * copy of the pointer, unless zero copy input is enabled with
+ * AV1E_SET_ZERO_COPY_INPUT.
  */
 int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
                           const YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
-                          int64_t end_time_stamp);
+                          int64_t end_time_stamp, void *input_priv);
 
 /*!\brief Encode a frame
  *
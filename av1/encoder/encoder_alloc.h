@@ -15,6 +15,7 @@
 #include "av1/encoder/block.h"
 #include "av1/encoder/encodeframe_utils.h"
 #include "av1/encoder/encoder.h"
+#include "av1/encoder/encoder_utils.h"
 #include "av1/encoder/encodetxb.h"
 #include "av1/encoder/ethread.h"
 #include "av1/encoder/global_motion_facade.h"
@@ -47,7 +48,8 @@ static inline void alloc_context_buffers_ext(
     dealloc_context_buffers_ext(mbmi_ext_info);
     CHECK_MEM_ERROR(
         cm, mbmi_ext_info->frame_base,
-        aom_malloc(new_ext_mi_size * sizeof(*mbmi_ext_info->frame_base)));
+        aom_memalign_huge(
+            32, new_ext_mi_size * sizeof(*mbmi_ext_info->frame_base)));
     mbmi_ext_info->alloc_size = new_ext_mi_size;
   }
   // The stride needs to be updated regardless of whether new allocation
@@ -70,8 +72,11 @@ static inline void alloc_compressor_data(AV1_COMP *cpi) {
   // Avoid the memory allocation of 'mv_costs_alloc' for allintra encoding
   // mode.
   if (cpi->oxcf.kf_cfg.key_freq_max != 0) {
+    const aom_mem_tag_t prev_tag =
+        aom_mem_push_tag(AOM_MEM_TAG_ENTROPY_TABLES);
     CHECK_MEM_ERROR(cm, cpi->td.mv_costs_alloc,
                     (MvCosts *)aom_calloc(1, sizeof(*cpi->td.mv_costs_alloc)));
+    aom_mem_pop_tag(prev_tag);
     cpi->td.mb.mv_costs = cpi->td.mv_costs_alloc;
   }
 
@@ -274,20 +279,14 @@ static inline void dealloc_compressor_data(AV1_COMP *cpi) {
   av1_free_pmc(cpi->td.firstpass_ctx, num_planes);
   cpi->td.firstpass_ctx = NULL;
 
-  const int is_highbitdepth = cpi->tf_ctx.is_highbitdepth;
-  // This call ensures that the buffers allocated by tf_alloc_and_reset_data()
-  // in av1_temporal_filter() for single-threaded encode are freed in case an
-  // error is encountered during temporal filtering (due to early termination
-  // tf_dealloc_data() in av1_temporal_filter() would not be invoked).
-  tf_dealloc_data(&cpi->td.tf_data, is_highbitdepth);
-
-  // This call ensures that tpl_tmp_buffers for single-threaded encode are freed
-  // in case of an error during tpl.
+  // The temporal filter, tpl, global motion and source difference buffers of
+  // all threads are allocated from the frame arena. Freeing the arena also
+  // covers the buffers that were not released due to an error in the middle
+  // of a frame.
+  tf_dealloc_data(&cpi->td.tf_data);
   tpl_dealloc_temp_buffers(&cpi->td.tpl_tmp_buffers);
-
-  // This call ensures that the global motion (gm) data buffers for
-  // single-threaded encode are freed in case of an error during gm.
   gm_dealloc_data(&cpi->td.gm_data);
+  aom_arena_destroy(&cpi->frame_arena);
 
   // This call ensures that CDEF search context buffers are deallocated in case
   // of an error during cdef search.
@@ -432,6 +431,9 @@ static inline YV12_BUFFER_CONFIG *realloc_and_scale_source(AV1_COMP *cpi,
                                                            int scaled_height) {
   AV1_COMMON *cm = &cpi->common;
   const int num_planes = av1_num_planes(cm);
+  const int border = av1_use_reduced_frame_border(&cpi->oxcf)
+                         ? cpi->oxcf.border_in_pixels
+                         : AOM_BORDER_IN_PIXELS;
 
   if (scaled_width == cpi->unscaled_source->y_crop_width &&
       scaled_height == cpi->unscaled_source->y_crop_height) {
@@ -441,7 +443,7 @@ static inline YV12_BUFFER_CONFIG *realloc_and_scale_source(AV1_COMP *cpi,
   if (aom_realloc_frame_buffer(
           &cpi->scaled_source, scaled_width, scaled_height,
           cm->seq_params->subsampling_x, cm->seq_params->subsampling_y,
-          cm->seq_params->use_highbitdepth, AOM_BORDER_IN_PIXELS,
+          cm->seq_params->use_highbitdepth, border,
           cm->features.byte_alignment, NULL, NULL, NULL, cpi->alloc_pyramid, 0))
     aom_internal_error(cm->error, AOM_CODEC_MEM_ERROR,
                        "Failed to reallocate scaled source buffer");
@@ -458,11 +460,6 @@ static inline YV12_BUFFER_CONFIG *realloc_and_scale_source(AV1_COMP *cpi,
 // Deallocate allocated thread_data.
 static inline void free_thread_data(AV1_PRIMARY *ppi) {
   PrimaryMultiThreadInfo *const p_mt_info = &ppi->p_mt_info;
-  const int num_tf_workers =
-      AOMMIN(p_mt_info->num_mod_workers[MOD_TF], p_mt_info->num_workers);
-  const int num_tpl_workers =
-      AOMMIN(p_mt_info->num_mod_workers[MOD_TPL], p_mt_info->num_workers);
-  const int is_highbitdepth = ppi->seq_params.use_highbitdepth;
   const int num_planes = ppi->seq_params.monochrome ? 1 : MAX_MB_PLANE;
   for (int t = 1; t < p_mt_info->num_workers; ++t) {
     EncWorkerData *const thread_data = &p_mt_info->tile_thr_data[t];
@@ -496,18 +493,6 @@ static inline void free_thread_data(AV1_PRIMARY *ppi) {
     td->firstpass_ctx = NULL;
     av1_free_shared_coeff_buffer(&td->shared_coeff_buf);
     av1_free_sms_tree(td);
-    // This call ensures that the buffers allocated by tf_alloc_and_reset_data()
-    // in prepare_tf_workers() for MT encode are freed in case an error is
-    // encountered during temporal filtering (due to early termination
-    // tf_dealloc_thread_data() in av1_tf_do_filtering_mt() would not be
-    // invoked).
-    if (t < num_tf_workers) tf_dealloc_data(&td->tf_data, is_highbitdepth);
-    // This call ensures that tpl_tmp_buffers for MT encode are freed in case of
-    // an error during tpl.
-    if (t < num_tpl_workers) tpl_dealloc_temp_buffers(&td->tpl_tmp_buffers);
-    // This call ensures that the buffers in gm_data for MT encode are freed in
-    // case of an error during gm.
-    gm_dealloc_data(&td->gm_data);
     av1_dealloc_mb_data(&td->mb, num_planes);
     aom_free(td->mb.sb_stats_cache);
     td->mb.sb_stats_cache = NULL;
@@ -481,6 +481,7 @@ static void process_tpl_stats_frame(AV1_COMP *cpi) {
   TplParams *const tpl_data = &cpi->ppi->tpl_data;
   TplDepFrame *tpl_frame = &tpl_data->tpl_frame[tpl_idx];
   TplDepStats *tpl_stats = tpl_frame->tpl_stats_ptr;
+  TplDepFlow *tpl_flow = tpl_frame->tpl_flow_ptr;
 
   if (tpl_frame->is_valid) {
     int tpl_stride = tpl_frame->stride;
@@ -495,12 +496,14 @@ static void process_tpl_stats_frame(AV1_COMP *cpi) {
 
     for (int row = 0; row < cm->mi_params.mi_rows; row += row_step) {
       for (int col = 0; col < mi_cols_sr; col += col_step_sr) {
-        TplDepStats *this_stats = &tpl_stats[av1_tpl_ptr_pos(
-            row, col, tpl_stride, tpl_data->tpl_stats_block_mis_log2)];
+        const int pos = av1_tpl_ptr_pos(row, col, tpl_stride,
+                                        tpl_data->tpl_stats_block_mis_log2);
+        TplDepStats *this_stats = &tpl_stats[pos];
+        TplDepFlow *this_flow = &tpl_flow[pos];
         double cbcmp = (double)(this_stats->srcrf_dist);
         int64_t mc_dep_delta =
-            RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                   this_stats->mc_dep_dist);
+            RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                   this_flow->mc_dep_dist);
         double dist_scaled = (double)(this_stats->recrf_dist << RDDIV_BITS);
         intra_cost_base += log(dist_scaled) * cbcmp;
         mc_dep_cost_base += log(dist_scaled + mc_dep_delta) * cbcmp;
@@ -689,12 +692,121 @@ void av1_update_film_grain_parameters(struct AV1_COMP *cpi,
 }
 #endif  // !CONFIG_REALTIME_ONLY
 
+static void remove_scaled_ref_entry(ScaledRefCache *cache, int idx) {
+  --cache->entries[idx].buf->ref_count;
+  cache->entries[idx] = cache->entries[--cache->num_entries];
+}
+
+void av1_invalidate_scaled_refs(AV1_COMP *cpi, const RefCntBuffer *src) {
+  ScaledRefCache *const cache = &cpi->scaled_ref_cache;
+  for (int i = cache->num_entries - 1; i >= 0; --i) {
+    if (cache->entries[i].src == src) remove_scaled_ref_entry(cache, i);
+  }
+}
+
+void av1_free_scaled_ref_cache(AV1_COMP *cpi) {
+  ScaledRefCache *const cache = &cpi->scaled_ref_cache;
+  while (cache->num_entries > 0)
+    remove_scaled_ref_entry(cache, cache->num_entries - 1);
+}
+
+// The copies are shared by the frames encoded one after the other with the
+// same buffer pool. Frames encoded in parallel do not use the cache, as they
+// may write to a reference frame the cache holds a copy of. With spatial
+// layers, each scaled reference is used by one frame only, so the copies
+// would only hold memory.
+static int use_scaled_ref_cache(const AV1_COMP *cpi) {
+  return cpi->oxcf.scaled_ref_cache && cpi->ppi->num_fp_contexts == 1 &&
+         !cpi->ppi->use_svc;
+}
+
+static RefCntBuffer *find_scaled_ref(ScaledRefCache *cache,
+                                     const RefCntBuffer *src, int width,
+                                     int height, int border,
+                                     InterpFilter filter, int phase,
+                                     int use_optimized_scaler) {
+  for (int i = 0; i < cache->num_entries; ++i) {
+    ScaledRefCacheEntry *const entry = &cache->entries[i];
+    const YV12_BUFFER_CONFIG *const buf = &entry->buf->buf;
+    if (entry->src == src && buf->y_crop_width == width &&
+        buf->y_crop_height == height && buf->border == border &&
+        entry->filter == filter && entry->phase == phase &&
+        entry->use_optimized_scaler == use_optimized_scaler) {
+      entry->last_used = cache->counter;
+      return entry->buf;
+    }
+  }
+  return NULL;
+}
+
+// Evicts the least recently used copy not used by the current frame. Returns
+// 0 if all the copies are in use.
+static int evict_scaled_ref(ScaledRefCache *cache) {
+  int lru = -1;
+  for (int i = 0; i < cache->num_entries; ++i) {
+    const ScaledRefCacheEntry *const entry = &cache->entries[i];
+    if (entry->buf->ref_count > 1) continue;
+    if (lru < 0 || entry->last_used < cache->entries[lru].last_used) lru = i;
+  }
+  if (lru < 0) return 0;
+  remove_scaled_ref_entry(cache, lru);
+  return 1;
+}
+
+// Evicts copies until a new scaled reference frame can be taken from the
+// buffer pool without holding more than INTER_REFS_PER_FRAME scaled frames,
+// counting the ones held by scaled_ref_buf outside of the cache.
+static void make_room_for_scaled_ref(AV1_COMP *cpi) {
+  const AV1_COMMON *const cm = &cpi->common;
+  ScaledRefCache *const cache = &cpi->scaled_ref_cache;
+  int num_held;
+  do {
+    num_held = cache->num_entries;
+    for (int i = 0; i < INTER_REFS_PER_FRAME; ++i) {
+      const RefCntBuffer *const buf = cpi->scaled_ref_buf[i];
+      if (buf == NULL || buf == get_ref_frame_buf(cm, LAST_FRAME + i)) continue;
+      int cached = 0;
+      for (int j = 0; j < cache->num_entries && !cached; ++j)
+        cached = cache->entries[j].buf == buf;
+      int seen = 0;
+      for (int j = 0; j < i && !seen; ++j) seen = cpi->scaled_ref_buf[j] == buf;
+      num_held += !cached && !seen;
+    }
+  } while (num_held >= INTER_REFS_PER_FRAME && evict_scaled_ref(cache));
+}
+
+static void add_scaled_ref(ScaledRefCache *cache, const RefCntBuffer *src,
+                           RefCntBuffer *buf, InterpFilter filter, int phase,
+                           int use_optimized_scaler) {
+  if (cache->num_entries == INTER_REFS_PER_FRAME && !evict_scaled_ref(cache))
+    return;
+  ScaledRefCacheEntry *const entry = &cache->entries[cache->num_entries++];
+  entry->src = src;
+  entry->buf = buf;
+  entry->filter = filter;
+  entry->phase = phase;
+  entry->use_optimized_scaler = use_optimized_scaler;
+  entry->last_used = cache->counter;
+  ++buf->ref_count;
+}
+
 void av1_scale_references(AV1_COMP *cpi, const InterpFilter filter,
                           const int phase, const int use_optimized_scaler) {
   AV1_COMMON *cm = &cpi->common;
   const int num_planes = av1_num_planes(cm);
+  const int scaled_border = av1_use_reduced_frame_border(&cpi->oxcf)
+                                ? cpi->oxcf.border_in_pixels
+                                : AOM_BORDER_IN_PIXELS;
+  ScaledRefCache *const cache = &cpi->scaled_ref_cache;
+  const int use_cache = use_scaled_ref_cache(cpi);
   MV_REFERENCE_FRAME ref_frame;
 
+  if (use_cache) {
+    ++cache->counter;
+  } else {
+    av1_free_scaled_ref_cache(cpi);
+  }
+
   for (ref_frame = LAST_FRAME; ref_frame <= ALTREF_FRAME; ++ref_frame) {
     // Need to convert from AOM_REFFRAME to index into ref_mask (subtract 1).
     if (cpi->ref_frame_flags & av1_ref_frame_flag_list[ref_frame]) {
@@ -707,6 +819,22 @@ void av1_scale_references(AV1_COMP *cpi, const InterpFilter filter,
         continue;
       }
 
+      // Replace the reference buffer with a copy having a thicker border,
+      // if the reference buffer is higher resolution than the current
+      // frame, and the border is thin. This is needed by the motion
+      // compensation from the reference even when its scaling is skipped
+      // below.
+      if ((ref->y_crop_width > cm->width || ref->y_crop_height > cm->height) &&
+          ref->border < AOM_BORDER_IN_PIXELS) {
+        RefCntBuffer *ref_fb = get_ref_frame_buf(cm, ref_frame);
+        if (aom_yv12_realloc_with_new_border(
+                &ref_fb->buf, AOM_BORDER_IN_PIXELS, cm->features.byte_alignment,
+                cpi->alloc_pyramid, num_planes) != 0) {
+          aom_internal_error(cm->error, AOM_CODEC_MEM_ERROR,
+                             "Failed to allocate frame buffer");
+        }
+      }
+
       // For RTC-SVC: if force_zero_mode_spatial_ref is enabled, check if the
       // motion search can be skipped for the references: last, golden, altref.
       // If so, we can skip scaling that reference.
@@ -727,23 +855,20 @@ void av1_scale_references(AV1_COMP *cpi, const InterpFilter filter,
       }
 
       if (ref->y_crop_width != cm->width || ref->y_crop_height != cm->height) {
-        // Replace the reference buffer with a copy having a thicker border,
-        // if the reference buffer is higher resolution than the current
-        // frame, and the border is thin.
-        if ((ref->y_crop_width > cm->width ||
-             ref->y_crop_height > cm->height) &&
-            ref->border < AOM_BORDER_IN_PIXELS) {
-          RefCntBuffer *ref_fb = get_ref_frame_buf(cm, ref_frame);
-          if (aom_yv12_realloc_with_new_border(
-                  &ref_fb->buf, AOM_BORDER_IN_PIXELS,
-                  cm->features.byte_alignment, cpi->alloc_pyramid,
-                  num_planes) != 0) {
-            aom_internal_error(cm->error, AOM_CODEC_MEM_ERROR,
-                               "Failed to allocate frame buffer");
-          }
-        }
         int force_scaling = 0;
+        const RefCntBuffer *const ref_buf = get_ref_frame_buf(cm, ref_frame);
         RefCntBuffer *new_fb = cpi->scaled_ref_buf[ref_frame - 1];
+        if (new_fb == NULL && use_cache) {
+          new_fb = find_scaled_ref(cache, ref_buf, cm->width, cm->height,
+                                   scaled_border, filter, phase,
+                                   use_optimized_scaler);
+          if (new_fb != NULL) {
+            ++new_fb->ref_count;
+            cpi->scaled_ref_buf[ref_frame - 1] = new_fb;
+            continue;
+          }
+          make_room_for_scaled_ref(cpi);
+        }
         if (new_fb == NULL) {
           const int new_fb_idx = get_free_fb(cm);
           if (new_fb_idx == INVALID_IDX) {
@@ -756,10 +881,18 @@ void av1_scale_references(AV1_COMP *cpi, const InterpFilter filter,
 
         if (force_scaling || new_fb->buf.y_crop_width != cm->width ||
             new_fb->buf.y_crop_height != cm->height) {
+          // A copy kept from a previous frame is scaled again in place, so it
+          // no longer matches its cache entry.
+          if (!force_scaling) {
+            for (int i = cache->num_entries - 1; i >= 0; --i) {
+              if (cache->entries[i].buf == new_fb)
+                remove_scaled_ref_entry(cache, i);
+            }
+          }
           if (aom_realloc_frame_buffer(
                   &new_fb->buf, cm->width, cm->height,
                   cm->seq_params->subsampling_x, cm->seq_params->subsampling_y,
-                  cm->seq_params->use_highbitdepth, AOM_BORDER_IN_PIXELS,
+                  cm->seq_params->use_highbitdepth, scaled_border,
                   cm->features.byte_alignment, NULL, NULL, NULL, false, 0)) {
             if (force_scaling) {
               // Release the reference acquired in the get_free_fb() call above.
@@ -802,6 +935,10 @@ void av1_scale_references(AV1_COMP *cpi, const InterpFilter filter,
 #endif
           cpi->scaled_ref_buf[ref_frame - 1] = new_fb;
           alloc_frame_mvs(cm, new_fb);
+          if (use_cache) {
+            add_scaled_ref(cache, ref_buf, new_fb, filter, phase,
+                           use_optimized_scaler);
+          }
         }
       } else {
         RefCntBuffer *buf = get_ref_frame_buf(cm, ref_frame);
@@ -1103,7 +1240,9 @@ void av1_determine_sc_tools_with_encoding(AV1_COMP *cpi, const int q_orig) {
   cpi->source = av1_realloc_and_scale_if_required(
       cm, cpi->unscaled_source, &cpi->scaled_source, cm->features.interp_filter,
       0, false, false, cpi->oxcf.border_in_pixels, cpi->alloc_pyramid);
-  if (cpi->unscaled_last_source != NULL) {
+  if (!av1_need_scaled_last_source(cpi)) {
+    cpi->last_source = NULL;
+  } else if (cpi->unscaled_last_source != NULL) {
     cpi->last_source = av1_realloc_and_scale_if_required(
         cm, cpi->unscaled_last_source, &cpi->scaled_last_source,
         cm->features.interp_filter, 0, false, false, cpi->oxcf.border_in_pixels,
@@ -1014,6 +1014,13 @@ void av1_update_film_grain_parameters(struct AV1_COMP *cpi,
 void av1_scale_references(AV1_COMP *cpi, const InterpFilter filter,
                           const int phase, const int use_optimized_scaler);
 
+// Drops the scaled copies of src kept by av1_scale_references(). Must be called
+// when the content of src changes.
+void av1_invalidate_scaled_refs(AV1_COMP *cpi, const RefCntBuffer *src);
+
+// Releases all the scaled copies kept by av1_scale_references().
+void av1_free_scaled_ref_cache(AV1_COMP *cpi);
+
 void av1_setup_frame(AV1_COMP *cpi);
 
 BLOCK_SIZE av1_select_sb_size(const AV1EncoderConfig *const oxcf, int width,
@@ -1064,6 +1071,31 @@ static inline bool av1_is_resize_needed(const AV1EncoderConfig *oxcf) {
   return resize_cfg->resize_mode || superres_cfg->superres_mode;
 }
 
+// Returns whether realtime encoding keeps the border of unscaled encoding for
+// all frame buffers, including scaled sources and references. Only the
+// references that are larger than the current frame get a thicker border, in
+// av1_scale_references().
+static inline bool av1_use_reduced_frame_border(const AV1EncoderConfig *oxcf) {
+  return oxcf->mode == REALTIME && oxcf->reduced_frame_border;
+}
+
+// Returns whether the frame buffers need the AOM_BORDER_IN_PIXELS border of
+// resized encoding.
+static inline bool av1_is_resize_border_needed(const AV1EncoderConfig *oxcf) {
+  return av1_is_resize_needed(oxcf) && !av1_use_reduced_frame_border(oxcf);
+}
+
+// Returns whether a scaled copy of the last source frame is made for frames
+// coded at a scaled resolution. Outside realtime mode, cpi->last_source is
+// only read by tune=vmaf, so the copy is skipped at any low memory level.
+static inline bool av1_need_scaled_last_source(const AV1_COMP *cpi) {
+  const aom_tune_metric tuning = cpi->oxcf.tune_cfg.tuning;
+  return cpi->oxcf.low_mem_level == LOW_MEM_OFF ||
+         cpi->oxcf.mode == REALTIME ||
+         (tuning >= AOM_TUNE_VMAF_WITH_PREPROCESSING &&
+          tuning <= AOM_TUNE_VMAF_NEG_MAX_GAIN);
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <stdbool.h>
 
+#include "aom_dsp/psnr.h"
 #include "aom_util/aom_pthread.h"
 
 #include "av1/common/warped_motion.h"
@@ -24,6 +25,7 @@
 #include "av1/encoder/encodeframe_utils.h"
 #include "av1/encoder/encoder.h"
 #include "av1/encoder/encoder_alloc.h"
+#include "av1/encoder/encoder_utils.h"
 #include "av1/encoder/ethread.h"
 #if !CONFIG_REALTIME_ONLY
 #include "av1/encoder/firstpass.h"
@@ -963,6 +965,7 @@ void av1_init_tile_thread_data(AV1_PRIMARY *ppi, int is_first_pass) {
   int num_workers = p_mt_info->num_workers;
   int num_enc_workers = av1_get_num_mod_workers_for_alloc(p_mt_info, MOD_ENC);
   assert(num_enc_workers <= num_workers);
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_THREAD_DATA);
   for (int i = num_workers - 1; i >= 0; i--) {
     EncWorkerData *const thread_data = &p_mt_info->tile_thr_data[i];
 
@@ -1072,6 +1075,8 @@ void av1_init_tile_thread_data(AV1_PRIMARY *ppi, int is_first_pass) {
     }
   }
 
+  aom_mem_pop_tag(prev_tag);
+
   // Record the number of workers in encode stage multi-threading for which
   // allocation is done.
   p_mt_info->prev_num_enc_workers = num_enc_workers;
@@ -1175,6 +1180,10 @@ int av1_check_fpmt_config(AV1_PRIMARY *const ppi,
         ppi->parallel_cpi[i]->common.cur_frame = NULL;
       }
     }
+    // The frames encoded in parallel did not keep the scaled reference frames
+    // of the other contexts up to date.
+    for (int i = 0; i < ppi->num_fp_contexts; i++)
+      av1_free_scaled_ref_cache(ppi->parallel_cpi[i]);
 
     int cur_gf_index = ppi->cpi->gf_frame_index;
     int reset_size = AOMMAX(0, ppi->gf_group.size - cur_gf_index);
@@ -1682,7 +1691,7 @@ static inline void fp_prepare_enc_workers(AV1_COMP *cpi, AVxWorkerHook hook,
       // Before encoding a frame, copy the thread data from cpi.
       thread_data->td->mb = cpi->td.mb;
     }
-    av1_alloc_src_diff_buf(cm, &thread_data->td->mb);
+    av1_alloc_src_diff_buf(cm, &thread_data->td->mb, &cpi->frame_arena);
   }
 }
 #endif
@@ -1747,10 +1756,12 @@ void av1_encode_tiles_mt(AV1_COMP *cpi) {
   av1_init_tile_data(cpi);
   num_workers = AOMMIN(num_workers, mt_info->num_workers);
 
+  const aom_arena_mark_t arena_mark = aom_arena_get_mark(&cpi->frame_arena);
   prepare_enc_workers(cpi, enc_worker_hook, num_workers);
   launch_workers(&cpi->mt_info, num_workers);
   sync_enc_workers(&cpi->mt_info, cm, num_workers);
   accumulate_counters_enc_workers(cpi, num_workers);
+  aom_arena_release(&cpi->frame_arena, arena_mark);
 }
 
 // Accumulate frame counts. FRAME_COUNTS consist solely of 'unsigned int'
@@ -1977,11 +1988,13 @@ void av1_encode_tiles_row_mt(AV1_COMP *cpi) {
 
   assign_tile_to_thread(thread_id_to_tile_id, tile_cols * tile_rows,
                         num_workers);
+  const aom_arena_mark_t arena_mark = aom_arena_get_mark(&cpi->frame_arena);
   prepare_enc_workers(cpi, enc_row_mt_worker_hook, num_workers);
   launch_workers(&cpi->mt_info, num_workers);
   sync_enc_workers(&cpi->mt_info, cm, num_workers);
   if (cm->delta_q_info.delta_lf_present_flag) update_delta_lf_for_row_mt(cpi);
   accumulate_counters_enc_workers(cpi, num_workers);
+  aom_arena_release(&cpi->frame_arena, arena_mark);
 }
 
 #if !CONFIG_REALTIME_ONLY
@@ -2292,7 +2305,8 @@ static inline void prepare_tpl_workers(AV1_COMP *cpi, AVxWorkerHook hook,
       // called from tpl, hence set the buffers to defaults.
       av1_init_obmc_buffer(&thread_data->td->mb.obmc_buffer);
       if (!tpl_alloc_temp_buffers(&thread_data->td->tpl_tmp_buffers,
-                                  cpi->ppi->tpl_data.tpl_bsize_1d)) {
+                                  cpi->ppi->tpl_data.tpl_bsize_1d,
+                                  &cpi->frame_arena)) {
         aom_internal_error(cpi->common.error, AOM_CODEC_MEM_ERROR,
                            "Error allocating tpl data");
       }
@@ -2342,6 +2356,7 @@ void av1_mc_flow_dispenser_mt(AV1_COMP *cpi) {
   memset(tpl_sync->num_finished_cols, -1,
          sizeof(*tpl_sync->num_finished_cols) * mb_rows);
 
+  const aom_arena_mark_t arena_mark = aom_arena_get_mark(&cpi->frame_arena);
   prepare_tpl_workers(cpi, tpl_worker_hook, num_workers);
   launch_workers(&cpi->mt_info, num_workers);
   sync_enc_workers(&cpi->mt_info, cm, num_workers);
@@ -2353,6 +2368,7 @@ void av1_mc_flow_dispenser_mt(AV1_COMP *cpi) {
     ThreadData *td = thread_data->td;
     if (td != &cpi->td) tpl_dealloc_temp_buffers(&td->tpl_tmp_buffers);
   }
+  aom_arena_release(&cpi->frame_arena, arena_mark);
 }
 
 // Deallocate memory for temporal filter multi-thread synchronization.
@@ -2470,7 +2486,8 @@ static void prepare_tf_workers(AV1_COMP *cpi, AVxWorkerHook hook,
       // called from tf, hence set the buffers to defaults.
       av1_init_obmc_buffer(&thread_data->td->mb.obmc_buffer);
       if (!tf_alloc_and_reset_data(&thread_data->td->tf_data,
-                                   cpi->tf_ctx.num_pels, is_highbitdepth)) {
+                                   cpi->tf_ctx.num_pels, is_highbitdepth,
+                                   &cpi->frame_arena)) {
         aom_internal_error(cpi->common.error, AOM_CODEC_MEM_ERROR,
                            "Error allocating temporal filter data");
       }
@@ -2479,13 +2496,12 @@ static void prepare_tf_workers(AV1_COMP *cpi, AVxWorkerHook hook,
 }
 
 // Deallocate thread specific data for temporal filter.
-static void tf_dealloc_thread_data(AV1_COMP *cpi, int num_workers,
-                                   int is_highbitdepth) {
+static void tf_dealloc_thread_data(AV1_COMP *cpi, int num_workers) {
   MultiThreadInfo *mt_info = &cpi->mt_info;
   for (int i = num_workers - 1; i >= 0; i--) {
     EncWorkerData *thread_data = &mt_info->tile_thr_data[i];
     ThreadData *td = thread_data->td;
-    if (td != &cpi->td) tf_dealloc_data(&td->tf_data, is_highbitdepth);
+    if (td != &cpi->td) tf_dealloc_data(&td->tf_data);
   }
 }
 
@@ -2517,7 +2533,7 @@ void av1_tf_do_filtering_mt(AV1_COMP *cpi) {
   launch_workers(mt_info, num_workers);
   sync_enc_workers(mt_info, cm, num_workers);
   tf_accumulate_frame_diff(cpi, num_workers);
-  tf_dealloc_thread_data(cpi, num_workers, is_highbitdepth);
+  tf_dealloc_thread_data(cpi, num_workers);
 }
 
 // Checks if a job is available in the current direction. If a job is available,
@@ -3218,6 +3234,10 @@ void av1_write_tile_obu_mt(
     uint8_t **tile_data_start, const int num_workers) {
   MultiThreadInfo *const mt_info = &cpi->mt_info;
 
+  // Unlike the other multithreaded stages, bitstream packing takes no scratch
+  // memory from cpi->frame_arena: the per tile parameters below live on the
+  // stack, the tile order in pack_bs_sync is sized for MAX_TILES and the
+  // workers write straight into dst.
   PackBSParams pack_bs_params[MAX_TILES];
   uint32_t tile_size[MAX_TILES] = { 0 };
 
@@ -3371,6 +3391,108 @@ void av1_cdef_mse_calc_frame_mt(AV1_COMP *cpi) {
   sync_enc_workers(mt_info, &cpi->common, num_workers);
 }
 
+// Height in rows of the bands the planes are split into for frame PSNR.
+#define PSNR_MT_BAND_HEIGHT 64
+
+// Shared state of a frame PSNR computation. Each worker takes the bands
+// thread_id, thread_id + num_workers, ... in plane order and sums their SSE
+// into its own slot, so no locking is needed.
+typedef struct {
+  const YV12_BUFFER_CONFIG *a;
+  const YV12_BUFFER_CONFIG *b;
+  unsigned int input_shift;
+  int need_hbd;
+  int num_bands[3];
+  int num_workers;
+  uint64_t sse[MAX_NUM_THREADS][3];
+  uint64_t sse_hbd[MAX_NUM_THREADS][3];
+} PsnrMtCtx;
+
+static int psnr_worker_hook(void *arg1, void *arg2) {
+  const EncWorkerData *const thread_data = (const EncWorkerData *)arg1;
+  PsnrMtCtx *const ctx = (PsnrMtCtx *)arg2;
+  const int thread_id = thread_data->thread_id;
+  int band = 0;
+  for (int plane = 0; plane < 3; ++plane) {
+    const int height = ctx->a->crop_heights[plane > 0];
+    for (int i = 0; i < ctx->num_bands[plane]; ++i, ++band) {
+      if (band % ctx->num_workers != thread_id) continue;
+      const int vstart = i * PSNR_MT_BAND_HEIGHT;
+      const int rows = AOMMIN(PSNR_MT_BAND_HEIGHT, height - vstart);
+      ctx->sse[thread_id][plane] += aom_get_sse_plane_rows(
+          ctx->a, ctx->b, plane, vstart, rows, ctx->input_shift);
+      if (ctx->need_hbd) {
+        ctx->sse_hbd[thread_id][plane] +=
+            aom_get_sse_plane_rows(ctx->a, ctx->b, plane, vstart, rows, 0);
+      }
+    }
+  }
+  return 1;
+}
+
+void av1_calc_psnr_mt(AV1_COMP *cpi, const YV12_BUFFER_CONFIG *a,
+                      const YV12_BUFFER_CONFIG *b, PSNR_STATS *psnr) {
+  MultiThreadInfo *const mt_info = &cpi->mt_info;
+#if CONFIG_AV1_HIGHBITDEPTH
+  const uint32_t in_bit_depth = cpi->oxcf.input_cfg.input_bit_depth;
+  const uint32_t bit_depth = cpi->td.mb.e_mbd.bd;
+#else
+  const uint32_t in_bit_depth = 8;
+  const uint32_t bit_depth = 8;
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+  PsnrMtCtx ctx;
+  int num_bands = 0;
+  for (int plane = 0; plane < 3; ++plane) {
+    ctx.num_bands[plane] =
+        get_num_blocks(a->crop_heights[plane > 0], PSNR_MT_BAND_HEIGHT);
+    num_bands += ctx.num_bands[plane];
+  }
+  const int num_workers = AOMMIN(mt_info->num_workers, num_bands);
+
+  if (num_workers <= 1) {
+#if CONFIG_AV1_HIGHBITDEPTH
+    aom_calc_highbd_psnr(a, b, psnr, bit_depth, in_bit_depth);
+#else
+    aom_calc_psnr(a, b, psnr);
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+    return;
+  }
+
+  ctx.a = a;
+  ctx.b = b;
+  ctx.input_shift =
+      (a->flags & YV12_FLAG_HIGHBITDEPTH) ? bit_depth - in_bit_depth : 0;
+  ctx.need_hbd = aom_psnr_needs_hbd_stats(a, bit_depth, in_bit_depth);
+  ctx.num_workers = num_workers;
+  memset(ctx.sse, 0, sizeof(ctx.sse[0]) * num_workers);
+  memset(ctx.sse_hbd, 0, sizeof(ctx.sse_hbd[0]) * num_workers);
+
+  for (int i = num_workers - 1; i >= 0; i--) {
+    AVxWorker *const worker = &mt_info->workers[i];
+    EncWorkerData *const thread_data = &mt_info->tile_thr_data[i];
+
+    thread_data->cpi = cpi;
+    thread_data->thread_id = i;
+    // sync_enc_workers() expects the main worker to use the main thread data.
+    if (i == 0) thread_data->td = &cpi->td;
+    worker->hook = psnr_worker_hook;
+    worker->data1 = thread_data;
+    worker->data2 = &ctx;
+  }
+  launch_workers(mt_info, num_workers);
+  sync_enc_workers(mt_info, &cpi->common, num_workers);
+
+  uint64_t sse[3] = { 0, 0, 0 };
+  uint64_t sse_hbd[3] = { 0, 0, 0 };
+  for (int i = 0; i < num_workers; ++i) {
+    for (int plane = 0; plane < 3; ++plane) {
+      sse[plane] += ctx.sse[i][plane];
+      sse_hbd[plane] += ctx.sse_hbd[i][plane];
+    }
+  }
+  aom_calc_psnr_from_sse(a, sse, sse_hbd, bit_depth, in_bit_depth, psnr);
+}
+
 // Computes num_workers for temporal filter multi-threading.
 static inline int compute_num_tf_workers(const AV1_COMP *cpi) {
   // For single-pass encode, using no. of workers as per tf block size was not
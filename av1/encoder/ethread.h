@@ -12,6 +12,8 @@
 #ifndef AOM_AV1_ENCODER_ETHREAD_H_
 #define AOM_AV1_ENCODER_ETHREAD_H_
 
+#include "aom_dsp/psnr.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -111,6 +113,13 @@ void av1_cdef_mse_calc_frame_mt(AV1_COMP *cpi);
 
 void av1_cdef_mt_dealloc(AV1CdefSync *cdef_sync);
 
+// Computes the PSNR of frame b against source frame a, splitting the planes
+// into row bands spread over the encoder's worker threads. The result is the
+// same as aom_calc_psnr() / aom_calc_highbd_psnr(), which are used directly
+// when there is only one worker.
+void av1_calc_psnr_mt(AV1_COMP *cpi, const YV12_BUFFER_CONFIG *a,
+                      const YV12_BUFFER_CONFIG *b, PSNR_STATS *psnr);
+
 void av1_write_tile_obu_mt(
     AV1_COMP *const cpi, uint8_t *const dst, uint32_t *total_size,
     struct aom_write_bit_buffer *saved_wb, uint8_t obu_extn_header,
@@ -29,11 +29,14 @@ static void copy_and_extend_plane(const uint8_t *src, int src_pitch,
   const uint8_t *src_ptr2 = src + (w - 1) * chroma_step;
   uint8_t *dst_ptr1 = dst - extend_left;
   uint8_t *dst_ptr2 = dst + w;
+  // When extending in place only the borders are written.
+  const int copy = src != dst;
+  assert(copy || (src_pitch == dst_pitch && chroma_step == 1));
 
   for (i = 0; i < h; i++) {
     memset(dst_ptr1, src_ptr1[0], extend_left);
     if (chroma_step == 1) {
-      memcpy(dst_ptr1 + extend_left, src_ptr1, w);
+      if (copy) memcpy(dst_ptr1 + extend_left, src_ptr1, w);
     } else {
       for (int j = 0; j < w; j++) {
         dst_ptr1[extend_left + j] = src_ptr1[chroma_step * j];
@@ -79,10 +82,14 @@ static void highbd_copy_and_extend_plane(const uint8_t *src8, int src_pitch,
   const uint16_t *src_ptr2 = src + w - 1;
   uint16_t *dst_ptr1 = dst - extend_left;
   uint16_t *dst_ptr2 = dst + w;
+  const int copy = src != dst;
+  assert(copy || src_pitch == dst_pitch);
 
   for (i = 0; i < h; i++) {
     aom_memset16(dst_ptr1, src_ptr1[0], extend_left);
-    memcpy(dst_ptr1 + extend_left, src_ptr1, w * sizeof(src_ptr1[0]));
+    if (copy) {
+      memcpy(dst_ptr1 + extend_left, src_ptr1, w * sizeof(src_ptr1[0]));
+    }
     aom_memset16(dst_ptr2, src_ptr2[0], extend_right);
     src_ptr1 += src_pitch;
     src_ptr2 += src_pitch;
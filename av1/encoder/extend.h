@@ -19,6 +19,9 @@
 extern "C" {
 #endif
 
+// Copies the visible area of src into dst and extends it into the border of
+// dst. src and dst may be the same frame, in which case only the border is
+// written.
 void av1_copy_and_extend_frame(const YV12_BUFFER_CONFIG *src,
                                YV12_BUFFER_CONFIG *dst);
 
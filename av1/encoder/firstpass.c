@@ -1105,7 +1105,7 @@ static void first_pass_tiles(AV1_COMP *cpi, const BLOCK_SIZE fp_block_size) {
   const int tile_cols = cm->tiles.cols;
   const int tile_rows = cm->tiles.rows;
 
-  av1_alloc_src_diff_buf(cm, &cpi->td.mb);
+  av1_alloc_src_diff_buf(cm, &cpi->td.mb, &cpi->frame_arena);
   for (int tile_row = 0; tile_row < tile_rows; ++tile_row) {
     for (int tile_col = 0; tile_col < tile_cols; ++tile_col) {
       TileDataEnc *const tile_data =
@@ -1396,6 +1396,7 @@ void av1_first_pass(AV1_COMP *cpi, const int64_t ts_duration) {
   enc_row_mt->sync_read_ptr = av1_row_mt_sync_read_dummy;
   enc_row_mt->sync_write_ptr = av1_row_mt_sync_write_dummy;
 
+  const aom_arena_mark_t arena_mark = aom_arena_get_mark(&cpi->frame_arena);
   if (mt_info->num_workers > 1) {
     enc_row_mt->sync_read_ptr = av1_row_mt_sync_read;
     enc_row_mt->sync_write_ptr = av1_row_mt_sync_write;
@@ -1411,6 +1412,7 @@ void av1_first_pass(AV1_COMP *cpi, const int64_t ts_duration) {
       raw_motion_error_stdev(raw_motion_err_list, total_raw_motion_err_count);
   av1_free_firstpass_data(&cpi->firstpass_data);
   av1_dealloc_src_diff_buf(&cpi->td.mb, av1_num_planes(cm));
+  aom_arena_release(&cpi->frame_arena, arena_mark);
 
   // Clamp the image start to rows/2. This number of rows is discarded top
   // and bottom as dead data so rows / 2 means the frame is blank.
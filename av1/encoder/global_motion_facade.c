@@ -421,12 +421,15 @@ void av1_compute_global_motion_facade(AV1_COMP *cpi) {
     setup_global_motion_info_params(cpi);
     // Terminate early if the total number of reference frames is zero.
     if (cpi->gm_info.num_ref_frames[0] || cpi->gm_info.num_ref_frames[1]) {
+      const aom_arena_mark_t arena_mark =
+          aom_arena_get_mark(&cpi->frame_arena);
       gm_alloc_data(cpi, &cpi->td.gm_data);
       if (cpi->mt_info.num_workers > 1)
         av1_global_motion_estimation_mt(cpi);
       else
         global_motion_estimation(cpi);
       gm_dealloc_data(&cpi->td.gm_data);
+      aom_arena_release(&cpi->frame_arena, arena_mark);
       gm_info->search_done = 1;
     }
   }
@@ -18,29 +18,33 @@ extern "C" {
 struct yv12_buffer_config;
 struct AV1_COMP;
 
-// Allocates memory for members of GlobalMotionData.
+// Allocates memory for members of GlobalMotionData from the frame arena.
 static inline void gm_alloc_data(AV1_COMP *cpi, GlobalMotionData *gm_data) {
   AV1_COMMON *cm = &cpi->common;
   GlobalMotionInfo *gm_info = &cpi->gm_info;
+  aom_arena_t *const arena = &cpi->frame_arena;
 
-  CHECK_MEM_ERROR(cm, gm_data->segment_map,
-                  aom_malloc(sizeof(*gm_data->segment_map) *
+  CHECK_MEM_ERROR(
+      cm, gm_data->segment_map,
+      aom_arena_memalign(arena, 16,
+                         sizeof(*gm_data->segment_map) *
                              gm_info->segment_map_w * gm_info->segment_map_h));
 
   av1_zero_array(gm_data->motion_models, RANSAC_NUM_MOTIONS);
   for (int m = 0; m < RANSAC_NUM_MOTIONS; m++) {
-    CHECK_MEM_ERROR(cm, gm_data->motion_models[m].inliers,
-                    aom_malloc(sizeof(*gm_data->motion_models[m].inliers) * 2 *
-                               MAX_CORNERS));
+    CHECK_MEM_ERROR(
+        cm, gm_data->motion_models[m].inliers,
+        aom_arena_memalign(
+            arena, 16,
+            sizeof(*gm_data->motion_models[m].inliers) * 2 * MAX_CORNERS));
   }
 }
 
-// Deallocates the memory allocated for members of GlobalMotionData.
+// Clears the members of GlobalMotionData. The memory is owned by the frame
+// arena and is returned to it by aom_arena_release().
 static inline void gm_dealloc_data(GlobalMotionData *gm_data) {
-  aom_free(gm_data->segment_map);
   gm_data->segment_map = NULL;
   for (int m = 0; m < RANSAC_NUM_MOTIONS; m++) {
-    aom_free(gm_data->motion_models[m].inliers);
     gm_data->motion_models[m].inliers = NULL;
   }
 }
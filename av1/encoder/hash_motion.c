@@ -126,8 +126,10 @@ bool av1_hash_table_create(hash_table *p_hash_table) {
     clear_all(p_hash_table);
     return true;
   }
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_HASH_TABLES);
   p_hash_table->p_lookup_table =
       (Vector **)aom_calloc(kMaxAddr, sizeof(p_hash_table->p_lookup_table[0]));
+  aom_mem_pop_tag(prev_tag);
   if (!p_hash_table->p_lookup_table) return false;
   return true;
 }
@@ -313,7 +315,9 @@ bool av1_add_to_hash_map_by_row_with_precal_data(hash_table *p_hash_table,
   add_value <<= kSrcBits;
   const int crc_mask = (1 << kSrcBits) - 1;
 
-  for (int x_pos = 0; x_pos < x_end; x_pos++) {
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_HASH_TABLES);
+  bool ok = true;
+  for (int x_pos = 0; x_pos < x_end && ok; x_pos++) {
     for (int y_pos = 0; y_pos < y_end; y_pos++) {
       const int pos = y_pos * pic_width + x_pos;
       // valid data
@@ -327,12 +331,14 @@ bool av1_add_to_hash_map_by_row_with_precal_data(hash_table *p_hash_table,
 
         if (!hash_table_add_to_table(p_hash_table, hash_value1,
                                      &curr_block_hash)) {
-          return false;
+          ok = false;
+          break;
         }
       }
     }
   }
-  return true;
+  aom_mem_pop_tag(prev_tag);
+  return ok;
 }
 
 int av1_hash_is_horizontal_perfect(const YV12_BUFFER_CONFIG *picture,
@@ -9,6 +9,8 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include "config/av1_rtcd.h"
+
 #include "av1/common/av1_common_int.h"
 #include "av1/common/cfl.h"
 #include "av1/common/reconintra.h"
@@ -317,8 +319,10 @@ static int rd_pick_filter_intra_sby(const AV1_COMP *const cpi, MACROBLOCK *x,
   }
 }
 
-void av1_count_colors(const uint8_t *src, int stride, int rows, int cols,
-                      int *val_count, int *num_colors) {
+// Counts the occurrences of each pixel value of src in val_count and sets
+// *num_colors to the number of distinct values. Used by palette mode.
+void av1_count_colors_c(const uint8_t *src, int stride, int rows, int cols,
+                        int *val_count, int *num_colors) {
   const int max_pix_val = 1 << 8;
   memset(val_count, 0, max_pix_val * sizeof(val_count[0]));
   for (int r = 0; r < rows; ++r) {
@@ -335,10 +339,13 @@ void av1_count_colors(const uint8_t *src, int stride, int rows, int cols,
   *num_colors = n;
 }
 
-void av1_count_colors_highbd(const uint8_t *src8, int stride, int rows,
-                             int cols, int bit_depth, int *val_count,
-                             int *bin_val_count, int *num_color_bins,
-                             int *num_colors) {
+// See av1_count_colors_c(). The pixels are also counted after conversion to
+// 8 bits in bin_val_count, which gives *num_color_bins. If val_count is NULL,
+// only the 8-bit bins are counted and *num_colors is left unset.
+void av1_count_colors_highbd_c(const uint8_t *src8, int stride, int rows,
+                               int cols, int bit_depth, int *val_count,
+                               int *bin_val_count, int *num_color_bins,
+                               int *num_colors) {
   assert(bit_depth <= 12);
   const int max_bin_val = 1 << 8;
   const int max_pix_val = 1 << bit_depth;
@@ -70,34 +70,45 @@ void RENAME_C(av1_calc_indices)(const int16_t *data, const int16_t *centroids,
   }
 }
 
-static void RENAME(calc_centroids)(const int16_t *data, int16_t *centroids,
-                                   const uint8_t *indices, int n, int k) {
-  int i, j;
-  int count[PALETTE_MAX_SIZE] = { 0 };
-  int centroids_sum[AV1_K_MEANS_DIM * PALETTE_MAX_SIZE];
-  unsigned int rand_state = (unsigned int)data[0];
-  assert(n <= 32768);
-  memset(centroids_sum, 0, sizeof(centroids_sum[0]) * k * AV1_K_MEANS_DIM);
-
-  for (i = 0; i < n; ++i) {
+// Assigns the data to the nearest centroids like av1_calc_indices(), and also
+// accumulates the per-cluster sums and counts that the next centroids are
+// computed from. SIMD versions do both in one pass over the data.
+void RENAME_C(av1_calc_indices_sums)(const int16_t *data,
+                                     const int16_t *centroids,
+                                     uint8_t *indices, int64_t *dist,
+                                     int *sums, int *counts, int n, int k) {
+#if AV1_K_MEANS_DIM == 1
+  av1_calc_indices_dim1(data, centroids, indices, dist, n, k);
+#else
+  av1_calc_indices_dim2(data, centroids, indices, dist, n, k);
+#endif
+  memset(counts, 0, sizeof(counts[0]) * k);
+  memset(sums, 0, sizeof(sums[0]) * k * AV1_K_MEANS_DIM);
+  for (int i = 0; i < n; ++i) {
     const int index = indices[i];
     assert(index < k);
-    ++count[index];
-    for (j = 0; j < AV1_K_MEANS_DIM; ++j) {
-      centroids_sum[index * AV1_K_MEANS_DIM + j] +=
-          data[i * AV1_K_MEANS_DIM + j];
+    ++counts[index];
+    for (int j = 0; j < AV1_K_MEANS_DIM; ++j) {
+      sums[index * AV1_K_MEANS_DIM + j] += data[i * AV1_K_MEANS_DIM + j];
     }
   }
+}
 
-  for (i = 0; i < k; ++i) {
-    if (count[i] == 0) {
+static void RENAME(calc_centroids)(const int16_t *data, int16_t *centroids,
+                                   const int *sums, const int *counts, int n,
+                                   int k) {
+  unsigned int rand_state = (unsigned int)data[0];
+  assert(n <= 32768);
+
+  for (int i = 0; i < k; ++i) {
+    if (counts[i] == 0) {
       memcpy(centroids + i * AV1_K_MEANS_DIM,
              data + (lcg_rand16(&rand_state) % n) * AV1_K_MEANS_DIM,
              sizeof(centroids[0]) * AV1_K_MEANS_DIM);
     } else {
-      for (j = 0; j < AV1_K_MEANS_DIM; ++j) {
+      for (int j = 0; j < AV1_K_MEANS_DIM; ++j) {
         centroids[i * AV1_K_MEANS_DIM + j] =
-            DIVIDE_AND_ROUND(centroids_sum[i * AV1_K_MEANS_DIM + j], count[i]);
+            DIVIDE_AND_ROUND(sums[i * AV1_K_MEANS_DIM + j], counts[i]);
       }
     }
   }
@@ -106,6 +117,8 @@ static void RENAME(calc_centroids)(const int16_t *data, int16_t *centroids,
 void RENAME(av1_k_means)(const int16_t *data, int16_t *centroids,
                          uint8_t *indices, int n, int k, int max_itr) {
   int16_t centroids_tmp[AV1_K_MEANS_DIM * PALETTE_MAX_SIZE];
+  int sums[AV1_K_MEANS_DIM * PALETTE_MAX_SIZE];
+  int counts[PALETTE_MAX_SIZE];
   uint8_t indices_tmp[MAX_PALETTE_BLOCK_WIDTH * MAX_PALETTE_BLOCK_HEIGHT];
   int16_t *meta_centroids[2] = { centroids, centroids_tmp };
   uint8_t *meta_indices[2] = { indices, indices_tmp };
@@ -114,29 +127,23 @@ void RENAME(av1_k_means)(const int16_t *data, int16_t *centroids,
 
   assert(n <= MAX_PALETTE_BLOCK_WIDTH * MAX_PALETTE_BLOCK_HEIGHT);
 
-#if AV1_K_MEANS_DIM == 1
-  av1_calc_indices_dim1(data, centroids, indices, &this_dist, n, k);
-#else
-  av1_calc_indices_dim2(data, centroids, indices, &this_dist, n, k);
-#endif
+  // sums and counts always describe the latest indices, from which the next
+  // centroids are computed.
+  RENAME(av1_calc_indices_sums)(data, centroids, indices, &this_dist, sums,
+                                counts, n, k);
 
   for (i = 0; i < max_itr; ++i) {
     const int64_t prev_dist = this_dist;
     prev_l = l;
     l = (l == 1) ? 0 : 1;
 
-    RENAME(calc_centroids)(data, meta_centroids[l], meta_indices[prev_l], n, k);
+    RENAME(calc_centroids)(data, meta_centroids[l], sums, counts, n, k);
     if (!memcmp(meta_centroids[l], meta_centroids[prev_l],
                 sizeof(centroids[0]) * k * AV1_K_MEANS_DIM)) {
       break;
     }
-#if AV1_K_MEANS_DIM == 1
-    av1_calc_indices_dim1(data, meta_centroids[l], meta_indices[l], &this_dist,
-                          n, k);
-#else
-    av1_calc_indices_dim2(data, meta_centroids[l], meta_indices[l], &this_dist,
-                          n, k);
-#endif
+    RENAME(av1_calc_indices_sums)(data, meta_centroids[l], meta_indices[l],
+                                  &this_dist, sums, counts, n, k);
 
     if (this_dist > prev_dist) {
       best_l = prev_l;
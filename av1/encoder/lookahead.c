@@ -13,6 +13,8 @@
 
 #include "config/aom_config.h"
 
+#include "aom_dsp/flow_estimation/corner_detect.h"
+#include "aom_dsp/pyramid.h"
 #include "aom_scale/yv12config.h"
 #include "av1/common/common.h"
 #include "av1/encoder/encoder.h"
@@ -30,24 +32,77 @@ static struct lookahead_entry *pop(struct lookahead_ctx *ctx, int *idx) {
   return buf;
 }
 
+/* Hand a referenced input image back to the application */
+static void release_input(struct lookahead_ctx *ctx,
+                          struct lookahead_entry *buf) {
+  if (!buf->input_ref) return;
+  ctx->zero_copy.release_cb(ctx->zero_copy.cb_priv, buf->input_priv);
+  buf->input_ref = false;
+  buf->input_priv = NULL;
+}
+
 void av1_lookahead_destroy(struct lookahead_ctx *ctx) {
   if (ctx) {
     if (ctx->buf) {
       int i;
 
-      for (i = 0; i < ctx->max_sz; i++) aom_free_frame_buffer(&ctx->buf[i].img);
+      for (i = 0; i < ctx->max_sz; i++) {
+        release_input(ctx, &ctx->buf[i]);
+        aom_free_frame_buffer(&ctx->buf[i].img);
+      }
       free(ctx->buf);
     }
     free(ctx);
   }
 }
 
+/* Set up the layout of a buffer without allocating its pixels, which come
+ * from the referenced input images or a later allocation. */
+static int init_ref_buffer(YV12_BUFFER_CONFIG *img, int width, int height,
+                           int ss_x, int ss_y, int use_highbitdepth,
+                           int border, bool alloc_pyramid) {
+  const int aligned_width = (width + 7) & ~7;
+  const int aligned_height = (height + 7) & ~7;
+  img->y_crop_width = width;
+  img->y_crop_height = height;
+  img->y_width = aligned_width;
+  img->y_height = aligned_height;
+  img->y_stride = aom_calc_y_stride(aligned_width, border);
+  img->uv_crop_width = (width + ss_x) >> ss_x;
+  img->uv_crop_height = (height + ss_y) >> ss_y;
+  img->uv_width = aligned_width >> ss_x;
+  img->uv_height = aligned_height >> ss_y;
+  img->uv_stride = img->y_stride >> ss_x;
+  img->border = border;
+  img->subsampling_x = ss_x;
+  img->subsampling_y = ss_y;
+  img->flags = use_highbitdepth ? YV12_FLAG_HIGHBITDEPTH : 0;
+#if !CONFIG_REALTIME_ONLY
+  if (alloc_pyramid) {
+    img->y_pyramid = aom_alloc_pyramid(width, height, use_highbitdepth);
+    if (!img->y_pyramid) return 1;
+    img->corners = av1_alloc_corner_list();
+    if (!img->corners) return 1;
+  }
+#else
+  (void)alloc_pyramid;
+#endif  // !CONFIG_REALTIME_ONLY
+  return 0;
+}
+
 struct lookahead_ctx *av1_lookahead_init(
     unsigned int width, unsigned int height, unsigned int subsampling_x,
     unsigned int subsampling_y, int use_highbitdepth, unsigned int depth,
     const int border_in_pixels, int byte_alignment, int num_lap_buffers,
-    bool is_all_intra, bool alloc_pyramid) {
+    bool is_all_intra, bool alloc_pyramid,
+    const aom_zero_copy_input_t *zero_copy) {
   int lag_in_frames = AOMMAX(1, depth);
+  // Input images are only referenced if their padding covers the border. The
+  // buffers then use the same border, so that all the queued frames have the
+  // same stride whether they were referenced or copied.
+  const bool ref_inputs = zero_copy && zero_copy->release_cb &&
+                          (int)zero_copy->border >= border_in_pixels;
+  const int border = ref_inputs ? (int)zero_copy->border : border_in_pixels;
 
   // For all-intra frame encoding, previous source frames are not required.
   // Hence max_pre_frames is set to 0 in this case. As previous source frames
@@ -70,6 +125,10 @@ struct lookahead_ctx *av1_lookahead_init(
     ctx->max_sz = depth;
     ctx->push_frame_count = 0;
     ctx->max_pre_frames = max_pre_frames;
+    ctx->border = border;
+    ctx->byte_alignment = byte_alignment;
+    if (zero_copy) ctx->zero_copy = *zero_copy;
+    ctx->ref_inputs = ref_inputs;
     ctx->read_ctxs[ENCODE_STAGE].pop_sz = ctx->max_sz - ctx->max_pre_frames;
     ctx->read_ctxs[ENCODE_STAGE].valid = 1;
     if (num_lap_buffers) {
@@ -79,10 +138,16 @@ struct lookahead_ctx *av1_lookahead_init(
     ctx->buf = calloc(depth, sizeof(*ctx->buf));
     if (!ctx->buf) goto fail;
     for (i = 0; i < depth; i++) {
-      if (aom_realloc_frame_buffer(
-              &ctx->buf[i].img, width, height, subsampling_x, subsampling_y,
-              use_highbitdepth, border_in_pixels, byte_alignment, NULL, NULL,
-              NULL, alloc_pyramid, 0)) {
+      if (ref_inputs) {
+        if (init_ref_buffer(&ctx->buf[i].img, width, height, subsampling_x,
+                            subsampling_y, use_highbitdepth, border,
+                            alloc_pyramid)) {
+          goto fail;
+        }
+      } else if (aom_realloc_frame_buffer(
+                     &ctx->buf[i].img, width, height, subsampling_x,
+                     subsampling_y, use_highbitdepth, border, byte_alignment,
+                     NULL, NULL, NULL, alloc_pyramid, 0)) {
         goto fail;
       }
     }
@@ -98,9 +163,29 @@ int av1_lookahead_full(const struct lookahead_ctx *ctx) {
   return ctx->read_ctxs[ENCODE_STAGE].sz >= ctx->read_ctxs[ENCODE_STAGE].pop_sz;
 }
 
+/* Whether src can be referenced by a buffer of the queue. Its strides must
+ * match those of the buffers and its padding must hold the border written by
+ * av1_copy_and_extend_frame(), which extends the right and bottom edges to at
+ * least a multiple of 64. */
+static bool can_ref_input(const struct lookahead_ctx *ctx,
+                          const YV12_BUFFER_CONFIG *src, int use_highbitdepth) {
+  if (!ctx->ref_inputs || src->monochrome || !src->u_buffer || !src->v_buffer)
+    return false;
+  if (!(src->flags & YV12_FLAG_HIGHBITDEPTH) != !use_highbitdepth) return false;
+  const int aligned_width = (src->y_crop_width + 7) & ~7;
+  const int aligned_height = (src->y_crop_height + 7) & ~7;
+  const int y_stride = aom_calc_y_stride(aligned_width, ctx->border);
+  return src->y_stride == y_stride &&
+         src->uv_stride == y_stride >> src->subsampling_x &&
+         src->y_width <= aligned_width && src->y_height <= aligned_height &&
+         ALIGN_POWER_OF_TWO(src->y_width, 6) <= src->y_width + ctx->border &&
+         ALIGN_POWER_OF_TWO(src->y_height, 6) <= src->y_height + ctx->border;
+}
+
 int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
                        int64_t ts_start, int64_t ts_end, int use_highbitdepth,
-                       bool alloc_pyramid, aom_enc_frame_flags_t flags) {
+                       bool alloc_pyramid, aom_enc_frame_flags_t flags,
+                       void *input_priv) {
   int width = src->y_crop_width;
   int height = src->y_crop_height;
   int uv_width = src->uv_crop_width;
@@ -119,6 +204,10 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
   }
 
   struct lookahead_entry *buf = pop(ctx, &ctx->write_idx);
+  // The frame previously held by this entry is no longer needed.
+  const bool was_ref = buf->input_ref;
+  release_input(ctx, buf);
+  const bool ref_input = can_ref_input(ctx, src, use_highbitdepth);
 
   new_dimensions = width != buf->img.y_crop_width ||
                    height != buf->img.y_crop_height ||
@@ -129,7 +218,47 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
       uv_width > buf->img.uv_crop_width || uv_height > buf->img.uv_crop_height;
   assert(!larger_dimensions || new_dimensions);
 
-  if (larger_dimensions) {
+  if (ref_input) {
+#if !CONFIG_REALTIME_ONLY
+    if (larger_dimensions && buf->img.y_pyramid) {
+      aom_free_pyramid(buf->img.y_pyramid);
+      buf->img.y_pyramid = aom_alloc_pyramid(width, height, use_highbitdepth);
+      if (!buf->img.y_pyramid) return 1;
+    }
+#endif  // !CONFIG_REALTIME_ONLY
+    // Point the buffer at the input image and extend its border in place. The
+    // own allocation of the buffer, if any, is kept for later copies.
+    YV12_BUFFER_CONFIG *const img = &buf->img;
+    img->y_width = src->y_width;
+    img->y_height = src->y_height;
+    img->uv_width = src->uv_width;
+    img->uv_height = src->uv_height;
+    img->y_crop_width = src->y_crop_width;
+    img->y_crop_height = src->y_crop_height;
+    img->uv_crop_width = src->uv_crop_width;
+    img->uv_crop_height = src->uv_crop_height;
+    img->y_stride = src->y_stride;
+    img->uv_stride = src->uv_stride;
+    img->y_buffer = src->y_buffer;
+    img->u_buffer = src->u_buffer;
+    img->v_buffer = src->v_buffer;
+    img->border = ctx->border;
+    img->subsampling_x = src->subsampling_x;
+    img->subsampling_y = src->subsampling_y;
+    img->flags = src->flags;
+    av1_copy_and_extend_frame(img, img);
+    buf->input_ref = true;
+    buf->input_priv = input_priv;
+  } else if (ctx->ref_inputs &&
+             (was_ref || !buf->img.buffer_alloc || larger_dimensions)) {
+    // Allocate the buffer, or restore its planes after it referenced an input
+    // image, with the border that keeps the stride of the referenced frames.
+    if (aom_realloc_frame_buffer(&buf->img, width, height, subsampling_x,
+                                 subsampling_y, use_highbitdepth, ctx->border,
+                                 ctx->byte_alignment, NULL, NULL, NULL,
+                                 alloc_pyramid, 0))
+      return 1;
+  } else if (larger_dimensions) {
     YV12_BUFFER_CONFIG new_img;
     memset(&new_img, 0, sizeof(new_img));
     if (aom_alloc_frame_buffer(&new_img, width, height, subsampling_x,
@@ -150,7 +279,11 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
     buf->img.subsampling_x = src->subsampling_x;
     buf->img.subsampling_y = src->subsampling_y;
   }
-  av1_copy_and_extend_frame(src, &buf->img);
+  if (!ref_input) {
+    av1_copy_and_extend_frame(src, &buf->img);
+    if (ctx->zero_copy.release_cb)
+      ctx->zero_copy.release_cb(ctx->zero_copy.cb_priv, input_priv);
+  }
 
   buf->ts_start = ts_start;
   buf->ts_end = ts_end;
@@ -223,3 +356,12 @@ int av1_lookahead_pop_sz(struct lookahead_ctx *ctx, COMPRESSOR_STAGE stage) {
   assert(read_ctx->valid == 1);
   return read_ctx->pop_sz;
 }
+
+void av1_lookahead_release_pyramids(struct lookahead_ctx *ctx) {
+#if !CONFIG_REALTIME_ONLY
+  for (int i = 0; i < ctx->max_sz; i++)
+    aom_release_pyramid(ctx->buf[i].img.y_pyramid);
+#else
+  (void)ctx;
+#endif  // !CONFIG_REALTIME_ONLY
+}
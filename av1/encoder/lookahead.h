@@ -19,6 +19,7 @@
 
 #include "aom_scale/yv12config.h"
 #include "aom/aom_integer.h"
+#include "aom/aomcx.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -36,6 +37,10 @@ struct lookahead_entry {
   int64_t ts_end;
   int display_idx;
   aom_enc_frame_flags_t flags;
+  // Set when img references the planes of an application owned input image,
+  // which is released with input_priv when the entry is reused.
+  bool input_ref;
+  void *input_priv;
 };
 
 // The max of past frames we want to keep in the queue.
@@ -58,19 +63,27 @@ struct lookahead_ctx {
   int push_frame_count; /* Number of frames that have been pushed in the queue*/
   uint8_t
       max_pre_frames; /* Maximum number of past frames allowed in the queue */
+  int border;         /* Border of the buffers, in pixels */
+  int byte_alignment; /* Alignment of the buffers */
+  aom_zero_copy_input_t zero_copy; /* Release callback for input images */
+  bool ref_inputs; /* Whether input images may be referenced */
 };
 /*!\endcond */
 
 /**\brief Initializes the lookahead stage
  *
  * The lookahead stage is a queue of frame buffers on which some analysis
- * may be done when buffers are enqueued.
+ * may be done when buffers are enqueued. If \p zero_copy is not NULL and has a
+ * release callback, the queue references the input images that allow it
+ * instead of copying them, and its buffers are only allocated when an image
+ * has to be copied.
  */
 struct lookahead_ctx *av1_lookahead_init(
     unsigned int width, unsigned int height, unsigned int subsampling_x,
     unsigned int subsampling_y, int use_highbitdepth, unsigned int depth,
     const int border_in_pixels, int byte_alignment, int num_lap_buffers,
-    bool is_all_intra, bool alloc_pyramid);
+    bool is_all_intra, bool alloc_pyramid,
+    const aom_zero_copy_input_t *zero_copy);
 
 /**\brief Destroys the lookahead stage
  */
@@ -83,7 +96,9 @@ int av1_lookahead_full(const struct lookahead_ctx *ctx);
 /**\brief Enqueue a source buffer
  *
  * This function will copy the source image into a new framebuffer with
- * the expected stride/border.
+ * the expected stride/border. In zero copy mode, the source image is
+ * referenced instead if its padding is large enough, and its border is
+ * extended in place. Otherwise it is copied and released right away.
  *
  * \param[in] ctx               Pointer to the lookahead context
  * \param[in] src               Pointer to the image to enqueue
@@ -93,10 +108,16 @@ int av1_lookahead_full(const struct lookahead_ctx *ctx);
  * \param[in] alloc_pyramid     Whether to allocate a downsampling pyramid
  *                              for each frame buffer
  * \param[in] flags             Flags set on this frame
+ * \param[in] input_priv        Private data of the source image passed to the
+ *                              release callback in zero copy mode
+ *
+ * \return 0 on success. The source image is not released if it could not be
+ * queued, which leaves push_frame_count unchanged.
  */
 int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
                        int64_t ts_start, int64_t ts_end, int use_highbitdepth,
-                       bool alloc_pyramid, aom_enc_frame_flags_t flags);
+                       bool alloc_pyramid, aom_enc_frame_flags_t flags,
+                       void *input_priv);
 
 /**\brief Get the next source buffer to encode
  *
@@ -131,6 +152,12 @@ unsigned int av1_lookahead_depth(struct lookahead_ctx *ctx,
  */
 int av1_lookahead_pop_sz(struct lookahead_ctx *ctx, COMPRESSOR_STAGE stage);
 
+/**\brief Free the downsampling pyramids of all the buffers
+ *
+ * The pyramids are allocated again when they are next computed.
+ */
+void av1_lookahead_release_pyramids(struct lookahead_ctx *ctx);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -119,6 +119,7 @@ static void collect_tpl_stats_sb(const AV1_COMP *const cpi,
   TplParams *const tpl_data = &cpi->ppi->tpl_data;
   TplDepFrame *tpl_frame = &tpl_data->tpl_frame[cpi->gf_frame_index];
   TplDepStats *tpl_stats = tpl_frame->tpl_stats_ptr;
+  TplDepFlow *tpl_flow = tpl_frame->tpl_flow_ptr;
   // If tpl stats is not established, early return
   if (!tpl_data->ready || gf_group->max_layer_depth_allowed == 0) {
     if (features != NULL) features->sb_features.tpl_features.available = 0;
@@ -169,12 +170,12 @@ static void collect_tpl_stats_sb(const AV1_COMP *const cpi,
     count = 0;
     for (int row = 0; row < mi_height; row += step) {
       for (int col = 0; col < mi_width; col += step) {
-        TplDepStats *this_stats =
-            &tpl_stats[av1_tpl_ptr_pos(mi_row + row, mi_col + col, tpl_stride,
-                                       tpl_data->tpl_stats_block_mis_log2)];
+        TplDepFlow *this_flow =
+            &tpl_flow[av1_tpl_ptr_pos(mi_row + row, mi_col + col, tpl_stride,
+                                      tpl_data->tpl_stats_block_mis_log2)];
         const int64_t mc_dep_delta =
-            RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                   this_stats->mc_dep_dist);
+            RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                   this_flow->mc_dep_dist);
         fprintf(pfile, "%.0f", (double)mc_dep_delta);
         if (count < num_blocks - 1) fprintf(pfile, ",");
         ++count;
@@ -188,12 +189,14 @@ static void collect_tpl_stats_sb(const AV1_COMP *const cpi,
     int count = 0;
     for (int row = 0; row < mi_height; row += step) {
       for (int col = 0; col < mi_width; col += step) {
-        TplDepStats *this_stats =
-            &tpl_stats[av1_tpl_ptr_pos(mi_row + row, mi_col + col, tpl_stride,
-                                       tpl_data->tpl_stats_block_mis_log2)];
+        const int pos =
+            av1_tpl_ptr_pos(mi_row + row, mi_col + col, tpl_stride,
+                            tpl_data->tpl_stats_block_mis_log2);
+        TplDepStats *this_stats = &tpl_stats[pos];
+        TplDepFlow *this_flow = &tpl_flow[pos];
         const int64_t mc_dep_delta =
-            RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                   this_stats->mc_dep_dist);
+            RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                   this_flow->mc_dep_dist);
         features->sb_features.tpl_features.intra_cost[count] =
             this_stats->intra_cost;
         features->sb_features.tpl_features.inter_cost[count] =
@@ -5037,6 +5040,7 @@ static void prepare_tpl_stats_block(const AV1_COMP *const cpi,
   TplParams *const tpl_data = &cpi->ppi->tpl_data;
   TplDepFrame *tpl_frame = &tpl_data->tpl_frame[cpi->gf_frame_index];
   TplDepStats *tpl_stats = tpl_frame->tpl_stats_ptr;
+  TplDepFlow *tpl_flow = tpl_frame->tpl_flow_ptr;
   // If tpl stats is not established, early return
   if (!tpl_data->ready || gf_group->max_layer_depth_allowed == 0) {
     return;
@@ -5054,14 +5058,15 @@ static void prepare_tpl_stats_block(const AV1_COMP *const cpi,
   int64_t sum_mc_dep_cost = 0;
   for (int row = 0; row < mi_height; row += step) {
     for (int col = 0; col < mi_width; col += step) {
-      TplDepStats *this_stats =
-          &tpl_stats[av1_tpl_ptr_pos(mi_row + row, mi_col + col, tpl_stride,
-                                     tpl_data->tpl_stats_block_mis_log2)];
+      const int pos = av1_tpl_ptr_pos(mi_row + row, mi_col + col, tpl_stride,
+                                      tpl_data->tpl_stats_block_mis_log2);
+      TplDepStats *this_stats = &tpl_stats[pos];
+      TplDepFlow *this_flow = &tpl_flow[pos];
       sum_intra_cost += this_stats->intra_cost;
       sum_inter_cost += this_stats->inter_cost;
       const int64_t mc_dep_delta =
-          RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                 this_stats->mc_dep_dist);
+          RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                 this_flow->mc_dep_dist);
       sum_mc_dep_cost += mc_dep_delta;
     }
   }
@@ -835,9 +835,12 @@ void av1_initialize_rd_consts(AV1_COMP *cpi) {
   // Frame level dv cost update
   if (av1_need_dv_costs(cpi)) {
     if (cpi->td.dv_costs_alloc == NULL) {
+      const aom_mem_tag_t prev_tag =
+          aom_mem_push_tag(AOM_MEM_TAG_ENTROPY_TABLES);
       CHECK_MEM_ERROR(
           cm, cpi->td.dv_costs_alloc,
           (IntraBCMVCosts *)aom_malloc(sizeof(*cpi->td.dv_costs_alloc)));
+      aom_mem_pop_tag(prev_tag);
       cpi->td.mb.dv_costs = cpi->td.dv_costs_alloc;
     }
     av1_fill_dv_costs(&cm->fc->ndvc, x->dv_costs);
@@ -1434,7 +1434,9 @@ void av1_temporal_filter(AV1_COMP *cpi, const int filter_frame_lookahead_idx,
 
   // Allocate and reset temporal filter buffers.
   const int is_highbitdepth = tf_ctx->is_highbitdepth;
-  if (!tf_alloc_and_reset_data(tf_data, tf_ctx->num_pels, is_highbitdepth)) {
+  const aom_arena_mark_t arena_mark = aom_arena_get_mark(&cpi->frame_arena);
+  if (!tf_alloc_and_reset_data(tf_data, tf_ctx->num_pels, is_highbitdepth,
+                               &cpi->frame_arena)) {
     aom_internal_error(cpi->common.error, AOM_CODEC_MEM_ERROR,
                        "Error allocating temporal filter data");
   }
@@ -1449,7 +1451,8 @@ void av1_temporal_filter(AV1_COMP *cpi, const int filter_frame_lookahead_idx,
     *frame_diff = tf_data->diff;
   }
   // Deallocate temporal filter buffers.
-  tf_dealloc_data(tf_data, is_highbitdepth);
+  tf_dealloc_data(tf_data);
+  aom_arena_release(&cpi->frame_arena, arena_mark);
 }
 
 int av1_is_temporal_filter_on(const AV1EncoderConfig *oxcf) {
@@ -1463,17 +1466,17 @@ bool av1_tf_info_alloc(TEMPORAL_FILTER_INFO *tf_info, const AV1_COMP *cpi) {
 
   const AV1_COMMON *cm = &cpi->common;
   const SequenceHeader *const seq_params = cm->seq_params;
-  for (int i = 0; i < TF_INFO_BUF_COUNT; ++i) {
-    if (aom_realloc_frame_buffer(
-            &tf_info->tf_buf[i], oxcf->frm_dim_cfg.width,
-            oxcf->frm_dim_cfg.height, seq_params->subsampling_x,
-            seq_params->subsampling_y, seq_params->use_highbitdepth,
-            cpi->oxcf.border_in_pixels, cm->features.byte_alignment, NULL, NULL,
-            NULL, cpi->alloc_pyramid, 0)) {
-      return false;
-    }
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_TF);
+  bool ok = true;
+  for (int i = 0; i < TF_INFO_BUF_COUNT && ok; ++i) {
+    ok = !aom_realloc_frame_buffer(
+        &tf_info->tf_buf[i], oxcf->frm_dim_cfg.width, oxcf->frm_dim_cfg.height,
+        seq_params->subsampling_x, seq_params->subsampling_y,
+        seq_params->use_highbitdepth, cpi->oxcf.border_in_pixels,
+        cm->features.byte_alignment, NULL, NULL, NULL, cpi->alloc_pyramid, 0);
   }
-  return true;
+  aom_mem_pop_tag(prev_tag);
+  return ok;
 }
 
 void av1_tf_info_free(TEMPORAL_FILTER_INFO *tf_info) {
@@ -14,6 +14,7 @@
 
 #include <stdbool.h>
 
+#include "aom_mem/aom_arena.h"
 #include "aom_util/aom_pthread.h"
 
 #ifdef __cplusplus
@@ -351,28 +352,31 @@ int av1_check_show_filtered_frame(const YV12_BUFFER_CONFIG *frame,
                                   aom_bit_depth_t bit_depth);
 
 /*!\cond */
-// Allocates memory for members of TemporalFilterData.
+// Allocates memory for members of TemporalFilterData from the frame arena.
 // Inputs:
 //   tf_data: Pointer to the structure containing temporal filter related data.
 //   num_pels: Number of pixels in the block across all planes.
 //   is_high_bitdepth: Whether the frame is high-bitdepth or not.
+//   arena: Arena the buffers are allocated from.
 // Returns:
 //   True if allocation is successful and false otherwise.
 static inline bool tf_alloc_and_reset_data(TemporalFilterData *tf_data,
-                                           int num_pels, int is_high_bitdepth) {
-  tf_data->tmp_mbmi = (MB_MODE_INFO *)aom_calloc(1, sizeof(*tf_data->tmp_mbmi));
-  tf_data->accum =
-      (uint32_t *)aom_memalign(16, num_pels * sizeof(*tf_data->accum));
-  tf_data->count =
-      (uint16_t *)aom_memalign(16, num_pels * sizeof(*tf_data->count));
+                                           int num_pels, int is_high_bitdepth,
+                                           aom_arena_t *arena) {
+  tf_data->tmp_mbmi =
+      (MB_MODE_INFO *)aom_arena_calloc(arena, 1, sizeof(*tf_data->tmp_mbmi));
+  tf_data->accum = (uint32_t *)aom_arena_memalign(
+      arena, 16, num_pels * sizeof(*tf_data->accum));
+  tf_data->count = (uint16_t *)aom_arena_memalign(
+      arena, 16, num_pels * sizeof(*tf_data->count));
   if (is_high_bitdepth)
     tf_data->pred = CONVERT_TO_BYTEPTR(
-        aom_memalign(32, num_pels * 2 * sizeof(*tf_data->pred)));
+        aom_arena_memalign(arena, 32, num_pels * 2 * sizeof(*tf_data->pred)));
   else
-    tf_data->pred =
-        (uint8_t *)aom_memalign(32, num_pels * sizeof(*tf_data->pred));
-  // In case of an allocation failure, other successfully allocated buffers will
-  // be freed by the tf_dealloc_data() call in encoder_destroy().
+    tf_data->pred = (uint8_t *)aom_arena_memalign(
+        arena, 32, num_pels * sizeof(*tf_data->pred));
+  // In case of an allocation failure, the successfully allocated buffers are
+  // returned to the arena when it is released or reset.
   if (!(tf_data->tmp_mbmi && tf_data->accum && tf_data->count && tf_data->pred))
     return false;
   memset(&tf_data->diff, 0, sizeof(tf_data->diff));
@@ -395,23 +399,16 @@ static inline void tf_setup_macroblockd(MACROBLOCKD *mbd,
   mbd->mi[0]->motion_mode = SIMPLE_TRANSLATION;
 }
 
-// Deallocates the memory allocated for members of TemporalFilterData.
+// Clears the members of TemporalFilterData. The memory itself is owned by the
+// frame arena and is returned to it by aom_arena_release().
 // Inputs:
 //   tf_data: Pointer to the structure containing temporal filter related data.
-//   is_high_bitdepth: Whether the frame is high-bitdepth or not.
 // Returns:
 //   Nothing will be returned.
-static inline void tf_dealloc_data(TemporalFilterData *tf_data,
-                                   int is_high_bitdepth) {
-  if (is_high_bitdepth)
-    tf_data->pred = (uint8_t *)CONVERT_TO_SHORTPTR(tf_data->pred);
-  aom_free(tf_data->tmp_mbmi);
+static inline void tf_dealloc_data(TemporalFilterData *tf_data) {
   tf_data->tmp_mbmi = NULL;
-  aom_free(tf_data->accum);
   tf_data->accum = NULL;
-  aom_free(tf_data->count);
   tf_data->count = NULL;
-  aom_free(tf_data->pred);
   tf_data->pred = NULL;
 }
 
@@ -181,6 +181,7 @@ void av1_setup_tpl_buffers(AV1_PRIMARY *const ppi,
   // allocations are avoided for buffers in tpl_data.
   if (lag_in_frames <= 1) return;
 
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_TPL);
   AOM_CHECK_MEM_ERROR(&ppi->error, tpl_data->txfm_stats_list,
                       aom_calloc(MAX_LENGTH_TPL_FRAME_STATS,
                                  sizeof(*tpl_data->txfm_stats_list)));
@@ -188,9 +189,16 @@ void av1_setup_tpl_buffers(AV1_PRIMARY *const ppi,
   for (int frame = 0; frame < lag_in_frames; ++frame) {
     AOM_CHECK_MEM_ERROR(
         &ppi->error, tpl_data->tpl_stats_pool[frame],
-        aom_calloc(tpl_data->tpl_stats_buffer[frame].width *
-                       tpl_data->tpl_stats_buffer[frame].height,
-                   sizeof(*tpl_data->tpl_stats_buffer[frame].tpl_stats_ptr)));
+        aom_calloc_huge(
+            tpl_data->tpl_stats_buffer[frame].width *
+                tpl_data->tpl_stats_buffer[frame].height,
+            sizeof(*tpl_data->tpl_stats_buffer[frame].tpl_stats_ptr)));
+    AOM_CHECK_MEM_ERROR(
+        &ppi->error, tpl_data->tpl_flow_pool[frame],
+        aom_calloc_huge(
+            tpl_data->tpl_stats_buffer[frame].width *
+                tpl_data->tpl_stats_buffer[frame].height,
+            sizeof(*tpl_data->tpl_stats_buffer[frame].tpl_flow_ptr)));
 
     if (aom_alloc_frame_buffer(
             &tpl_data->tpl_rec_pool[frame], width, height,
@@ -200,6 +208,7 @@ void av1_setup_tpl_buffers(AV1_PRIMARY *const ppi,
       aom_internal_error(&ppi->error, AOM_CODEC_MEM_ERROR,
                          "Failed to allocate frame buffer");
   }
+  aom_mem_pop_tag(prev_tag);
 }
 
 static inline int32_t tpl_get_satd_cost(BitDepthInfo bd_info, int16_t *src_diff,
@@ -665,10 +674,6 @@ static inline void mode_estimation(AV1_COMP *cpi, TplTxfmStats *tpl_txfm_stats,
                         qcoeff, dqcoeff, cm, x, NULL, rec_buffer_pool,
                         rec_stride_pool, tx_size, best_mode, mi_row, mi_col,
                         use_y_only_rate_distortion, 1 /*do_recon*/, NULL);
-
-    tpl_stats->intra_dist = recon_error << TPL_DEP_COST_SCALE_LOG2;
-    tpl_stats->intra_sse = pred_error << TPL_DEP_COST_SCALE_LOG2;
-    tpl_stats->intra_rate = rate_cost;
   }
 
 #if CONFIG_THREE_PASS
@@ -1034,7 +1039,6 @@ static inline void mode_estimation(AV1_COMP *cpi, TplTxfmStats *tpl_txfm_stats,
                       tpl_txfm_stats);
 
   tpl_stats->recrf_dist = recon_error << TPL_DEP_COST_SCALE_LOG2;
-  tpl_stats->recrf_sse = pred_error << TPL_DEP_COST_SCALE_LOG2;
   tpl_stats->recrf_rate = rate_cost;
 
   if (!is_inter_mode(best_mode)) {
@@ -1172,8 +1176,10 @@ static inline void tpl_model_update_b(TplParams *const tpl_data, int mi_row,
   TplDepStats *tpl_ptr = tpl_frame_ptr->tpl_stats_ptr;
   TplDepFrame *tpl_frame = tpl_data->tpl_frame;
   const uint8_t block_mis_log2 = tpl_data->tpl_stats_block_mis_log2;
-  TplDepStats *tpl_stats_ptr = &tpl_ptr[av1_tpl_ptr_pos(
-      mi_row, mi_col, tpl_frame->stride, block_mis_log2)];
+  const int pos =
+      av1_tpl_ptr_pos(mi_row, mi_col, tpl_frame->stride, block_mis_log2);
+  TplDepStats *tpl_stats_ptr = &tpl_ptr[pos];
+  const TplDepFlow *tpl_flow_ptr = &tpl_frame_ptr->tpl_flow_ptr[pos];
 
   int is_compound = tpl_stats_ptr->ref_frame_index[1] >= 0;
 
@@ -1181,7 +1187,7 @@ static inline void tpl_model_update_b(TplParams *const tpl_data, int mi_row,
   const int ref_frame_index = tpl_stats_ptr->ref_frame_index[ref];
   TplDepFrame *ref_tpl_frame =
       &tpl_frame[tpl_frame[frame_idx].ref_map_index[ref_frame_index]];
-  TplDepStats *ref_stats_ptr = ref_tpl_frame->tpl_stats_ptr;
+  TplDepFlow *ref_flow_ptr = ref_tpl_frame->tpl_flow_ptr;
 
   if (tpl_frame[frame_idx].ref_map_index[ref_frame_index] < 0) return;
 
@@ -1210,13 +1216,13 @@ static inline void tpl_model_update_b(TplParams *const tpl_data, int mi_row,
 
   int64_t cur_dep_dist = tpl_stats_ptr->recrf_dist - srcrf_dist;
   int64_t mc_dep_dist =
-      (int64_t)(tpl_stats_ptr->mc_dep_dist *
+      (int64_t)(tpl_flow_ptr->mc_dep_dist *
                 ((double)(tpl_stats_ptr->recrf_dist - srcrf_dist) /
                  tpl_stats_ptr->recrf_dist));
   int64_t delta_rate =
       (tpl_stats_ptr->recrf_rate << TPL_DEP_COST_SCALE_LOG2) - srcrf_rate;
   int64_t mc_dep_rate =
-      av1_delta_rate_cost(tpl_stats_ptr->mc_dep_rate, tpl_stats_ptr->recrf_dist,
+      av1_delta_rate_cost(tpl_flow_ptr->mc_dep_rate, tpl_stats_ptr->recrf_dist,
                           srcrf_dist, pix_num);
 
   for (block = 0; block < 4; ++block) {
@@ -1231,11 +1237,11 @@ static inline void tpl_model_update_b(TplParams *const tpl_data, int mi_row,
       int ref_mi_col = round_floor(grid_pos_col, bw) * mi_width;
       assert((1 << block_mis_log2) == mi_height);
       assert((1 << block_mis_log2) == mi_width);
-      TplDepStats *des_stats = &ref_stats_ptr[av1_tpl_ptr_pos(
+      TplDepFlow *des_flow = &ref_flow_ptr[av1_tpl_ptr_pos(
           ref_mi_row, ref_mi_col, ref_tpl_frame->stride, block_mis_log2)];
-      des_stats->mc_dep_dist +=
+      des_flow->mc_dep_dist +=
           ((cur_dep_dist + mc_dep_dist) * overlap_area) / pix_num;
-      des_stats->mc_dep_rate +=
+      des_flow->mc_dep_rate +=
           ((delta_rate + mc_dep_rate) * overlap_area) / pix_num;
     }
   }
@@ -1251,13 +1257,15 @@ static inline void tpl_model_update(TplParams *const tpl_data, int mi_row,
                      1);
 }
 
-static inline void tpl_model_store(TplDepStats *tpl_stats_ptr, int mi_row,
+static inline void tpl_model_store(TplDepStats *tpl_stats_ptr,
+                                   TplDepFlow *tpl_flow_ptr, int mi_row,
                                    int mi_col, int stride,
                                    const TplDepStats *src_stats,
                                    uint8_t block_mis_log2) {
   int index = av1_tpl_ptr_pos(mi_row, mi_col, stride, block_mis_log2);
   TplDepStats *tpl_ptr = &tpl_stats_ptr[index];
   *tpl_ptr = *src_stats;
+  memset(&tpl_flow_ptr[index], 0, sizeof(tpl_flow_ptr[index]));
   tpl_ptr->intra_cost = AOMMAX(1, tpl_ptr->intra_cost);
   tpl_ptr->inter_cost = AOMMAX(1, tpl_ptr->inter_cost);
   tpl_ptr->srcrf_dist = AOMMAX(1, tpl_ptr->srcrf_dist);
@@ -1473,8 +1481,9 @@ void av1_mc_flow_dispenser_row(AV1_COMP *cpi, TplTxfmStats *tpl_txfm_stats,
                     bsize, tx_size, &tpl_stats);
 
     // Motion flow dependency dispenser.
-    tpl_model_store(tpl_frame->tpl_stats_ptr, mi_row, mi_col, tpl_frame->stride,
-                    &tpl_stats, tpl_data->tpl_stats_block_mis_log2);
+    tpl_model_store(tpl_frame->tpl_stats_ptr, tpl_frame->tpl_flow_ptr, mi_row,
+                    mi_col, tpl_frame->stride, &tpl_stats,
+                    tpl_data->tpl_stats_block_mis_log2);
     (*tpl_row_mt->sync_write_ptr)(&tpl_data->tpl_mt_sync, tplb_row,
                                   tplb_col_in_tile, tplb_cols_in_tile);
   }
@@ -1601,6 +1610,7 @@ static inline void init_gop_frames_for_tpl(
         frame_update_type != INTNL_OVERLAY_UPDATE) {
       tpl_frame->rec_picture = &tpl_data->tpl_rec_pool[process_frame_count];
       tpl_frame->tpl_stats_ptr = tpl_data->tpl_stats_pool[process_frame_count];
+      tpl_frame->tpl_flow_ptr = tpl_data->tpl_flow_pool[process_frame_count];
       ++process_frame_count;
     }
     const int true_disp = (int)(tpl_frame->frame_display_index);
@@ -1663,6 +1673,7 @@ static inline void init_gop_frames_for_tpl(
     tpl_frame->gf_picture = &buf->img;
     tpl_frame->rec_picture = &tpl_data->tpl_rec_pool[process_frame_count];
     tpl_frame->tpl_stats_ptr = tpl_data->tpl_stats_pool[process_frame_count];
+    tpl_frame->tpl_flow_ptr = tpl_data->tpl_flow_pool[process_frame_count];
     // 'cm->current_frame.frame_number' is the display number
     // of the current frame.
     // 'frame_display_index' is frame offset within the gf group.
@@ -1737,6 +1748,9 @@ void av1_init_tpl_stats(TplParams *const tpl_data) {
     memset(tpl_data->tpl_stats_pool[frame_idx], 0,
            tpl_frame->height * tpl_frame->width *
                sizeof(*tpl_frame->tpl_stats_ptr));
+    memset(tpl_data->tpl_flow_pool[frame_idx], 0,
+           tpl_frame->height * tpl_frame->width *
+               sizeof(*tpl_frame->tpl_flow_ptr));
   }
 }
 
@@ -1830,6 +1844,7 @@ static double get_frame_importance(const TplParams *tpl_data,
                                    int gf_frame_index) {
   const TplDepFrame *tpl_frame = &tpl_data->tpl_frame[gf_frame_index];
   const TplDepStats *tpl_stats = tpl_frame->tpl_stats_ptr;
+  const TplDepFlow *tpl_flow = tpl_frame->tpl_flow_ptr;
 
   const int tpl_stride = tpl_frame->stride;
   double intra_cost_base = 0;
@@ -1839,12 +1854,14 @@ static double get_frame_importance(const TplParams *tpl_data,
 
   for (int row = 0; row < tpl_frame->mi_rows; row += step) {
     for (int col = 0; col < tpl_frame->mi_cols; col += step) {
-      const TplDepStats *this_stats = &tpl_stats[av1_tpl_ptr_pos(
-          row, col, tpl_stride, tpl_data->tpl_stats_block_mis_log2)];
+      const int pos = av1_tpl_ptr_pos(row, col, tpl_stride,
+                                      tpl_data->tpl_stats_block_mis_log2);
+      const TplDepStats *this_stats = &tpl_stats[pos];
+      const TplDepFlow *this_flow = &tpl_flow[pos];
       double cbcmp = (double)this_stats->srcrf_dist;
       const int64_t mc_dep_delta =
-          RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                 this_stats->mc_dep_dist);
+          RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                 this_flow->mc_dep_dist);
       double dist_scaled = (double)(this_stats->recrf_dist << RDDIV_BITS);
       dist_scaled = AOMMAX(dist_scaled, 1);
       intra_cost_base += log(dist_scaled) * cbcmp;
@@ -1897,7 +1914,9 @@ int av1_tpl_setup_stats(AV1_COMP *cpi, int gop_eval,
   av1_init_tpl_stats(tpl_data);
 
   TplBuffers *tpl_tmp_buffers = &cpi->td.tpl_tmp_buffers;
-  if (!tpl_alloc_temp_buffers(tpl_tmp_buffers, tpl_data->tpl_bsize_1d)) {
+  const aom_arena_mark_t arena_mark = aom_arena_get_mark(&cpi->frame_arena);
+  if (!tpl_alloc_temp_buffers(tpl_tmp_buffers, tpl_data->tpl_bsize_1d,
+                              &cpi->frame_arena)) {
     aom_internal_error(cpi->common.error, AOM_CODEC_MEM_ERROR,
                        "Error allocating tpl data");
   }
@@ -1985,6 +2004,7 @@ int av1_tpl_setup_stats(AV1_COMP *cpi, int gop_eval,
 #endif
 
   tpl_dealloc_temp_buffers(tpl_tmp_buffers);
+  aom_arena_release(&cpi->frame_arena, arena_mark);
 
   if (!approx_gop_eval) {
     tpl_data->ready = 1;
@@ -2019,6 +2039,7 @@ void av1_tpl_rdmult_setup(AV1_COMP *cpi) {
   if (!tpl_frame->is_valid) return;
 
   const TplDepStats *const tpl_stats = tpl_frame->tpl_stats_ptr;
+  const TplDepFlow *const tpl_flow = tpl_frame->tpl_flow_ptr;
   const int tpl_stride = tpl_frame->stride;
   const int mi_cols_sr = av1_pixels_to_mi(cm->superres_upscaled_width);
 
@@ -2040,11 +2061,13 @@ void av1_tpl_rdmult_setup(AV1_COMP *cpi) {
         for (int mi_col = col * num_mi_w; mi_col < (col + 1) * num_mi_w;
              mi_col += step) {
           if (mi_row >= cm->mi_params.mi_rows || mi_col >= mi_cols_sr) continue;
-          const TplDepStats *this_stats = &tpl_stats[av1_tpl_ptr_pos(
-              mi_row, mi_col, tpl_stride, tpl_data->tpl_stats_block_mis_log2)];
+          const int pos = av1_tpl_ptr_pos(mi_row, mi_col, tpl_stride,
+                                          tpl_data->tpl_stats_block_mis_log2);
+          const TplDepStats *this_stats = &tpl_stats[pos];
+          const TplDepFlow *this_flow = &tpl_flow[pos];
           int64_t mc_dep_delta =
-              RDCOST(tpl_frame->base_rdmult, this_stats->mc_dep_rate,
-                     this_stats->mc_dep_dist);
+              RDCOST(tpl_frame->base_rdmult, this_flow->mc_dep_rate,
+                     this_flow->mc_dep_dist);
           intra_cost += (double)(this_stats->recrf_dist << RDDIV_BITS);
           mc_dep_cost +=
               (double)(this_stats->recrf_dist << RDDIV_BITS) + mc_dep_delta;
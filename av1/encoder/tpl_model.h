@@ -29,6 +29,7 @@ struct TPL_INFO;
 
 #include "config/aom_config.h"
 
+#include "aom_mem/aom_arena.h"
 #include "aom_scale/yv12config.h"
 #include "aom_util/aom_pthread.h"
 
@@ -123,27 +124,31 @@ typedef struct {
 typedef struct TplDepStats {
   int64_t srcrf_sse;
   int64_t srcrf_dist;
-  int64_t recrf_sse;
   int64_t recrf_dist;
-  int64_t intra_sse;
-  int64_t intra_dist;
   int64_t cmp_recrf_dist[2];
-  int64_t mc_dep_rate;
-  int64_t mc_dep_dist;
-  int64_t pred_error[INTER_REFS_PER_FRAME];
   int32_t intra_cost;
   int32_t inter_cost;
   int32_t srcrf_rate;
   int32_t recrf_rate;
-  int32_t intra_rate;
   int32_t cmp_recrf_rate[2];
+  // Inter cost of each reference, clamped to at least 1.
+  int32_t pred_error[INTER_REFS_PER_FRAME];
   int_mv mv[INTER_REFS_PER_FRAME];
   int8_t ref_frame_index[2];
 } TplDepStats;
 
+// The rate and distortion that later frames propagate back to a tpl block.
+// These are the only fields the backward propagation writes, so they are kept
+// in an array of their own next to the TplDepStats of the frame.
+typedef struct TplDepFlow {
+  int64_t mc_dep_rate;
+  int64_t mc_dep_dist;
+} TplDepFlow;
+
 typedef struct TplDepFrame {
   uint8_t is_valid;
   TplDepStats *tpl_stats_ptr;
+  TplDepFlow *tpl_flow_ptr;
   const YV12_BUFFER_CONFIG *gf_picture;
   YV12_BUFFER_CONFIG *rec_picture;
   int ref_map_index[REF_FRAMES];
@@ -192,6 +197,13 @@ typedef struct TplParams {
    */
   TplDepStats *tpl_stats_pool[MAX_LAG_BUFFERS];
 
+  /*!
+   * Buffer to store the propagated tpl dependency.
+   * tpl_flow_pool[i][j] stores the TplDepFlow of the block that
+   * tpl_stats_pool[i][j] describes.
+   */
+  TplDepFlow *tpl_flow_pool[MAX_LAG_BUFFERS];
+
   /*!
    * Pointer to the buffer which stores tpl transform stats per frame.
    * txfm_stats_list[i] stores the TplTxfmStats of the ith frame in a gf group.
@@ -416,35 +428,33 @@ void av1_setup_tpl_buffers(struct AV1_PRIMARY *const ppi,
                            CommonModeInfoParams *const mi_params, int width,
                            int height, int byte_alignment, int lag_in_frames);
 
+// The temporary buffers are owned by the frame arena, and are returned to it
+// by aom_arena_release().
 static inline void tpl_dealloc_temp_buffers(TplBuffers *tpl_tmp_buffers) {
-  aom_free(tpl_tmp_buffers->predictor8);
   tpl_tmp_buffers->predictor8 = NULL;
-  aom_free(tpl_tmp_buffers->src_diff);
   tpl_tmp_buffers->src_diff = NULL;
-  aom_free(tpl_tmp_buffers->coeff);
   tpl_tmp_buffers->coeff = NULL;
-  aom_free(tpl_tmp_buffers->qcoeff);
   tpl_tmp_buffers->qcoeff = NULL;
-  aom_free(tpl_tmp_buffers->dqcoeff);
   tpl_tmp_buffers->dqcoeff = NULL;
 }
 
 static inline bool tpl_alloc_temp_buffers(TplBuffers *tpl_tmp_buffers,
-                                          uint8_t tpl_bsize_1d) {
+                                          uint8_t tpl_bsize_1d,
+                                          aom_arena_t *arena) {
   // Number of pixels in a tpl block
   const int tpl_block_pels = tpl_bsize_1d * tpl_bsize_1d;
 
   // Allocate temporary buffers used in mode estimation.
-  tpl_tmp_buffers->predictor8 = (uint8_t *)aom_memalign(
-      32, tpl_block_pels * 2 * sizeof(*tpl_tmp_buffers->predictor8));
-  tpl_tmp_buffers->src_diff = (int16_t *)aom_memalign(
-      32, tpl_block_pels * sizeof(*tpl_tmp_buffers->src_diff));
-  tpl_tmp_buffers->coeff = (tran_low_t *)aom_memalign(
-      32, tpl_block_pels * sizeof(*tpl_tmp_buffers->coeff));
-  tpl_tmp_buffers->qcoeff = (tran_low_t *)aom_memalign(
-      32, tpl_block_pels * sizeof(*tpl_tmp_buffers->qcoeff));
-  tpl_tmp_buffers->dqcoeff = (tran_low_t *)aom_memalign(
-      32, tpl_block_pels * sizeof(*tpl_tmp_buffers->dqcoeff));
+  tpl_tmp_buffers->predictor8 = (uint8_t *)aom_arena_memalign(
+      arena, 32, tpl_block_pels * 2 * sizeof(*tpl_tmp_buffers->predictor8));
+  tpl_tmp_buffers->src_diff = (int16_t *)aom_arena_memalign(
+      arena, 32, tpl_block_pels * sizeof(*tpl_tmp_buffers->src_diff));
+  tpl_tmp_buffers->coeff = (tran_low_t *)aom_arena_memalign(
+      arena, 32, tpl_block_pels * sizeof(*tpl_tmp_buffers->coeff));
+  tpl_tmp_buffers->qcoeff = (tran_low_t *)aom_arena_memalign(
+      arena, 32, tpl_block_pels * sizeof(*tpl_tmp_buffers->qcoeff));
+  tpl_tmp_buffers->dqcoeff = (tran_low_t *)aom_arena_memalign(
+      arena, 32, tpl_block_pels * sizeof(*tpl_tmp_buffers->dqcoeff));
 
   if (!(tpl_tmp_buffers->predictor8 && tpl_tmp_buffers->src_diff &&
         tpl_tmp_buffers->coeff && tpl_tmp_buffers->qcoeff &&
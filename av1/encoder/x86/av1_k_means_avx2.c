@@ -23,10 +23,86 @@ static int64_t k_means_horizontal_sum_avx2(__m256i a) {
   return res;
 }
 
+static int32_t k_means_horizontal_sum32_avx2(__m256i a) {
+  const __m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(a),
+                                     _mm256_extracti128_si256(a, 1));
+  const __m128i sum2 = _mm_add_epi32(sum4, _mm_srli_si128(sum4, 8));
+  return _mm_cvtsi128_si32(_mm_add_epi32(sum2, _mm_srli_si128(sum2, 4)));
+}
+
+// Finds the nearest centroid of 16 data points. Returns the indices in 16-bit
+// lanes and the L1 distances in *dist_min.
+static inline __m256i calc_indices_dim1_16(const __m256i in,
+                                           const __m256i *cents, int k,
+                                           __m256i *dist_min) {
+  __m256i ind = _mm256_setzero_si256();
+  // Compute the distance to the first centroid.
+  __m256i d1 = _mm256_sub_epi16(in, cents[0]);
+  *dist_min = _mm256_abs_epi16(d1);
+
+  for (int j = 1; j < k; ++j) {
+    // Compute the distance to the centroid.
+    d1 = _mm256_sub_epi16(in, cents[j]);
+    const __m256i dist = _mm256_abs_epi16(d1);
+    // Compare to the minimal one.
+    const __m256i cmp = _mm256_cmpgt_epi16(*dist_min, dist);
+    *dist_min = _mm256_min_epi16(*dist_min, dist);
+    const __m256i ind1 = _mm256_set1_epi16(j);
+    ind = _mm256_or_si256(_mm256_andnot_si256(cmp, ind),
+                          _mm256_and_si256(cmp, ind1));
+  }
+  return ind;
+}
+
+// Finds the nearest centroid of 8 data points. Returns the indices in 32-bit
+// lanes and the squared distances in *dist_min.
+static inline __m256i calc_indices_dim2_8(const __m256i in,
+                                          const __m256i *cents, int k,
+                                          __m256i *dist_min) {
+  __m256i ind = _mm256_setzero_si256();
+  // Compute the distance to the first centroid.
+  __m256i d1 = _mm256_sub_epi16(in, cents[0]);
+  *dist_min = _mm256_madd_epi16(d1, d1);
+
+  for (int j = 1; j < k; ++j) {
+    // Compute the distance to the centroid.
+    d1 = _mm256_sub_epi16(in, cents[j]);
+    const __m256i dist = _mm256_madd_epi16(d1, d1);
+    // Compare to the minimal one.
+    const __m256i cmp = _mm256_cmpgt_epi32(*dist_min, dist);
+    *dist_min = _mm256_min_epi32(*dist_min, dist);
+    const __m256i ind1 = _mm256_set1_epi32(j);
+    ind = _mm256_or_si256(_mm256_andnot_si256(cmp, ind),
+                          _mm256_and_si256(cmp, ind1));
+  }
+  return ind;
+}
+
+static inline void store_indices_dim1(uint8_t *indices, const __m256i ind) {
+  const __m256i p1 = _mm256_packus_epi16(ind, _mm256_setzero_si256());
+  const __m256i px = _mm256_permute4x64_epi64(p1, 0x58);
+  _mm_storeu_si128((__m128i *)indices, _mm256_castsi256_si128(px));
+}
+
+static inline void store_indices_dim2(uint8_t *indices, const __m256i ind0,
+                                      const __m256i ind1) {
+  const __m256i permute = _mm256_set_epi32(0, 0, 0, 0, 5, 1, 4, 0);
+  const __m256i d2 = _mm256_packus_epi32(ind0, ind1);
+  const __m256i d3 = _mm256_packus_epi16(d2, _mm256_setzero_si256());
+  const __m256i d4 = _mm256_permutevar8x32_epi32(d3, permute);
+  _mm_storeu_si128((__m128i *)indices, _mm256_castsi256_si128(d4));
+}
+
+// Adds 32-bit distances to 64-bit accumulators.
+static inline __m256i add_dist_epi32(__m256i sum, const __m256i dist) {
+  const __m256i v_zero = _mm256_setzero_si256();
+  sum = _mm256_add_epi64(sum, _mm256_unpacklo_epi32(dist, v_zero));
+  return _mm256_add_epi64(sum, _mm256_unpackhi_epi32(dist, v_zero));
+}
+
 void av1_calc_indices_dim1_avx2(const int16_t *data, const int16_t *centroids,
                                 uint8_t *indices, int64_t *total_dist, int n,
                                 int k) {
-  const __m256i v_zero = _mm256_setzero_si256();
   __m256i sum = _mm256_setzero_si256();
   __m256i cents[PALETTE_MAX_SIZE];
   for (int j = 0; j < k; ++j) {
@@ -35,37 +111,14 @@ void av1_calc_indices_dim1_avx2(const int16_t *data, const int16_t *centroids,
 
   for (int i = 0; i < n; i += 16) {
     const __m256i in = _mm256_loadu_si256((__m256i *)data);
-    __m256i ind = _mm256_setzero_si256();
-    // Compute the distance to the first centroid.
-    __m256i d1 = _mm256_sub_epi16(in, cents[0]);
-    __m256i dist_min = _mm256_abs_epi16(d1);
-
-    for (int j = 1; j < k; ++j) {
-      // Compute the distance to the centroid.
-      d1 = _mm256_sub_epi16(in, cents[j]);
-      const __m256i dist = _mm256_abs_epi16(d1);
-      // Compare to the minimal one.
-      const __m256i cmp = _mm256_cmpgt_epi16(dist_min, dist);
-      dist_min = _mm256_min_epi16(dist_min, dist);
-      const __m256i ind1 = _mm256_set1_epi16(j);
-      ind = _mm256_or_si256(_mm256_andnot_si256(cmp, ind),
-                            _mm256_and_si256(cmp, ind1));
-    }
-
-    const __m256i p1 = _mm256_packus_epi16(ind, v_zero);
-    const __m256i px = _mm256_permute4x64_epi64(p1, 0x58);
-    const __m128i d2 = _mm256_extracti128_si256(px, 0);
-
-    _mm_storeu_si128((__m128i *)indices, d2);
+    __m256i dist_min;
+    const __m256i ind = calc_indices_dim1_16(in, cents, k, &dist_min);
+    store_indices_dim1(indices, ind);
 
     if (total_dist) {
       // Square, convert to 32 bit and add together.
       dist_min = _mm256_madd_epi16(dist_min, dist_min);
-      // Convert to 64 bit and add to sum.
-      const __m256i dist1 = _mm256_unpacklo_epi32(dist_min, v_zero);
-      const __m256i dist2 = _mm256_unpackhi_epi32(dist_min, v_zero);
-      sum = _mm256_add_epi64(sum, dist1);
-      sum = _mm256_add_epi64(sum, dist2);
+      sum = add_dist_epi32(sum, dist_min);
     }
 
     indices += 16;
@@ -79,8 +132,6 @@ void av1_calc_indices_dim1_avx2(const int16_t *data, const int16_t *centroids,
 void av1_calc_indices_dim2_avx2(const int16_t *data, const int16_t *centroids,
                                 uint8_t *indices, int64_t *total_dist, int n,
                                 int k) {
-  const __m256i v_zero = _mm256_setzero_si256();
-  const __m256i permute = _mm256_set_epi32(0, 0, 0, 0, 5, 1, 4, 0);
   __m256i sum = _mm256_setzero_si256();
   __m256i ind[2];
   __m256i cents[PALETTE_MAX_SIZE];
@@ -93,40 +144,115 @@ void av1_calc_indices_dim2_avx2(const int16_t *data, const int16_t *centroids,
   for (int i = 0; i < n; i += 16) {
     for (int l = 0; l < 2; ++l) {
       const __m256i in = _mm256_loadu_si256((__m256i *)data);
-      ind[l] = _mm256_setzero_si256();
-      // Compute the distance to the first centroid.
-      __m256i d1 = _mm256_sub_epi16(in, cents[0]);
-      __m256i dist_min = _mm256_madd_epi16(d1, d1);
-
-      for (int j = 1; j < k; ++j) {
-        // Compute the distance to the centroid.
-        d1 = _mm256_sub_epi16(in, cents[j]);
-        const __m256i dist = _mm256_madd_epi16(d1, d1);
-        // Compare to the minimal one.
-        const __m256i cmp = _mm256_cmpgt_epi32(dist_min, dist);
-        dist_min = _mm256_min_epi32(dist_min, dist);
-        const __m256i ind1 = _mm256_set1_epi32(j);
-        ind[l] = _mm256_or_si256(_mm256_andnot_si256(cmp, ind[l]),
-                                 _mm256_and_si256(cmp, ind1));
-      }
+      __m256i dist_min;
+      ind[l] = calc_indices_dim2_8(in, cents, k, &dist_min);
       if (total_dist) {
         // Convert to 64 bit and add to sum.
-        const __m256i dist1 = _mm256_unpacklo_epi32(dist_min, v_zero);
-        const __m256i dist2 = _mm256_unpackhi_epi32(dist_min, v_zero);
-        sum = _mm256_add_epi64(sum, dist1);
-        sum = _mm256_add_epi64(sum, dist2);
+        sum = add_dist_epi32(sum, dist_min);
       }
       data += 16;
     }
     // Cast to 8 bit and store.
-    const __m256i d2 = _mm256_packus_epi32(ind[0], ind[1]);
-    const __m256i d3 = _mm256_packus_epi16(d2, v_zero);
-    const __m256i d4 = _mm256_permutevar8x32_epi32(d3, permute);
-    const __m128i d5 = _mm256_extracti128_si256(d4, 0);
-    _mm_storeu_si128((__m128i *)indices, d5);
+    store_indices_dim2(indices, ind[0], ind[1]);
     indices += 16;
   }
   if (total_dist) {
     *total_dist = k_means_horizontal_sum_avx2(sum);
   }
 }
+
+// The per-cluster sums are accumulated in 32-bit lanes. For dim1 the counts
+// fit in 16-bit lanes, as each lane sees at most 4096 / 16 points.
+void av1_calc_indices_sums_dim1_avx2(const int16_t *data,
+                                     const int16_t *centroids,
+                                     uint8_t *indices, int64_t *total_dist,
+                                     int *sums, int *counts, int n, int k) {
+  const __m256i ones = _mm256_set1_epi16(1);
+  __m256i dist_sum = _mm256_setzero_si256();
+  __m256i cents[PALETTE_MAX_SIZE];
+  __m256i cluster_sums[PALETTE_MAX_SIZE];
+  __m256i cluster_counts[PALETTE_MAX_SIZE];
+  for (int j = 0; j < k; ++j) {
+    cents[j] = _mm256_set1_epi16(centroids[j]);
+    cluster_sums[j] = _mm256_setzero_si256();
+    cluster_counts[j] = _mm256_setzero_si256();
+  }
+
+  for (int i = 0; i < n; i += 16) {
+    const __m256i in = _mm256_loadu_si256((__m256i *)data);
+    __m256i dist_min;
+    const __m256i ind = calc_indices_dim1_16(in, cents, k, &dist_min);
+    store_indices_dim1(indices, ind);
+
+    for (int j = 0; j < k; ++j) {
+      const __m256i mask = _mm256_cmpeq_epi16(ind, _mm256_set1_epi16(j));
+      cluster_counts[j] = _mm256_sub_epi16(cluster_counts[j], mask);
+      cluster_sums[j] = _mm256_add_epi32(
+          cluster_sums[j], _mm256_madd_epi16(_mm256_and_si256(in, mask), ones));
+    }
+    dist_sum = add_dist_epi32(dist_sum, _mm256_madd_epi16(dist_min, dist_min));
+
+    indices += 16;
+    data += 16;
+  }
+
+  for (int j = 0; j < k; ++j) {
+    sums[j] = k_means_horizontal_sum32_avx2(cluster_sums[j]);
+    counts[j] = k_means_horizontal_sum32_avx2(
+        _mm256_madd_epi16(cluster_counts[j], ones));
+  }
+  if (total_dist) {
+    *total_dist = k_means_horizontal_sum_avx2(dist_sum);
+  }
+}
+
+void av1_calc_indices_sums_dim2_avx2(const int16_t *data,
+                                     const int16_t *centroids,
+                                     uint8_t *indices, int64_t *total_dist,
+                                     int *sums, int *counts, int n, int k) {
+  __m256i dist_sum = _mm256_setzero_si256();
+  __m256i ind[2];
+  __m256i cents[PALETTE_MAX_SIZE];
+  __m256i cluster_sums[2 * PALETTE_MAX_SIZE];
+  __m256i cluster_counts[PALETTE_MAX_SIZE];
+  for (int j = 0; j < k; ++j) {
+    const int16_t cx = centroids[2 * j], cy = centroids[2 * j + 1];
+    cents[j] = _mm256_set_epi16(cy, cx, cy, cx, cy, cx, cy, cx, cy, cx, cy, cx,
+                                cy, cx, cy, cx);
+    cluster_sums[2 * j] = _mm256_setzero_si256();
+    cluster_sums[2 * j + 1] = _mm256_setzero_si256();
+    cluster_counts[j] = _mm256_setzero_si256();
+  }
+
+  for (int i = 0; i < n; i += 16) {
+    for (int l = 0; l < 2; ++l) {
+      const __m256i in = _mm256_loadu_si256((__m256i *)data);
+      __m256i dist_min;
+      ind[l] = calc_indices_dim2_8(in, cents, k, &dist_min);
+      // Sign extend the two coordinates of each point to 32 bits.
+      const __m256i x = _mm256_srai_epi32(_mm256_slli_epi32(in, 16), 16);
+      const __m256i y = _mm256_srai_epi32(in, 16);
+      for (int j = 0; j < k; ++j) {
+        const __m256i mask = _mm256_cmpeq_epi32(ind[l], _mm256_set1_epi32(j));
+        cluster_counts[j] = _mm256_sub_epi32(cluster_counts[j], mask);
+        cluster_sums[2 * j] =
+            _mm256_add_epi32(cluster_sums[2 * j], _mm256_and_si256(x, mask));
+        cluster_sums[2 * j + 1] = _mm256_add_epi32(cluster_sums[2 * j + 1],
+                                                   _mm256_and_si256(y, mask));
+      }
+      dist_sum = add_dist_epi32(dist_sum, dist_min);
+      data += 16;
+    }
+    store_indices_dim2(indices, ind[0], ind[1]);
+    indices += 16;
+  }
+
+  for (int j = 0; j < k; ++j) {
+    sums[2 * j] = k_means_horizontal_sum32_avx2(cluster_sums[2 * j]);
+    sums[2 * j + 1] = k_means_horizontal_sum32_avx2(cluster_sums[2 * j + 1]);
+    counts[j] = k_means_horizontal_sum32_avx2(cluster_counts[j]);
+  }
+  if (total_dist) {
+    *total_dist = k_means_horizontal_sum_avx2(dist_sum);
+  }
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/av1_rtcd.h"
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_dsp_common.h"
+
+typedef struct {
+  __m512i round;
+  __m512i quant;
+  __m512i dequant;
+} QuantParams512;
+
+// Lane 0 of the first vector holds the DC parameters, every other lane the AC
+// parameters.
+static inline void init_qp(const int16_t *round_ptr, const int16_t *quant_ptr,
+                           const int16_t *dequant_ptr, int log_scale,
+                           QuantParams512 *qp) {
+  qp->round = _mm512_mask_set1_epi32(
+      _mm512_set1_epi32(ROUND_POWER_OF_TWO(round_ptr[1], log_scale)), 1,
+      ROUND_POWER_OF_TWO(round_ptr[0], log_scale));
+  qp->quant = _mm512_mask_set1_epi32(_mm512_set1_epi32(quant_ptr[1]), 1,
+                                     quant_ptr[0]);
+  qp->dequant = _mm512_mask_set1_epi32(_mm512_set1_epi32(dequant_ptr[1]), 1,
+                                       dequant_ptr[0]);
+}
+
+static inline void update_qp(const int16_t *round_ptr,
+                             const int16_t *quant_ptr,
+                             const int16_t *dequant_ptr, int log_scale,
+                             QuantParams512 *qp) {
+  qp->round = _mm512_set1_epi32(ROUND_POWER_OF_TWO(round_ptr[1], log_scale));
+  qp->quant = _mm512_set1_epi32(quant_ptr[1]);
+  qp->dequant = _mm512_set1_epi32(dequant_ptr[1]);
+}
+
+// Quantizes 16 coefficients in 32-bit lanes, which reproduces
+// av1_quantize_fp_no_qmatrix() without the 16-bit saturation of the AVX2
+// version.
+static AOM_FORCE_INLINE void quantize_fp_16(const QuantParams512 *qp,
+                                            int log_scale,
+                                            const tran_low_t *coeff_ptr,
+                                            const int16_t *iscan_ptr,
+                                            tran_low_t *qcoeff_ptr,
+                                            tran_low_t *dqcoeff_ptr,
+                                            __m512i *eob) {
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i coeff = _mm512_loadu_si512(coeff_ptr);
+  const __m512i abs_coeff = _mm512_abs_epi32(coeff);
+  const __mmask16 zbin_mask = _mm512_cmpge_epi32_mask(
+      _mm512_sll_epi32(abs_coeff, _mm_cvtsi32_si128(1 + log_scale)),
+      qp->dequant);
+
+  if (zbin_mask) {
+    const __m512i tmp_rnd = _mm512_min_epi32(
+        _mm512_add_epi32(abs_coeff, qp->round), _mm512_set1_epi32(INT16_MAX));
+    const __m512i abs_q = _mm512_maskz_mov_epi32(
+        zbin_mask,
+        _mm512_sra_epi32(_mm512_mullo_epi32(tmp_rnd, qp->quant),
+                         _mm_cvtsi32_si128(16 - log_scale)));
+    const __m512i abs_dq =
+        _mm512_sra_epi32(_mm512_mullo_epi32(abs_q, qp->dequant),
+                         _mm_cvtsi32_si128(log_scale));
+    const __mmask16 neg_mask = _mm512_cmplt_epi32_mask(coeff, zero);
+    const __m512i q = _mm512_mask_sub_epi32(abs_q, neg_mask, zero, abs_q);
+    const __m512i dq = _mm512_mask_sub_epi32(abs_dq, neg_mask, zero, abs_dq);
+    const __mmask16 nz_mask = _mm512_test_epi32_mask(abs_q, abs_q);
+
+    _mm512_storeu_si512(qcoeff_ptr, q);
+    _mm512_storeu_si512(dqcoeff_ptr, dq);
+
+    const __m512i iscan_plus1 = _mm512_add_epi32(
+        _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)iscan_ptr)),
+        _mm512_set1_epi32(1));
+    *eob = _mm512_mask_max_epi32(*eob, nz_mask, *eob, iscan_plus1);
+  } else {
+    _mm512_storeu_si512(qcoeff_ptr, zero);
+    _mm512_storeu_si512(dqcoeff_ptr, zero);
+  }
+}
+
+static inline uint16_t quant_gather_eob(const __m512i eob) {
+  const __m256i eob256 = _mm256_max_epi32(_mm512_castsi512_si256(eob),
+                                          _mm512_extracti64x4_epi64(eob, 1));
+  __m128i eob128 = _mm_max_epi32(_mm256_castsi256_si128(eob256),
+                                 _mm256_extracti128_si256(eob256, 1));
+  eob128 = _mm_max_epi32(eob128, _mm_srli_si128(eob128, 8));
+  eob128 = _mm_max_epi32(eob128, _mm_srli_si128(eob128, 4));
+  return (uint16_t)_mm_cvtsi128_si32(eob128);
+}
+
+static AOM_FORCE_INLINE void quantize_fp_avx512(
+    const tran_low_t *coeff_ptr, intptr_t n_coeffs, const int16_t *round_ptr,
+    const int16_t *quant_ptr, tran_low_t *qcoeff_ptr, tran_low_t *dqcoeff_ptr,
+    const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *iscan_ptr,
+    int log_scale) {
+  const int step = 16;
+  QuantParams512 qp;
+  __m512i eob = _mm512_setzero_si512();
+
+  init_qp(round_ptr, quant_ptr, dequant_ptr, log_scale, &qp);
+
+  quantize_fp_16(&qp, log_scale, coeff_ptr, iscan_ptr, qcoeff_ptr,
+                 dqcoeff_ptr, &eob);
+
+  coeff_ptr += step;
+  qcoeff_ptr += step;
+  dqcoeff_ptr += step;
+  iscan_ptr += step;
+  n_coeffs -= step;
+
+  update_qp(round_ptr, quant_ptr, dequant_ptr, log_scale, &qp);
+
+  while (n_coeffs > 0) {
+    quantize_fp_16(&qp, log_scale, coeff_ptr, iscan_ptr, qcoeff_ptr,
+                   dqcoeff_ptr, &eob);
+
+    coeff_ptr += step;
+    qcoeff_ptr += step;
+    dqcoeff_ptr += step;
+    iscan_ptr += step;
+    n_coeffs -= step;
+  }
+  *eob_ptr = quant_gather_eob(eob);
+}
+
+void av1_quantize_fp_avx512(const tran_low_t *coeff_ptr, intptr_t n_coeffs,
+                            const int16_t *zbin_ptr, const int16_t *round_ptr,
+                            const int16_t *quant_ptr,
+                            const int16_t *quant_shift_ptr,
+                            tran_low_t *qcoeff_ptr, tran_low_t *dqcoeff_ptr,
+                            const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                            const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+  (void)scan_ptr;
+  (void)zbin_ptr;
+  (void)quant_shift_ptr;
+  quantize_fp_avx512(coeff_ptr, n_coeffs, round_ptr, quant_ptr, qcoeff_ptr,
+                     dqcoeff_ptr, dequant_ptr, eob_ptr, iscan_ptr, 0);
+}
+
+void av1_quantize_fp_32x32_avx512(
+    const tran_low_t *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+    const int16_t *round_ptr, const int16_t *quant_ptr,
+    const int16_t *quant_shift_ptr, tran_low_t *qcoeff_ptr,
+    tran_low_t *dqcoeff_ptr, const int16_t *dequant_ptr, uint16_t *eob_ptr,
+    const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+  (void)scan_ptr;
+  (void)zbin_ptr;
+  (void)quant_shift_ptr;
+  quantize_fp_avx512(coeff_ptr, n_coeffs, round_ptr, quant_ptr, qcoeff_ptr,
+                     dqcoeff_ptr, dequant_ptr, eob_ptr, iscan_ptr, 1);
+}
+
+void av1_quantize_fp_64x64_avx512(
+    const tran_low_t *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+    const int16_t *round_ptr, const int16_t *quant_ptr,
+    const int16_t *quant_shift_ptr, tran_low_t *qcoeff_ptr,
+    tran_low_t *dqcoeff_ptr, const int16_t *dequant_ptr, uint16_t *eob_ptr,
+    const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+  (void)scan_ptr;
+  (void)zbin_ptr;
+  (void)quant_shift_ptr;
+  quantize_fp_avx512(coeff_ptr, n_coeffs, round_ptr, quant_ptr, qcoeff_ptr,
+                     dqcoeff_ptr, dequant_ptr, eob_ptr, iscan_ptr, 2);
+}
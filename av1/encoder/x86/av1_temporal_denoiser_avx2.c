@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+#include <stdlib.h>
+
+#include "config/av1_rtcd.h"
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+#include "av1/common/reconinter.h"
+#include "av1/encoder/context_tree.h"
+#include "av1/encoder/av1_temporal_denoiser.h"
+
+// Every register holds 32 pixels of the block: 4 rows of an 8-wide block,
+// 2 rows of a 16-wide block or 32 pixels of a single row otherwise.
+static inline __m256i load_32_pixels(const uint8_t *p, int stride, int w) {
+  if (w == 8) {
+    return yy_loadu_4x64(p + 3 * stride, p + 2 * stride, p + stride, p);
+  }
+  if (w == 16) return yy_loadu2_128(p + stride, p);
+  return yy_loadu_256(p);
+}
+
+static inline void store_32_pixels(uint8_t *p, int stride, int w,
+                                   const __m256i v) {
+  if (w == 8) {
+    const __m128i lo = _mm256_castsi256_si128(v);
+    const __m128i hi = _mm256_extracti128_si256(v, 1);
+    xx_storel_64(p, lo);
+    xx_storel_64(p + stride, _mm_srli_si128(lo, 8));
+    xx_storel_64(p + 2 * stride, hi);
+    xx_storel_64(p + 3 * stride, _mm_srli_si128(hi, 8));
+  } else if (w == 16) {
+    yy_storeu2_128(p + stride, p, v);
+  } else {
+    yy_storeu_256(p, v);
+  }
+}
+
+// Compute the sum of all pixel differences accumulated in acc_diff.
+static inline int sum_diff_32x1(const __m256i acc_diff) {
+  const __m256i acc_diff_lo =
+      _mm256_srai_epi16(_mm256_unpacklo_epi8(acc_diff, acc_diff), 8);
+  const __m256i acc_diff_hi =
+      _mm256_srai_epi16(_mm256_unpackhi_epi8(acc_diff, acc_diff), 8);
+  const __m256i acc_diff_16 = _mm256_add_epi16(acc_diff_lo, acc_diff_hi);
+  const __m256i sum_32 = _mm256_madd_epi16(acc_diff_16, _mm256_set1_epi16(1));
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(sum_32),
+                              _mm256_extracti128_si256(sum_32, 1));
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 8));
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 4));
+  return _mm_cvtsi128_si32(sum);
+}
+
+// Denoise 32 pixels with the strong filter. Same as av1_denoiser_16x1_sse2().
+static inline __m256i denoiser_32x1(const __m256i v_sig,
+                                    const __m256i v_mc_running_avg_y,
+                                    __m256i *v_running_avg_y, const __m256i k_4,
+                                    const __m256i l3, __m256i acc_diff) {
+  const __m256i k_0 = _mm256_setzero_si256();
+  const __m256i k_8 = _mm256_set1_epi8(8);
+  const __m256i k_16 = _mm256_set1_epi8(16);
+  // Difference between level 3 and level 2 is 2.
+  const __m256i l32 = _mm256_set1_epi8(2);
+  // Difference between level 2 and level 1 is 1.
+  const __m256i l21 = _mm256_set1_epi8(1);
+  // Calculate differences
+  const __m256i pdiff = _mm256_subs_epu8(v_mc_running_avg_y, v_sig);
+  const __m256i ndiff = _mm256_subs_epu8(v_sig, v_mc_running_avg_y);
+  // Obtain the sign. FF if diff is negative.
+  const __m256i diff_sign = _mm256_cmpeq_epi8(pdiff, k_0);
+  // Clamp absolute difference to 16 to be used to get mask. Doing this
+  // allows us to use _mm256_cmpgt_epi8, which operates on signed byte.
+  const __m256i clamped_absdiff =
+      _mm256_min_epu8(_mm256_or_si256(pdiff, ndiff), k_16);
+  // Get masks for l2 l1 and l0 adjustments.
+  const __m256i mask2 = _mm256_cmpgt_epi8(k_16, clamped_absdiff);
+  const __m256i mask1 = _mm256_cmpgt_epi8(k_8, clamped_absdiff);
+  const __m256i mask0 = _mm256_cmpgt_epi8(k_4, clamped_absdiff);
+  // Get adjustments for l2, l1, and l0.
+  const __m256i adj2 = _mm256_and_si256(mask2, l32);
+  const __m256i adj1 = _mm256_and_si256(mask1, l21);
+  const __m256i adj0 = _mm256_and_si256(mask0, clamped_absdiff);
+
+  // Combine the adjustments and get absolute adjustments.
+  __m256i adj = _mm256_sub_epi8(l3, _mm256_add_epi8(adj2, adj1));
+  adj = _mm256_andnot_si256(mask0, adj);
+  adj = _mm256_or_si256(adj, adj0);
+
+  // Restore the sign and get positive and negative adjustments.
+  const __m256i padj = _mm256_andnot_si256(diff_sign, adj);
+  const __m256i nadj = _mm256_and_si256(diff_sign, adj);
+
+  // Calculate filtered value.
+  *v_running_avg_y = _mm256_subs_epu8(_mm256_adds_epu8(v_sig, padj), nadj);
+
+  // Adjustments <=7, and each element in acc_diff can fit in signed
+  // char.
+  acc_diff = _mm256_adds_epi8(acc_diff, padj);
+  return _mm256_subs_epi8(acc_diff, nadj);
+}
+
+// Denoise 32 pixels with the weaker filter. Same as
+// av1_denoiser_adj_16x1_sse2().
+static inline __m256i denoiser_adj_32x1(const __m256i v_sig,
+                                        const __m256i v_mc_running_avg_y,
+                                        __m256i *v_running_avg_y,
+                                        const __m256i k_delta,
+                                        __m256i acc_diff) {
+  const __m256i pdiff = _mm256_subs_epu8(v_mc_running_avg_y, v_sig);
+  const __m256i ndiff = _mm256_subs_epu8(v_sig, v_mc_running_avg_y);
+  // Obtain the sign. FF if diff is negative.
+  const __m256i diff_sign = _mm256_cmpeq_epi8(pdiff, _mm256_setzero_si256());
+  // Clamp absolute difference to delta to get the adjustment.
+  const __m256i adj = _mm256_min_epu8(_mm256_or_si256(pdiff, ndiff), k_delta);
+  // Restore the sign and get positive and negative adjustments.
+  const __m256i padj = _mm256_andnot_si256(diff_sign, adj);
+  const __m256i nadj = _mm256_and_si256(diff_sign, adj);
+  // Calculate filtered value.
+  *v_running_avg_y =
+      _mm256_adds_epu8(_mm256_subs_epu8(*v_running_avg_y, padj), nadj);
+
+  // Accumulate the adjustments.
+  acc_diff = _mm256_subs_epi8(acc_diff, padj);
+  return _mm256_adds_epi8(acc_diff, nadj);
+}
+
+// Denoise 8x8 to 128x128 blocks. The adjustments are accumulated per byte
+// over at most 16 rows, so, as in the SSE2 version, the signed 8-bit
+// accumulators never saturate and the sum matches the C version. step_w is
+// the number of pixels of a row held in a register: 8, 16 or 32.
+static inline int denoiser_NxM_avx2(const uint8_t *sig, int sig_stride,
+                                    const uint8_t *mc_running_avg_y,
+                                    int mc_avg_y_stride, uint8_t *running_avg_y,
+                                    int avg_y_stride, int increase_denoising,
+                                    BLOCK_SIZE bs, int motion_magnitude,
+                                    const int step_w) {
+  const int shift_inc =
+      (increase_denoising && motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD)
+          ? 1
+          : 0;
+  const __m256i k_4 = _mm256_set1_epi8(4 + shift_inc);
+  // Modify each level's adjustment according to motion_magnitude.
+  const __m256i l3 = _mm256_set1_epi8(
+      (motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD) ? 7 + shift_inc : 6);
+  const int b_width = block_size_wide[bs];
+  const int b_height = block_size_high[bs];
+  const int step_h = 32 / step_w;
+  int sum_diff = 0;
+
+  for (int r = 0; r < b_height; r += 16) {
+    const int band_h = AOMMIN(16, b_height - r);
+    for (int c = 0; c < b_width; c += step_w) {
+      __m256i acc_diff = _mm256_setzero_si256();
+      for (int i = r; i < r + band_h; i += step_h) {
+        __m256i v_running_avg_y;
+        acc_diff = denoiser_32x1(
+            load_32_pixels(sig + i * sig_stride + c, sig_stride, step_w),
+            load_32_pixels(mc_running_avg_y + i * mc_avg_y_stride + c,
+                           mc_avg_y_stride, step_w),
+            &v_running_avg_y, k_4, l3, acc_diff);
+        store_32_pixels(running_avg_y + i * avg_y_stride + c, avg_y_stride,
+                        step_w, v_running_avg_y);
+      }
+      sum_diff += sum_diff_32x1(acc_diff);
+    }
+  }
+
+  const int sum_diff_thresh = total_adj_strong_thresh(bs, increase_denoising);
+  if (abs(sum_diff) <= sum_diff_thresh) return FILTER_BLOCK;
+
+  // Before returning to copy the block (i.e., apply no denoising), check if
+  // we can still apply some (weaker) temporal filtering to this block, that
+  // would otherwise not be denoised at all. The delta is set by the excess of
+  // absolute pixel diff over the threshold.
+  const int delta =
+      ((abs(sum_diff) - sum_diff_thresh) >> num_pels_log2_lookup[bs]) + 1;
+  // Only apply the adjustment for max delta up to 3.
+  if (delta >= 4) return COPY_BLOCK;
+
+  const __m256i k_delta = _mm256_set1_epi8(delta);
+  for (int r = 0; r < b_height; r += 16) {
+    const int band_h = AOMMIN(16, b_height - r);
+    for (int c = 0; c < b_width; c += step_w) {
+      __m256i acc_diff = _mm256_setzero_si256();
+      for (int i = r; i < r + band_h; i += step_h) {
+        uint8_t *const avg = running_avg_y + i * avg_y_stride + c;
+        __m256i v_running_avg_y = load_32_pixels(avg, avg_y_stride, step_w);
+        acc_diff = denoiser_adj_32x1(
+            load_32_pixels(sig + i * sig_stride + c, sig_stride, step_w),
+            load_32_pixels(mc_running_avg_y + i * mc_avg_y_stride + c,
+                           mc_avg_y_stride, step_w),
+            &v_running_avg_y, k_delta, acc_diff);
+        store_32_pixels(avg, avg_y_stride, step_w, v_running_avg_y);
+      }
+      sum_diff += sum_diff_32x1(acc_diff);
+    }
+  }
+  return abs(sum_diff) > sum_diff_thresh ? COPY_BLOCK : FILTER_BLOCK;
+}
+
+int av1_denoiser_filter_avx2(const uint8_t *sig, int sig_stride,
+                             const uint8_t *mc_avg, int mc_avg_stride,
+                             uint8_t *avg, int avg_stride,
+                             int increase_denoising, BLOCK_SIZE bs,
+                             int motion_magnitude) {
+  // Denoise the same block sizes as the SSE2 version.
+  if (bs == BLOCK_8X8 || bs == BLOCK_8X16) {
+    return denoiser_NxM_avx2(sig, sig_stride, mc_avg, mc_avg_stride, avg,
+                             avg_stride, increase_denoising, bs,
+                             motion_magnitude, 8);
+  }
+  if (bs == BLOCK_16X8 || bs == BLOCK_16X16 || bs == BLOCK_16X32) {
+    return denoiser_NxM_avx2(sig, sig_stride, mc_avg, mc_avg_stride, avg,
+                             avg_stride, increase_denoising, bs,
+                             motion_magnitude, 16);
+  }
+  if (bs == BLOCK_32X16 || bs == BLOCK_32X32 || bs == BLOCK_32X64 ||
+      bs == BLOCK_64X32 || bs == BLOCK_64X64 || bs == BLOCK_64X128 ||
+      bs == BLOCK_128X64 || bs == BLOCK_128X128) {
+    return denoiser_NxM_avx2(sig, sig_stride, mc_avg, mc_avg_stride, avg,
+                             avg_stride, increase_denoising, bs,
+                             motion_magnitude, 32);
+  }
+  return COPY_BLOCK;
+}
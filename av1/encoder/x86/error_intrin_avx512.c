@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>  // AVX512
+
+#include "config/av1_rtcd.h"
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/x86/synonyms_avx512.h"
+
+// Accumulates the squares of the 16 signed 32-bit values of v into the 64-bit
+// lanes of acc.
+static inline __m512i add_squares_epi64(__m512i acc, const __m512i v) {
+  const __m512i v_odd = _mm512_srli_epi64(v, 32);
+  acc = _mm512_add_epi64(acc, _mm512_mul_epi32(v, v));
+  return _mm512_add_epi64(acc, _mm512_mul_epi32(v_odd, v_odd));
+}
+
+int64_t av1_block_error_avx512(const tran_low_t *coeff,
+                               const tran_low_t *dqcoeff, intptr_t block_size,
+                               int64_t *ssz) {
+  __m512i sse_reg = _mm512_setzero_si512();
+  __m512i ssz_reg = _mm512_setzero_si512();
+
+  // Unlike the AVX2 version, the coefficients are not packed to 16 bits, so
+  // the result is exact for the full range of tran_low_t.
+  for (intptr_t i = 0; i < block_size; i += 16) {
+    const __m512i c = zz_loadu_512(coeff + i);
+    const __m512i d = zz_loadu_512(dqcoeff + i);
+    sse_reg = add_squares_epi64(sse_reg, _mm512_sub_epi32(c, d));
+    ssz_reg = add_squares_epi64(ssz_reg, c);
+  }
+
+  *ssz = zz_hsum_epi64(ssz_reg);
+  return zz_hsum_epi64(sse_reg);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+#include <string.h>
+
+#include "config/av1_rtcd.h"
+
+#include "aom_ports/mem.h"
+
+// Returns the number of nonzero entries of count. n must be a multiple of 8.
+static inline int count_nonzero_avx2(const int *count, int n) {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i zeros = _mm256_setzero_si256();
+  for (int i = 0; i < n; i += 8) {
+    const __m256i v = _mm256_loadu_si256((const __m256i *)(count + i));
+    zeros = _mm256_sub_epi32(zeros, _mm256_cmpeq_epi32(v, zero));
+  }
+  const __m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(zeros),
+                                     _mm256_extracti128_si256(zeros, 1));
+  const __m128i sum2 = _mm_add_epi32(sum4, _mm_srli_si128(sum4, 8));
+  return n - _mm_cvtsi128_si32(_mm_add_epi32(sum2, _mm_srli_si128(sum2, 4)));
+}
+
+// Screen content, which palette mode is meant for, has long runs of a single
+// color. Every group of pixels equal to its first pixel is counted with one
+// increment; other groups fall back to counting one pixel at a time.
+void av1_count_colors_avx2(const uint8_t *src, int stride, int rows, int cols,
+                           int *val_count, int *num_colors) {
+  memset(val_count, 0, (1 << 8) * sizeof(val_count[0]));
+  for (int r = 0; r < rows; ++r) {
+    int c = 0;
+    for (; c + 32 <= cols; c += 32) {
+      const __m256i v = _mm256_loadu_si256((const __m256i *)(src + c));
+      const __m256i first = _mm256_set1_epi8((char)src[c]);
+      if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, first)) == -1) {
+        val_count[src[c]] += 32;
+      } else {
+        for (int i = 0; i < 32; ++i) ++val_count[src[c + i]];
+      }
+    }
+    for (; c + 16 <= cols; c += 16) {
+      const __m128i v = _mm_loadu_si128((const __m128i *)(src + c));
+      const __m128i first = _mm_set1_epi8((char)src[c]);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, first)) == 0xffff) {
+        val_count[src[c]] += 16;
+      } else {
+        for (int i = 0; i < 16; ++i) ++val_count[src[c + i]];
+      }
+    }
+    for (; c < cols; ++c) ++val_count[src[c]];
+    src += stride;
+  }
+  *num_colors = count_nonzero_avx2(val_count, 1 << 8);
+}
+
+static inline void count_highbd_color(int val, int n, int shift,
+                                      int *val_count, int *bin_val_count) {
+  const int bin = val >> shift;
+  assert(bin < (1 << 8));
+  if (bin >= (1 << 8)) return;
+  bin_val_count[bin] += n;
+  if (val_count != NULL) val_count[val] += n;
+}
+
+void av1_count_colors_highbd_avx2(const uint8_t *src8, int stride, int rows,
+                                  int cols, int bit_depth, int *val_count,
+                                  int *bin_val_count, int *num_color_bins,
+                                  int *num_colors) {
+  assert(bit_depth <= 12);
+  const int shift = bit_depth - 8;
+  const uint16_t *src = CONVERT_TO_SHORTPTR(src8);
+  memset(bin_val_count, 0, (1 << 8) * sizeof(bin_val_count[0]));
+  if (val_count != NULL) {
+    memset(val_count, 0, (1 << bit_depth) * sizeof(val_count[0]));
+  }
+  for (int r = 0; r < rows; ++r) {
+    int c = 0;
+    for (; c + 16 <= cols; c += 16) {
+      const __m256i v = _mm256_loadu_si256((const __m256i *)(src + c));
+      const __m256i first = _mm256_set1_epi16((int16_t)src[c]);
+      if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(v, first)) == -1) {
+        count_highbd_color(src[c], 16, shift, val_count, bin_val_count);
+      } else {
+        for (int i = 0; i < 16; ++i) {
+          count_highbd_color(src[c + i], 1, shift, val_count, bin_val_count);
+        }
+      }
+    }
+    for (; c < cols; ++c) {
+      count_highbd_color(src[c], 1, shift, val_count, bin_val_count);
+    }
+    src += stride;
+  }
+  *num_color_bins = count_nonzero_avx2(bin_val_count, 1 << 8);
+  if (val_count != NULL) {
+    *num_colors = count_nonzero_avx2(val_count, 1 << bit_depth);
+  }
+}
@@ -120,7 +120,22 @@ elseif("${AOM_TARGET_CPU}" MATCHES "^x86")
     set(RTCD_ARCH_X86_64 "yes")
   endif()
 
-  set(X86_FLAVORS "MMX;SSE;SSE2;SSE3;SSSE3;SSE4_1;SSE4_2;AVX;AVX2")
+  # AVX-512 may not be supported by older compilers.
+  if(ENABLE_AVX512 AND NOT CMAKE_C_COMPILER_ID STREQUAL "MSVC")
+    set(OLD_CMAKE_REQURED_FLAGS ${CMAKE_REQUIRED_FLAGS})
+    set(CMAKE_REQUIRED_FLAGS "${CMAKE_REQUIRED_FLAGS} ${AOM_AVX512_FLAGS}")
+    unset(FLAG_SUPPORTED)
+    aom_check_source_compiles("x86_feature_flag_avx512_available" "
+#include <immintrin.h>
+__m512i function(__m512i a) { return _mm512_abs_epi8(a)\; }" FLAG_SUPPORTED)
+    set(CMAKE_REQUIRED_FLAGS ${OLD_CMAKE_REQURED_FLAGS})
+
+    if(NOT ${FLAG_SUPPORTED})
+      set(ENABLE_AVX512 0)
+    endif()
+  endif()
+
+  set(X86_FLAVORS "MMX;SSE;SSE2;SSE3;SSSE3;SSE4_1;SSE4_2;AVX;AVX2;AVX512")
   foreach(flavor ${X86_FLAVORS})
     if(ENABLE_${flavor} AND NOT disable_remaining_flavors)
       set(HAVE_${flavor} 1)
@@ -41,9 +41,13 @@ static void write_greyscale(const aom_image_t *img, int n, WRITER writer_func,
     uint16_t u16[BATCH_SIZE / 2];
   } batched;
   if (img->fmt & AOM_IMG_FMT_HIGHBITDEPTH) {
+    // P010 samples are aligned to the most significant bit.
+    const int neutral = img->fmt == AOM_IMG_FMT_P010
+                            ? 1 << 15
+                            : 1 << (img->bit_depth - 1);
     bytes_per_sample = 2;
     for (int i = 0; i < BATCH_SIZE / 2; ++i) {
-      batched.u16[i] = 1 << (img->bit_depth - 1);
+      batched.u16[i] = neutral;
     }
   } else {
     bytes_per_sample = 1;
@@ -69,10 +73,14 @@ static void raw_write_image_file_or_md5(const aom_image_t *img,
                                         void *file_or_md5, WRITER writer_func) {
   const bool high_bitdepth = img->fmt & AOM_IMG_FMT_HIGHBITDEPTH;
   const int bytes_per_sample = high_bitdepth ? 2 : 1;
+  const bool interleaved_uv = img_fmt_has_interleaved_uv(img->fmt);
   for (int i = 0; i < num_planes; ++i) {
     const int plane = planes[i];
-    const int w = aom_img_plane_width(img, plane);
+    // With interleaved chroma, the U plane holds both U and V.
+    if (interleaved_uv && plane == AOM_PLANE_V) continue;
+    int w = aom_img_plane_width(img, plane);
     const int h = aom_img_plane_height(img, plane);
+    if (interleaved_uv && plane == AOM_PLANE_U) w *= 2;
     // If we're on a color plane and the output is monochrome, write a greyscale
     // value. Since there are only YUV planes, compare against Y.
     if (img->monochrome && plane != AOM_PLANE_Y) {
@@ -81,10 +81,15 @@ const char *image_format_to_string(aom_img_fmt_t fmt) {
     case AOM_IMG_FMT_I42016: return "I42016";
     case AOM_IMG_FMT_I42216: return "I42216";
     case AOM_IMG_FMT_I44416: return "I44416";
+    case AOM_IMG_FMT_P010: return "P010";
     default: return "Other";
   }
 }
 
+bool img_fmt_has_interleaved_uv(aom_img_fmt_t fmt) {
+  return fmt == AOM_IMG_FMT_NV12 || fmt == AOM_IMG_FMT_P010;
+}
+
 int read_yuv_frame(struct AvxInputContext *input_ctx, aom_image_t *yuv_frame) {
   FILE *f = input_ctx->file;
   struct FileTypeDetectionBuffer *detect = &input_ctx->detect;
@@ -254,9 +259,9 @@ void aom_img_write(const aom_image_t *img, FILE *file) {
     const int h = aom_img_plane_height(img, plane);
     int y;
 
-    // Assuming that for nv12 we write all chroma data at once
-    if (img->fmt == AOM_IMG_FMT_NV12 && plane > 1) break;
-    if (img->fmt == AOM_IMG_FMT_NV12 && plane == 1) w *= 2;
+    // Assuming that for nv12 and p010 we write all chroma data at once
+    if (img_fmt_has_interleaved_uv(img->fmt) && plane > 1) break;
+    if (img_fmt_has_interleaved_uv(img->fmt) && plane == 1) w *= 2;
 
     for (y = 0; y < h; ++y) {
       fwrite(buf, bytespp, w, file);
@@ -276,9 +281,9 @@ bool aom_img_read(aom_image_t *img, FILE *file) {
     const int h = aom_img_plane_height(img, plane);
     int y;
 
-    // Assuming that for nv12 we read all chroma data at once
-    if (img->fmt == AOM_IMG_FMT_NV12 && plane > 1) break;
-    if (img->fmt == AOM_IMG_FMT_NV12 && plane == 1) w *= 2;
+    // Assuming that for nv12 and p010 we read all chroma data at once
+    if (img_fmt_has_interleaved_uv(img->fmt) && plane > 1) break;
+    if (img_fmt_has_interleaved_uv(img->fmt) && plane == 1) w *= 2;
 
     for (y = 0; y < h; ++y) {
       if (fread(buf, bytespp, w, file) != (size_t)w) return false;
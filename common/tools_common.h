@@ -179,6 +179,9 @@ uint32_t get_fourcc_by_aom_decoder(aom_codec_iface_t *iface);
 
 const char *image_format_to_string(aom_img_fmt_t fmt);
 
+// Returns true if the U and V samples of fmt are interleaved in one plane.
+bool img_fmt_has_interleaved_uv(aom_img_fmt_t fmt);
+
 int read_yuv_frame(struct AvxInputContext *input_ctx, aom_image_t *yuv_frame);
 
 void aom_img_write(const aom_image_t *img, FILE *file);
@@ -73,6 +73,23 @@ TEST(AomImageTest, AomImgAllocNv12) {
   aom_img_free(&img);
 }
 
+TEST(AomImageTest, AomImgAllocP010) {
+  const int kWidth = 128;
+  const int kHeight = 128;
+
+  aom_image_t img;
+  aom_img_fmt_t format = AOM_IMG_FMT_P010;
+  unsigned int align = 32;
+  EXPECT_EQ(aom_img_alloc(&img, format, kWidth, kHeight, align), &img);
+  EXPECT_EQ(img.stride[AOM_PLANE_Y], kWidth * 2);
+  EXPECT_EQ(img.stride[AOM_PLANE_U], img.stride[AOM_PLANE_Y]);
+  EXPECT_EQ(img.stride[AOM_PLANE_V], 0);
+  EXPECT_EQ(img.planes[AOM_PLANE_V], nullptr);
+  EXPECT_EQ(img.planes[AOM_PLANE_U],
+            img.planes[AOM_PLANE_Y] + kHeight * img.stride[AOM_PLANE_Y]);
+  aom_img_free(&img);
+}
+
 TEST(AomImageTest, AomImgAllocHugeWidth) {
   // The stride (0x80000000 * 2) would overflow unsigned int.
   aom_image_t *image =
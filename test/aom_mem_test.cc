@@ -13,6 +13,11 @@
 
 #include <cstdio>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "aom_mem/aom_arena.h"
+#include "aom_ports/aom_timer.h"
 
 #include "gtest/gtest.h"
 
@@ -32,3 +37,195 @@ TEST(AomMemTest, NullParams) {
   ASSERT_EQ(aom_memset16(nullptr, 0, 0), nullptr);
   aom_free(nullptr);
 }
+
+TEST(AomMemTest, Tracker) {
+  aom_mem_tracker_t tracker = {};
+  aom_mem_tracker_t *const prev_tracker = aom_mem_set_tracker(&tracker);
+  void *const a = aom_malloc(1000);
+  const aom_mem_tag_t prev_tag = aom_mem_push_tag(AOM_MEM_TAG_TPL);
+  // The outer tag is kept.
+  EXPECT_EQ(aom_mem_push_tag(AOM_MEM_TAG_TF), AOM_MEM_TAG_TPL);
+  void *const b = aom_memalign(64, 3000);
+  aom_mem_pop_tag(AOM_MEM_TAG_TPL);
+  aom_mem_pop_tag(prev_tag);
+  aom_mem_set_tracker(prev_tracker);
+  // Not charged to the tracker.
+  void *const c = aom_malloc(500);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  ASSERT_NE(c, nullptr);
+
+  aom_memory_usage_t usage;
+  aom_mem_get_usage(&tracker, &usage);
+  // The requested sizes are charged, without the alignment padding.
+  EXPECT_EQ(usage.current_bytes[AOM_MEM_TAG_OTHER], 1000u);
+  EXPECT_EQ(usage.current_bytes[AOM_MEM_TAG_TPL], 3000u);
+  EXPECT_EQ(usage.current_bytes[AOM_MEM_TAG_TF], 0u);
+  EXPECT_EQ(usage.total_current_bytes,
+            usage.current_bytes[AOM_MEM_TAG_OTHER] +
+                usage.current_bytes[AOM_MEM_TAG_TPL]);
+  const uint64_t peak = usage.total_current_bytes;
+
+  // Frees credit the tracker without one being set.
+  aom_free(b);
+  aom_free(c);
+  aom_mem_get_usage(&tracker, &usage);
+  EXPECT_EQ(usage.current_bytes[AOM_MEM_TAG_TPL], 0u);
+  EXPECT_EQ(usage.peak_bytes[AOM_MEM_TAG_TPL], 3000u);
+  EXPECT_EQ(usage.total_peak_bytes, peak);
+  aom_free(a);
+  aom_mem_get_usage(&tracker, &usage);
+  EXPECT_EQ(usage.total_current_bytes, 0u);
+  EXPECT_EQ(usage.total_peak_bytes, peak);
+}
+
+TEST(AomMemTest, HugePages) {
+  const size_t kHugePageSize = 2 << 20;
+  aom_mem_tracker_t tracker = {};
+  aom_mem_tracker_t *const prev_tracker = aom_mem_set_tracker(&tracker);
+  EXPECT_EQ(aom_mem_set_huge_pages(1), 0);
+  uint8_t *const large =
+      static_cast<uint8_t *>(aom_calloc_huge(3, kHugePageSize / 2));
+  uint8_t *const small = static_cast<uint8_t *>(aom_memalign_huge(64, 1000));
+  EXPECT_EQ(aom_mem_set_huge_pages(0), 1);
+  aom_mem_set_tracker(prev_tracker);
+  ASSERT_NE(large, nullptr);
+  ASSERT_NE(small, nullptr);
+#if CONFIG_HUGE_PAGES && defined(__linux__)
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(large) % kHugePageSize, 0u);
+#endif
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(small) % 64, 0u);
+  // The 2 MB alignment of the large buffer is not charged to the tracker.
+  EXPECT_EQ(tracker.total, 3 * kHugePageSize / 2 + 1000);
+  for (size_t i = 0; i < 3 * kHugePageSize / 2; ++i) ASSERT_EQ(large[i], 0);
+  aom_free(large);
+  aom_free(small);
+  EXPECT_EQ(tracker.total, 0u);
+
+  // Huge pages are off by default.
+  void *const x = aom_memalign_huge(32, kHugePageSize);
+  ASSERT_NE(x, nullptr);
+  aom_free(x);
+  EXPECT_EQ(aom_memalign_huge(32, SIZE_MAX), nullptr);
+  EXPECT_EQ(aom_calloc_huge(32, SIZE_MAX / 32), nullptr);
+}
+
+// Reads 8x8 blocks at random positions of 4K sized frame buffers, like motion
+// compensation does, with and without huge pages. Run under
+// "perf stat -e dTLB-loads,dTLB-load-misses" to compare the TLB miss rates.
+TEST(AomMemTest, DISABLED_HugePagesSpeed) {
+  const int kStride = 3840 + 2 * 288;
+  const int kHeight = 2160 + 2 * 288;
+  const int kFrames = 7;
+  const int kBlocks = 4000000;
+  for (int huge_pages = 0; huge_pages < 2; ++huge_pages) {
+    const int prev_huge_pages = aom_mem_set_huge_pages(huge_pages);
+    uint8_t *frames[kFrames];
+    for (auto &frame : frames) {
+      frame = static_cast<uint8_t *>(
+          aom_calloc_huge(static_cast<size_t>(kStride) * kHeight, 1));
+      ASSERT_NE(frame, nullptr);
+    }
+    aom_mem_set_huge_pages(prev_huge_pages);
+
+    // A linear congruential generator keeps the overhead of the positions low.
+    uint32_t state = 1;
+    uint32_t sum = 0;
+    aom_usec_timer timer;
+    aom_usec_timer_start(&timer);
+    for (int i = 0; i < kBlocks; ++i) {
+      state = state * 1664525u + 1013904223u;
+      const uint32_t row = (state >> 8) % (kHeight - 8);
+      state = state * 1664525u + 1013904223u;
+      const uint32_t col = (state >> 8) % (kStride - 8);
+      const uint8_t *const src =
+          frames[i % kFrames] + static_cast<size_t>(row) * kStride + col;
+      for (int r = 0; r < 8; ++r) {
+        for (int c = 0; c < 8; ++c) sum += src[r * kStride + c];
+      }
+    }
+    aom_usec_timer_mark(&timer);
+    printf("huge_pages=%d: %6.2f ms (%u)\n", huge_pages,
+           aom_usec_timer_elapsed(&timer) / 1000.0, sum);
+    for (auto &frame : frames) aom_free(frame);
+  }
+}
+
+TEST(AomArenaTest, AlignmentAndRelease) {
+  aom_arena_t arena = {};
+  const aom_arena_mark_t start = aom_arena_get_mark(&arena);
+  uint8_t *a = static_cast<uint8_t *>(aom_arena_memalign(&arena, 32, 100));
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 32, 0u);
+  memset(a, 1, 100);
+  const aom_arena_mark_t mark = aom_arena_get_mark(&arena);
+  int *b = static_cast<int *>(aom_arena_calloc(&arena, 10, sizeof(*b)));
+  ASSERT_NE(b, nullptr);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(b[i], 0);
+  aom_arena_release(&arena, mark);
+  aom_arena_release(&arena, start);
+  aom_arena_destroy(&arena);
+  EXPECT_EQ(arena.buf, nullptr);
+}
+
+TEST(AomArenaTest, ResetReusesBackingBlock) {
+  aom_arena_t arena = {};
+  // The first frame has no backing block, so all the allocations get chunks.
+  const aom_arena_mark_t mark = aom_arena_get_mark(&arena);
+  void *a = aom_arena_memalign(&arena, 16, 4096);
+  void *b = aom_arena_memalign(&arena, 64, 1000);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 64, 0u);
+  aom_arena_release(&arena, mark);
+  aom_arena_reset(&arena);
+  ASSERT_NE(arena.buf, nullptr);
+  const uint8_t *const buf = arena.buf;
+
+  // The same allocations fit in the backing block after the reset.
+  for (int frame = 0; frame < 3; ++frame) {
+    uint8_t *c = static_cast<uint8_t *>(aom_arena_memalign(&arena, 16, 4096));
+    uint8_t *d = static_cast<uint8_t *>(aom_arena_memalign(&arena, 64, 1000));
+    ASSERT_NE(c, nullptr);
+    ASSERT_NE(d, nullptr);
+    EXPECT_GE(c, buf);
+    EXPECT_LE(d + 1000, buf + arena.size);
+    EXPECT_EQ(arena.chunks, nullptr);
+    aom_arena_reset(&arena);
+    EXPECT_EQ(arena.buf, buf);
+  }
+  aom_arena_destroy(&arena);
+}
+
+TEST(AomArenaTest, ResetShrinksBackingBlock) {
+  aom_arena_t arena = {};
+  // The peak includes the alignment padding of the chunk.
+  ASSERT_NE(aom_arena_memalign(&arena, 16, 100000), nullptr);
+  aom_arena_reset(&arena);
+  const size_t size = arena.size;
+  EXPECT_GE(size, 100000u);
+
+  // A frame that uses at least half of the block keeps it.
+  ASSERT_NE(aom_arena_memalign(&arena, 16, 60000), nullptr);
+  aom_arena_reset(&arena);
+  EXPECT_EQ(arena.size, size);
+
+  // A frame that uses less than half of the block shrinks it.
+  ASSERT_NE(aom_arena_memalign(&arena, 16, 10000), nullptr);
+  aom_arena_reset(&arena);
+  EXPECT_EQ(arena.size, 10000u);
+
+  // A reset without any use keeps it.
+  aom_arena_reset(&arena);
+  EXPECT_NE(arena.buf, nullptr);
+  EXPECT_EQ(arena.size, 10000u);
+  aom_arena_destroy(&arena);
+}
+
+TEST(AomArenaTest, Overflow) {
+  aom_arena_t arena = {};
+  ASSERT_EQ(aom_arena_memalign(&arena, 64, SIZE_MAX), nullptr);
+  ASSERT_EQ(aom_arena_calloc(&arena, 32, SIZE_MAX / 32), nullptr);
+  ASSERT_EQ(aom_arena_calloc(&arena, SIZE_MAX, SIZE_MAX), nullptr);
+  aom_arena_destroy(&arena);
+}
@@ -416,6 +416,13 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(kBlockDim)));
 #endif  // HAVE_SSE4_1
 
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, LowBDConvolveScaleTest,
+    ::testing::Combine(::testing::Values(av1_convolve_2d_scale_avx2),
+                       ::testing::ValuesIn(kBlockDim)));
+#endif  // HAVE_AVX2
+
 #if CONFIG_AV1_HIGHBITDEPTH
 typedef void (*HighbdConvolveFunc)(const uint16_t *src, int src_stride,
                                    uint16_t *dst, int dst_stride, int w, int h,
@@ -486,6 +493,14 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(kBDs)));
 #endif  // HAVE_SSE4_1
 
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, HighBDConvolveScaleTest,
+    ::testing::Combine(::testing::Values(av1_highbd_convolve_2d_scale_avx2),
+                       ::testing::ValuesIn(kBlockDim),
+                       ::testing::ValuesIn(kBDs)));
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, HighBDConvolveScaleTest,
@@ -423,6 +423,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1ConvolveXTest,
                          BuildLowbdParams(av1_convolve_x_sr_avx2));
 #endif
 
+#if HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1ConvolveXTest,
+                         BuildLowbdParams(av1_convolve_x_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1ConvolveXTest,
                          BuildLowbdParams(av1_convolve_x_sr_neon));
@@ -827,6 +832,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1ConvolveYTest,
                          BuildLowbdParams(av1_convolve_y_sr_avx2));
 #endif
 
+#if HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1ConvolveYTest,
+                         BuildLowbdParams(av1_convolve_y_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1ConvolveYTest,
                          BuildLowbdParams(av1_convolve_y_sr_neon));
@@ -1318,6 +1328,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1Convolve2DTest,
                          BuildLowbdParams(av1_convolve_2d_sr_avx2));
 #endif
 
+#if HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1Convolve2DTest,
+                         BuildLowbdParams(av1_convolve_2d_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1Convolve2DTest,
                          BuildLowbdParams(av1_convolve_2d_sr_neon));
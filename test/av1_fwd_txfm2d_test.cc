@@ -676,6 +676,14 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1HighbdFwdTxfm2dTest,
                                  Values(av1_highbd_fwd_txfm)));
 #endif  // HAVE_AVX2
 
+#if HAVE_AVX512
+static TX_SIZE Highbd_fwd_txfm_for_avx512[] = { TX_32X32, TX_64X64 };
+
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1HighbdFwdTxfm2dTest,
+                         Combine(ValuesIn(Highbd_fwd_txfm_for_avx512),
+                                 Values(av1_highbd_fwd_txfm)));
+#endif  // HAVE_AVX512
+
 #if HAVE_NEON
 static TX_SIZE Highbd_fwd_txfm_for_neon[] = {
   TX_4X4,  TX_8X8,  TX_16X16, TX_32X32, TX_64X64, TX_4X8,   TX_8X4,
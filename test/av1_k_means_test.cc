@@ -251,6 +251,181 @@ TEST_P(AV1KmeansTest2, DISABLED_Speed) {
   RunSpeedTest(GET_PARAM(0), GET_PARAM(1), 8);
 }
 
+typedef void (*av1_calc_indices_sums_func)(const int16_t *data,
+                                           const int16_t *centroids,
+                                           uint8_t *indices,
+                                           int64_t *total_dist, int *sums,
+                                           int *counts, int n, int k);
+
+// Reference function, function under test, data dimension and block size.
+typedef std::tuple<av1_calc_indices_sums_func, av1_calc_indices_sums_func, int,
+                   BLOCK_SIZE>
+    av1_calc_indices_sumsParam;
+
+class AV1KmeansSumsTest
+    : public ::testing::TestWithParam<av1_calc_indices_sumsParam> {
+ public:
+  void SetUp() override {
+    rnd_.Reset(libaom_test::ACMRandom::DeterministicSeed());
+    // Up to 12-bit data, as in high bitdepth encodes.
+    for (int i = 0; i < 4096 * 2; ++i) data_[i] = rnd_.Rand16() & 0xfff;
+  }
+
+ protected:
+  void RunCheckOutput(int k) {
+    const av1_calc_indices_sums_func ref_impl = GET_PARAM(0);
+    const av1_calc_indices_sums_func test_impl = GET_PARAM(1);
+    const int dim = GET_PARAM(2);
+    const BLOCK_SIZE bsize = GET_PARAM(3);
+    const int n = block_size_wide[bsize] * block_size_high[bsize];
+    // Use some data points as centroids, so that some clusters may be left
+    // empty when they repeat.
+    for (int i = 0; i < k * dim; ++i) {
+      centroids_[i] = data_[rnd_.PseudoUniform(n * dim)];
+    }
+    int64_t ref_dist, test_dist;
+    int ref_sums[8 * 2], test_sums[8 * 2];
+    int ref_counts[8], test_counts[8];
+    ref_impl(data_, centroids_, indices1_, &ref_dist, ref_sums, ref_counts, n,
+             k);
+    API_REGISTER_STATE_CHECK(test_impl(data_, centroids_, indices2_,
+                                       &test_dist, test_sums, test_counts, n,
+                                       k));
+    ASSERT_EQ(ref_dist, test_dist) << "block " << bsize << " k " << k;
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(indices1_[i], indices2_[i]) << "index " << i;
+    }
+    for (int j = 0; j < k; ++j) {
+      ASSERT_EQ(ref_counts[j], test_counts[j]) << "cluster " << j;
+      for (int d = 0; d < dim; ++d) {
+        ASSERT_EQ(ref_sums[j * dim + d], test_sums[j * dim + d])
+            << "cluster " << j << " dim " << d;
+      }
+    }
+  }
+
+  libaom_test::ACMRandom rnd_;
+  int16_t data_[4096 * 2];
+  int16_t centroids_[8 * 2];
+  uint8_t indices1_[4096];
+  uint8_t indices2_[4096];
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(AV1KmeansSumsTest);
+
+TEST_P(AV1KmeansSumsTest, CheckOutput) {
+  for (int k = 2; k <= 8; ++k) RunCheckOutput(k);
+}
+
+typedef void (*av1_count_colors_func)(const uint8_t *src, int stride, int rows,
+                                      int cols, int *val_count,
+                                      int *num_colors);
+typedef void (*av1_count_colors_highbd_func)(const uint8_t *src8, int stride,
+                                             int rows, int cols, int bit_depth,
+                                             int *val_count,
+                                             int *bin_val_count,
+                                             int *num_color_bins,
+                                             int *num_colors);
+
+typedef std::tuple<av1_count_colors_func, av1_count_colors_highbd_func,
+                   BLOCK_SIZE>
+    av1_count_colorsParam;
+
+// Checks the color counts of blocks with random pixels, with runs of a few
+// colors as in screen content, and with a single color.
+class AV1CountColorsTest
+    : public ::testing::TestWithParam<av1_count_colorsParam> {
+ public:
+  void SetUp() override {
+    rnd_.Reset(libaom_test::ACMRandom::DeterministicSeed());
+  }
+
+ protected:
+  static const int kStride = 80;
+
+  void FillBlock(int mode, int max_val, int rows, int cols) {
+    int colors[4];
+    for (int i = 0; i < 4; ++i) colors[i] = rnd_.PseudoUniform(max_val + 1);
+    int run = 0;
+    int color = colors[0];
+    for (int r = 0; r < rows; ++r) {
+      for (int c = 0; c < cols; ++c) {
+        if (mode == 0) {
+          color = rnd_.PseudoUniform(max_val + 1);
+        } else if (mode == 1 && run-- == 0) {
+          run = rnd_.PseudoUniform(48);
+          color = colors[rnd_.PseudoUniform(4)];
+        }
+        pixels_[r * kStride + c] = color;
+      }
+    }
+  }
+
+  void RunCheckOutput() {
+    const av1_count_colors_func test_impl = GET_PARAM(0);
+    const BLOCK_SIZE bsize = GET_PARAM(2);
+    const int rows = block_size_high[bsize];
+    const int cols = block_size_wide[bsize];
+    for (int mode = 0; mode < 3; ++mode) {
+      FillBlock(mode, 255, rows, cols);
+      uint8_t src[64 * kStride];
+      for (int i = 0; i < rows * kStride; ++i) src[i] = (uint8_t)pixels_[i];
+      int ref_colors, test_colors;
+      av1_count_colors_c(src, kStride, rows, cols, ref_count_, &ref_colors);
+      API_REGISTER_STATE_CHECK(
+          test_impl(src, kStride, rows, cols, test_count_, &test_colors));
+      ASSERT_EQ(ref_colors, test_colors) << "mode " << mode;
+      for (int i = 0; i < 256; ++i) {
+        ASSERT_EQ(ref_count_[i], test_count_[i]) << "mode " << mode;
+      }
+    }
+  }
+
+  void RunCheckOutputHighbd(int bit_depth, bool count_all) {
+    const av1_count_colors_highbd_func test_impl = GET_PARAM(1);
+    const BLOCK_SIZE bsize = GET_PARAM(2);
+    const int rows = block_size_high[bsize];
+    const int cols = block_size_wide[bsize];
+    const uint8_t *const src8 = CONVERT_TO_BYTEPTR(pixels_);
+    for (int mode = 0; mode < 3; ++mode) {
+      FillBlock(mode, (1 << bit_depth) - 1, rows, cols);
+      int ref_bins, test_bins;
+      int ref_colors = -1, test_colors = -1;
+      av1_count_colors_highbd_c(src8, kStride, rows, cols, bit_depth,
+                                count_all ? ref_count_ : nullptr,
+                                ref_bin_count_, &ref_bins, &ref_colors);
+      API_REGISTER_STATE_CHECK(test_impl(
+          src8, kStride, rows, cols, bit_depth,
+          count_all ? test_count_ : nullptr, test_bin_count_, &test_bins,
+          &test_colors));
+      ASSERT_EQ(ref_bins, test_bins) << "mode " << mode;
+      ASSERT_EQ(ref_colors, test_colors) << "mode " << mode;
+      for (int i = 0; i < 256; ++i) {
+        ASSERT_EQ(ref_bin_count_[i], test_bin_count_[i]) << "mode " << mode;
+      }
+      for (int i = 0; count_all && i < (1 << bit_depth); ++i) {
+        ASSERT_EQ(ref_count_[i], test_count_[i]) << "mode " << mode;
+      }
+    }
+  }
+
+  libaom_test::ACMRandom rnd_;
+  uint16_t pixels_[64 * kStride];
+  int ref_count_[1 << 12];
+  int test_count_[1 << 12];
+  int ref_bin_count_[1 << 8];
+  int test_bin_count_[1 << 8];
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(AV1CountColorsTest);
+
+TEST_P(AV1CountColorsTest, CheckOutput) { RunCheckOutput(); }
+
+TEST_P(AV1CountColorsTest, CheckOutputHighbd) {
+  for (int bit_depth : { 8, 10, 12 }) {
+    RunCheckOutputHighbd(bit_depth, /*count_all=*/true);
+    RunCheckOutputHighbd(bit_depth, /*count_all=*/false);
+  }
+}
+
 #if HAVE_SSE2 || HAVE_AVX2 || HAVE_NEON
 const BLOCK_SIZE kValidBlockSize[] = { BLOCK_8X8,   BLOCK_8X16,  BLOCK_8X32,
                                        BLOCK_16X8,  BLOCK_16X16, BLOCK_16X32,
@@ -279,6 +454,23 @@ INSTANTIATE_TEST_SUITE_P(
     AVX2, AV1KmeansTest2,
     ::testing::Combine(::testing::Values(&av1_calc_indices_dim2_avx2),
                        ::testing::ValuesIn(kValidBlockSize)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX2_DIM1, AV1KmeansSumsTest,
+    ::testing::Combine(::testing::Values(&av1_calc_indices_sums_dim1_c),
+                       ::testing::Values(&av1_calc_indices_sums_dim1_avx2),
+                       ::testing::Values(1),
+                       ::testing::ValuesIn(kValidBlockSize)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX2_DIM2, AV1KmeansSumsTest,
+    ::testing::Combine(::testing::Values(&av1_calc_indices_sums_dim2_c),
+                       ::testing::Values(&av1_calc_indices_sums_dim2_avx2),
+                       ::testing::Values(2),
+                       ::testing::ValuesIn(kValidBlockSize)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, AV1CountColorsTest,
+    ::testing::Combine(::testing::Values(&av1_count_colors_avx2),
+                       ::testing::Values(&av1_count_colors_highbd_avx2),
+                       ::testing::ValuesIn(kValidBlockSize)));
 #endif
 
 #if HAVE_NEON
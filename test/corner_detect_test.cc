@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/flow_estimation/corner_detect.h"
+#include "aom_ports/aom_timer.h"
+#include "test/acm_random.h"
+#include "test/register_state_check.h"
+#include "test/util.h"
+
+extern "C" {
+#include "third_party/fastfeat/fast.h"
+}
+
+namespace {
+
+using libaom_test::ACMRandom;
+
+const int kThreshold = 18;  // FAST_BARRIER in corner_detect.c.
+
+enum ImageType { kNoise, kLowContrast, kBinary, kRectangles, kNumImageTypes };
+
+// Fills a width x height image with the given content.
+void FillImage(ACMRandom *rnd, ImageType type, int width, int height,
+               int stride, uint8_t *buf) {
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      uint8_t v = 0;
+      switch (type) {
+        case kNoise: v = rnd->Rand8(); break;
+        // Differences from the center hover around the threshold.
+        case kLowContrast: v = 110 + rnd->PseudoUniform(2 * kThreshold); break;
+        case kBinary: v = rnd->Rand8() < 128 ? 0 : 255; break;
+        default: v = 128 + rnd->PseudoUniform(5); break;
+      }
+      buf[y * stride + x] = v;
+    }
+  }
+  if (type != kRectangles) return;
+  // Flat, overlapping rectangles give isolated corners with equal scores.
+  const int num_rects = (width * height) / 256 + 1;
+  for (int i = 0; i < num_rects; ++i) {
+    const int x0 = rnd->PseudoUniform(width);
+    const int y0 = rnd->PseudoUniform(height);
+    const int rect_w = 1 + rnd->PseudoUniform(24);
+    const int rect_h = 1 + rnd->PseudoUniform(24);
+    const int x1 = AOMMIN(width, x0 + rect_w);
+    const int y1 = AOMMIN(height, y0 + rect_h);
+    const uint8_t v = rnd->Rand8();
+    for (int y = y0; y < y1; ++y) {
+      for (int x = x0; x < x1; ++x) buf[y * stride + x] = v;
+    }
+  }
+}
+
+// Runs fastfeat and applies the same selection of the strongest corners as
+// av1_fast9_detect_corners(). Returns the number of corners.
+int ReferenceDetect(const uint8_t *buf, int width, int height, int stride,
+                    int max_corners, std::vector<int> *out_xy) {
+  int *scores = nullptr;
+  int num_corners = 0;
+  xy *const corners = aom_fast9_detect_nonmax(
+      buf, width, height, stride, kThreshold, &scores, &num_corners);
+  if (num_corners <= 0) return num_corners;
+
+  int score_threshold = -1;
+  if (num_corners > max_corners) {
+    int histogram[256] = { 0 };
+    for (int i = 0; i < num_corners; ++i) histogram[scores[i]] += 1;
+    int found_corners = 0;
+    for (int bucket = 255; bucket >= 0; bucket--) {
+      if (found_corners + histogram[bucket] > max_corners) {
+        score_threshold = bucket;
+        break;
+      }
+      found_corners += histogram[bucket];
+    }
+  }
+  int num_selected = 0;
+  for (int i = 0; i < num_corners; ++i) {
+    if (scores[i] > score_threshold) {
+      (*out_xy)[2 * num_selected + 0] = corners[i].x;
+      (*out_xy)[2 * num_selected + 1] = corners[i].y;
+      num_selected++;
+    }
+  }
+  free(scores);
+  free(corners);
+  return num_selected;
+}
+
+TEST(CornerDetectTest, MatchesFastfeat) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  const int kSizes[][2] = { { 6, 6 },   { 7, 7 },    { 8, 40 },
+                            { 37, 23 }, { 100, 64 }, { 255, 129 } };
+  for (const auto &size : kSizes) {
+    const int width = size[0];
+    const int height = size[1];
+    const int stride = width + 13;
+    std::vector<uint8_t> buf(stride * height);
+    for (int type = 0; type < kNumImageTypes; ++type) {
+      FillImage(&rnd, static_cast<ImageType>(type), width, height, stride,
+                buf.data());
+      // Keep every corner, then only the strongest few.
+      for (const int max_corners : { width * height, 50 }) {
+        SCOPED_TRACE(testing::Message() << width << "x" << height << " type "
+                                        << type << " max " << max_corners);
+        std::vector<int> ref_xy(2 * width * height);
+        std::vector<int> tst_xy(2 * width * height);
+        const int ref_num = ReferenceDetect(buf.data(), width, height, stride,
+                                            max_corners, &ref_xy);
+        const int tst_num =
+            av1_fast9_detect_corners(buf.data(), width, height, stride,
+                                     kThreshold, max_corners, tst_xy.data());
+        ASSERT_EQ(ref_num, tst_num);
+        for (int i = 0; i < 2 * ref_num; ++i) {
+          ASSERT_EQ(ref_xy[i], tst_xy[i]) << "corner " << i / 2;
+        }
+      }
+    }
+  }
+}
+
+typedef void (*Fast9ScoreRowFunc)(const uint8_t *src, int stride, int width,
+                                  int threshold, uint8_t *scores);
+typedef void (*Fast9NonmaxRowFunc)(const uint8_t *above, const uint8_t *cur,
+                                   const uint8_t *below, int width,
+                                   uint8_t *kept);
+typedef std::tuple<Fast9ScoreRowFunc, Fast9NonmaxRowFunc> Fast9RowParam;
+
+class Fast9RowTest : public ::testing::TestWithParam<Fast9RowParam> {
+ protected:
+  static const int kWidth = 256;
+  static const int kHeight = 16;
+  static const int kStride = kWidth + 2 * FAST_RADIUS;
+
+  void SetUp() override {
+    rnd_.Reset(ACMRandom::DeterministicSeed());
+    score_func_ = GET_PARAM(0);
+    nonmax_func_ = GET_PARAM(1);
+  }
+
+  const uint8_t *Row(int y) const {
+    return &image_[(y + FAST_RADIUS) * kStride + FAST_RADIUS];
+  }
+
+  ACMRandom rnd_;
+  Fast9ScoreRowFunc score_func_;
+  Fast9NonmaxRowFunc nonmax_func_;
+  uint8_t image_[(kHeight + 2 * FAST_RADIUS) * kStride];
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Fast9RowTest);
+
+TEST_P(Fast9RowTest, ScoreMatchesC) {
+  for (int type = 0; type < kNumImageTypes; ++type) {
+    FillImage(&rnd_, static_cast<ImageType>(type), kStride,
+              kHeight + 2 * FAST_RADIUS, kStride, image_);
+    for (int y = 0; y < kHeight; ++y) {
+      // Odd widths leave a tail for the C code.
+      const int width = y == 0 ? kWidth : 1 + rnd_.PseudoUniform(kWidth);
+      const int threshold = 1 + rnd_.PseudoUniform(64);
+      uint8_t ref[kWidth];
+      uint8_t tst[kWidth];
+      aom_fast9_score_row_c(Row(y), kStride, width, threshold, ref);
+      API_REGISTER_STATE_CHECK(
+          score_func_(Row(y), kStride, width, threshold, tst));
+      for (int x = 0; x < width; ++x) {
+        ASSERT_EQ(ref[x], tst[x]) << "type " << type << " at (" << x << ", "
+                                  << y << ") threshold " << threshold;
+      }
+    }
+  }
+}
+
+TEST_P(Fast9RowTest, NonmaxMatchesC) {
+  // Sparse scores with many ties, like a real score map.
+  for (int i = 0; i < (kHeight + 2 * FAST_RADIUS) * kStride; ++i) {
+    image_[i] = rnd_.Rand8() < 64 ? kThreshold + rnd_.PseudoUniform(4) : 0;
+  }
+  for (int y = 0; y < kHeight; ++y) {
+    const int width = y == 0 ? kWidth : 1 + rnd_.PseudoUniform(kWidth);
+    uint8_t ref[kWidth];
+    uint8_t tst[kWidth];
+    aom_fast9_nonmax_row_c(Row(y - 1), Row(y), Row(y + 1), width, ref);
+    API_REGISTER_STATE_CHECK(
+        nonmax_func_(Row(y - 1), Row(y), Row(y + 1), width, tst));
+    for (int x = 0; x < width; ++x) {
+      ASSERT_EQ(ref[x], tst[x]) << "at (" << x << ", " << y << ")";
+    }
+  }
+}
+
+TEST_P(Fast9RowTest, DISABLED_Speed) {
+  const int kIters = 20000;
+  uint8_t scores[kWidth];
+  FillImage(&rnd_, kRectangles, kStride, kHeight + 2 * FAST_RADIUS, kStride,
+            image_);
+  const Fast9ScoreRowFunc funcs[2] = { aom_fast9_score_row_c, score_func_ };
+  double elapsed[2];
+  for (int f = 0; f < 2; ++f) {
+    aom_usec_timer timer;
+    aom_usec_timer_start(&timer);
+    for (int i = 0; i < kIters; ++i) {
+      for (int y = 0; y < kHeight; ++y) {
+        funcs[f](Row(y), kStride, kWidth, kThreshold, scores);
+      }
+    }
+    aom_usec_timer_mark(&timer);
+    elapsed[f] = static_cast<double>(aom_usec_timer_elapsed(&timer));
+  }
+  printf("fast9_score_row: ref %.0f us, test %.0f us, %.2fx\n", elapsed[0],
+         elapsed[1], elapsed[0] / elapsed[1]);
+}
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(AVX2, Fast9RowTest,
+                         ::testing::Values(std::make_tuple(
+                             &aom_fast9_score_row_avx2,
+                             &aom_fast9_nonmax_row_avx2)));
+#endif  // HAVE_AVX2
+
+}  // namespace
@@ -59,4 +59,61 @@ TEST(DecodeAPI, InvalidControlId) {
   EXPECT_EQ(AOM_CODEC_OK, aom_codec_destroy(&dec));
 }
 
+TEST(DecodeAPI, SetOutputFormat) {
+  aom_codec_iface_t *iface = aom_codec_av1_dx();
+  aom_codec_ctx_t dec;
+  EXPECT_EQ(AOM_CODEC_OK, aom_codec_dec_init(&dec, iface, nullptr, 0));
+  EXPECT_EQ(AOM_CODEC_OK, AOM_CODEC_CONTROL_TYPECHECKED(
+                              &dec, AV1D_SET_OUTPUT_FORMAT, AOM_IMG_FMT_NV12));
+  EXPECT_EQ(AOM_CODEC_OK, AOM_CODEC_CONTROL_TYPECHECKED(
+                              &dec, AV1D_SET_OUTPUT_FORMAT, AOM_IMG_FMT_P010));
+  EXPECT_EQ(AOM_CODEC_OK, AOM_CODEC_CONTROL_TYPECHECKED(
+                              &dec, AV1D_SET_OUTPUT_FORMAT, AOM_IMG_FMT_NONE));
+  EXPECT_EQ(AOM_CODEC_INVALID_PARAM,
+            AOM_CODEC_CONTROL_TYPECHECKED(&dec, AV1D_SET_OUTPUT_FORMAT,
+                                          AOM_IMG_FMT_I420));
+  EXPECT_EQ(AOM_CODEC_OK, aom_codec_destroy(&dec));
+}
+
+TEST(DecodeAPI, SetFastDecode) {
+  aom_codec_iface_t *iface = aom_codec_av1_dx();
+  aom_codec_ctx_t dec;
+  EXPECT_EQ(AOM_CODEC_OK, aom_codec_dec_init(&dec, iface, nullptr, 0));
+  for (int level = 0; level <= 3; ++level) {
+    EXPECT_EQ(AOM_CODEC_OK,
+              AOM_CODEC_CONTROL_TYPECHECKED(&dec, AV1D_SET_FAST_DECODE, level));
+  }
+  EXPECT_EQ(AOM_CODEC_INVALID_PARAM,
+            AOM_CODEC_CONTROL_TYPECHECKED(&dec, AV1D_SET_FAST_DECODE, -1));
+  EXPECT_EQ(AOM_CODEC_INVALID_PARAM,
+            AOM_CODEC_CONTROL_TYPECHECKED(&dec, AV1D_SET_FAST_DECODE, 4));
+  EXPECT_EQ(AOM_CODEC_OK, aom_codec_destroy(&dec));
+}
+
+TEST(DecodeAPI, SetPreallocFrameBuffers) {
+  aom_codec_iface_t *iface = aom_codec_av1_dx();
+  aom_codec_ctx_t dec;
+  EXPECT_EQ(AOM_CODEC_OK, aom_codec_dec_init(&dec, iface, nullptr, 0));
+  EXPECT_EQ(AOM_CODEC_OK, AOM_CODEC_CONTROL_TYPECHECKED(
+                              &dec, AV1D_SET_PREALLOC_FRAME_BUFFERS, 1));
+  EXPECT_EQ(AOM_CODEC_OK, AOM_CODEC_CONTROL_TYPECHECKED(
+                              &dec, AV1D_SET_PREALLOC_FRAME_BUFFERS, 0));
+  EXPECT_EQ(AOM_CODEC_OK, aom_codec_destroy(&dec));
+}
+
+TEST(DecodeAPI, GetFrameStats) {
+  aom_codec_iface_t *iface = aom_codec_av1_dx();
+  aom_codec_ctx_t dec;
+  aom_frame_stats frame_stats;
+  EXPECT_EQ(AOM_CODEC_OK, aom_codec_dec_init(&dec, iface, nullptr, 0));
+  // No frame has been decoded yet.
+  EXPECT_EQ(AOM_CODEC_ERROR, AOM_CODEC_CONTROL_TYPECHECKED(
+                                 &dec, AOMD_GET_FRAME_STATS, &frame_stats));
+  EXPECT_EQ(AOM_CODEC_INVALID_PARAM,
+            AOM_CODEC_CONTROL_TYPECHECKED(
+                &dec, AOMD_GET_FRAME_STATS,
+                static_cast<aom_frame_stats *>(nullptr)));
+  EXPECT_EQ(AOM_CODEC_OK, aom_codec_destroy(&dec));
+}
+
 }  // namespace
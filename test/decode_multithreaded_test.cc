@@ -11,7 +11,9 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "aom_mem/aom_mem.h"
 #include "gtest/gtest.h"
@@ -20,6 +22,7 @@
 #include "test/i420_video_source.h"
 #include "test/md5_helper.h"
 #include "test/util.h"
+#include "test/video_source.h"
 
 namespace {
 
@@ -179,4 +182,139 @@ AV1_INSTANTIATE_TEST_SUITE(AV1DecodeMultiThreadedLSTestLarge,
                            ::testing::Values(1), ::testing::Values(0, 3),
                            ::testing::Values(0, 1));
 
+// Smooth random texture that is either static or pans by a fractional
+// amount every frame, so most blocks share one translational motion vector.
+class PanningVideoSource : public ::libaom_test::DummyVideoSource {
+ public:
+  static const int kTexSize = 1024;
+
+  PanningVideoSource(int dx_q4, int dy_q4) : dx_q4_(dx_q4), dy_q4_(dy_q4) {
+    ::libaom_test::ACMRandom rnd(::libaom_test::ACMRandom::DeterministicSeed());
+    // Bilinearly interpolated 8x8 lattice of random values.
+    const int lattice = kTexSize / 8 + 1;
+    std::vector<uint8_t> grid(lattice * lattice);
+    for (uint8_t &v : grid) v = rnd.Rand8();
+    texture_.resize(kTexSize * kTexSize);
+    for (int y = 0; y < kTexSize; ++y) {
+      for (int x = 0; x < kTexSize; ++x) {
+        const int gx = x >> 3, gy = y >> 3, fx = x & 7, fy = y & 7;
+        const uint8_t *g = &grid[gy * lattice + gx];
+        const int top = g[0] * (8 - fx) + g[1] * fx;
+        const int bottom = g[lattice] * (8 - fx) + g[lattice + 1] * fx;
+        texture_[y * kTexSize + x] = (top * (8 - fy) + bottom * fy + 32) >> 6;
+      }
+    }
+    SetSize(352, 288);
+    set_limit(10);
+  }
+
+ protected:
+  void FillFrame() override {
+    if (!img_) return;
+    const int off_x = frame_ * dx_q4_, off_y = frame_ * dy_q4_;
+    for (int plane = 0; plane < 3; ++plane) {
+      const int ss = plane ? 1 : 0;
+      const int w = (img_->d_w + ss) >> ss, h = (img_->d_h + ss) >> ss;
+      for (int y = 0; y < h; ++y) {
+        uint8_t *row = img_->planes[plane] + y * img_->stride[plane];
+        for (int x = 0; x < w; ++x) {
+          // Position in 1/16 pel, with the chroma planes sampling a shifted
+          // part of the texture.
+          const int px = (x << (4 + ss)) + off_x + plane * 1600;
+          const int py = (y << (4 + ss)) + off_y;
+          const int tx = (px >> 4) % (kTexSize - 1);
+          const int ty = (py >> 4) % (kTexSize - 1);
+          const int fx = px & 15, fy = py & 15;
+          const uint8_t *t = &texture_[ty * kTexSize + tx];
+          const int top = t[0] * (16 - fx) + t[1] * fx;
+          const int bottom = t[kTexSize] * (16 - fx) + t[kTexSize + 1] * fx;
+          row[x] = (top * (16 - fy) + bottom * fy + 128) >> 8;
+        }
+      }
+    }
+  }
+
+ private:
+  int dx_q4_;
+  int dy_q4_;
+  std::vector<uint8_t> texture_;
+};
+
+// Row-based multithreaded decoding reconstructs a superblock after it has
+// been parsed and merges the inter prediction of partitions whose blocks
+// share the same motion. Single-threaded decoding predicts every block on
+// its own, so the two must produce identical output. Partitions are capped
+// at 16x16 so that larger areas with a single motion are coded as split
+// partitions, which are the ones that get merged. The encoder is allowed to
+// use OBMC, warped motion and masked compound so merged partitions end up
+// next to blocks that cannot be merged.
+class AV1DecodeMergedMcTest
+    : public ::libaom_test::CodecTestWith2Params<int, int>,
+      public ::libaom_test::EncoderTest {
+ protected:
+  AV1DecodeMergedMcTest()
+      : EncoderTest(GET_PARAM(0)), pan_(GET_PARAM(1)),
+        enable_global_motion_(GET_PARAM(2)) {
+    aom_codec_dec_cfg_t cfg = aom_codec_dec_cfg_t();
+    cfg.allow_lowbitdepth = 1;
+    cfg.threads = 1;
+    single_thread_dec_.reset(codec_->CreateDecoder(cfg, 0));
+    cfg.threads = 4;
+    row_mt_dec_.reset(codec_->CreateDecoder(cfg, 0));
+    row_mt_dec_->Control(AV1D_SET_ROW_MT, 1);
+  }
+
+  void SetUp() override { InitializeConfig(libaom_test::kTwoPassGood); }
+
+  void PreEncodeFrameHook(libaom_test::VideoSource *video,
+                          libaom_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(AOME_SET_CPUUSED, 3);
+      encoder->Control(AV1E_SET_ENABLE_OBMC, 1);
+      encoder->Control(AV1E_SET_ENABLE_WARPED_MOTION, 1);
+      encoder->Control(AV1E_SET_ENABLE_MASKED_COMP, 1);
+      encoder->Control(AV1E_SET_ENABLE_GLOBAL_MOTION, enable_global_motion_);
+      encoder->Control(AV1E_SET_MAX_PARTITION_SIZE, 16);
+    }
+  }
+
+  void UpdateMD5(::libaom_test::Decoder *dec, const aom_codec_cx_pkt_t *pkt,
+                 ::libaom_test::MD5 *md5) {
+    const aom_codec_err_t res = dec->DecodeFrame(
+        reinterpret_cast<uint8_t *>(pkt->data.frame.buf), pkt->data.frame.sz);
+    if (res != AOM_CODEC_OK) {
+      abort_ = true;
+      ASSERT_EQ(AOM_CODEC_OK, res);
+    }
+    ::libaom_test::DxDataIterator dec_iter = dec->GetDxData();
+    while (const aom_image_t *img = dec_iter.Next()) md5->Add(img);
+  }
+
+  void FramePktHook(const aom_codec_cx_pkt_t *pkt) override {
+    UpdateMD5(single_thread_dec_.get(), pkt, &md5_single_thread_);
+    UpdateMD5(row_mt_dec_.get(), pkt, &md5_row_mt_);
+  }
+
+  int pan_;
+  int enable_global_motion_;
+  std::unique_ptr<::libaom_test::Decoder> single_thread_dec_;
+  std::unique_ptr<::libaom_test::Decoder> row_mt_dec_;
+  ::libaom_test::MD5 md5_single_thread_;
+  ::libaom_test::MD5 md5_row_mt_;
+};
+
+TEST_P(AV1DecodeMergedMcTest, MD5Match) {
+  cfg_.rc_target_bitrate = 800;
+  cfg_.g_lag_in_frames = 12;
+  cfg_.rc_end_usage = AOM_VBR;
+
+  // Static content, or a pan of 1.25 pel right and 0.5 pel down per frame.
+  PanningVideoSource video(pan_ ? 20 : 0, pan_ ? 8 : 0);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  ASSERT_STREQ(md5_single_thread_.Get(), md5_row_mt_.Get());
+}
+
+AV1_INSTANTIATE_TEST_SUITE(AV1DecodeMergedMcTest, ::testing::Values(0, 1),
+                           ::testing::Values(0, 1));
+
 }  // namespace
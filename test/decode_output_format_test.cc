@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <memory>
+#include <ostream>
+
+#include "gtest/gtest.h"
+
+#include "config/aom_config.h"
+#include "aom/aomdx.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/util.h"
+#include "test/y4m_video_source.h"
+
+namespace {
+
+const int kFrames = 5;
+
+struct OutputFormatParam {
+  const char *filename;
+  unsigned int bit_depth;
+  aom_img_fmt_t output_fmt;
+};
+
+std::ostream &operator<<(std::ostream &os, const OutputFormatParam &p) {
+  return os << "file: " << p.filename << " output_fmt: " << p.output_fmt;
+}
+
+const OutputFormatParam kOutputFormatParams[] = {
+  { "park_joy_90p_8_420.y4m", 8, AOM_IMG_FMT_NV12 },
+#if CONFIG_AV1_HIGHBITDEPTH
+  { "park_joy_90p_10_420.y4m", 10, AOM_IMG_FMT_P010 },
+#endif
+};
+
+// Decodes with AV1D_SET_OUTPUT_FORMAT and checks the interleaved output
+// against the planar reconstruction of the encoder.
+class DecodeOutputFormatTest
+    : public ::libaom_test::CodecTestWithParam<OutputFormatParam>,
+      public ::libaom_test::EncoderTest {
+ protected:
+  DecodeOutputFormatTest()
+      : EncoderTest(GET_PARAM(0)), param_(GET_PARAM(1)), frames_checked_(0) {}
+
+  ~DecodeOutputFormatTest() override = default;
+
+  void SetUp() override { InitializeConfig(::libaom_test::kRealTime); }
+
+  void PreEncodeFrameHook(::libaom_test::VideoSource *video,
+                          ::libaom_test::Encoder *encoder) override {
+    if (video->frame() == 0) encoder->Control(AOME_SET_CPUUSED, 9);
+  }
+
+  bool HandleDecodeResult(const aom_codec_err_t res_dec,
+                          ::libaom_test::Decoder *decoder) override {
+    EXPECT_EQ(AOM_CODEC_OK, res_dec) << decoder->DecodeError();
+    // The format is applied when the frame is read out of the decoder, which
+    // happens after this hook.
+    decoder->Control(AV1D_SET_OUTPUT_FORMAT,
+                     static_cast<int>(param_.output_fmt));
+    return AOM_CODEC_OK == res_dec;
+  }
+
+  // The decoded image never has the format of the encoder's reconstruction,
+  // so every decoded frame is compared here.
+  void MismatchHook(const aom_image_t *img_enc,
+                    const aom_image_t *img_dec) override {
+    CheckInterleavedImage(img_enc, img_dec);
+  }
+
+  // Checks that img_dec is the planar image img converted to the output
+  // format.
+  void CheckInterleavedImage(const aom_image_t *img,
+                             const aom_image_t *img_dec) {
+    ASSERT_EQ(img_dec->fmt, param_.output_fmt);
+    ASSERT_EQ(img_dec->bit_depth, param_.bit_depth);
+    ASSERT_EQ(img_dec->d_w, img->d_w);
+    ASSERT_EQ(img_dec->d_h, img->d_h);
+    ASSERT_EQ(img_dec->planes[AOM_PLANE_V], nullptr);
+
+    const int shift = img_dec->fmt == AOM_IMG_FMT_P010
+                          ? 16 - static_cast<int>(param_.bit_depth)
+                          : 0;
+    for (int plane = AOM_PLANE_Y; plane <= AOM_PLANE_V; ++plane) {
+      const int w = aom_img_plane_width(img, plane);
+      const int h = aom_img_plane_height(img, plane);
+      for (int r = 0; r < h; ++r) {
+        for (int c = 0; c < w; ++c) {
+          const int expected = GetSample(img, plane, r, c) << shift;
+          const int actual =
+              plane == AOM_PLANE_Y
+                  ? GetSample(img_dec, AOM_PLANE_Y, r, c)
+                  : GetSample(img_dec, AOM_PLANE_U, r,
+                              2 * c + (plane == AOM_PLANE_V));
+          ASSERT_EQ(expected, actual)
+              << "plane: " << plane << " row: " << r << " col: " << c;
+        }
+      }
+    }
+    ++frames_checked_;
+  }
+
+  static int GetSample(const aom_image_t *img, int plane, int row, int col) {
+    const uint8_t *buf = img->planes[plane] + row * img->stride[plane];
+    if (img->fmt & AOM_IMG_FMT_HIGHBITDEPTH) {
+      return reinterpret_cast<const uint16_t *>(buf)[col];
+    }
+    return buf[col];
+  }
+
+  void DoTest() {
+    cfg_.g_profile = 0;
+    cfg_.g_bit_depth = static_cast<aom_bit_depth_t>(param_.bit_depth);
+    cfg_.g_input_bit_depth = param_.bit_depth;
+    if (param_.bit_depth > 8) init_flags_ = AOM_CODEC_USE_HIGHBITDEPTH;
+
+    ::libaom_test::Y4mVideoSource video(param_.filename, 0, kFrames);
+    ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+    EXPECT_EQ(frames_checked_, kFrames);
+  }
+
+  const OutputFormatParam param_;
+  int frames_checked_;
+};
+
+TEST_P(DecodeOutputFormatTest, MatchesPlanarOutput) { DoTest(); }
+
+AV1_INSTANTIATE_TEST_SUITE(DecodeOutputFormatTest,
+                           ::testing::ValuesIn(kOutputFormatParams));
+
+// Film grain is written directly in the output format. Checks the result
+// against the planar film grain output of a second decoder.
+class DecodeOutputFormatGrainTest : public DecodeOutputFormatTest {
+ protected:
+  DecodeOutputFormatGrainTest() : planar_img_(nullptr) {
+    aom_codec_dec_cfg_t cfg = aom_codec_dec_cfg_t();
+    cfg.allow_lowbitdepth = 1;
+    planar_dec_.reset(codec_->CreateDecoder(cfg, 0));
+  }
+
+  void PreEncodeFrameHook(::libaom_test::VideoSource *video,
+                          ::libaom_test::Encoder *encoder) override {
+    DecodeOutputFormatTest::PreEncodeFrameHook(video, encoder);
+    if (video->frame() == 0) {
+      encoder->Control(AV1E_SET_FILM_GRAIN_TEST_VECTOR, 1);
+    }
+  }
+
+  void FramePktHook(const aom_codec_cx_pkt_t *pkt) override {
+    const aom_codec_err_t res = planar_dec_->DecodeFrame(
+        reinterpret_cast<uint8_t *>(pkt->data.frame.buf), pkt->data.frame.sz);
+    ASSERT_EQ(AOM_CODEC_OK, res) << planar_dec_->DecodeError();
+    ::libaom_test::DxDataIterator dec_iter = planar_dec_->GetDxData();
+    planar_img_ = dec_iter.Next();
+    ASSERT_NE(planar_img_, nullptr);
+  }
+
+  void MismatchHook(const aom_image_t * /*img_enc*/,
+                    const aom_image_t *img_dec) override {
+    ASSERT_NE(planar_img_, nullptr);
+    CheckInterleavedImage(planar_img_, img_dec);
+  }
+
+  std::unique_ptr<::libaom_test::Decoder> planar_dec_;
+  // Output of planar_dec_ for the last frame, valid until its next decode.
+  const aom_image_t *planar_img_;
+};
+
+TEST_P(DecodeOutputFormatGrainTest, MatchesPlanarGrainOutput) { DoTest(); }
+
+AV1_INSTANTIATE_TEST_SUITE(DecodeOutputFormatGrainTest,
+                           ::testing::ValuesIn(kOutputFormatParams));
+
+}  // namespace
@@ -9,10 +9,13 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include <cmath>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "aom/aom_codec.h"
+#include "aom/aomdx.h"
 #include "aom_ports/aom_timer.h"
 #include "common/ivfenc.h"
 #include "test/codec_factory.h"
@@ -242,4 +245,139 @@ TEST_P(AV1NewEncodeDecodePerfTest, PerfTest) {
 
 AV1_INSTANTIATE_TEST_SUITE(AV1NewEncodeDecodePerfTest,
                            ::testing::Values(::libaom_test::kTwoPassGood));
+
+/*
+ Measures the speed of each AV1D_SET_FAST_DECODE level and the drift of its
+ output from the normative decode, as luma PSNR against the level 0 output.
+ */
+class AV1FastDecodePerfTest
+    : public ::libaom_test::CodecTestWithParam<libaom_test::TestMode>,
+      public ::libaom_test::EncoderTest {
+ protected:
+  static const int kMaxFastDecodeLevel = 3;
+
+  AV1FastDecodePerfTest() : EncoderTest(GET_PARAM(0)) {}
+
+  ~AV1FastDecodePerfTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig(GET_PARAM(1));
+    cfg_.g_lag_in_frames = 35;
+    cfg_.rc_end_usage = AOM_VBR;
+  }
+
+  void PreEncodeFrameHook(::libaom_test::VideoSource *video,
+                          ::libaom_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(AOME_SET_CPUUSED, 5);
+      encoder->Control(AV1E_SET_TILE_COLUMNS, 2);
+    }
+  }
+
+  void FramePktHook(const aom_codec_cx_pkt_t *pkt) override {
+    const uint8_t *const buf =
+        static_cast<const uint8_t *>(pkt->data.frame.buf);
+    packets_.emplace_back(buf, buf + pkt->data.frame.sz);
+  }
+
+  bool DoDecode() const override { return false; }
+
+  // Decodes all packets at the given level. Returns the decode time in
+  // seconds and the luma planes of the output frames in |frames|.
+  double DecodeAtLevel(int level, unsigned threads,
+                       std::vector<std::vector<uint8_t>> *frames) {
+    aom_codec_dec_cfg_t cfg = aom_codec_dec_cfg_t();
+    cfg.threads = threads;
+    cfg.allow_lowbitdepth = 1;
+    libaom_test::AV1Decoder decoder(cfg, 0);
+    decoder.Control(AV1D_SET_ROW_MT, 1);
+    decoder.Control(AV1D_SET_FAST_DECODE, level);
+
+    int64_t elapsed = 0;
+    for (const std::vector<uint8_t> &packet : packets_) {
+      aom_usec_timer t;
+      aom_usec_timer_start(&t);
+      EXPECT_EQ(decoder.DecodeFrame(packet.data(), packet.size()),
+                AOM_CODEC_OK);
+      libaom_test::DxDataIterator dec_iter = decoder.GetDxData();
+      const aom_image_t *img;
+      while ((img = dec_iter.Next()) != nullptr) {
+        aom_usec_timer_mark(&t);
+        elapsed += aom_usec_timer_elapsed(&t);
+        // Copying the output frame is not part of the measured time.
+        std::vector<uint8_t> luma;
+        for (unsigned int r = 0; r < img->d_h; ++r) {
+          const uint8_t *const row =
+              img->planes[AOM_PLANE_Y] + r * img->stride[AOM_PLANE_Y];
+          luma.insert(luma.end(), row, row + img->d_w);
+        }
+        frames->push_back(luma);
+        aom_usec_timer_start(&t);
+      }
+      aom_usec_timer_mark(&t);
+      elapsed += aom_usec_timer_elapsed(&t);
+    }
+    return static_cast<double>(elapsed) / kUsecsInSec;
+  }
+
+  static double LumaPsnr(const std::vector<std::vector<uint8_t>> &ref,
+                         const std::vector<std::vector<uint8_t>> &test) {
+    EXPECT_EQ(ref.size(), test.size());
+    uint64_t sse = 0;
+    uint64_t samples = 0;
+    for (size_t i = 0; i < ref.size() && i < test.size(); ++i) {
+      EXPECT_EQ(ref[i].size(), test[i].size());
+      for (size_t j = 0; j < ref[i].size() && j < test[i].size(); ++j) {
+        const int diff = ref[i][j] - test[i][j];
+        sse += diff * diff;
+      }
+      samples += ref[i].size();
+    }
+    if (sse == 0) return 100.0;
+    const double mse = static_cast<double>(sse) / static_cast<double>(samples);
+    return 10.0 * log10(255.0 * 255.0 / mse);
+  }
+
+  std::vector<std::vector<uint8_t>> packets_;
+};
+
+TEST_P(AV1FastDecodePerfTest, PerfTest) {
+  const aom_rational timebase = { 33333333, 1000000000 };
+  cfg_.g_timebase = timebase;
+  cfg_.rc_target_bitrate = kAV1EncodePerfTestVectors[0].bitrate;
+
+  const char *video_name = kAV1EncodePerfTestVectors[0].name;
+  libaom_test::I420VideoSource video(
+      video_name, kAV1EncodePerfTestVectors[0].width,
+      kAV1EncodePerfTestVectors[0].height, timebase.den, timebase.num, 0, 60);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+
+  const unsigned threads = 4;
+  std::vector<std::vector<uint8_t>> normative_frames;
+  const double normative_secs = DecodeAtLevel(0, threads, &normative_frames);
+
+  for (int level = 0; level <= kMaxFastDecodeLevel; ++level) {
+    std::vector<std::vector<uint8_t>> frames;
+    const double elapsed_secs = DecodeAtLevel(level, threads, &frames);
+    const unsigned decode_frames = static_cast<unsigned>(frames.size());
+    const double fps = static_cast<double>(decode_frames) / elapsed_secs;
+
+    printf("{\n");
+    printf("\t\"type\" : \"fast_decode_perf_test\",\n");
+    printf("\t\"version\" : \"%s\",\n", aom_codec_version_str());
+    printf("\t\"videoName\" : \"%s\",\n", video_name);
+    printf("\t\"fastDecodeLevel\" : %d,\n", level);
+    printf("\t\"threadCount\" : %u,\n", threads);
+    printf("\t\"decodeTimeSecs\" : %f,\n", elapsed_secs);
+    printf("\t\"totalFrames\" : %u,\n", decode_frames);
+    printf("\t\"framesPerSecond\" : %f,\n", fps);
+    printf("\t\"speedup\" : %f,\n", normative_secs / elapsed_secs);
+    printf("\t\"lumaPsnrVsNormative\" : %f\n",
+           LumaPsnr(normative_frames, frames));
+    printf("}\n");
+  }
+}
+
+AV1_INSTANTIATE_TEST_SUITE(AV1FastDecodePerfTest,
+                           ::testing::Values(::libaom_test::kTwoPassGood));
 }  // namespace
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "aom/aomcx.h"
+#include "aom/aomdx.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/i420_video_source.h"
+#include "test/md5_helper.h"
+#include "test/util.h"
+
+namespace {
+
+const int kFrames = 10;
+const int kWidth = 352;
+const int kHeight = 288;
+const int kTileColumnsLog2 = 1;
+const int kTiles = 1 << kTileColumnsLog2;
+
+// Encodes a clip and decodes every temporal unit with a row-multithreaded
+// decoder, checking what AOMD_GET_FRAME_STATS and AOMD_GET_MEMORY_USAGE
+// report against the encoded data. Without lag every temporal unit holds
+// exactly one coded frame. The parameter enables the deblocking filter, CDEF
+// and loop restoration.
+class DecodeFrameStatsTest : public ::libaom_test::CodecTestWithParam<int>,
+                             public ::libaom_test::EncoderTest {
+ protected:
+  DecodeFrameStatsTest()
+      : EncoderTest(GET_PARAM(0)), enable_filters_(GET_PARAM(1)),
+        num_frames_(0), loop_filter_time_(0), cdef_time_(0),
+        loop_restoration_time_(0) {
+    aom_codec_dec_cfg_t cfg = aom_codec_dec_cfg_t();
+    cfg.allow_lowbitdepth = 1;
+    // The parse and reconstruction times are only measured with row based
+    // multithreading.
+    cfg.threads = 2;
+    decoder_.reset(codec_->CreateDecoder(cfg, 0));
+    decoder_->Control(AV1D_SET_ROW_MT, 1);
+  }
+
+  void SetUp() override {
+    InitializeConfig(::libaom_test::kOnePassGood);
+    cfg_.g_lag_in_frames = 0;
+    cfg_.rc_end_usage = AOM_Q;
+  }
+
+  void PreEncodeFrameHook(::libaom_test::VideoSource *video,
+                          ::libaom_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(AOME_SET_CPUUSED, 5);
+      encoder->Control(AOME_SET_CQ_LEVEL, 32);
+      encoder->Control(AV1E_SET_TILE_COLUMNS, kTileColumnsLog2);
+      encoder->Control(AV1E_SET_ENABLE_CDEF, enable_filters_);
+      encoder->Control(AV1E_SET_ENABLE_RESTORATION, enable_filters_);
+      // 0 disables the deblocking filter.
+      encoder->Control(AV1E_SET_LOOPFILTER_CONTROL, enable_filters_);
+    }
+  }
+
+  void FramePktHook(const aom_codec_cx_pkt_t *pkt) override {
+    const aom_codec_err_t res = decoder_->DecodeFrame(
+        static_cast<const uint8_t *>(pkt->data.frame.buf), pkt->data.frame.sz);
+    ASSERT_EQ(AOM_CODEC_OK, res) << decoder_->DecodeError();
+
+    aom_frame_stats stats;
+    ASSERT_EQ(AOM_CODEC_OK,
+              AOM_CODEC_CONTROL_TYPECHECKED(decoder_->GetDecoder(),
+                                            AOMD_GET_FRAME_STATS, &stats));
+    EXPECT_EQ(stats.num_frames, 1);
+    EXPECT_EQ(stats.num_tiles, kTiles);
+    EXPECT_EQ(stats.frame_bytes, pkt->data.frame.sz);
+    EXPECT_GT(stats.decode_time, 0);
+    EXPECT_GT(stats.tile_decode_time, 0);
+    EXPECT_LE(stats.tile_decode_time, stats.decode_time);
+    EXPECT_GT(stats.parse_time, 0);
+    EXPECT_GT(stats.recon_time, 0);
+    EXPECT_GE(stats.num_workers, 1);
+    EXPECT_LE(stats.num_workers, 2);
+    EXPECT_GT(stats.worker_busy_time, 0);
+    EXPECT_EQ(stats.film_grain_time, 0);
+    ASSERT_NO_FATAL_FAILURE(CheckMemoryUsage());
+
+    // A filter may be off in some frames even when it is enabled, so the
+    // stage times are checked over the whole clip.
+    ++num_frames_;
+    loop_filter_time_ += stats.loop_filter_time;
+    cdef_time_ += stats.cdef_time;
+    loop_restoration_time_ += stats.loop_restoration_time;
+  }
+
+  // Checks AOMD_GET_MEMORY_USAGE after a frame is decoded.
+  void CheckMemoryUsage() {
+    aom_memory_usage_t usage;
+    ASSERT_EQ(AOM_CODEC_OK,
+              AOM_CODEC_CONTROL_TYPECHECKED(decoder_->GetDecoder(),
+                                            AOMD_GET_MEMORY_USAGE, &usage));
+    uint64_t sum = 0;
+    for (int i = 0; i < AOM_MEM_TAG_COUNT; ++i) {
+      EXPECT_GE(usage.peak_bytes[i], usage.current_bytes[i]);
+      sum += usage.current_bytes[i];
+    }
+    EXPECT_EQ(usage.total_current_bytes, sum);
+    EXPECT_GE(usage.total_peak_bytes, usage.total_current_bytes);
+    // At least the frame just decoded, without its border.
+    EXPECT_GE(usage.current_bytes[AOM_MEM_TAG_FRAME_BUFFERS],
+              static_cast<uint64_t>(kWidth * kHeight * 3 / 2));
+    EXPECT_GT(usage.current_bytes[AOM_MEM_TAG_ENTROPY_TABLES], 0u);
+    EXPECT_GT(usage.current_bytes[AOM_MEM_TAG_THREAD_DATA], 0u);
+    // Encoder only categories.
+    EXPECT_EQ(usage.peak_bytes[AOM_MEM_TAG_LOOKAHEAD], 0u);
+    EXPECT_EQ(usage.peak_bytes[AOM_MEM_TAG_TPL], 0u);
+    EXPECT_EQ(usage.peak_bytes[AOM_MEM_TAG_TF], 0u);
+    EXPECT_EQ(usage.peak_bytes[AOM_MEM_TAG_HASH_TABLES], 0u);
+  }
+
+  void DoTest() {
+    ::libaom_test::I420VideoSource video("hantro_collage_w352h288.yuv", kWidth,
+                                         kHeight, 30, 1, 0, kFrames);
+    ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+    EXPECT_EQ(num_frames_, kFrames);
+    if (enable_filters_) {
+      EXPECT_GT(loop_filter_time_, 0);
+      EXPECT_GT(cdef_time_, 0);
+      EXPECT_GT(loop_restoration_time_, 0);
+    } else {
+      EXPECT_EQ(loop_filter_time_, 0);
+      EXPECT_EQ(cdef_time_, 0);
+      EXPECT_EQ(loop_restoration_time_, 0);
+    }
+  }
+
+  const int enable_filters_;
+  std::unique_ptr<::libaom_test::Decoder> decoder_;
+  int num_frames_;
+  int64_t loop_filter_time_;
+  int64_t cdef_time_;
+  int64_t loop_restoration_time_;
+};
+
+TEST_P(DecodeFrameStatsTest, MatchesEncodedData) { DoTest(); }
+
+AV1_INSTANTIATE_TEST_SUITE(DecodeFrameStatsTest, ::testing::Values(0, 1));
+
+// Encodes a clip whose frame size changes with AOME_SET_SCALEMODE and decodes
+// it with and without AV1D_SET_PREALLOC_FRAME_BUFFERS. The sequence header
+// has the full size as the maximum frame size, so the preallocated frame
+// buffers fit every frame.
+class DecodePreallocFrameBuffersTest
+    : public ::libaom_test::CodecTestWithParam<libaom_test::TestMode>,
+      public ::libaom_test::EncoderTest {
+ protected:
+  DecodePreallocFrameBuffersTest()
+      : EncoderTest(GET_PARAM(0)), encoding_mode_(GET_PARAM(1)),
+        first_frame_buffer_bytes_(0) {
+    aom_codec_dec_cfg_t cfg = aom_codec_dec_cfg_t();
+    cfg.allow_lowbitdepth = 1;
+    decoder_.reset(codec_->CreateDecoder(cfg, 0));
+    prealloc_decoder_.reset(codec_->CreateDecoder(cfg, 0));
+    prealloc_decoder_->Control(AV1D_SET_PREALLOC_FRAME_BUFFERS, 1);
+  }
+
+  void SetUp() override {
+    InitializeConfig(encoding_mode_);
+    cfg_.g_lag_in_frames = 0;
+    cfg_.g_forced_max_frame_width = kWidth;
+    cfg_.g_forced_max_frame_height = kHeight;
+  }
+
+  void PreEncodeFrameHook(::libaom_test::VideoSource *video,
+                          ::libaom_test::Encoder *encoder) override {
+    if (video->frame() == 0) encoder->Control(AOME_SET_CPUUSED, 6);
+    // Full size, 1/2, 3/4, then full size again.
+    static const AOM_SCALING_MODE kModes[] = { AOME_NORMAL, AOME_ONETWO,
+                                               AOME_THREEFOUR };
+    if (video->frame() % 3 == 0) {
+      const AOM_SCALING_MODE mode = kModes[(video->frame() / 3) % 3];
+      aom_scaling_mode_t scaling_mode = { mode, mode };
+      encoder->Control(AOME_SET_SCALEMODE, &scaling_mode);
+    }
+  }
+
+  // Decodes the frame and returns the MD5 of the output.
+  std::string DecodeFrame(::libaom_test::Decoder *decoder,
+                          const aom_codec_cx_pkt_t *pkt) {
+    const aom_codec_err_t res = decoder->DecodeFrame(
+        static_cast<const uint8_t *>(pkt->data.frame.buf), pkt->data.frame.sz);
+    EXPECT_EQ(AOM_CODEC_OK, res) << decoder->DecodeError();
+    ::libaom_test::DxDataIterator dec_iter = decoder->GetDxData();
+    ::libaom_test::MD5 md5;
+    const aom_image_t *img;
+    while ((img = dec_iter.Next()) != nullptr) {
+      md5.Add(img);
+      sizes_.insert(std::make_pair(img->d_w, img->d_h));
+    }
+    return md5.Get();
+  }
+
+  void FramePktHook(const aom_codec_cx_pkt_t *pkt) override {
+    const std::string md5 = DecodeFrame(decoder_.get(), pkt);
+    EXPECT_EQ(md5, DecodeFrame(prealloc_decoder_.get(), pkt));
+
+    aom_memory_usage_t usage;
+    ASSERT_EQ(AOM_CODEC_OK,
+              AOM_CODEC_CONTROL_TYPECHECKED(prealloc_decoder_->GetDecoder(),
+                                            AOMD_GET_MEMORY_USAGE, &usage));
+    const uint64_t frame_buffer_bytes =
+        usage.current_bytes[AOM_MEM_TAG_FRAME_BUFFERS];
+    if (first_frame_buffer_bytes_ == 0) {
+      first_frame_buffer_bytes_ = frame_buffer_bytes;
+    } else {
+      EXPECT_LE(frame_buffer_bytes, first_frame_buffer_bytes_);
+    }
+  }
+
+  const libaom_test::TestMode encoding_mode_;
+  std::unique_ptr<::libaom_test::Decoder> decoder_;
+  std::unique_ptr<::libaom_test::Decoder> prealloc_decoder_;
+  uint64_t first_frame_buffer_bytes_;
+  std::set<std::pair<unsigned int, unsigned int>> sizes_;
+};
+
+TEST_P(DecodePreallocFrameBuffersTest, MatchesWithoutPrealloc) {
+  ::libaom_test::I420VideoSource video("hantro_collage_w352h288.yuv", kWidth,
+                                       kHeight, 30, 1, 0, kFrames);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  EXPECT_GT(first_frame_buffer_bytes_, 0u);
+  EXPECT_EQ(sizes_.size(), 3u);
+}
+
+AV1_INSTANTIATE_TEST_SUITE(DecodePreallocFrameBuffersTest,
+                           ::testing::Values(::libaom_test::kRealTime,
+                                             ::libaom_test::kOnePassGood));
+
+}  // namespace
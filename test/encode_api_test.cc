@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <tuple>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -935,7 +936,370 @@ INSTANTIATE_TEST_SUITE_P(All, EncodeAPIParameterized,
                              /*speed=*/testing::Values(6, 7, 10),
                              /*aq_mode=*/testing::Values(0, 1, 2, 3)));
 
+// Records the images released by the encoder in zero copy input mode. The
+// user_priv of each image is its index.
+void ReleaseInputImage(void *priv, void *img_priv) {
+  std::vector<int> *const released = static_cast<std::vector<int> *>(priv);
+  const size_t index = reinterpret_cast<size_t>(img_priv);
+  ASSERT_LT(index, released->size());
+  ++(*released)[index];
+}
+
+// Creates a frame of a diagonal gradient that moves with the frame index.
+aom_image_t *CreateMovingImage(unsigned int w, unsigned int h,
+                               unsigned int border, int index) {
+  aom_image_t *const image =
+      border ? aom_img_alloc_with_border(nullptr, AOM_IMG_FMT_I420, w, h, 32, 8,
+                                         border)
+             : aom_img_alloc(nullptr, AOM_IMG_FMT_I420, w, h, 1);
+  if (!image) return image;
+  for (int plane = 0; plane < 3; ++plane) {
+    const unsigned int plane_w = plane ? (w + 1) / 2 : w;
+    const unsigned int plane_h = plane ? (h + 1) / 2 : h;
+    for (unsigned int i = 0; i < plane_h; ++i) {
+      for (unsigned int j = 0; j < plane_w; ++j) {
+        image->planes[plane][i * image->stride[plane] + j] =
+            static_cast<uint8_t>(plane * 40 + 2 * (i + j) + 3 * index);
+      }
+    }
+  }
+  image->user_priv = reinterpret_cast<void *>(static_cast<size_t>(index));
+  return image;
+}
+
+// Encodes frames with borders of the given size, referencing them if
+// zero_copy is set, and returns the compressed frames.
+void EncodeWithZeroCopyInput(bool zero_copy, unsigned int border,
+                             std::vector<uint8_t> *output,
+                             std::vector<int> *released) {
+  constexpr int kNumFrames = 10;
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, kUsage), AOM_CODEC_OK);
+  cfg.g_w = 100;
+  cfg.g_h = 70;
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, 6), AOM_CODEC_OK);
+  released->assign(kNumFrames, 0);
+  if (zero_copy) {
+    const aom_zero_copy_input_t zero_copy_input = { border, ReleaseInputImage,
+                                                    released };
+    ASSERT_EQ(aom_codec_control(&enc, AV1E_SET_ZERO_COPY_INPUT,
+                                &zero_copy_input),
+              AOM_CODEC_OK);
+  }
+
+  std::vector<aom_image_t *> images;
+  for (int i = 0; i <= kNumFrames; ++i) {
+    aom_image_t *image = nullptr;
+    if (i < kNumFrames) {
+      image = CreateMovingImage(cfg.g_w, cfg.g_h, border, i);
+      ASSERT_NE(image, nullptr);
+      images.push_back(image);
+    }
+    ASSERT_EQ(aom_codec_encode(&enc, image, i, 1, 0), AOM_CODEC_OK);
+    // A referenced image stays in the lookahead after it is queued.
+    if (zero_copy && i == 0) {
+      EXPECT_EQ((*released)[0], 0);
+    }
+    aom_codec_iter_t iter = nullptr;
+    const aom_codec_cx_pkt_t *pkt;
+    while ((pkt = aom_codec_get_cx_data(&enc, &iter)) != nullptr) {
+      if (pkt->kind != AOM_CODEC_CX_FRAME_PKT) continue;
+      const uint8_t *const buf = static_cast<uint8_t *>(pkt->data.frame.buf);
+      output->insert(output->end(), buf, buf + pkt->data.frame.sz);
+    }
+  }
+  // Drain the encoder.
+  const aom_codec_cx_pkt_t *pkt;
+  do {
+    ASSERT_EQ(aom_codec_encode(&enc, nullptr, 0, 0, 0), AOM_CODEC_OK);
+    aom_codec_iter_t iter = nullptr;
+    while ((pkt = aom_codec_get_cx_data(&enc, &iter)) != nullptr) {
+      if (pkt->kind != AOM_CODEC_CX_FRAME_PKT) continue;
+      const uint8_t *const buf = static_cast<uint8_t *>(pkt->data.frame.buf);
+      output->insert(output->end(), buf, buf + pkt->data.frame.sz);
+      break;
+    }
+  } while (pkt != nullptr);
+  ASSERT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  for (aom_image_t *image : images) aom_img_free(image);
+}
+
+TEST(EncodeAPI, ZeroCopyInputMatchesCopiedInput) {
+  std::vector<uint8_t> copied_output, output;
+  std::vector<int> released;
+  EncodeWithZeroCopyInput(/*zero_copy=*/false, 288, &copied_output, &released);
+  EncodeWithZeroCopyInput(/*zero_copy=*/true, 288, &output, &released);
+  ASSERT_FALSE(output.empty());
+  EXPECT_EQ(copied_output, output);
+  for (int count : released) EXPECT_EQ(count, 1);
+}
+
+TEST(EncodeAPI, ZeroCopyInputCopiesImagesWithoutBorder) {
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, kUsage), AOM_CODEC_OK);
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  std::vector<int> released(2, 0);
+  aom_zero_copy_input_t zero_copy_input = { 40, ReleaseInputImage, &released };
+  // The border must be a multiple of 32.
+  EXPECT_EQ(
+      aom_codec_control(&enc, AV1E_SET_ZERO_COPY_INPUT, &zero_copy_input),
+      AOM_CODEC_INVALID_PARAM);
+  zero_copy_input.border = 288;
+  ASSERT_EQ(
+      aom_codec_control(&enc, AV1E_SET_ZERO_COPY_INPUT, &zero_copy_input),
+      AOM_CODEC_OK);
+
+  // An image without a border is copied and released right away.
+  aom_image_t *image = CreateMovingImage(cfg.g_w, cfg.g_h, 0, 0);
+  ASSERT_NE(image, nullptr);
+  ASSERT_EQ(aom_codec_encode(&enc, image, 0, 1, 0), AOM_CODEC_OK);
+  EXPECT_EQ(released[0], 1);
+  // So is an image the encoder rejects.
+  image->user_priv = reinterpret_cast<void *>(static_cast<size_t>(1));
+  EXPECT_EQ(aom_codec_encode(&enc, image, -1, 1, 0), AOM_CODEC_INVALID_PARAM);
+  EXPECT_EQ(released[1], 1);
+  // The mode cannot be changed once frames have been queued.
+  EXPECT_EQ(
+      aom_codec_control(&enc, AV1E_SET_ZERO_COPY_INPUT, &zero_copy_input),
+      AOM_CODEC_INVALID_PARAM);
+
+  ASSERT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  EXPECT_EQ(released[0], 1);
+  EXPECT_EQ(released[1], 1);
+  aom_img_free(image);
+}
+
+TEST(EncodeAPI, GetMemoryUsage) {
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, AOM_USAGE_REALTIME),
+            AOM_CODEC_OK);
+  cfg.g_threads = 2;
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_GET_MEMORY_USAGE, nullptr),
+            AOM_CODEC_INVALID_PARAM);
+  aom_memory_usage_t usage;
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_GET_MEMORY_USAGE, &usage),
+            AOM_CODEC_OK);
+  EXPECT_GT(usage.total_current_bytes, 0u);
+  const uint64_t init_bytes = usage.total_current_bytes;
+
+  aom_image_t *image = CreateGrayImage(AOM_IMG_FMT_I420, cfg.g_w, cfg.g_h);
+  ASSERT_NE(image, nullptr);
+  ASSERT_EQ(aom_codec_encode(&enc, image, 0, 1, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_GET_MEMORY_USAGE, &usage),
+            AOM_CODEC_OK);
+  EXPECT_GT(usage.total_current_bytes, init_bytes);
+  EXPECT_GT(usage.current_bytes[AOM_MEM_TAG_FRAME_BUFFERS], 0u);
+  EXPECT_GT(usage.current_bytes[AOM_MEM_TAG_LOOKAHEAD], 0u);
+  EXPECT_GT(usage.current_bytes[AOM_MEM_TAG_ENTROPY_TABLES], 0u);
+  uint64_t sum = 0;
+  for (int i = 0; i < AOM_MEM_TAG_COUNT; ++i) {
+    EXPECT_GE(usage.peak_bytes[i], usage.current_bytes[i]);
+    sum += usage.current_bytes[i];
+  }
+  EXPECT_EQ(usage.total_current_bytes, sum);
+  EXPECT_GE(usage.total_peak_bytes, usage.total_current_bytes);
+
+  aom_img_free(image);
+  ASSERT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+}
+
 #if !CONFIG_REALTIME_ONLY
+// Encodes frames at the given low memory level and returns the compressed
+// frames and the memory in use once they are all encoded.
+void EncodeWithLowMemoryLevel(unsigned int level, std::vector<uint8_t> *output,
+                              uint64_t *current_bytes) {
+  constexpr int kNumFrames = 8;
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, AOM_USAGE_GOOD_QUALITY),
+            AOM_CODEC_OK);
+  cfg.g_w = 176;
+  cfg.g_h = 144;
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, 6), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_SET_LOW_MEMORY_LEVEL, level),
+            AOM_CODEC_OK);
+
+  for (int i = 0; i <= kNumFrames; ++i) {
+    aom_image_t *image = nullptr;
+    if (i < kNumFrames) {
+      image = CreateMovingImage(cfg.g_w, cfg.g_h, 0, i);
+      ASSERT_NE(image, nullptr);
+    }
+    const aom_codec_cx_pkt_t *pkt;
+    do {
+      ASSERT_EQ(aom_codec_encode(&enc, image, i, 1, 0), AOM_CODEC_OK);
+      aom_codec_iter_t iter = nullptr;
+      bool got_frame = false;
+      while ((pkt = aom_codec_get_cx_data(&enc, &iter)) != nullptr) {
+        if (pkt->kind != AOM_CODEC_CX_FRAME_PKT) continue;
+        const uint8_t *const buf = static_cast<uint8_t *>(pkt->data.frame.buf);
+        output->insert(output->end(), buf, buf + pkt->data.frame.sz);
+        got_frame = true;
+      }
+      // Keep draining the encoder until it has no more frames.
+      if (image != nullptr || !got_frame) break;
+    } while (true);
+    aom_img_free(image);
+  }
+  aom_memory_usage_t usage;
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_GET_MEMORY_USAGE, &usage),
+            AOM_CODEC_OK);
+  *current_bytes = usage.total_current_bytes;
+  ASSERT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+}
+
+TEST(EncodeAPI, LowMemoryLevelKeepsOutput) {
+  std::vector<uint8_t> output[3];
+  uint64_t current_bytes[3];
+  for (unsigned int level = 0; level < 3; ++level) {
+    EncodeWithLowMemoryLevel(level, &output[level], &current_bytes[level]);
+  }
+  ASSERT_FALSE(output[0].empty());
+  EXPECT_EQ(output[0], output[1]);
+  EXPECT_EQ(output[0], output[2]);
+  // Level 1 frees the source pyramids, level 2 also the reference pyramids.
+  EXPECT_LT(current_bytes[1], current_bytes[0]);
+  EXPECT_LT(current_bytes[2], current_bytes[1]);
+}
+
+TEST(EncodeAPI, InvalidLowMemoryLevel) {
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, AOM_USAGE_GOOD_QUALITY),
+            AOM_CODEC_OK);
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_SET_LOW_MEMORY_LEVEL, 3),
+            AOM_CODEC_INVALID_PARAM);
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_SET_LOW_MEMORY_LEVEL, 2),
+            AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+}
+
+// Replaces a reference frame of the given size with a copy of itself with a
+// different content. Returns false if no reference frame has that size.
+bool ReplaceReferenceOfSize(aom_codec_ctx_t *enc, unsigned int w,
+                            unsigned int h) {
+  for (int idx = 0; idx < 8; ++idx) {
+    av1_ref_frame_t ref;
+    ref.idx = idx;
+    if (aom_codec_control(enc, AV1_GET_REFERENCE, &ref) != AOM_CODEC_OK ||
+        ref.img.d_w != w || ref.img.d_h != h) {
+      continue;
+    }
+    aom_image_t *const image = aom_img_alloc(nullptr, ref.img.fmt, w, h, 1);
+    if (image == nullptr) return false;
+    for (int plane = 0; plane < 3; ++plane) {
+      const unsigned int plane_w = plane ? (w + 1) / 2 : w;
+      const unsigned int plane_h = plane ? (h + 1) / 2 : h;
+      for (unsigned int i = 0; i < plane_h; ++i) {
+        for (unsigned int j = 0; j < plane_w; ++j) {
+          image->planes[plane][i * image->stride[plane] + j] =
+              ref.img.planes[plane][i * ref.img.stride[plane] + j] ^ 0x20;
+        }
+      }
+    }
+    av1_ref_frame_t new_ref;
+    new_ref.idx = idx;
+    new_ref.use_external_ref = 0;
+    new_ref.img = *image;
+    const aom_codec_err_t res =
+        aom_codec_control(enc, AV1_SET_REFERENCE, &new_ref);
+    aom_img_free(image);
+    return res == AOM_CODEC_OK;
+  }
+  return false;
+}
+
+// Encodes frames whose coded size changes with AOME_SET_SCALEMODE, so that
+// reference frames of another size are scaled, with the scaled reference
+// cache on or off. The lookahead enables the recode loop, which speed 1 runs
+// for every frame type. A reference frame of half size is overwritten after
+// it has been scaled up. Returns the compressed frames and the peak memory of
+// the frame buffers.
+void EncodeWithScaledRefCache(unsigned int scaled_ref_cache,
+                              std::vector<uint8_t> *output,
+                              uint64_t *frame_buffer_peak_bytes) {
+  constexpr int kNumFrames = 12;
+  constexpr unsigned int kWidth = 96;
+  constexpr unsigned int kHeight = 80;
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, AOM_USAGE_GOOD_QUALITY),
+            AOM_CODEC_OK);
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  cfg.g_lag_in_frames = 4;
+  cfg.rc_target_bitrate = 10;
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, 1), AOM_CODEC_OK);
+  ASSERT_EQ(
+      aom_codec_control(&enc, AV1E_SET_SCALED_REF_CACHE, scaled_ref_cache),
+      AOM_CODEC_OK);
+
+  const auto get_cx_data = [&]() {
+    aom_codec_iter_t iter = nullptr;
+    const aom_codec_cx_pkt_t *pkt;
+    bool got_data = false;
+    while ((pkt = aom_codec_get_cx_data(&enc, &iter)) != nullptr) {
+      if (pkt->kind != AOM_CODEC_CX_FRAME_PKT) continue;
+      const uint8_t *const buf = static_cast<uint8_t *>(pkt->data.frame.buf);
+      output->insert(output->end(), buf, buf + pkt->data.frame.sz);
+      got_data = true;
+    }
+    return got_data;
+  };
+  for (int i = 0; i < kNumFrames; ++i) {
+    // Full size, half size, full size, then half size again.
+    if (i % 3 == 0) {
+      aom_scaling_mode_t mode = { AOME_NORMAL, AOME_NORMAL };
+      if (i % 6 == 3) mode = { AOME_ONETWO, AOME_ONETWO };
+      ASSERT_EQ(aom_codec_control(&enc, AOME_SET_SCALEMODE, &mode),
+                AOM_CODEC_OK);
+    }
+    if (i == 7) {
+      ASSERT_TRUE(ReplaceReferenceOfSize(&enc, kWidth / 2, kHeight / 2));
+    }
+    aom_image_t *const image = CreateMovingImage(kWidth, kHeight, 0, i);
+    ASSERT_NE(image, nullptr);
+    ASSERT_EQ(aom_codec_encode(&enc, image, i, 1, 0), AOM_CODEC_OK);
+    get_cx_data();
+    aom_img_free(image);
+  }
+  // Flush the lookahead.
+  do {
+    ASSERT_EQ(aom_codec_encode(&enc, nullptr, 0, 0, 0), AOM_CODEC_OK);
+  } while (get_cx_data());
+  aom_memory_usage_t usage;
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_GET_MEMORY_USAGE, &usage),
+            AOM_CODEC_OK);
+  *frame_buffer_peak_bytes = usage.peak_bytes[AOM_MEM_TAG_FRAME_BUFFERS];
+  ASSERT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+}
+
+TEST(EncodeAPI, ScaledRefCacheKeepsOutput) {
+  std::vector<uint8_t> output, cache_output;
+  uint64_t peak_bytes, cache_peak_bytes;
+  ASSERT_NO_FATAL_FAILURE(EncodeWithScaledRefCache(0, &output, &peak_bytes));
+  ASSERT_NO_FATAL_FAILURE(
+      EncodeWithScaledRefCache(1, &cache_output, &cache_peak_bytes));
+  ASSERT_FALSE(output.empty());
+  EXPECT_EQ(output, cache_output);
+  // The cache keeps the scaled copies in frame buffers.
+  EXPECT_GE(cache_peak_bytes, peak_bytes);
+}
+
 TEST(EncodeAPI, AllIntraMode) {
   aom_codec_iface_t *iface = aom_codec_av1_cx();
   aom_codec_ctx_t enc;
@@ -170,6 +170,27 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(kTxSize)));
 #endif  // HAVE_SSE4_1
 
+#if HAVE_AVX2
+const PredFuncMode kPredFuncMdArrayAVX2[] = {
+  make_tuple(&av1_filter_intra_predictor_c, &av1_filter_intra_predictor_avx2,
+             FILTER_DC_PRED),
+  make_tuple(&av1_filter_intra_predictor_c, &av1_filter_intra_predictor_avx2,
+             FILTER_V_PRED),
+  make_tuple(&av1_filter_intra_predictor_c, &av1_filter_intra_predictor_avx2,
+             FILTER_H_PRED),
+  make_tuple(&av1_filter_intra_predictor_c, &av1_filter_intra_predictor_avx2,
+             FILTER_D157_PRED),
+  make_tuple(&av1_filter_intra_predictor_c, &av1_filter_intra_predictor_avx2,
+             FILTER_PAETH_PRED),
+};
+
+// AVX2 builds always enable SSE4.1, so kTxSize is available here.
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, AV1FilterIntraPredTest,
+    ::testing::Combine(::testing::ValuesIn(kPredFuncMdArrayAVX2),
+                       ::testing::ValuesIn(kTxSize)));
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 // TODO(aomedia:349436249): enable for armv7 after SIGBUS is fixed.
 #if AOM_ARCH_AARCH64
@@ -536,5 +536,30 @@ const IntraPredFunc<HighbdIntraPred> HighbdIntraPredTestVectorSse2[] = {
 INSTANTIATE_TEST_SUITE_P(SSE2, HighbdIntraPredTest,
                          ::testing::ValuesIn(HighbdIntraPredTestVectorSse2));
 #endif  // HAVE_SSE2
+
+#if HAVE_SSE4_1
+const IntraPredFunc<HighbdIntraPred> HighbdIntraPredTestVectorSse4_1[] = {
+  highbd_intrapred(paeth, sse4_1, 12),
+  highbd_intrapred(smooth, sse4_1, 12),
+  highbd_intrapred(smooth_v, sse4_1, 12),
+  highbd_intrapred(smooth_h, sse4_1, 12),
+};
+
+INSTANTIATE_TEST_SUITE_P(SSE4_1, HighbdIntraPredTest,
+                         ::testing::ValuesIn(HighbdIntraPredTestVectorSse4_1));
+#endif  // HAVE_SSE4_1
+
+#if HAVE_AVX2
+const IntraPredFunc<HighbdIntraPred> HighbdIntraPredTestVectorAvx2[] = {
+  highbd_intrapred(dc, avx2, 12),       highbd_intrapred(dc_top, avx2, 12),
+  highbd_intrapred(dc_left, avx2, 12),  highbd_intrapred(dc_128, avx2, 12),
+  highbd_intrapred(v, avx2, 12),        highbd_intrapred(h, avx2, 12),
+  highbd_intrapred(paeth, avx2, 12),    highbd_intrapred(smooth, avx2, 12),
+  highbd_intrapred(smooth_v, avx2, 12), highbd_intrapred(smooth_h, avx2, 12),
+};
+
+INSTANTIATE_TEST_SUITE_P(AVX2, HighbdIntraPredTest,
+                         ::testing::ValuesIn(HighbdIntraPredTestVectorAvx2));
+#endif  // HAVE_AVX2
 #endif  // CONFIG_AV1_HIGHBITDEPTH
 }  // namespace
@@ -16,6 +16,8 @@
 
 #include "aom_dsp/noise_model.h"
 #include "aom_dsp/noise_util.h"
+#include "aom_util/aom_thread.h"
+#include "config/aom_config.h"
 #include "config/aom_dsp_rtcd.h"
 #include "gtest/gtest.h"
 #include "test/acm_random.h"
@@ -119,6 +121,29 @@ std::vector<float> get_noise_psd(double *noise, int width, int height,
   return psd;
 }
 
+// Worker threads for the multithreaded functions. The first worker runs on
+// the calling thread.
+class NoiseModelWorkers {
+ public:
+  explicit NoiseModelWorkers(int num_workers) : workers_(num_workers) {
+    const AVxWorkerInterface *const winterface = aom_get_worker_interface();
+    for (int i = 0; i < num_workers; ++i) {
+      winterface->init(&workers_[i]);
+      if (i > 0) {
+        EXPECT_TRUE(winterface->reset(&workers_[i]));
+      }
+    }
+  }
+  ~NoiseModelWorkers() {
+    for (AVxWorker &worker : workers_) aom_get_worker_interface()->end(&worker);
+  }
+  AVxWorker *workers() { return &workers_[0]; }
+  int num_workers() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  std::vector<AVxWorker> workers_;
+};
+
 }  // namespace
 
 TEST(NoiseStrengthSolver, GetCentersTwoBins) {
@@ -524,8 +549,51 @@ TYPED_TEST_P(FlatBlockEstimatorTest, FindFlatBlocks) {
   aom_flat_block_finder_free(&flat_block_finder);
 }
 
+TYPED_TEST_P(FlatBlockEstimatorTest, FindFlatBlocksMultithreaded) {
+  const int kBlockSize = 32;
+  aom_flat_block_finder_t flat_block_finder;
+  ASSERT_EQ(1, aom_flat_block_finder_init(&flat_block_finder, kBlockSize,
+                                          this->kBitDepth, this->kUseHighBD));
+
+  // A partial block at the right and bottom edges.
+  const int w = kBlockSize * 9 + 5;
+  const int h = kBlockSize * 7 + 11;
+  const int num_blocks = 10 * 8;
+  const int shift = this->kBitDepth - 8;
+  this->data_.resize(w * h);
+  // Mix flat noisy blocks with gradients and textures of various strengths.
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      const int block = (y / kBlockSize) * 10 + x / kBlockSize;
+      const double sigma = 0.5 + (block % 4);
+      const double slope = (block % 3) * 0.5;
+      const double texture = (block % 5 == 0) ? 20 * ((x >> 2) & 1) : 0;
+      this->data_[y * w + x] = static_cast<typename TypeParam::data_type_t>(
+          (int)(64 + slope * x + texture + randn(&this->random_, sigma))
+          << shift);
+    }
+  }
+
+  std::vector<uint8_t> ref_flat_blocks(num_blocks);
+  const int ref_num_flat = aom_flat_block_finder_run(
+      &flat_block_finder, (uint8_t *)&this->data_[0], w, h, w,
+      &ref_flat_blocks[0]);
+  EXPECT_GT(ref_num_flat, 0);
+  for (int num_workers : { 2, 3, 8, 16 }) {
+    NoiseModelWorkers workers(num_workers);
+    std::vector<uint8_t> flat_blocks(num_blocks);
+    EXPECT_EQ(ref_num_flat,
+              aom_flat_block_finder_run_mt(
+                  &flat_block_finder, (uint8_t *)&this->data_[0], w, h, w,
+                  &flat_blocks[0], workers.workers(), workers.num_workers()))
+        << "num_workers: " << num_workers;
+    EXPECT_EQ(ref_flat_blocks, flat_blocks) << "num_workers: " << num_workers;
+  }
+  aom_flat_block_finder_free(&flat_block_finder);
+}
+
 REGISTER_TYPED_TEST_SUITE_P(FlatBlockEstimatorTest, ExtractBlock,
-                            FindFlatBlocks);
+                            FindFlatBlocks, FindFlatBlocksMultithreaded);
 
 typedef ::testing::Types<BitDepthParams<uint8_t, 8, false>,   // lowbd
                          BitDepthParams<uint16_t, 8, true>,   // lowbd in 16-bit
@@ -961,6 +1029,74 @@ TYPED_TEST_P(NoiseModelUpdateTest, NoiseCoeffsSignalsDifferentNoiseType) {
   }
   EXPECT_EQ(AOM_NOISE_STATUS_DIFFERENT_NOISE_TYPE, this->NoiseModelUpdate());
 }
+TYPED_TEST_P(NoiseModelUpdateTest, UpdateMultithreaded) {
+  const int width = this->kWidth;
+  const int height = this->kHeight;
+  const int shift = this->kBitDepth - 8;
+  for (int c = 0; c < 3; ++c) {
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        this->data_ptr_[c][y * width + x] =
+            int(64 + y + c + randn(&this->random_, 2)) << shift;
+        this->denoised_ptr_[c][y * width + x] = (64 + y + c) << shift;
+      }
+    }
+  }
+  // Leave out some blocks so that the observations of a block depend on its
+  // neighbors.
+  for (size_t i = 0; i < this->flat_blocks_.size(); ++i) {
+    this->flat_blocks_[i] = (i % 7) != 3;
+  }
+  // Subsampled chroma includes the averaged luma in the observations.
+  this->chroma_sub_[0] = this->chroma_sub_[1] = 1;
+  EXPECT_EQ(AOM_NOISE_STATUS_OK, this->NoiseModelUpdate());
+
+  const aom_noise_model_t &ref = this->model_;
+  for (int num_workers : { 2, 3, 5 }) {
+    NoiseModelWorkers workers(num_workers);
+    aom_noise_model_t model;
+    ASSERT_TRUE(aom_noise_model_init(&model, ref.params));
+    const uint8_t *const data[3] = {
+      reinterpret_cast<uint8_t *>(this->data_ptr_[0]),
+      reinterpret_cast<uint8_t *>(this->data_ptr_[1]),
+      reinterpret_cast<uint8_t *>(this->data_ptr_[2]),
+    };
+    const uint8_t *const denoised[3] = {
+      reinterpret_cast<uint8_t *>(this->denoised_ptr_[0]),
+      reinterpret_cast<uint8_t *>(this->denoised_ptr_[1]),
+      reinterpret_cast<uint8_t *>(this->denoised_ptr_[2]),
+    };
+    EXPECT_EQ(AOM_NOISE_STATUS_OK,
+              aom_noise_model_update_mt(
+                  &model, data, denoised, width, height, this->strides_,
+                  this->chroma_sub_, &this->flat_blocks_[0], this->kBlockSize,
+                  workers.workers(), workers.num_workers()));
+    for (int c = 0; c < 3; ++c) {
+      const aom_noise_state_t &ref_state = ref.latest_state[c];
+      const aom_noise_state_t &state = model.latest_state[c];
+      const int n = state.eqns.n;
+      ASSERT_EQ(ref_state.eqns.n, n);
+      EXPECT_EQ(ref_state.num_observations, state.num_observations);
+      for (int i = 0; i < n * n; ++i) {
+        ASSERT_EQ(ref_state.eqns.A[i], state.eqns.A[i])
+            << "num_workers: " << num_workers << " c: " << c << " i: " << i;
+      }
+      for (int i = 0; i < n; ++i) {
+        ASSERT_EQ(ref_state.eqns.b[i], state.eqns.b[i]);
+        ASSERT_EQ(ref_state.eqns.x[i], state.eqns.x[i]);
+      }
+      EXPECT_EQ(ref_state.ar_gain, state.ar_gain);
+      const aom_equation_system_t &ref_strength =
+          ref_state.strength_solver.eqns;
+      const aom_equation_system_t &strength = state.strength_solver.eqns;
+      for (int i = 0; i < strength.n; ++i) {
+        ASSERT_EQ(ref_strength.x[i], strength.x[i]);
+      }
+    }
+    aom_noise_model_free(&model);
+  }
+}
+
 REGISTER_TYPED_TEST_SUITE_P(NoiseModelUpdateTest, UpdateFailsNoFlatBlocks,
                             UpdateSuccessForZeroNoiseAllFlat,
                             UpdateFailsBlockSizeTooSmall,
@@ -968,7 +1104,8 @@ REGISTER_TYPED_TEST_SUITE_P(NoiseModelUpdateTest, UpdateFailsNoFlatBlocks,
                             UpdateSuccessForScaledWhiteNoise,
                             UpdateSuccessForCorrelatedNoise,
                             NoiseStrengthChangeSignalsDifferentNoiseType,
-                            NoiseCoeffsSignalsDifferentNoiseType);
+                            NoiseCoeffsSignalsDifferentNoiseType,
+                            UpdateMultithreaded);
 
 // Note the empty final argument can be removed if C++20 is made the minimum
 // requirement.
@@ -1369,10 +1506,104 @@ TYPED_TEST_P(WienerDenoiseTest, GradientTest) {
   }
 }
 
+TYPED_TEST_P(WienerDenoiseTest, Multithreaded) {
+  const uint8_t *const data_ptrs[3] = {
+    reinterpret_cast<uint8_t *>(&this->data_[0][0]),
+    reinterpret_cast<uint8_t *>(&this->data_[1][0]),
+    reinterpret_cast<uint8_t *>(&this->data_[2][0]),
+  };
+  uint8_t *denoised_ptrs[3] = {
+    reinterpret_cast<uint8_t *>(&this->denoised_[0][0]),
+    reinterpret_cast<uint8_t *>(&this->denoised_[1][0]),
+    reinterpret_cast<uint8_t *>(&this->denoised_[2][0]),
+  };
+  ASSERT_EQ(1, aom_wiener_denoise_2d(data_ptrs, denoised_ptrs, this->kWidth,
+                                     this->kHeight, this->stride_,
+                                     this->chroma_sub_, this->noise_psd_ptrs_,
+                                     this->kBlockSize, this->kBitDepth,
+                                     this->kUseHighBD));
+  std::vector<typename TypeParam::data_type_t> ref_denoised[3];
+  for (int c = 0; c < 3; ++c) ref_denoised[c] = this->denoised_[c];
+
+  for (int num_workers : { 2, 4, 16 }) {
+    NoiseModelWorkers workers(num_workers);
+    for (int c = 0; c < 3; ++c) {
+      std::fill(this->denoised_[c].begin(), this->denoised_[c].end(), 0);
+    }
+    ASSERT_EQ(1, aom_wiener_denoise_2d_mt(
+                     data_ptrs, denoised_ptrs, this->kWidth, this->kHeight,
+                     this->stride_, this->chroma_sub_, this->noise_psd_ptrs_,
+                     this->kBlockSize, this->kBitDepth, this->kUseHighBD,
+                     workers.workers(), workers.num_workers()));
+    for (int c = 0; c < 3; ++c) {
+      EXPECT_EQ(ref_denoised[c], this->denoised_[c])
+          << "num_workers: " << num_workers << " c: " << c;
+    }
+  }
+}
+
 REGISTER_TYPED_TEST_SUITE_P(WienerDenoiseTest, InvalidBlockSize,
-                            InvalidChromaSubsampling, GradientTest);
+                            InvalidChromaSubsampling, GradientTest,
+                            Multithreaded);
 
 // Note the empty final argument can be removed if C++20 is made the minimum
 // requirement.
 INSTANTIATE_TYPED_TEST_SUITE_P(WienerDenoiseTestInstatiation, WienerDenoiseTest,
                                AllBitDepthParams, );
+
+typedef void (*GradientStatsFunc)(const double *block, int block_size,
+                                  double *stats);
+
+class FlatBlockGradientStatsTest
+    : public ::testing::TestWithParam<GradientStatsFunc> {};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FlatBlockGradientStatsTest);
+
+TEST_P(FlatBlockGradientStatsTest, MatchesC) {
+  libaom_test::ACMRandom random(libaom_test::ACMRandom::DeterministicSeed());
+  for (int block_size : { 3, 4, 5, 6, 8, 9, 16, 17, 32 }) {
+    std::vector<double> block(block_size * block_size);
+    for (int iter = 0; iter < 100; ++iter) {
+      for (double &v : block) v = randn(&random, 0.1);
+      double ref_stats[5], stats[5];
+      aom_flat_block_gradient_stats_c(&block[0], block_size, ref_stats);
+      GetParam()(&block[0], block_size, stats);
+      for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(ref_stats[i], stats[i])
+            << "block_size: " << block_size << " stat: " << i;
+      }
+    }
+  }
+}
+
+typedef void (*OuterProductFunc)(double *A, double *b, const double *x,
+                                 double y, int n);
+
+class NoiseEqnsOuterProductTest
+    : public ::testing::TestWithParam<OuterProductFunc> {};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(NoiseEqnsOuterProductTest);
+
+TEST_P(NoiseEqnsOuterProductTest, MatchesC) {
+  libaom_test::ACMRandom random(libaom_test::ACMRandom::DeterministicSeed());
+  // Up to the 25 coefficients of a lag 3 chroma model, and a few more.
+  for (int n = 1; n <= 32; ++n) {
+    std::vector<double> ref_A(n * n), A(n * n), ref_b(n), b(n), x(n);
+    for (int i = 0; i < n * n; ++i) ref_A[i] = A[i] = randn(&random, 100);
+    for (int i = 0; i < n; ++i) ref_b[i] = b[i] = randn(&random, 100);
+    for (int iter = 0; iter < 10; ++iter) {
+      for (double &v : x) v = randn(&random, 10);
+      const double y = randn(&random, 10);
+      aom_noise_eqns_add_outer_product_c(&ref_A[0], &ref_b[0], &x[0], y, n);
+      GetParam()(&A[0], &b[0], &x[0], y, n);
+    }
+    EXPECT_EQ(ref_A, A) << "n: " << n;
+    EXPECT_EQ(ref_b, b) << "n: " << n;
+  }
+}
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(AVX2, FlatBlockGradientStatsTest,
+                         ::testing::Values(aom_flat_block_gradient_stats_avx2));
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, NoiseEqnsOuterProductTest,
+    ::testing::Values(aom_noise_eqns_add_outer_product_avx2));
+#endif  // HAVE_AVX2
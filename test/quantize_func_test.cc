@@ -589,6 +589,24 @@ INSTANTIATE_TEST_SUITE_P(AVX2, FullPrecisionQuantizeTest,
                          ::testing::ValuesIn(kQParamArrayAvx2));
 #endif  // HAVE_AVX2
 
+#if HAVE_AVX512
+const QuantizeParam<QuantizeFunc> kQParamArrayAvx512[] = {
+  make_tuple(&av1_quantize_fp_c, &av1_quantize_fp_avx512,
+             static_cast<TX_SIZE>(TX_16X16), TYPE_FP, AOM_BITS_8),
+  make_tuple(&av1_quantize_fp_c, &av1_quantize_fp_avx512,
+             static_cast<TX_SIZE>(TX_4X4), TYPE_FP, AOM_BITS_8),
+  make_tuple(&av1_quantize_fp_c, &av1_quantize_fp_avx512,
+             static_cast<TX_SIZE>(TX_4X16), TYPE_FP, AOM_BITS_8),
+  make_tuple(&av1_quantize_fp_32x32_c, &av1_quantize_fp_32x32_avx512,
+             static_cast<TX_SIZE>(TX_32X32), TYPE_FP, AOM_BITS_8),
+  make_tuple(&av1_quantize_fp_64x64_c, &av1_quantize_fp_64x64_avx512,
+             static_cast<TX_SIZE>(TX_64X64), TYPE_FP, AOM_BITS_8),
+};
+
+INSTANTIATE_TEST_SUITE_P(AVX512, FullPrecisionQuantizeTest,
+                         ::testing::ValuesIn(kQParamArrayAvx512));
+#endif  // HAVE_AVX512
+
 #if HAVE_SSE2
 
 const QuantizeParam<LPQuantizeFunc> kLPQParamArraySSE2[] = {
@@ -406,7 +406,8 @@ class ResizeRealtimeTest
   ResizeRealtimeTest()
       : EncoderTest(GET_PARAM(0)), num_threads_(GET_PARAM(3)),
         set_scale_mode_(false), set_scale_mode2_(false),
-        set_scale_mode3_(false), is_screen_(false) {}
+        set_scale_mode3_(false), is_screen_(false),
+        reduced_frame_border_(false) {}
   ~ResizeRealtimeTest() override = default;
 
   void PreEncodeFrameHook(libaom_test::VideoSource *video,
@@ -420,6 +421,8 @@ class ResizeRealtimeTest
       encoder->Control(AV1E_SET_FRAME_PARALLEL_DECODING, 1);
       if (is_screen_)
         encoder->Control(AV1E_SET_TUNE_CONTENT, AOM_CONTENT_SCREEN);
+      if (reduced_frame_border_)
+        encoder->Control(AV1E_SET_REDUCED_FRAME_BORDER, 1);
     }
     if (set_scale_mode_) {
       struct aom_scaling_mode mode;
@@ -514,6 +517,7 @@ class ResizeRealtimeTest
   bool set_scale_mode2_;
   bool set_scale_mode3_;
   bool is_screen_;
+  bool reduced_frame_border_;
 };
 
 // Check the AOME_SET_SCALEMODE control by downsizing to
@@ -752,6 +756,34 @@ TEST_P(ResizeRealtimeTest, TestExternalResizeWorksUsePSNR) {
   }
 }
 
+// Check that internal resizing of externally resized frames works with the
+// reduced frame border, which thickens the border of larger references only
+// when they are used.
+TEST_P(ResizeRealtimeTest, TestExternalResizeWorksReducedBorder) {
+  ResizingVideoSource video;
+  video.flag_codec_ = 1;
+  video.change_start_resln_ = false;
+  change_bitrate_ = false;
+  set_scale_mode_ = false;
+  set_scale_mode2_ = false;
+  set_scale_mode3_ = false;
+  reduced_frame_border_ = true;
+  mismatch_psnr_ = 0.0;
+  mismatch_nframes_ = 0;
+  DefaultConfig();
+  cfg_.rc_resize_mode = RESIZE_FIXED;
+  cfg_.rc_resize_denominator = 12;
+  cfg_.rc_resize_kf_denominator = 12;
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+#if CONFIG_AV1_DECODER
+  // Check we decoded the same number of frames as we attempted to encode
+  ASSERT_EQ(frame_info_list_.size(), video.limit());
+  EXPECT_EQ(static_cast<unsigned int>(0), GetMismatchFrames());
+#else
+  printf("Warning: AV1 decoder unavailable, unable to check resize count!\n");
+#endif
+}
+
 // Verify the dynamic resizer behavior for real time, 1 pass CBR mode.
 // Run at low bitrate, with resize_allowed = 1, and verify that we get
 // one resize down event.
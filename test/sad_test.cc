@@ -2923,4 +2923,39 @@ const SadMxNx4Param x3d_avx2_tests[] = {
 INSTANTIATE_TEST_SUITE_P(AVX2, SADx3Test, ::testing::ValuesIn(x3d_avx2_tests));
 #endif  // HAVE_AVX2
 
+#if HAVE_AVX512
+const SadMxNx4Param x4d_avx512_tests[] = {
+  make_tuple(128, 128, &aom_sad128x128x4d_avx512, -1),
+  make_tuple(128, 64, &aom_sad128x64x4d_avx512, -1),
+  make_tuple(64, 128, &aom_sad64x128x4d_avx512, -1),
+  make_tuple(64, 64, &aom_sad64x64x4d_avx512, -1),
+  make_tuple(64, 32, &aom_sad64x32x4d_avx512, -1),
+  make_tuple(32, 64, &aom_sad32x64x4d_avx512, -1),
+  make_tuple(32, 32, &aom_sad32x32x4d_avx512, -1),
+  make_tuple(32, 16, &aom_sad32x16x4d_avx512, -1),
+#if !CONFIG_REALTIME_ONLY
+  make_tuple(64, 16, &aom_sad64x16x4d_avx512, -1),
+  make_tuple(32, 8, &aom_sad32x8x4d_avx512, -1),
+#endif
+};
+INSTANTIATE_TEST_SUITE_P(AVX512, SADx4Test,
+                         ::testing::ValuesIn(x4d_avx512_tests));
+
+const SadSkipMxNx4Param skip_x4d_avx512_tests[] = {
+  make_tuple(128, 128, &aom_sad_skip_128x128x4d_avx512, -1),
+  make_tuple(128, 64, &aom_sad_skip_128x64x4d_avx512, -1),
+  make_tuple(64, 128, &aom_sad_skip_64x128x4d_avx512, -1),
+  make_tuple(64, 64, &aom_sad_skip_64x64x4d_avx512, -1),
+  make_tuple(64, 32, &aom_sad_skip_64x32x4d_avx512, -1),
+  make_tuple(32, 64, &aom_sad_skip_32x64x4d_avx512, -1),
+  make_tuple(32, 32, &aom_sad_skip_32x32x4d_avx512, -1),
+  make_tuple(32, 16, &aom_sad_skip_32x16x4d_avx512, -1),
+#if !CONFIG_REALTIME_ONLY
+  make_tuple(64, 16, &aom_sad_skip_64x16x4d_avx512, -1),
+#endif
+};
+INSTANTIATE_TEST_SUITE_P(AVX512, SADSkipx4Test,
+                         ::testing::ValuesIn(skip_x4d_avx512_tests));
+#endif  // HAVE_AVX512
+
 }  // namespace
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include "gtest/gtest.h"
+
+#include "config/aom_config.h"
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_ports/aom_timer.h"
+#include "aom_ports/mem.h"
+#include "test/acm_random.h"
+#include "test/function_equivalence_test.h"
+#include "test/register_state_check.h"
+
+using libaom_test::FunctionEquivalenceTest;
+
+namespace {
+
+const int kStride = 64;
+const int kBufSize = kStride * kStride;
+
+template <typename Pixel>
+using SsimParmsFunc = void (*)(const Pixel *s, int sp, const Pixel *r, int rp,
+                               uint32_t *sum_s, uint32_t *sum_r,
+                               uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                               uint32_t *sum_sxr);
+
+// Checks that an 8x8 SSIM window gives the same sums as the C version. The
+// sums passed in are nonzero since the functions accumulate into them.
+template <typename Pixel>
+class SsimParmsTest : public FunctionEquivalenceTest<SsimParmsFunc<Pixel>> {
+ protected:
+  static const int kIterations = 10000;
+
+  void RunCheck(bool extreme) {
+    const int max_val = (1 << this->params_.bit_depth) - 1;
+    for (int iter = 0; iter < kIterations && !this->HasFatalFailure();
+         ++iter) {
+      FillBlocks(extreme, max_val);
+      // Windows start anywhere that keeps them inside the buffer.
+      const int s_stride = 8 + this->rng_(kStride - 7);
+      const int r_stride = 8 + this->rng_(kStride - 7);
+      const int max_pos = kBufSize - 7 * AOMMAX(s_stride, r_stride) - 8;
+      const int pos = this->rng_(max_pos + 1);
+
+      uint32_t ref_sums[5] = { 1, 2, 3, 4, 5 };
+      uint32_t tst_sums[5] = { 1, 2, 3, 4, 5 };
+      this->params_.ref_func(src_ + pos, s_stride, rec_ + pos, r_stride,
+                             &ref_sums[0], &ref_sums[1], &ref_sums[2],
+                             &ref_sums[3], &ref_sums[4]);
+      API_REGISTER_STATE_CHECK(this->params_.tst_func(
+          src_ + pos, s_stride, rec_ + pos, r_stride, &tst_sums[0],
+          &tst_sums[1], &tst_sums[2], &tst_sums[3], &tst_sums[4]));
+      for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(ref_sums[i], tst_sums[i])
+            << "sum " << i << " at iteration " << iter;
+      }
+    }
+  }
+
+  void RunSpeedTest() {
+    const int max_val = (1 << this->params_.bit_depth) - 1;
+    FillBlocks(false, max_val);
+    const SsimParmsFunc<Pixel> funcs[2] = { this->params_.ref_func,
+                                            this->params_.tst_func };
+    double elapsed[2];
+    uint32_t sums[5] = { 0, 0, 0, 0, 0 };
+    for (int f = 0; f < 2; ++f) {
+      aom_usec_timer timer;
+      aom_usec_timer_start(&timer);
+      for (int n = 0; n < 20000; ++n) {
+        // The windows of one 64x64 area, on a 4x4 grid like aom_ssim2().
+        for (int y = 0; y <= kStride - 8; y += 4) {
+          for (int x = 0; x <= kStride - 8; x += 4) {
+            const int pos = y * kStride + x;
+            funcs[f](src_ + pos, kStride, rec_ + pos, kStride, &sums[0],
+                     &sums[1], &sums[2], &sums[3], &sums[4]);
+          }
+        }
+      }
+      aom_usec_timer_mark(&timer);
+      elapsed[f] = static_cast<double>(aom_usec_timer_elapsed(&timer));
+    }
+    printf("ssim_parms_8x8 (bd %d): ref %.0f us, test %.0f us, %.2fx\n",
+           this->params_.bit_depth, elapsed[0], elapsed[1],
+           elapsed[0] / elapsed[1]);
+  }
+
+ private:
+  void FillBlocks(bool extreme, int max_val) {
+    for (int i = 0; i < kBufSize; ++i) {
+      if (extreme) {
+        src_[i] = static_cast<Pixel>(max_val - this->rng_(2));
+        rec_[i] = static_cast<Pixel>(max_val - this->rng_(2));
+      } else {
+        src_[i] = static_cast<Pixel>(this->rng_(max_val + 1));
+        rec_[i] = static_cast<Pixel>(this->rng_(max_val + 1));
+      }
+    }
+  }
+
+  Pixel src_[kBufSize];
+  Pixel rec_[kBufSize];
+};
+
+using SsimParmsLowbdTest = SsimParmsTest<uint8_t>;
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SsimParmsLowbdTest);
+
+TEST_P(SsimParmsLowbdTest, RandomValues) { RunCheck(false); }
+TEST_P(SsimParmsLowbdTest, ExtremeValues) { RunCheck(true); }
+TEST_P(SsimParmsLowbdTest, DISABLED_Speed) { RunSpeedTest(); }
+
+using LowbdParam = libaom_test::FuncParam<SsimParmsFunc<uint8_t>>;
+
+#if HAVE_SSE2 && AOM_ARCH_X86_64
+INSTANTIATE_TEST_SUITE_P(SSE2, SsimParmsLowbdTest,
+                         ::testing::Values(LowbdParam(
+                             aom_ssim_parms_8x8_c, aom_ssim_parms_8x8_sse2,
+                             8)));
+#endif  // HAVE_SSE2 && AOM_ARCH_X86_64
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(AVX2, SsimParmsLowbdTest,
+                         ::testing::Values(LowbdParam(
+                             aom_ssim_parms_8x8_c, aom_ssim_parms_8x8_avx2,
+                             8)));
+#endif  // HAVE_AVX2
+
+#if HAVE_NEON
+INSTANTIATE_TEST_SUITE_P(NEON, SsimParmsLowbdTest,
+                         ::testing::Values(LowbdParam(
+                             aom_ssim_parms_8x8_c, aom_ssim_parms_8x8_neon,
+                             8)));
+#endif  // HAVE_NEON
+
+#if CONFIG_AV1_HIGHBITDEPTH
+using SsimParmsHighbdTest = SsimParmsTest<uint16_t>;
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SsimParmsHighbdTest);
+
+TEST_P(SsimParmsHighbdTest, RandomValues) { RunCheck(false); }
+TEST_P(SsimParmsHighbdTest, ExtremeValues) { RunCheck(true); }
+TEST_P(SsimParmsHighbdTest, DISABLED_Speed) { RunSpeedTest(); }
+
+using HighbdParam = libaom_test::FuncParam<SsimParmsFunc<uint16_t>>;
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, SsimParmsHighbdTest,
+    ::testing::Values(HighbdParam(aom_highbd_ssim_parms_8x8_c,
+                                  aom_highbd_ssim_parms_8x8_avx2, 10),
+                      HighbdParam(aom_highbd_ssim_parms_8x8_c,
+                                  aom_highbd_ssim_parms_8x8_avx2, 12)));
+#endif  // HAVE_AVX2
+
+#if HAVE_NEON
+INSTANTIATE_TEST_SUITE_P(
+    NEON, SsimParmsHighbdTest,
+    ::testing::Values(HighbdParam(aom_highbd_ssim_parms_8x8_c,
+                                  aom_highbd_ssim_parms_8x8_neon, 10),
+                      HighbdParam(aom_highbd_ssim_parms_8x8_c,
+                                  aom_highbd_ssim_parms_8x8_neon, 12)));
+#endif  // HAVE_NEON
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+
+#if CONFIG_INTERNAL_STATS
+using FastSsimRowFunc = void (*)(const uint32_t *gx_buf, const uint32_t *gy_buf,
+                                 int stride, int j, int w, double c2,
+                                 double *ssim);
+
+// Checks that a row of the FastSSIM structure term matches the C version
+// exactly, for widths that exercise the partial strips.
+class FastSsimRowTest : public FunctionEquivalenceTest<FastSsimRowFunc> {
+ protected:
+  static const int kMaxWidth = 200;
+  static const int kRowStride = kMaxWidth + 8;
+  static const int kIterations = 2000;
+
+  void RunCheck(bool extreme) {
+    // The gradients of the coarsest level reach 5 * 256 times the largest
+    // sample value.
+    const uint32_t max_grad = 5 * 256 * ((1u << params_.bit_depth) - 1);
+    for (int iter = 0; iter < kIterations && !HasFatalFailure(); ++iter) {
+      const int w = 1 + rng_(kMaxWidth);
+      const int stride = w + 8;
+      const int j = 4 + rng_(16);
+      // Like fs_calc_structure(), 4 zero columns on each side of a row.
+      for (int r = 0; r < 8; ++r) {
+        for (int c = 0; c < stride; ++c) {
+          const bool inside = c >= 4 && c < w + 3;
+          gx_[r * stride + c] = inside ? Gradient(extreme, max_grad) : 0;
+          gy_[r * stride + c] = inside ? Gradient(extreme, max_grad) : 0;
+        }
+      }
+      const double c2 = 1.0 + rng_(1 << 20) * 0.37;
+      params_.ref_func(gx_, gy_, stride, j, w, c2, ref_);
+      API_REGISTER_STATE_CHECK(
+          params_.tst_func(gx_, gy_, stride, j, w, c2, tst_));
+      for (int i = 0; i < w; ++i) {
+        ASSERT_EQ(ref_[i], tst_[i])
+            << "column " << i << " width " << w << " at iteration " << iter;
+      }
+    }
+  }
+
+  void RunSpeedTest() {
+    const uint32_t max_grad = 5 * ((1u << params_.bit_depth) - 1);
+    for (int i = 0; i < 8 * kRowStride; ++i) {
+      gx_[i] = Gradient(false, max_grad);
+      gy_[i] = Gradient(false, max_grad);
+    }
+    const FastSsimRowFunc funcs[2] = { params_.ref_func, params_.tst_func };
+    double elapsed[2];
+    for (int f = 0; f < 2; ++f) {
+      aom_usec_timer timer;
+      aom_usec_timer_start(&timer);
+      for (int n = 0; n < 100000; ++n) {
+        funcs[f](gx_, gy_, kRowStride, 4 + (n & 7), kMaxWidth, 1000.0, tst_);
+      }
+      aom_usec_timer_mark(&timer);
+      elapsed[f] = static_cast<double>(aom_usec_timer_elapsed(&timer));
+    }
+    printf("fastssim_structure_row (bd %d): ref %.0f us, test %.0f us, %.2fx\n",
+           params_.bit_depth, elapsed[0], elapsed[1], elapsed[0] / elapsed[1]);
+  }
+
+ private:
+  uint32_t Gradient(bool extreme, uint32_t max_grad) {
+    const uint32_t r = rng_.Rand31();
+    return extreme ? max_grad - (r & 1) : r % (max_grad + 1);
+  }
+
+  uint32_t gx_[8 * kRowStride];
+  uint32_t gy_[8 * kRowStride];
+  double ref_[kMaxWidth];
+  double tst_[kMaxWidth];
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FastSsimRowTest);
+
+TEST_P(FastSsimRowTest, RandomValues) { RunCheck(false); }
+TEST_P(FastSsimRowTest, ExtremeValues) { RunCheck(true); }
+TEST_P(FastSsimRowTest, DISABLED_Speed) { RunSpeedTest(); }
+
+using FastSsimRowParam = libaom_test::FuncParam<FastSsimRowFunc>;
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, FastSsimRowTest,
+    ::testing::Values(FastSsimRowParam(aom_fastssim_structure_row_c,
+                                       aom_fastssim_structure_row_avx2, 8),
+                      FastSsimRowParam(aom_fastssim_structure_row_c,
+                                       aom_fastssim_structure_row_avx2, 12)));
+#endif  // HAVE_AVX2
+#endif  // CONFIG_INTERNAL_STATS
+
+}  // namespace
@@ -68,6 +68,8 @@ list(APPEND AOM_UNIT_TEST_ENCODER_SOURCES
             "${AOM_ROOT}/test/cpu_used_firstpass_test.cc"
             "${AOM_ROOT}/test/datarate_test.cc"
             "${AOM_ROOT}/test/datarate_test.h"
+            "${AOM_ROOT}/test/decode_output_format_test.cc"
+            "${AOM_ROOT}/test/decode_stats_test.cc"
             "${AOM_ROOT}/test/deltaq_mode_test.cc"
             "${AOM_ROOT}/test/dropframe_encode_test.cc"
             "${AOM_ROOT}/test/svc_datarate_test.cc"
@@ -124,6 +126,7 @@ if(CONFIG_REALTIME_ONLY)
                    "${AOM_ROOT}/test/borders_test.cc"
                    "${AOM_ROOT}/test/cpu_speed_test.cc"
                    "${AOM_ROOT}/test/cpu_used_firstpass_test.cc"
+                   "${AOM_ROOT}/test/decode_stats_test.cc"
                    "${AOM_ROOT}/test/deltaq_mode_test.cc"
                    "${AOM_ROOT}/test/dropframe_encode_test.cc"
                    "${AOM_ROOT}/test/end_to_end_psnr_test.cc"
@@ -231,6 +234,7 @@ if(NOT BUILD_SHARED_LIBS)
               "${AOM_ROOT}/test/subtract_test.cc"
               "${AOM_ROOT}/test/sum_squares_test.cc"
               "${AOM_ROOT}/test/sse_sum_test.cc"
+              "${AOM_ROOT}/test/ssim_test.cc"
               "${AOM_ROOT}/test/variance_test.cc"
               "${AOM_ROOT}/test/warp_filter_test.cc"
               "${AOM_ROOT}/test/warp_filter_test_util.cc"
@@ -239,6 +243,8 @@ if(NOT BUILD_SHARED_LIBS)
               "${AOM_ROOT}/test/wiener_test.cc")
 
   if(NOT CONFIG_REALTIME_ONLY)
+    list(APPEND AOM_UNIT_TEST_ENCODER_SOURCES
+                "${AOM_ROOT}/test/corner_detect_test.cc")
     list(APPEND AOM_UNIT_TEST_ENCODER_INTRIN_SSE4_1
                 "${AOM_ROOT}/test/corner_match_test.cc")
   endif()
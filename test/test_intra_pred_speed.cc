@@ -1352,6 +1352,61 @@ HIGHBD_INTRA_PRED_TEST(SSE2, TX_4X8, aom_highbd_dc_predictor_4x8_sse2,
                        nullptr, nullptr)
 #endif
 
+#if HAVE_SSE4_1
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_4X4, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_4x4_sse4_1,
+                       aom_highbd_smooth_predictor_4x4_sse4_1,
+                       aom_highbd_smooth_v_predictor_4x4_sse4_1,
+                       aom_highbd_smooth_h_predictor_4x4_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_4X8, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_4x8_sse4_1,
+                       aom_highbd_smooth_predictor_4x8_sse4_1,
+                       aom_highbd_smooth_v_predictor_4x8_sse4_1,
+                       aom_highbd_smooth_h_predictor_4x8_sse4_1)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_4X16, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_4x16_sse4_1,
+                       aom_highbd_smooth_predictor_4x16_sse4_1,
+                       aom_highbd_smooth_v_predictor_4x16_sse4_1,
+                       aom_highbd_smooth_h_predictor_4x16_sse4_1)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_SSE4_1
+
+#if HAVE_AVX2
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_4X4, aom_highbd_dc_predictor_4x4_avx2,
+                       aom_highbd_dc_left_predictor_4x4_avx2,
+                       aom_highbd_dc_top_predictor_4x4_avx2,
+                       aom_highbd_dc_128_predictor_4x4_avx2,
+                       aom_highbd_v_predictor_4x4_avx2,
+                       aom_highbd_h_predictor_4x4_avx2,
+                       aom_highbd_paeth_predictor_4x4_avx2,
+                       aom_highbd_smooth_predictor_4x4_avx2,
+                       aom_highbd_smooth_v_predictor_4x4_avx2,
+                       aom_highbd_smooth_h_predictor_4x4_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_4X8, aom_highbd_dc_predictor_4x8_avx2,
+                       aom_highbd_dc_left_predictor_4x8_avx2,
+                       aom_highbd_dc_top_predictor_4x8_avx2,
+                       aom_highbd_dc_128_predictor_4x8_avx2,
+                       aom_highbd_v_predictor_4x8_avx2,
+                       aom_highbd_h_predictor_4x8_avx2,
+                       aom_highbd_paeth_predictor_4x8_avx2,
+                       aom_highbd_smooth_predictor_4x8_avx2,
+                       aom_highbd_smooth_v_predictor_4x8_avx2,
+                       aom_highbd_smooth_h_predictor_4x8_avx2)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_4X16, aom_highbd_dc_predictor_4x16_avx2,
+                       aom_highbd_dc_left_predictor_4x16_avx2,
+                       aom_highbd_dc_top_predictor_4x16_avx2,
+                       aom_highbd_dc_128_predictor_4x16_avx2,
+                       aom_highbd_v_predictor_4x16_avx2,
+                       aom_highbd_h_predictor_4x16_avx2,
+                       aom_highbd_paeth_predictor_4x16_avx2,
+                       aom_highbd_smooth_predictor_4x16_avx2,
+                       aom_highbd_smooth_v_predictor_4x16_avx2,
+                       aom_highbd_smooth_h_predictor_4x16_avx2)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 HIGHBD_INTRA_PRED_TEST(NEON, TX_4X4, aom_highbd_dc_predictor_4x4_neon,
                        aom_highbd_dc_left_predictor_4x4_neon,
@@ -1450,6 +1505,76 @@ HIGHBD_INTRA_PRED_TEST(SSSE3, TX_8X8, nullptr, nullptr, nullptr, nullptr,
                        nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
 #endif
 
+#if HAVE_SSE4_1
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_8X8, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_8x8_sse4_1,
+                       aom_highbd_smooth_predictor_8x8_sse4_1,
+                       aom_highbd_smooth_v_predictor_8x8_sse4_1,
+                       aom_highbd_smooth_h_predictor_8x8_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_8X4, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_8x4_sse4_1,
+                       aom_highbd_smooth_predictor_8x4_sse4_1,
+                       aom_highbd_smooth_v_predictor_8x4_sse4_1,
+                       aom_highbd_smooth_h_predictor_8x4_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_8X16, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_8x16_sse4_1,
+                       aom_highbd_smooth_predictor_8x16_sse4_1,
+                       aom_highbd_smooth_v_predictor_8x16_sse4_1,
+                       aom_highbd_smooth_h_predictor_8x16_sse4_1)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_8X32, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_8x32_sse4_1,
+                       aom_highbd_smooth_predictor_8x32_sse4_1,
+                       aom_highbd_smooth_v_predictor_8x32_sse4_1,
+                       aom_highbd_smooth_h_predictor_8x32_sse4_1)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_SSE4_1
+
+#if HAVE_AVX2
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_8X8, aom_highbd_dc_predictor_8x8_avx2,
+                       aom_highbd_dc_left_predictor_8x8_avx2,
+                       aom_highbd_dc_top_predictor_8x8_avx2,
+                       aom_highbd_dc_128_predictor_8x8_avx2,
+                       aom_highbd_v_predictor_8x8_avx2,
+                       aom_highbd_h_predictor_8x8_avx2,
+                       aom_highbd_paeth_predictor_8x8_avx2,
+                       aom_highbd_smooth_predictor_8x8_avx2,
+                       aom_highbd_smooth_v_predictor_8x8_avx2,
+                       aom_highbd_smooth_h_predictor_8x8_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_8X4, aom_highbd_dc_predictor_8x4_avx2,
+                       aom_highbd_dc_left_predictor_8x4_avx2,
+                       aom_highbd_dc_top_predictor_8x4_avx2,
+                       aom_highbd_dc_128_predictor_8x4_avx2,
+                       aom_highbd_v_predictor_8x4_avx2,
+                       aom_highbd_h_predictor_8x4_avx2,
+                       aom_highbd_paeth_predictor_8x4_avx2,
+                       aom_highbd_smooth_predictor_8x4_avx2,
+                       aom_highbd_smooth_v_predictor_8x4_avx2,
+                       aom_highbd_smooth_h_predictor_8x4_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_8X16, aom_highbd_dc_predictor_8x16_avx2,
+                       aom_highbd_dc_left_predictor_8x16_avx2,
+                       aom_highbd_dc_top_predictor_8x16_avx2,
+                       aom_highbd_dc_128_predictor_8x16_avx2,
+                       aom_highbd_v_predictor_8x16_avx2,
+                       aom_highbd_h_predictor_8x16_avx2,
+                       aom_highbd_paeth_predictor_8x16_avx2,
+                       aom_highbd_smooth_predictor_8x16_avx2,
+                       aom_highbd_smooth_v_predictor_8x16_avx2,
+                       aom_highbd_smooth_h_predictor_8x16_avx2)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_8X32, aom_highbd_dc_predictor_8x32_avx2,
+                       aom_highbd_dc_left_predictor_8x32_avx2,
+                       aom_highbd_dc_top_predictor_8x32_avx2,
+                       aom_highbd_dc_128_predictor_8x32_avx2,
+                       aom_highbd_v_predictor_8x32_avx2,
+                       aom_highbd_h_predictor_8x32_avx2,
+                       aom_highbd_paeth_predictor_8x32_avx2,
+                       aom_highbd_smooth_predictor_8x32_avx2,
+                       aom_highbd_smooth_v_predictor_8x32_avx2,
+                       aom_highbd_smooth_h_predictor_8x32_avx2)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 HIGHBD_INTRA_PRED_TEST(NEON, TX_8X8, aom_highbd_dc_predictor_8x8_neon,
                        aom_highbd_dc_left_predictor_8x8_neon,
@@ -1565,16 +1690,93 @@ HIGHBD_INTRA_PRED_TEST(SSSE3, TX_16X16, nullptr, nullptr, nullptr, nullptr,
                        nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
 #endif
 
-#if HAVE_AVX2
-HIGHBD_INTRA_PRED_TEST(AVX2, TX_16X16, nullptr, nullptr, nullptr, nullptr,
-                       nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
-
-HIGHBD_INTRA_PRED_TEST(AVX2, TX_16X8, nullptr, nullptr, nullptr, nullptr,
-                       nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
+#if HAVE_SSE4_1
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_16X16, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_16x16_sse4_1,
+                       aom_highbd_smooth_predictor_16x16_sse4_1,
+                       aom_highbd_smooth_v_predictor_16x16_sse4_1,
+                       aom_highbd_smooth_h_predictor_16x16_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_16X8, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_16x8_sse4_1,
+                       aom_highbd_smooth_predictor_16x8_sse4_1,
+                       aom_highbd_smooth_v_predictor_16x8_sse4_1,
+                       aom_highbd_smooth_h_predictor_16x8_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_16X32, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_16x32_sse4_1,
+                       aom_highbd_smooth_predictor_16x32_sse4_1,
+                       aom_highbd_smooth_v_predictor_16x32_sse4_1,
+                       aom_highbd_smooth_h_predictor_16x32_sse4_1)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_16X4, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_16x4_sse4_1,
+                       aom_highbd_smooth_predictor_16x4_sse4_1,
+                       aom_highbd_smooth_v_predictor_16x4_sse4_1,
+                       aom_highbd_smooth_h_predictor_16x4_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_16X64, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_16x64_sse4_1,
+                       aom_highbd_smooth_predictor_16x64_sse4_1,
+                       aom_highbd_smooth_v_predictor_16x64_sse4_1,
+                       aom_highbd_smooth_h_predictor_16x64_sse4_1)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_SSE4_1
 
-HIGHBD_INTRA_PRED_TEST(AVX2, TX_16X32, nullptr, nullptr, nullptr, nullptr,
-                       nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
-#endif
+#if HAVE_AVX2
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_16X16, aom_highbd_dc_predictor_16x16_avx2,
+                       aom_highbd_dc_left_predictor_16x16_avx2,
+                       aom_highbd_dc_top_predictor_16x16_avx2,
+                       aom_highbd_dc_128_predictor_16x16_avx2,
+                       aom_highbd_v_predictor_16x16_avx2,
+                       aom_highbd_h_predictor_16x16_avx2,
+                       aom_highbd_paeth_predictor_16x16_avx2,
+                       aom_highbd_smooth_predictor_16x16_avx2,
+                       aom_highbd_smooth_v_predictor_16x16_avx2,
+                       aom_highbd_smooth_h_predictor_16x16_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_16X8, aom_highbd_dc_predictor_16x8_avx2,
+                       aom_highbd_dc_left_predictor_16x8_avx2,
+                       aom_highbd_dc_top_predictor_16x8_avx2,
+                       aom_highbd_dc_128_predictor_16x8_avx2,
+                       aom_highbd_v_predictor_16x8_avx2,
+                       aom_highbd_h_predictor_16x8_avx2,
+                       aom_highbd_paeth_predictor_16x8_avx2,
+                       aom_highbd_smooth_predictor_16x8_avx2,
+                       aom_highbd_smooth_v_predictor_16x8_avx2,
+                       aom_highbd_smooth_h_predictor_16x8_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_16X32, aom_highbd_dc_predictor_16x32_avx2,
+                       aom_highbd_dc_left_predictor_16x32_avx2,
+                       aom_highbd_dc_top_predictor_16x32_avx2,
+                       aom_highbd_dc_128_predictor_16x32_avx2,
+                       aom_highbd_v_predictor_16x32_avx2,
+                       aom_highbd_h_predictor_16x32_avx2,
+                       aom_highbd_paeth_predictor_16x32_avx2,
+                       aom_highbd_smooth_predictor_16x32_avx2,
+                       aom_highbd_smooth_v_predictor_16x32_avx2,
+                       aom_highbd_smooth_h_predictor_16x32_avx2)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_16X4, aom_highbd_dc_predictor_16x4_avx2,
+                       aom_highbd_dc_left_predictor_16x4_avx2,
+                       aom_highbd_dc_top_predictor_16x4_avx2,
+                       aom_highbd_dc_128_predictor_16x4_avx2,
+                       aom_highbd_v_predictor_16x4_avx2,
+                       aom_highbd_h_predictor_16x4_avx2,
+                       aom_highbd_paeth_predictor_16x4_avx2,
+                       aom_highbd_smooth_predictor_16x4_avx2,
+                       aom_highbd_smooth_v_predictor_16x4_avx2,
+                       aom_highbd_smooth_h_predictor_16x4_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_16X64, aom_highbd_dc_predictor_16x64_avx2,
+                       aom_highbd_dc_left_predictor_16x64_avx2,
+                       aom_highbd_dc_top_predictor_16x64_avx2,
+                       aom_highbd_dc_128_predictor_16x64_avx2,
+                       aom_highbd_v_predictor_16x64_avx2,
+                       aom_highbd_h_predictor_16x64_avx2,
+                       aom_highbd_paeth_predictor_16x64_avx2,
+                       aom_highbd_smooth_predictor_16x64_avx2,
+                       aom_highbd_smooth_v_predictor_16x64_avx2,
+                       aom_highbd_smooth_h_predictor_16x64_avx2)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_AVX2
 
 #if HAVE_NEON
 HIGHBD_INTRA_PRED_TEST(NEON, TX_16X16, aom_highbd_dc_predictor_16x16_neon,
@@ -1687,13 +1889,78 @@ HIGHBD_INTRA_PRED_TEST(SSSE3, TX_32X32, nullptr, nullptr, nullptr, nullptr,
                        nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
 #endif
 
-#if HAVE_AVX2
-HIGHBD_INTRA_PRED_TEST(AVX2, TX_32X32, nullptr, nullptr, nullptr, nullptr,
-                       nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
+#if HAVE_SSE4_1
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_32X32, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_32x32_sse4_1,
+                       aom_highbd_smooth_predictor_32x32_sse4_1,
+                       aom_highbd_smooth_v_predictor_32x32_sse4_1,
+                       aom_highbd_smooth_h_predictor_32x32_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_32X16, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_32x16_sse4_1,
+                       aom_highbd_smooth_predictor_32x16_sse4_1,
+                       aom_highbd_smooth_v_predictor_32x16_sse4_1,
+                       aom_highbd_smooth_h_predictor_32x16_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_32X64, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_32x64_sse4_1,
+                       aom_highbd_smooth_predictor_32x64_sse4_1,
+                       aom_highbd_smooth_v_predictor_32x64_sse4_1,
+                       aom_highbd_smooth_h_predictor_32x64_sse4_1)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_32X8, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, aom_highbd_paeth_predictor_32x8_sse4_1,
+                       aom_highbd_smooth_predictor_32x8_sse4_1,
+                       aom_highbd_smooth_v_predictor_32x8_sse4_1,
+                       aom_highbd_smooth_h_predictor_32x8_sse4_1)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_SSE4_1
 
-HIGHBD_INTRA_PRED_TEST(AVX2, TX_32X16, nullptr, nullptr, nullptr, nullptr,
-                       nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
-#endif
+#if HAVE_AVX2
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_32X32, aom_highbd_dc_predictor_32x32_avx2,
+                       aom_highbd_dc_left_predictor_32x32_avx2,
+                       aom_highbd_dc_top_predictor_32x32_avx2,
+                       aom_highbd_dc_128_predictor_32x32_avx2,
+                       aom_highbd_v_predictor_32x32_avx2,
+                       aom_highbd_h_predictor_32x32_avx2,
+                       aom_highbd_paeth_predictor_32x32_avx2,
+                       aom_highbd_smooth_predictor_32x32_avx2,
+                       aom_highbd_smooth_v_predictor_32x32_avx2,
+                       aom_highbd_smooth_h_predictor_32x32_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_32X16, aom_highbd_dc_predictor_32x16_avx2,
+                       aom_highbd_dc_left_predictor_32x16_avx2,
+                       aom_highbd_dc_top_predictor_32x16_avx2,
+                       aom_highbd_dc_128_predictor_32x16_avx2,
+                       aom_highbd_v_predictor_32x16_avx2,
+                       aom_highbd_h_predictor_32x16_avx2,
+                       aom_highbd_paeth_predictor_32x16_avx2,
+                       aom_highbd_smooth_predictor_32x16_avx2,
+                       aom_highbd_smooth_v_predictor_32x16_avx2,
+                       aom_highbd_smooth_h_predictor_32x16_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_32X64, aom_highbd_dc_predictor_32x64_avx2,
+                       aom_highbd_dc_left_predictor_32x64_avx2,
+                       aom_highbd_dc_top_predictor_32x64_avx2,
+                       aom_highbd_dc_128_predictor_32x64_avx2,
+                       aom_highbd_v_predictor_32x64_avx2,
+                       aom_highbd_h_predictor_32x64_avx2,
+                       aom_highbd_paeth_predictor_32x64_avx2,
+                       aom_highbd_smooth_predictor_32x64_avx2,
+                       aom_highbd_smooth_v_predictor_32x64_avx2,
+                       aom_highbd_smooth_h_predictor_32x64_avx2)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_32X8, aom_highbd_dc_predictor_32x8_avx2,
+                       aom_highbd_dc_left_predictor_32x8_avx2,
+                       aom_highbd_dc_top_predictor_32x8_avx2,
+                       aom_highbd_dc_128_predictor_32x8_avx2,
+                       aom_highbd_v_predictor_32x8_avx2,
+                       aom_highbd_h_predictor_32x8_avx2,
+                       aom_highbd_paeth_predictor_32x8_avx2,
+                       aom_highbd_smooth_predictor_32x8_avx2,
+                       aom_highbd_smooth_v_predictor_32x8_avx2,
+                       aom_highbd_smooth_h_predictor_32x8_avx2)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_AVX2
 
 #if HAVE_NEON
 HIGHBD_INTRA_PRED_TEST(NEON, TX_32X32, aom_highbd_dc_predictor_32x32_neon,
@@ -1767,6 +2034,64 @@ HIGHBD_INTRA_PRED_TEST(
     aom_highbd_smooth_h_predictor_64x16_c)
 #endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
 
+#if HAVE_SSE4_1
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_64X64, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_64x64_sse4_1,
+                       aom_highbd_smooth_predictor_64x64_sse4_1,
+                       aom_highbd_smooth_v_predictor_64x64_sse4_1,
+                       aom_highbd_smooth_h_predictor_64x64_sse4_1)
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_64X32, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_64x32_sse4_1,
+                       aom_highbd_smooth_predictor_64x32_sse4_1,
+                       aom_highbd_smooth_v_predictor_64x32_sse4_1,
+                       aom_highbd_smooth_h_predictor_64x32_sse4_1)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(SSE4_1, TX_64X16, nullptr, nullptr, nullptr, nullptr,
+                       nullptr, nullptr,
+                       aom_highbd_paeth_predictor_64x16_sse4_1,
+                       aom_highbd_smooth_predictor_64x16_sse4_1,
+                       aom_highbd_smooth_v_predictor_64x16_sse4_1,
+                       aom_highbd_smooth_h_predictor_64x16_sse4_1)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_SSE4_1
+
+#if HAVE_AVX2
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_64X64, aom_highbd_dc_predictor_64x64_avx2,
+                       aom_highbd_dc_left_predictor_64x64_avx2,
+                       aom_highbd_dc_top_predictor_64x64_avx2,
+                       aom_highbd_dc_128_predictor_64x64_avx2,
+                       aom_highbd_v_predictor_64x64_avx2,
+                       aom_highbd_h_predictor_64x64_avx2,
+                       aom_highbd_paeth_predictor_64x64_avx2,
+                       aom_highbd_smooth_predictor_64x64_avx2,
+                       aom_highbd_smooth_v_predictor_64x64_avx2,
+                       aom_highbd_smooth_h_predictor_64x64_avx2)
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_64X32, aom_highbd_dc_predictor_64x32_avx2,
+                       aom_highbd_dc_left_predictor_64x32_avx2,
+                       aom_highbd_dc_top_predictor_64x32_avx2,
+                       aom_highbd_dc_128_predictor_64x32_avx2,
+                       aom_highbd_v_predictor_64x32_avx2,
+                       aom_highbd_h_predictor_64x32_avx2,
+                       aom_highbd_paeth_predictor_64x32_avx2,
+                       aom_highbd_smooth_predictor_64x32_avx2,
+                       aom_highbd_smooth_v_predictor_64x32_avx2,
+                       aom_highbd_smooth_h_predictor_64x32_avx2)
+#if !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+HIGHBD_INTRA_PRED_TEST(AVX2, TX_64X16, aom_highbd_dc_predictor_64x16_avx2,
+                       aom_highbd_dc_left_predictor_64x16_avx2,
+                       aom_highbd_dc_top_predictor_64x16_avx2,
+                       aom_highbd_dc_128_predictor_64x16_avx2,
+                       aom_highbd_v_predictor_64x16_avx2,
+                       aom_highbd_h_predictor_64x16_avx2,
+                       aom_highbd_paeth_predictor_64x16_avx2,
+                       aom_highbd_smooth_predictor_64x16_avx2,
+                       aom_highbd_smooth_v_predictor_64x16_avx2,
+                       aom_highbd_smooth_h_predictor_64x16_avx2)
+#endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 HIGHBD_INTRA_PRED_TEST(NEON, TX_64X64, aom_highbd_dc_predictor_64x64_neon,
                        aom_highbd_dc_left_predictor_64x64_neon,
@@ -15,6 +15,8 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include "aom/aomdx.h"
+#include "aom_ports/aom_timer.h"
 #include "common/tools_common.h"
 #include "config/aom_config.h"
 #include "gtest/gtest.h"
@@ -168,6 +170,44 @@ INSTANTIATE_TEST_SUITE_P(
                                     libaom_test::kNumAV1TestVectors),
             ::testing::Range(0, 2))));
 
+#if CONFIG_WEBM_IO
+// Decodes the frame size switching test vectors with and without
+// AV1D_SET_PREALLOC_FRAME_BUFFERS. Each clip is decoded several times to
+// reduce the noise of the timings.
+TEST(TestVectorSpeedTest, DISABLED_PreallocFrameBuffersSpeed) {
+  const char *const kFiles[] = { "av1-1-b8-03-sizeup.mkv",
+                                 "av1-1-b8-03-sizedown.mkv" };
+  const int kRuns = 10;
+  for (const char *filename : kFiles) {
+    for (int prealloc = 0; prealloc < 2; ++prealloc) {
+      int64_t elapsed_us = 0;
+      for (int run = 0; run < kRuns; ++run) {
+        libaom_test::WebMVideoSource video(filename);
+        ASSERT_NO_FATAL_FAILURE(video.Init());
+        aom_codec_dec_cfg_t cfg = aom_codec_dec_cfg_t();
+        cfg.allow_lowbitdepth = !FORCE_HIGHBITDEPTH_DECODING;
+        libaom_test::AV1Decoder decoder(cfg, 0);
+        decoder.Control(AV1D_SET_PREALLOC_FRAME_BUFFERS, prealloc);
+        aom_usec_timer timer;
+        aom_usec_timer_start(&timer);
+        for (video.Begin(); video.cxdata() != nullptr; video.Next()) {
+          ASSERT_EQ(decoder.DecodeFrame(video.cxdata(), video.frame_size()),
+                    AOM_CODEC_OK)
+              << decoder.DecodeError();
+          libaom_test::DxDataIterator dec_iter = decoder.GetDxData();
+          while (dec_iter.Next() != nullptr) {
+          }
+        }
+        aom_usec_timer_mark(&timer);
+        elapsed_us += aom_usec_timer_elapsed(&timer);
+      }
+      printf("%s prealloc=%d: %6.2f ms\n", filename, prealloc,
+             elapsed_us / 1000.0 / kRuns);
+    }
+  }
+}
+#endif  // CONFIG_WEBM_IO
+
 #endif  // CONFIG_AV1_DECODER
 
 }  // namespace